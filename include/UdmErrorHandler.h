@@ -21,6 +21,7 @@
 #include "UdmBase.h"
 #include "udm_errorno.h"
 #include <stdarg.h>
+#include <pthread.h>
 
 #define     UDM_DEFAULT_DEBUG_LEVEL            0x0002
 #define     UDM_DEBUG_LEVEL_ERROR_MASK         0x00FF
@@ -57,6 +58,19 @@ typedef enum {
 class UdmErrorHandler
 {
 private:
+    /**
+     * 退避メッセージ
+     */
+    struct UdmQueuedMessage
+    {
+        UdmErrorLevel_t level;            ///< エラーレベル
+        UdmError_t error_no;            ///< エラー番号
+        std::string filename;            ///< エラーファイル名
+        int lineno;                        ///< エラーライン番号
+        std::string funcname;            ///< エラー関数
+        std::string message;            ///< エラー追加情報
+    };
+
     static UdmErrorHandler* m_instance;            ///< エラーハンドラインスタンス
     UdmError_t error_no;                ///< エラー番号
     std::string message;        ///< エラーメッセージ
@@ -84,6 +98,15 @@ private:
      */
     unsigned int output_target;
 
+    /**
+     * メッセージ退避スレッド.
+     * 非同期出力スレッドのメッセージはMPI関数を呼び出さないように退避し、呼出スレッドにて出力する.
+     */
+    pthread_t queue_thread;
+    bool queue_enabled;                    ///< メッセージ退避スレッド設定フラグ
+    pthread_mutex_t queue_mutex;        ///< 退避メッセージの排他制御
+    std::vector<UdmQueuedMessage> queued_messages;        ///< 退避メッセージ
+
 private:
     UdmErrorHandler();
     virtual ~UdmErrorHandler();
@@ -96,6 +119,7 @@ private:
     void printMessage(UdmErrorLevel_t level, UdmError_t error_no, const char* filename, int lineno, const char* funcname, const char* message);
     bool isOutputTargetStdout() const;
     bool isOutputTargetFile() const;
+    bool queueMessage(UdmErrorLevel_t level, UdmError_t error_no, const char* filename, int lineno, const char* funcname, const char* message);
 
 public:
     static UdmErrorHandler* getInstance();
@@ -118,6 +142,9 @@ public:
     void setOutputTarget(unsigned int outputTarget);
     void writeFile(const char *msg);
     bool isDebugLevelPrintDebug() const;
+    void beginQueueMessages();
+    void endQueueMessages();
+    void flushQueuedMessages();
 };
 
 } /* namespace udm */
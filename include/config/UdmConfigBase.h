@@ -173,6 +173,7 @@ inline UdmError_t UdmConfigBase::toString(UdmFileCompositionType_t value, std::s
     case (Udm_EachStep): buf = "EachStep"; return UDM_OK;
     case (Udm_GridConstant): buf = "GridConstant"; return UDM_OK;
     case (Udm_GridTimeSlice): buf = "GridTimeSlice"; return UDM_OK;
+    case (Udm_AggregateFile): buf = "AggregateFile"; return UDM_OK;
     default : break;
     }
 
@@ -86,9 +86,14 @@ public:
     UdmError_t getCgnsTimeSliceFilePath(std::string &file_path, int rank_no, int timeslice_step, bool mpiexec = true);
     UdmError_t getCgnsGridFilePath(std::string &file_path, int rank_no, int timeslice_step);
     UdmError_t getCgnsSolutionFilePath(std::string &file_path, int rank_no, int timeslice_step);
+    UdmError_t getCgnsTimeSliceInputFilePath(std::string &input_path, int rank_no, int timeslice_step);
+    int getCgnsFileRankno(int rank_no) const;
+    UdmError_t getCgnsProcessDirectory(std::string &dir_name, int rank_no) const;
+    UdmError_t connectProcessDirectory(std::string &file_name, int rank_no, bool input = true) const;
     UdmError_t setDomainConfig(int dimmention, UdmSize_t vertex_size, UdmSize_t cell_size);
     UdmError_t setMpiConfig(int num_process, int num_group);
     UdmError_t setProcessConfig(int num_process, const UdmSize_t *vertex_sizes, const UdmSize_t *cell_sizes);
+    UdmError_t setProcessFileRanks(int num_process, const int *file_rankids);
     const std::string &getOutputPath() const;
     void setOutputPath(const std::string path);
     UdmError_t getDfiOutputDirectory(std::string &path) const;
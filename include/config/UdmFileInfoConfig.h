@@ -30,6 +30,7 @@ private:
     UdmDfiType_t     dfi_type;                ///< DFI種別
     std::string      directory_path;            ///< フィールドデータディレクトリ
     bool            timeslice_directory;    ///< 時刻ディレクトリ作成オプション
+    int                process_directory;        ///< プロセスディレクトリ作成オプション : ディレクトリ当りのランク数, 0=作成しない
     std::string      prefix;                    ///< ベースファイル名
     std::string      fileformat;                ///< ファイルフォーマット
     UdmFieldFilenameFormat_t     fieldfilename_format;        ///< ファイル命名書式
@@ -64,6 +65,8 @@ public:
     void setPrefix(const std::string& prefix);
     bool isTimeSliceDirectory() const;
     void setTimeSliceDirectory(bool timesliceDirectory);
+    int getProcessDirectory() const;
+    void setProcessDirectory(int num_ranks);
     UdmError_t getDfiValue(const std::string &label_path, std::string &value) const;
     UdmError_t setDfiValue(const std::string &label_path, const std::string &value);
     int getNumDfiValue(const std::string &label_path) const;
@@ -75,6 +78,7 @@ public:
     bool isFileFlowSolution() const;
     bool isFileTimeSlice() const;
     bool isFileIncludeGrid() const;
+    bool isFileAggregate() const;
     UdmError_t generateCgnsTimeSliceName(std::string &file_name, int rank_no, int timeslice_step) const;
     UdmError_t generateCgnsFileName(std::string &file_name, int rank_no) const;
     UdmError_t generateCgnsLinkName(std::string &file_name, int rank_no) const;
@@ -82,6 +86,8 @@ public:
     UdmError_t generateCgnsTimeSliceSolutionName(std::string &file_name, int rank_no, int timeslice_step) const;
     UdmError_t generateCgnsGridName(std::string &file_name, int rank_no) const;
     UdmError_t generateCgnsSolutionName(std::string &file_name, int rank_no) const;
+    UdmError_t generateCgnsRankBaseName(std::string &base_name, int rank_no) const;
+    UdmError_t generateProcessDirectoryName(std::string &dir_name, int rank_no) const;
 
 protected:
 
@@ -31,6 +31,12 @@ class UdmFlowSolutionListConfig: public UdmConfigBase {
 private:
     std::map<std::string, UdmSolutionFieldConfig*, map_case_compare> solution_list;
 
+    /**
+     * 物理量情報リストの更新番号.
+     * 物理量情報の追加、削除、置換毎に更新する.
+     */
+    UdmSize_t solution_revision;
+
 public:
     UdmFlowSolutionListConfig();
     UdmFlowSolutionListConfig(TextParser *parser);
@@ -71,6 +77,7 @@ public:
     UdmError_t removeSolutionConfig(const std::string &solution_name);
     UdmError_t clear();
     UdmError_t rebuildSolutionList();
+    UdmSize_t getSolutionRevision() const;
     UdmError_t getDfiValue(const std::string &label_path, std::string &value) const;
     UdmError_t setDfiValue(const std::string &label_path, const std::string &value);
     int getNumDfiValue(const std::string &label_path) const;
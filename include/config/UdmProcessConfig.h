@@ -30,6 +30,8 @@ private:
     int        rankid;            ///< ランク番号
     UdmSize_t     vertex_size;            ///< プロセスの領域のノード数
     UdmSize_t    cell_size;                ///< プロセスの領域のセル（要素）数
+    int        file_rankid;            ///< 集約CGNSファイルのランク番号 : -1=ランク番号のCGNSファイル
+    std::string    directory;            ///< CGNSファイルのプロセスディレクトリ : 空文字列=プロセスディレクトリなし
 
 public:
     UdmRankConfig();
@@ -45,6 +47,10 @@ public:
     void setVertexSize(UdmSize_t vertexSize);
     UdmSize_t getCellSize() const;
     void setCellSize(UdmSize_t cellSize);
+    int getFileRankId() const;
+    void setFileRankId(int file_rankid);
+    const std::string& getDirectory() const;
+    void setDirectory(const std::string &directory);
     UdmError_t setRankConfig(const UdmRankConfig &src_rank_config);
     UdmError_t getDfiValue(const std::string &label_path, std::string &value) const;
     UdmError_t setDfiValue(const std::string &label_path, const std::string &value);
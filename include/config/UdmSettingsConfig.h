@@ -36,6 +36,7 @@ private:
     std::string     filename_udm_dfi;        ///< 入力udm.dfiファイル名
     int debug_level;                        ///< デバッグレベル
     UdmEnable_t     mxm_partition;            ///< MxM_PARTITION:分割数が同じ場合の分割実行
+    size_t          migration_memory_size;    ///< MIGRATION_MEMORY_SIZE:分割転送の送受信バッファ上限サイズ(byte)
     std::map<std::string, std::string, map_case_compare>    zoltan_parameters;        ///< Zontalパラメータ
 
 public:
@@ -49,6 +50,8 @@ public:
     UdmError_t setDebugLevel(int debuf_level);
     bool isMxMPartition() const;
     UdmError_t setMxMPartition(bool mxm_partition);
+    size_t getMigrationMemorySize() const;
+    UdmError_t setMigrationMemorySize(size_t memory_size);
     int getNumZoltanParameters() const;
     UdmError_t getZoltanParameterById(int param_id, std::string &name, std::string &value) const;
     UdmError_t getZoltanParameter(const std::string &name, std::string &value) const;
@@ -0,0 +1,152 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMBOUNDARYREDUCTION_H_
+#define _UDMBOUNDARYREDUCTION_H_
+
+/**
+ * @file UdmBoundaryReduction.h
+ * 内部境界節点（ノード）物理量集約クラスのヘッダーファイル
+ */
+
+#include "model/UdmGeneral.h"
+
+namespace udm
+{
+class UdmZone;
+class UdmNode;
+class UdmSolutionFieldConfig;
+class UdmEntityVoxels;
+
+/**
+ * 内部境界節点（ノード）物理量集約クラス.
+ * 複数ランクで共有される内部境界節点（ノード）の物理量を接続ランク間で集約する.
+ * 集約演算は総和(Udm_ReduceSum), 最小値(Udm_ReduceMin), 最大値(Udm_ReduceMax),
+ * 実体ランク（共有ランクの最小ランク番号）の値(Udm_ReduceOwner)とする.
+ * 集約計画は内部境界情報（UdmRankConnectivity）から１度作成し、接続ランクとのみ送受信を行う.
+ * 接続ランク別の節点（ノード）の並びは双方のランクで同一となる様に、
+ * 小さいランク番号側の節点（ノード）ID順とするので、集約計画の作成時に送受信は不要である.
+ * 集約計画は節点（ノード）を参照する為、ゾーンの再構築、分割時に破棄される.
+ */
+class UdmBoundaryReduction: public UdmGeneral
+{
+private:
+    /**
+     * 親ゾーン
+     */
+    UdmZone *parent_zone;
+
+    /**
+     * 集約計画作成済みフラグ
+     */
+    bool created_plan;
+
+    /**
+     * 集約対象の内部境界節点（ノード）
+     */
+    std::vector<UdmNode*> boundary_nodes;
+
+    /**
+     * 内部境界節点（ノード）の実体ランク番号 : 共有ランクの最小ランク番号
+     */
+    std::vector<int> owner_ranks;
+
+    /**
+     * 接続ランク番号 : 昇順
+     */
+    std::vector<int> neighbor_ranks;
+
+    /**
+     * 接続ランク別の節点（ノード）インデックス位置 : 接続ランク数+1.
+     * 送信, 受信の節点（ノード）の並びは同一である.
+     */
+    std::vector<size_t> neighbor_offsets;
+
+    /**
+     * 接続ランク別の節点（ノード）インデックス : boundary_nodesのインデックス
+     */
+    std::vector<size_t> neighbor_indices;
+
+    char *send_buffer;            ///< 送信バッファ
+    size_t send_capacity;        ///< 送信バッファ確保サイズ(byte)
+    char *recv_buffer;            ///< 受信バッファ
+    size_t recv_capacity;        ///< 受信バッファ確保サイズ(byte)
+    char *value_buffer;            ///< 内部境界節点（ノード）の物理量バッファ : 自ランクの値, 集約値の順
+    size_t value_capacity;        ///< 物理量バッファ確保サイズ(byte)
+
+    /**
+     * 集約用の複製MPIコミュニケータ.
+     * 他の送受信とメッセージが混在しないように、接続ランクとの送受信はこのコミュニケータにて行う.
+     * 初回のcreateReductionPlanにて複製し、デストラクタにて解放する.
+     */
+    MPI_Comm reduction_communicator;
+
+public:
+    UdmBoundaryReduction();
+    UdmBoundaryReduction(UdmZone *zone);
+    virtual ~UdmBoundaryReduction();
+
+    // Zone
+    UdmZone* getParentZone() const;
+    void setParentZone(UdmZone* zone);
+
+    // 集約計画
+    UdmError_t createReductionPlan();
+    void clearReductionPlan();
+    bool isCreatedPlan() const;
+    UdmSize_t getNumBoundaryNodes() const;
+    int getNumNeighborRanks() const;
+
+    // 集約
+    UdmError_t reduceSolutions(
+                    const std::vector<std::string> &field_names,
+                    UdmReduceType_t reduce_type);
+
+private:
+    void initialize();
+    UdmError_t getReductionFields(
+                    const std::vector<std::string> &field_names,
+                    std::vector<const UdmSolutionFieldConfig*> &fields,
+                    std::vector<UdmSize_t> &field_ids) const;
+    size_t getFieldBufferSize(size_t num_nodes, const UdmSolutionFieldConfig *config) const;
+    void reserveBuffer(char *&buffer, size_t &capacity, size_t size);
+    template<class VALUE_TYPE> void packSolutionValues(
+                    const UdmSolutionFieldConfig *config,
+                    const UdmEntityVoxels *voxels,
+                    UdmSize_t field_id,
+                    VALUE_TYPE *values,
+                    const std::vector<size_t> &positions);
+    template<class VALUE_TYPE> void unpackSolutionValues(
+                    const UdmSolutionFieldConfig *config,
+                    UdmEntityVoxels *voxels,
+                    UdmSize_t field_id,
+                    UdmReduceType_t reduce_type,
+                    VALUE_TYPE *values,
+                    const std::vector<size_t> &positions);
+    template<class VALUE_TYPE> void reduceSolutionValues(
+                    UdmReduceType_t reduce_type,
+                    int rankno,
+                    int nvector_size,
+                    const size_t *indices,
+                    size_t num_indices,
+                    const VALUE_TYPE *recv_values,
+                    VALUE_TYPE *results) const;
+
+    // MPI
+    MPI_Comm getMpiComm() const;
+    int getMpiRankno() const;
+    int getMpiProcessSize() const;
+};
+
+} /* namespace udm */
+
+#endif /* _UDMBOUNDARYREDUCTION_H_ */
@@ -20,6 +20,7 @@
 
 #include "model/UdmEntity.h"
 #include "model/UdmICellComponent.h"
+#include "model/UdmElementTopology.h"
 
 namespace udm
 {
@@ -36,6 +37,9 @@ class UdmComponent;
  */
 class UdmCell: public UdmEntity, public UdmICellComponent
 {
+friend class UdmElements;
+friend class UdmSections;
+friend class UdmMigrationArchive;
 private:
 
     /**
@@ -46,10 +50,27 @@ private:
     UdmSize_t elem_id;
 
     /**
-     * 構成ノード
+     * 構成ノード.
+     * セクション（要素構成）の接続情報配列を使用していない場合のみ保持する.
      */
     std::vector<UdmNode*>  nodes;
 
+    /**
+     * 構成ノードの接続情報配列を保持するセクション（要素構成）.
+     * 接続情報配列を使用していない場合はNULL
+     */
+    UdmElements *connectivity_elements;
+
+    /**
+     * 接続情報配列の構成ノード開始位置
+     */
+    UdmSize_t connectivity_offset;
+
+    /**
+     * 接続情報配列の構成ノード数
+     */
+    UdmSize_t connectivity_size;
+
     /**
      * 親セクション（要素構成）情報クラス
      */
@@ -80,7 +101,7 @@ public:
     // UdmNode
     UdmSize_t getNumNodes() const;
     UdmNode* getNode(UdmSize_t node_id) const;
-    const std::vector<UdmNode*>& getNodes() const;
+    UdmSize_t getNodes(std::vector<UdmNode*> &nodes) const;
     UdmError_t setNodes(UdmNode *node[], UdmSize_t size);
     UdmError_t setNodes(const std::vector<UdmNode*> &nodes);
     UdmError_t insertNode(UdmNode *node);
@@ -99,6 +120,7 @@ public:
 
     // 構成要素（セル）
     virtual UdmError_t createComponentCells() = 0;
+    unsigned int getComponentNodes(unsigned int component_id, UdmElementType_t &component_type, UdmSize_t component_nodes[]) const;
     UdmSize_t getNumComponentCells() const;
     UdmComponent* getComponentCell(UdmSize_t components_id) const;
     UdmError_t clearComponentCells();
@@ -116,7 +138,9 @@ public:
     size_t getMemSize() const;
 
     // Factory
-    static UdmCell* factoryCell(UdmElementType_t elem_type);
+    static UdmCell* factoryCell(UdmElementType_t elem_type, UdmEntityPool *pool = NULL);
+    template <UdmElementType_t ELEMENT_TYPE>
+    static UdmCell* factoryCell(UdmEntityPool *pool = NULL);
     UdmError_t cloneCell(const UdmCell& src);
 
     // 隣接要素（セル）
@@ -133,11 +157,14 @@ public:
 
 private:
     void initialize();
+    void attachConnectivity(UdmElements *elements);
+    void detachConnectivity();
     UdmError_t removeReferencedCells();
     UdmComponent* factoryComponentCell(UdmElementType_t elem_type);
 
 protected:
     UdmZone* getZone() const;
+    UdmEntityVoxels* getParentVoxels() const;
     UdmSize_t createComponentCell(UdmElementType_t element_type, unsigned int num_nodes, UdmSize_t face_nodes[]);
 };
 
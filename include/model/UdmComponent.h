@@ -20,6 +20,7 @@
 
 #include "UdmBase.h"
 #include "model/UdmICellComponent.h"
+#include "utils/UdmEntityPool.h"
 
 namespace udm
 {
@@ -32,6 +33,7 @@ class UdmNode;
  */
 class UdmComponent: public UdmBase, public UdmICellComponent
 {
+friend class UdmSections;
 private:
 
     /**
@@ -65,6 +67,12 @@ public:
     UdmComponent(UdmElementType_t element_type);
     virtual ~UdmComponent();
 
+    // メモリプール
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, UdmEntityPool *pool);
+    static void operator delete(void *ptr);
+    static void operator delete(void *ptr, UdmEntityPool *pool);
+
     UdmElementType_t getElementType() const;
     UdmError_t setElementType(UdmElementType_t element_type);
     UdmSize_t getNumNodes() const;
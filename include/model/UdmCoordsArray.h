@@ -0,0 +1,133 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMCOORDSARRAY_H_
+#define _UDMCOORDSARRAY_H_
+
+/**
+ * @file UdmCoordsArray.h
+ * 座標値配列クラスのヘッダーファイル
+ */
+
+#include "model/UdmGeneral.h"
+
+namespace udm
+{
+
+/**
+ * 座標値配列クラス.
+ * グリッド座標クラス(UdmGridCoordinates)が保持するX,Y,Z座標毎の連続配列.
+ * 節点（ノード）は格納位置（スロット）のみを保持し、座標値はスロットの位置に格納する.
+ * 座標値のデータ型はUdm_RealSingle, Udm_RealDoubleとする.
+ */
+class UdmCoordsArray: public UdmGeneral
+{
+private:
+    /**
+     * X座標配列 : データ型(datatype)の配列
+     */
+    void *coords_x;
+
+    /**
+     * Y座標配列 : データ型(datatype)の配列
+     */
+    void *coords_y;
+
+    /**
+     * Z座標配列 : データ型(datatype)の配列
+     */
+    void *coords_z;
+
+    /**
+     * 確保スロット数
+     */
+    UdmSize_t capacity;
+
+public:
+    UdmCoordsArray();
+    UdmCoordsArray(UdmDataType_t datatype);
+    virtual ~UdmCoordsArray();
+
+    UdmSize_t getCapacity() const;
+    UdmError_t reserveSlots(UdmSize_t size);
+    UdmError_t changeDataType(UdmDataType_t datatype);
+    UdmError_t rearrangeSlots(const std::vector<UdmSize_t> &src_slots);
+    void clearCoordsArray();
+    const void* getCoordinatesXPointer() const;
+    const void* getCoordinatesYPointer() const;
+    const void* getCoordinatesZPointer() const;
+    template<class VALUE_TYPE> void getCoords(UdmSize_t slot, VALUE_TYPE &x, VALUE_TYPE &y, VALUE_TYPE &z) const;
+    template<class VALUE_TYPE> void setCoords(UdmSize_t slot, VALUE_TYPE x, VALUE_TYPE y, VALUE_TYPE z);
+    template<class VALUE_TYPE> UdmSize_t getCoordinatesArray(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *x, VALUE_TYPE *y, VALUE_TYPE *z) const;
+    template<class VALUE_TYPE> UdmSize_t getCoordinatesX(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *coords) const;
+    template<class VALUE_TYPE> UdmSize_t getCoordinatesY(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *coords) const;
+    template<class VALUE_TYPE> UdmSize_t getCoordinatesZ(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *coords) const;
+    template<class VALUE_TYPE> UdmSize_t setCoordinatesArray(UdmSize_t start_slot, UdmSize_t size, const VALUE_TYPE *x, const VALUE_TYPE *y, const VALUE_TYPE *z);
+
+    // memory size
+    size_t getMemSize() const;
+
+private:
+    void initialize();
+    template<class VALUE_TYPE> UdmSize_t copyCoordinates(const void *src, UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *dest) const;
+    template<class VALUE_TYPE> UdmSize_t storeCoordinates(void *dest, UdmSize_t start_slot, UdmSize_t size, const VALUE_TYPE *src);
+};
+
+/**
+ * スロットのXYZ座標を取得する.
+ * @param [in]  slot        格納スロット（０～）
+ * @param [out] x        X座標
+ * @param [out] y        Y座標
+ * @param [out] z        Z座標
+ */
+template<class VALUE_TYPE>
+inline void UdmCoordsArray::getCoords(UdmSize_t slot, VALUE_TYPE &x, VALUE_TYPE &y, VALUE_TYPE &z) const
+{
+    if (this->getDataType() == Udm_RealDouble) {
+        x = (VALUE_TYPE)((const double*)this->coords_x)[slot];
+        y = (VALUE_TYPE)((const double*)this->coords_y)[slot];
+        z = (VALUE_TYPE)((const double*)this->coords_z)[slot];
+    }
+    else {
+        x = (VALUE_TYPE)((const float*)this->coords_x)[slot];
+        y = (VALUE_TYPE)((const float*)this->coords_y)[slot];
+        z = (VALUE_TYPE)((const float*)this->coords_z)[slot];
+    }
+    return;
+}
+
+/**
+ * スロットにXYZ座標を設定する.
+ * @param slot        格納スロット（０～）
+ * @param x        X座標
+ * @param y        Y座標
+ * @param z        Z座標
+ */
+template<class VALUE_TYPE>
+inline void UdmCoordsArray::setCoords(UdmSize_t slot, VALUE_TYPE x, VALUE_TYPE y, VALUE_TYPE z)
+{
+    if (this->getDataType() == Udm_RealDouble) {
+        ((double*)this->coords_x)[slot] = (double)x;
+        ((double*)this->coords_y)[slot] = (double)y;
+        ((double*)this->coords_z)[slot] = (double)z;
+    }
+    else {
+        ((float*)this->coords_x)[slot] = (float)x;
+        ((float*)this->coords_y)[slot] = (float)y;
+        ((float*)this->coords_z)[slot] = (float)z;
+    }
+    return;
+}
+
+} /* namespace udm */
+
+#endif /* _UDMCOORDSARRAY_H_ */
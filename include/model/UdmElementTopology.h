@@ -0,0 +1,209 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMELEMENTTOPOLOGY_H_
+#define _UDMELEMENTTOPOLOGY_H_
+
+/**
+ * @file UdmElementTopology.h
+ * 要素形状タイプ位相情報クラスのヘッダファイル
+ */
+
+#include "UdmBase.h"
+
+/**
+ * 部品要素（セル）の最大頂点（ノード）数
+ */
+#define UDM_CELL_MAXCOMPONENTNODES        4
+
+/**
+ * 部品要素-頂点テーブルの1部品要素当たりの要素数 : {部品要素形状タイプ, 頂点番号...}
+ */
+#define UDM_TOPOLOGY_COMPONENTSTRIDE        (UDM_CELL_MAXCOMPONENTNODES+1)
+
+namespace udm
+{
+class UdmBar;
+class UdmShell;
+class UdmSolid;
+
+/**
+ * 要素形状タイプ位相情報テンプレート.
+ * 要素形状タイプ毎に特殊化して、頂点数、部品要素数、次元数、要素（セル）クラス、
+ * 部品要素-頂点テーブルをコンパイル時に定義する.
+ * 部品要素-頂点テーブルは{部品要素形状タイプ, 頂点番号（１～）...}とする.
+ */
+template <UdmElementType_t ELEMENT_TYPE>
+struct UdmElementTraits {
+    enum {
+        NUM_VERTEX = 0,            ///< 頂点（ノード）数
+        NUM_COMPONENTS = 0,        ///< 部品要素数
+        DIMENSIONS = 0            ///< 次元数
+    };
+};
+
+/**
+ * 位相情報 : 節点（ノード）
+ */
+template <>
+struct UdmElementTraits<Udm_NODE> {
+    enum { NUM_VERTEX = 1, NUM_COMPONENTS = 0, DIMENSIONS = 0 };
+};
+
+/**
+ * 位相情報 : BAR要素
+ */
+template <>
+struct UdmElementTraits<Udm_BAR_2> {
+    enum { NUM_VERTEX = 2, NUM_COMPONENTS = 0, DIMENSIONS = 1 };
+    typedef UdmBar cell_type;
+};
+
+/**
+ * 位相情報 : Shell:三角形要素
+ */
+template <>
+struct UdmElementTraits<Udm_TRI_3> {
+    enum { NUM_VERTEX = 3, NUM_COMPONENTS = 3, DIMENSIONS = 2 };
+    typedef UdmShell cell_type;
+    static const UdmSize_t component_nodes[NUM_COMPONENTS][UDM_TOPOLOGY_COMPONENTSTRIDE];
+};
+
+/**
+ * 位相情報 : Shell:四角形要素
+ */
+template <>
+struct UdmElementTraits<Udm_QUAD_4> {
+    enum { NUM_VERTEX = 4, NUM_COMPONENTS = 4, DIMENSIONS = 2 };
+    typedef UdmShell cell_type;
+    static const UdmSize_t component_nodes[NUM_COMPONENTS][UDM_TOPOLOGY_COMPONENTSTRIDE];
+};
+
+/**
+ * 位相情報 : Solid:四面体要素
+ */
+template <>
+struct UdmElementTraits<Udm_TETRA_4> {
+    enum { NUM_VERTEX = 4, NUM_COMPONENTS = 4, DIMENSIONS = 3 };
+    typedef UdmSolid cell_type;
+    static const UdmSize_t component_nodes[NUM_COMPONENTS][UDM_TOPOLOGY_COMPONENTSTRIDE];
+};
+
+/**
+ * 位相情報 : Solid:ピラミッド要素
+ */
+template <>
+struct UdmElementTraits<Udm_PYRA_5> {
+    enum { NUM_VERTEX = 5, NUM_COMPONENTS = 5, DIMENSIONS = 3 };
+    typedef UdmSolid cell_type;
+    static const UdmSize_t component_nodes[NUM_COMPONENTS][UDM_TOPOLOGY_COMPONENTSTRIDE];
+};
+
+/**
+ * 位相情報 : Solid:五面体要素
+ */
+template <>
+struct UdmElementTraits<Udm_PENTA_6> {
+    enum { NUM_VERTEX = 6, NUM_COMPONENTS = 5, DIMENSIONS = 3 };
+    typedef UdmSolid cell_type;
+    static const UdmSize_t component_nodes[NUM_COMPONENTS][UDM_TOPOLOGY_COMPONENTSTRIDE];
+};
+
+/**
+ * 位相情報 : Solid:六面体要素
+ */
+template <>
+struct UdmElementTraits<Udm_HEXA_8> {
+    enum { NUM_VERTEX = 8, NUM_COMPONENTS = 6, DIMENSIONS = 3 };
+    typedef UdmSolid cell_type;
+    static const UdmSize_t component_nodes[NUM_COMPONENTS][UDM_TOPOLOGY_COMPONENTSTRIDE];
+};
+
+/**
+ * 要素形状タイプ位相情報クラス.
+ * UdmElementTraitsから作成した要素形状タイプをインデックスとするテーブルから位相情報を取得する.
+ */
+class UdmElementTopology
+{
+private:
+    /**
+     * 要素形状タイプの位相情報
+     */
+    struct UdmTopologyInfo {
+        int num_vertex;                        ///< 頂点（ノード）数
+        int num_components;                    ///< 部品要素数
+        int dimensions;                        ///< 次元数
+        const UdmSize_t *component_nodes;    ///< 部品要素-頂点テーブル : NULL=部品要素なし
+    };
+
+    /**
+     * 位相情報テーブル : 要素形状タイプ = インデックス
+     */
+    static const UdmTopologyInfo topology_table[Udm_MIXED+1];
+
+public:
+
+    /**
+     * 要素形状タイプの頂点（ノード）数を取得する.
+     * @param elem_type        要素形状タイプ
+     * @return        頂点（ノード）数 : 不明、エラーの場合は0を返す。
+     */
+    static int getNumVertex(UdmElementType_t elem_type)
+    {
+        if (elem_type < Udm_ElementTypeUnknown || elem_type > Udm_MIXED) return 0;
+        return topology_table[elem_type].num_vertex;
+    }
+
+    /**
+     * 要素形状タイプの部品要素数を取得する.
+     * @param elem_type        要素形状タイプ
+     * @return        部品要素数 : 不明、エラーの場合は0を返す。
+     */
+    static int getNumComponents(UdmElementType_t elem_type)
+    {
+        if (elem_type < Udm_ElementTypeUnknown || elem_type > Udm_MIXED) return 0;
+        return topology_table[elem_type].num_components;
+    }
+
+    /**
+     * 要素形状タイプの次元数を取得する.
+     * @param elem_type        要素形状タイプ
+     * @return        次元数 : 不明、エラーの場合は0を返す。
+     */
+    static int getDimensions(UdmElementType_t elem_type)
+    {
+        if (elem_type < Udm_ElementTypeUnknown || elem_type > Udm_MIXED) return 0;
+        return topology_table[elem_type].dimensions;
+    }
+
+    /**
+     * 要素形状タイプの部品要素-頂点テーブルを取得する.
+     * 部品要素毎にUDM_TOPOLOGY_COMPONENTSTRIDE個の{部品要素形状タイプ, 頂点番号（１～）...}が並ぶ.
+     * @param elem_type        要素形状タイプ
+     * @return        部品要素-頂点テーブル : 部品要素が存在しない場合はNULL
+     */
+    static const UdmSize_t* getComponentTable(UdmElementType_t elem_type)
+    {
+        if (elem_type < Udm_ElementTypeUnknown || elem_type > Udm_MIXED) return NULL;
+        return topology_table[elem_type].component_nodes;
+    }
+
+    static unsigned int getComponentNodes(
+                    UdmElementType_t elem_type,
+                    unsigned int component_id,
+                    UdmElementType_t &component_type,
+                    UdmSize_t component_nodes[]);
+};
+
+} /* namespace udm */
+
+#endif /* _UDMELEMENTTOPOLOGY_H_ */
@@ -26,6 +26,8 @@ class UdmZone;
 class UdmGridCoordinates;
 class UdmSections;
 class UdmCell;
+class UdmNode;
+class UdmEntityPool;
 
 /**
  * セクション（要素構成）情報クラス.
@@ -35,6 +37,8 @@ class UdmCell;
 class UdmElements: public UdmGeneral, public UdmISerializable
 {
 friend class UdmSections;
+friend class UdmCell;
+friend class UdmCgnsGatherArchive;
 
 private:
     UdmSections *parent_sections;                ///< 親要素管理クラス
@@ -57,6 +61,28 @@ private:
      */
     UdmSize_t end_elemid;
 
+    /**
+     * 要素（セル）の構成ノード（節点）の接続情報配列.
+     * セクション（要素構成）内の要素（セル）の構成ノードを連続して格納する.
+     * 要素（セル）は接続情報配列の開始位置と構成ノード数を保持する.
+     */
+    std::vector<UdmNode*> connectivity_nodes;
+
+    /**
+     * 接続情報配列を参照している要素（セル）数.
+     */
+    UdmSize_t num_connectivity_cells;
+
+    /**
+     * 接続情報配列の未使用領域数.
+     */
+    UdmSize_t unused_connectivity;
+
+    /**
+     * 非同期出力の接続情報（ノードID）退避バッファ
+     */
+    cgsize_t *staged_element_ids;
+
     /**
      * セクション（要素構成）内の最小座標
      */
@@ -96,6 +122,8 @@ public:
     UdmError_t writeCgns(int index_file, int index_base, int index_zone, int index_cell);
     UdmError_t writeCgnsLinkFile(int index_file, int index_base, int index_zone, const std::string &link_output_path, const std::vector<std::string> &linked_files);
     UdmError_t initializeWriteCgns();
+    UdmError_t stageCgnsElements();
+    void clearStagedElements();
     UdmError_t joinCgnsElements(UdmElements *dest_elements);
 
     // シリアライズ
@@ -127,8 +155,26 @@ private:
 
     UdmZone* getZone() const;
     UdmGridCoordinates* getGridCoordinates() const;
+    UdmEntityPool* getEntityPool() const;
     UdmError_t cloneElements(const UdmElements& src);
     bool equalsElements(const UdmElements &elements) const;
+
+    // 接続情報配列
+    void attachConnectivity(UdmCell *cell, const std::vector<UdmNode*> &nodes);
+    void appendConnectivityNode(UdmCell *cell, UdmNode *node);
+    void removeConnectivityNode(UdmCell *cell, const UdmNode *node);
+    void clearConnectivity(UdmCell *cell);
+    void releaseConnectivity(UdmCell *cell);
+    UdmError_t arrangeConnectivity();
+    cgsize_t* createCgnsElementIds(size_t &data_size);
+    UdmError_t readCgnsElements(UdmElementType_t elem_type, UdmSize_t start, UdmSize_t cell_size, const cgsize_t *elements);
+    UdmCell* readCgnsCell(UdmSize_t elem_id, UdmElementType_t elem_type, const cgsize_t *elements, std::vector<UdmNode*> &cell_nodes);
+    UdmSize_t readCgnsCells(UdmElementType_t elem_type, UdmSize_t start, UdmSize_t cell_size, const cgsize_t *elements);
+    template <UdmElementType_t ELEMENT_TYPE>
+    UdmSize_t readCgnsCells(UdmSize_t start, UdmSize_t cell_size, const cgsize_t *elements);
+    UdmSize_t insertCellsConnectivity(UdmElementType_t elem_type, UdmSize_t cell_size, UdmSize_t* elements);
+    template <UdmElementType_t ELEMENT_TYPE>
+    UdmSize_t insertCellsConnectivity(UdmSize_t cell_size, UdmSize_t* elements);
 };
 
 } /* namespace udm */
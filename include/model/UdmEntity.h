@@ -19,8 +19,10 @@
  */
 
 #include "model/UdmSolutionData.h"
+#include "model/UdmSolutionColumn.h"
 #include "model/UdmGlobalRankid.h"
 #include "utils/UdmSerialization.h"
+#include "utils/UdmEntityPool.h"
 
 namespace udm
 {
@@ -28,6 +30,7 @@ class UdmZone;
 class UdmNode;
 class UdmCell;
 class UdmSolutionFieldConfig;
+class UdmEntityVoxels;
 
 /**
  * 構成単位基底クラス.
@@ -35,6 +38,9 @@ class UdmSolutionFieldConfig;
  */
 class UdmEntity: public UdmBase, public UdmISerializable
 {
+friend class UdmEntityVoxels;
+friend class UdmMigrationArchive;
+
 private:
 
     /**
@@ -48,6 +54,17 @@ private:
      */
     std::vector<UdmSolutionData*> solution_fields;
 
+    /**
+     * 物理量カラムデータ格納ノード・要素構成クラス.
+     * 物理量カラムデータを使用していない場合はNULL
+     */
+    UdmEntityVoxels *solution_voxels;
+
+    /**
+     * 物理量カラムデータの格納スロット
+     */
+    UdmSize_t solution_slot;
+
     /**
      * グローバルID : 未使用
      * UdmSize_t global_id;
@@ -102,6 +119,12 @@ public:
     UdmEntity(UdmElementType_t element_type);
     virtual ~UdmEntity();
 
+    // メモリプール
+    static void* operator new(size_t size);
+    static void* operator new(size_t size, UdmEntityPool *pool);
+    static void operator delete(void *ptr);
+    static void operator delete(void *ptr, UdmEntityPool *pool);
+
     UdmSize_t getId() const;
     void setId(UdmSize_t id);
     // UdmSolutionData
@@ -138,9 +161,12 @@ public:
     UdmError_t getMpiRankInfo(int info_id, int &rankno, UdmSize_t &localid) const;
     UdmError_t setMpiRankInfo(int rankno, UdmSize_t localid);
     UdmError_t addMpiRankInfo(int rankno, UdmSize_t localid);
+    UdmError_t appendMpiRankInfo(int rankno, UdmSize_t localid);
+    void finalizeMpiRankInfos();
     UdmError_t removeMpiRankInfo(int rankno, UdmSize_t localid);
     bool existsMpiRankInfo(int rankno, UdmSize_t localid) const;
     UdmError_t updateMpiRankInfo(int old_rankno, UdmSize_t old_localid, int new_rankno, UdmSize_t new_localid);
+    UdmError_t replaceMpiRankInfo(int old_rankno, UdmSize_t old_localid, int new_rankno, UdmSize_t new_localid);
     const UdmGlobalRankidList& getMpiRankInfos() const;
     void clearMpiRankInfos();
     void eraseInvalidMpiRankInfos();
@@ -191,7 +217,9 @@ public:
 protected:
     UdmError_t cloneEntity(const UdmEntity &src);
     unsigned int insertSolutionData(UdmSolutionData *field);
+    void updateSolutionVoxels();
     virtual UdmZone* getZone() const = 0;
+    virtual UdmEntityVoxels* getParentVoxels() const = 0;
 
 private:
     void initialize();
@@ -199,6 +227,11 @@ private:
     const UdmSolutionFieldConfig* getSolutionFieldConfig(const std::string &solution_name) const;
     const UdmSolutionFieldConfig* getSolutionFieldConfig(UdmSize_t field_id) const;
     UdmSolutionData* factorySolutionData(const std::string &name, UdmVectorType_t vector);
+    const UdmSolutionColumn* getSolutionColumn(const std::string &solution_name) const;
+    UdmSolutionColumn* createSolutionColumn(const std::string &solution_name);
+    UdmError_t attachSolutionVoxels(UdmEntityVoxels *voxels);
+    UdmError_t detachSolutionVoxels();
+    UdmError_t importSolutionData(const UdmSolutionData *field);
 
     /**
      * コピーオペレータ：コピー禁止
@@ -222,6 +255,11 @@ private:
 template<class VALUE_TYPE>
 UdmError_t UdmEntity::getSolutionScalar(const std::string& solution_name, VALUE_TYPE& value) const
 {
+    const UdmSolutionColumn *column = this->getSolutionColumn(solution_name);
+    if (column != NULL) {
+        value = column->getSolutionValue<VALUE_TYPE>(this->solution_slot);
+        return UDM_OK;
+    }
     std::vector<UdmSolutionData*>::const_iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -241,6 +279,10 @@ UdmError_t UdmEntity::getSolutionScalar(const std::string& solution_name, VALUE_
 template<class VALUE_TYPE>
 unsigned int UdmEntity::getSolutionVector(const std::string& solution_name, VALUE_TYPE* values) const
 {
+    const UdmSolutionColumn *column = this->getSolutionColumn(solution_name);
+    if (column != NULL) {
+        return column->getSolutionValues<VALUE_TYPE>(this->solution_slot, values);
+    }
     std::vector<UdmSolutionData*>::const_iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -267,6 +309,11 @@ UdmError_t UdmEntity::setSolutionScalar(const std::string& solution_name, VALUE_
     if (!this->validateSolutionData(solution_name)) {
         return UDM_ERROR;
     }
+    UdmSolutionColumn *column = this->createSolutionColumn(solution_name);
+    if (column != NULL) {
+        column->setSolutionValue<VALUE_TYPE>(this->solution_slot, value);
+        return UDM_OK;
+    }
     std::vector<UdmSolutionData*>::iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -296,6 +343,11 @@ UdmError_t UdmEntity::setSolutionVector(const std::string& solution_name, const
     if (!this->validateSolutionData(solution_name)) {
         return UDM_ERROR;
     }
+    UdmSolutionColumn *column = this->createSolutionColumn(solution_name);
+    if (column != NULL) {
+        column->setSolutionValues<VALUE_TYPE>(this->solution_slot, values, size);
+        return UDM_OK;
+    }
     std::vector<UdmSolutionData*>::iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
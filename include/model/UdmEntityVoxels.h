@@ -20,6 +20,8 @@
 
 #include "model/UdmGeneral.h"
 #include "model/UdmEntity.h"
+#include "config/UdmSolutionFieldConfig.h"
+#include "model/UdmSolutionColumn.h"
 
 namespace udm
 {
@@ -32,6 +34,44 @@ class UdmZone;
  */
 class UdmEntityVoxels: public UdmGeneral, public UdmISerializable
 {
+friend class UdmEntity;
+
+private:
+    /**
+     * 物理量データ格納タイプ
+     */
+    UdmSolutionStorageType_t solution_storage;
+
+    /**
+     * 物理量カラムデータリスト : 物理量フィールド毎の連続配列
+     */
+    std::vector<UdmSolutionColumn*> solution_columns;
+
+    /**
+     * 物理量カラムデータのスロット使用ノード・要素リスト : 未使用スロット=NULL
+     */
+    std::vector<UdmEntity*> slot_entities;
+
+    /**
+     * 物理量カラムデータの未使用スロットリスト
+     */
+    std::vector<UdmSize_t> free_slots;
+
+    /**
+     * 物理量カラムデータの確保スロット数
+     */
+    UdmSize_t slot_capacity;
+
+    /**
+     * 物理量フィールドID毎の物理量カラムデータ : 物理量フィールドIDによるアクセス用
+     */
+    std::vector<UdmSolutionColumn*> field_columns;
+
+    /**
+     * 物理量フィールドID毎の物理量カラムデータ作成時の物理量情報リストの更新番号
+     */
+    UdmSize_t field_revision;
+
 public:
     UdmEntityVoxels();
     virtual ~UdmEntityVoxels();
@@ -39,20 +79,148 @@ public:
     UdmError_t getEntitySolutionArray(const std::string &field_name, UdmSize_t start_id, UdmSize_t end_id, int vector_size, UdmDataType_t datatype, void* solution_array, UdmMemArrayType_t memtype);
     virtual UdmSize_t getNumEntities() const = 0;
     virtual UdmZone* getParentZone() const = 0;
+    UdmEntityPool* getEntityPool() const;
+    // 物理量カラムデータ
+    UdmSolutionStorageType_t getSolutionStorageType() const;
+    UdmError_t setSolutionStorageType(UdmSolutionStorageType_t storage_type);
+    bool isColumnSolutionStorage() const;
+    int getNumSolutionColumns() const;
+    UdmSolutionColumn* getSolutionColumn(int column_id);
+    const UdmSolutionColumn* getSolutionColumn(int column_id) const;
+    UdmSolutionColumn* getSolutionColumn(const std::string &solution_name);
+    const UdmSolutionColumn* getSolutionColumn(const std::string &solution_name) const;
+    UdmSize_t getNumSolutionSlots() const;
+    void clearSolutionColumns();
+    // 物理量フィールドIDによるアクセス
+    UdmSolutionColumn* getSolutionColumnByFieldId(UdmSize_t field_id);
+    const UdmSolutionColumn* getSolutionColumnByFieldId(UdmSize_t field_id) const;
+    template <class VALUE_TYPE> UdmError_t getEntitySolutionScalar(const UdmEntity *entity, UdmSize_t field_id, VALUE_TYPE &value) const;
+    template <class VALUE_TYPE> unsigned int getEntitySolutionVector(const UdmEntity *entity, UdmSize_t field_id, VALUE_TYPE *values) const;
+    template <class VALUE_TYPE> UdmError_t setEntitySolutionScalar(UdmEntity *entity, UdmSize_t field_id, VALUE_TYPE value);
+    template <class VALUE_TYPE> UdmError_t setEntitySolutionVector(UdmEntity *entity, UdmSize_t field_id, const VALUE_TYPE* values, unsigned int size);
     // MPI
     MPI_Comm getMpiComm() const;
     int getMpiRankno() const;
     int getMpiProcessSize() const;
 
 protected:
+    UdmSolutionColumn* createSolutionColumn(const std::string &solution_name);
+    UdmSolutionColumn* createSolutionColumn(const std::string &solution_name, UdmDataType_t datatype, UdmVectorType_t vectortype, int nvector_size);
+    UdmSize_t allocateSolutionSlot(UdmEntity *entity);
+    void releaseSolutionSlot(UdmSize_t slot);
+    virtual UdmGridLocation_t getSolutionGridLocation() const = 0;
 
 private:
     virtual UdmEntity* getEntityById(UdmSize_t entity_id) = 0;
     virtual const UdmEntity* getEntityById(UdmSize_t entity_id) const = 0;
     virtual const UdmSolutionFieldConfig* getSolutionFieldConfig(const std::string &solution_name) const = 0;
+    const UdmSolutionFieldConfig* getSolutionFieldConfigById(UdmSize_t field_id) const;
+    UdmSize_t getSolutionFieldsRevision() const;
+    void rebuildFieldColumns();
 
 };
 
+/**
+ * 物理量フィールドIDのノード、要素（セル）の物理量データ値を取得する.
+ * 物理量フィールドIDはUdmFlowSolutions::getFieldIdにて取得すること.
+ * @param [in]  entity        ノード、要素（セル）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] value        取得物理データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmEntityVoxels::getEntitySolutionScalar(const UdmEntity *entity, UdmSize_t field_id, VALUE_TYPE &value) const
+{
+    if (entity == NULL) return UDM_ERROR;
+    if (entity->solution_voxels == this) {
+        // 物理量カラムデータから直接取得する
+        const UdmSolutionColumn *column = this->getSolutionColumnByFieldId(field_id);
+        if (column == NULL) return UDM_ERROR;
+        if (!column->existsSolutionValue(entity->solution_slot)) return UDM_ERROR;
+        value = column->getSolutionValue<VALUE_TYPE>(entity->solution_slot);
+        return UDM_OK;
+    }
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfigById(field_id);
+    if (config == NULL) return UDM_ERROR;
+    return entity->getSolutionScalar(config->getSolutionName(), value);
+}
+
+/**
+ * 物理量フィールドIDのノード、要素（セル）の物理量データ値リストを取得する.
+ * @param [in]  entity        ノード、要素（セル）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] values        取得物理データ値リスト
+ * @return        取得データ数
+ */
+template<class VALUE_TYPE>
+unsigned int UdmEntityVoxels::getEntitySolutionVector(const UdmEntity *entity, UdmSize_t field_id, VALUE_TYPE *values) const
+{
+    if (entity == NULL) return 0;
+    if (entity->solution_voxels == this) {
+        // 物理量カラムデータから直接取得する
+        const UdmSolutionColumn *column = this->getSolutionColumnByFieldId(field_id);
+        if (column == NULL) return 0;
+        if (!column->existsSolutionValue(entity->solution_slot)) return 0;
+        return column->getSolutionValues<VALUE_TYPE>(entity->solution_slot, values);
+    }
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfigById(field_id);
+    if (config == NULL) return 0;
+    return entity->getSolutionVector(config->getSolutionName(), values);
+}
+
+/**
+ * 物理量フィールドIDのノード、要素（セル）の物理量データ値を設定する.
+ * 物理量カラムデータを使用する場合は、物理量名称の検索を行わずに設定する.
+ * @param entity        ノード、要素（セル）
+ * @param field_id        物理量フィールドID（１～）
+ * @param value        物理データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmEntityVoxels::setEntitySolutionScalar(UdmEntity *entity, UdmSize_t field_id, VALUE_TYPE value)
+{
+    if (entity == NULL) return UDM_ERROR;
+    UdmSolutionColumn *column = this->getSolutionColumnByFieldId(field_id);
+    if (column != NULL && entity->solution_voxels != this && entity->getParentVoxels() == this) {
+        entity->attachSolutionVoxels(this);
+    }
+    if (column != NULL && entity->solution_voxels == this) {
+        // 物理量カラムデータに直接設定する
+        column->setSolutionValue<VALUE_TYPE>(entity->solution_slot, value);
+        return UDM_OK;
+    }
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfigById(field_id);
+    if (config == NULL) return UDM_ERROR;
+    return entity->setSolutionScalar(config->getSolutionName(), value);
+}
+
+/**
+ * 物理量フィールドIDのノード、要素（セル）の物理量データ値リストを設定する.
+ * 物理量カラムデータを使用する場合は、物理量名称の検索を行わずに設定する.
+ * @param entity        ノード、要素（セル）
+ * @param field_id        物理量フィールドID（１～）
+ * @param values        物理量データ値リスト
+ * @param size            物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmEntityVoxels::setEntitySolutionVector(UdmEntity *entity, UdmSize_t field_id, const VALUE_TYPE* values, unsigned int size)
+{
+    if (entity == NULL) return UDM_ERROR;
+    UdmSolutionColumn *column = this->getSolutionColumnByFieldId(field_id);
+    if (column != NULL && entity->solution_voxels != this && entity->getParentVoxels() == this) {
+        entity->attachSolutionVoxels(this);
+    }
+    if (column != NULL && entity->solution_voxels == this) {
+        // 物理量カラムデータに直接設定する
+        column->setSolutionValues<VALUE_TYPE>(entity->solution_slot, values, size);
+        return UDM_OK;
+    }
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfigById(field_id);
+    if (config == NULL) return UDM_ERROR;
+    return entity->setSolutionVector(config->getSolutionName(), values, size);
+}
+
 } /* namespace udm */
 
 #endif /* _UDMENTITYVOXELS_H_ */
@@ -24,6 +24,7 @@
 namespace udm
 {
 class UdmZone;
+class UdmEntityVoxels;
 
 
 /**
@@ -41,6 +42,11 @@ class UdmFlowSolutions: public UdmGeneral
      */
     std::vector<std::string> cgns_writesolutions;
 
+    /**
+     * 非同期出力の物理量データ退避バッファ : <物理量名, <データ型, データ配列>>
+     */
+    std::map<std::string, std::pair<UdmDataType_t, void*> > staged_fields;
+
 public:
     UdmFlowSolutions();
     UdmFlowSolutions(UdmZone *parent_zone);
@@ -94,6 +100,9 @@ public:
     int addCgnsWriteSolutions(const std::string solution_name);
     void clearCgnsWriteSolutions();
     int getNumCgnsWriteSolutions() const;
+    UdmError_t stageCgnsSolutionFields();
+    void clearStagedSolutionFields();
+    bool isStagedSolutionFields() const;
 
     // UdmZone
     UdmZone* getParentZone();
@@ -107,6 +116,8 @@ public:
 private:
     void initialize();
     UdmError_t rebuildSolutionFields();
+    UdmEntityVoxels* getSolutionFieldVoxels(const UdmSolutionFieldConfig* config);
+    UdmError_t createSolutionFieldArray(const UdmSolutionFieldConfig* config, void* &field_datas, UdmSize_t &data_size);
     UdmError_t getCgnsFlowSolutionIds(int index_dfi_field, int &index_solution, std::vector<int> &index_fields, int index_file, int index_base, int index_zone, int timeslice_step = -1);
     UdmError_t writeCgnsSolutionField(const UdmSolutionFieldConfig *config, int index_file, int index_base, int index_zone, int timeslice_step);
     int findCgnsFlowSolution(int index_file, int index_base, int index_zone, const UdmSolutionFieldConfig *config, int timeslice_step);
@@ -25,16 +25,22 @@ namespace udm
 
 class UdmEntity;
 
+/**
+ * グローバルIDリストの内部配列に格納するグローバルID数.
+ * 格納グローバルID数が内部配列数を超えた場合はヒープ領域に格納する.
+ */
+#define UDM_GLOBALRANKID_INLINESIZE        2
+
 /**
  * グローバルIDクラス.
  * ランク番号とローカルIDを対として持つ。
+ * 仮想関数を持たないPODクラスであり、グローバルIDリストの内部配列に直接格納する.
  */
 class UdmGlobalRankid
 {
 public:
     int                rankno;            ///< ランク番号（０～）
     UdmSize_t         localid;        ///< ローカルID (１～）
-    UdmEntity *ref_entity;                ///< 関連オブジェクト
 
 public:
     /**
@@ -57,24 +63,6 @@ public:
         this->localid = localid;
     };
 
-    /**
-     * コンストラクタ
-     * @param rankno        ランク番号（０～）
-     * @param localid        ローカルID (１～）
-     * @param entity;        関連オブジェクト
-     */
-    UdmGlobalRankid(int rankno, UdmSize_t localid, UdmEntity *entity)
-    {
-        this->rankno = rankno;
-        this->localid = localid;
-        this->ref_entity = entity;
-    };
-
-    /**
-     * デストラクタ
-     */
-    virtual ~UdmGlobalRankid() {};
-
     /**
      * ランク番号とローカルIDが同じであるかチェックする.
      * @param rankno        ランク番号
@@ -193,24 +181,6 @@ public:
         buf += std::string(stream);
         return;
     }
-
-    /**
-     * 関連オブジェクトを取得する.
-     * @return        関連オブジェクト
-     */
-    UdmEntity *getReferenceEntity() const
-    {
-        return this->ref_entity;
-    }
-
-    /**
-     * 関連オブジェクトを設定する.
-     * @param entity        関連オブジェクト
-     */
-    void setReferenceEntity(UdmEntity * entity)
-    {
-        this->ref_entity = entity;
-    }
 };
 
 
@@ -463,31 +433,58 @@ public:
 /**
  * グローバルIDリストクラス.
  * 重複を許可しないグローバルIDのリストクラス
+ * グローバルID数がUDM_GLOBALRANKID_INLINESIZE以下の場合は内部配列に格納して、
+ * 超えた場合はヒープ領域に格納する.
+ * ランク番号とローカルIDは別配列に格納して、パディングを持たない.
+ * 全節点（ノード）、要素（セル）が２つ保持するので、仮想関数を持たず、UDM_SIZE64で32byteとする.
+ * 一括追加はappendGlobalRankidで未ソートのまま追加して、
+ * finalizeGlobalRankidsでソート、重複削除を行う.
  */
-class UdmGlobalRankidList : public UdmISerializable
+class UdmGlobalRankidList
 {
 private:
 
     /**
-     * グローバルIDリスト
+     * グローバルID数
      */
-    std::vector<UdmGlobalRankid>  globalid_list;
+    unsigned int num_globalids;
+
+    /**
+     * グローバルIDの確保数 : UDM_GLOBALRANKID_INLINESIZE以下の場合は内部配列に格納する.
+     */
+    unsigned int capacity_globalids;
+
+    /**
+     * グローバルIDリスト : 内部配列 or ヒープ領域
+     */
+    union {
+        struct {
+            UdmSize_t localids[UDM_GLOBALRANKID_INLINESIZE];        ///< ローカルID
+            int ranknos[UDM_GLOBALRANKID_INLINESIZE];            ///< ランク番号
+        } inline_globalids;        ///< 内部配列
+        char *heap_globalids;        ///< ヒープ領域 : ローカルID配列, ランク番号配列の順
+    };
 
 public:
     UdmGlobalRankidList();
     UdmGlobalRankidList(UdmSize_t size);
-    virtual ~UdmGlobalRankidList();
+    UdmGlobalRankidList(const UdmGlobalRankidList &src);
+    ~UdmGlobalRankidList();
+    UdmGlobalRankidList& operator = (const UdmGlobalRankidList &src);
     UdmError_t addGlobalRankid(const UdmGlobalRankid &globalid);
     UdmError_t addGlobalRankid(int rankno, UdmSize_t localid);
-    UdmError_t addGlobalRankid(int rankno, UdmSize_t localid, UdmEntity *entity);
     UdmError_t addGlobalRankids(const UdmGlobalRankidList &globalids);
+    UdmError_t addGlobalRankids(const std::vector<UdmGlobalRankid> &globalids);
+    void appendGlobalRankid(int rankno, UdmSize_t localid);
+    UdmError_t replaceGlobalRankid(
+                    int old_rankno, UdmSize_t old_localid,
+                    int new_rankno, UdmSize_t new_localid);
+    void finalizeGlobalRankids();
     bool existsGlobalRankid(const UdmGlobalRankid &globalid) const;
     bool existsGlobalRankid(int rankno, UdmSize_t localid) const;
     void clear();
     UdmError_t removeGlobalRankid(const UdmGlobalRankid &globalid);
     UdmError_t removeGlobalRankid(int rankno, UdmSize_t localid);
-    UdmEntity* getReferenceEntity(const int rankno, const UdmSize_t localid) const;
-    void removeReferenceEntity(int rankno, UdmSize_t localid, UdmEntity* entity);
     UdmSize_t getNumGlobalRankids() const;
     UdmSize_t size() const;
     UdmError_t getGlobalRankid(UdmSize_t id, int &rankno, UdmSize_t &localid) const;
@@ -509,9 +506,18 @@ public:
     size_t getMemSize() const;
 
 private:
+    void initialize();
+    UdmSize_t* getLocalids();
+    const UdmSize_t* getLocalids() const;
+    int* getRanknos();
+    const int* getRanknos() const;
+    UdmGlobalRankid getGlobalRankidAt(UdmSize_t pos) const;
+    void setGlobalRankidAt(UdmSize_t pos, int rankno, UdmSize_t localid);
+    void insertGlobalRankid(UdmSize_t pos, const UdmGlobalRankid &globalid);
+    void eraseGlobalRankid(UdmSize_t pos);
     bool findGlobalRankid(
                 const UdmGlobalRankid &src_rank,
-                std::vector<UdmGlobalRankid>::const_iterator &insert_itr) const;
+                UdmSize_t &insert_pos) const;
 };
 
 /**
@@ -18,6 +18,7 @@
  */
 
 #include "model/UdmEntityVoxels.h"
+#include "model/UdmCoordsArray.h"
 
 namespace udm
 {
@@ -34,6 +35,7 @@ class UdmRankConnectivity;
  */
 class UdmGridCoordinates: public UdmEntityVoxels
 {
+friend class UdmNode;
 private:
     std::vector<UdmNode*> node_list;        ///< グリッド構成ノードリスト
     std::vector<UdmNode*> virtual_nodes;        ///< 仮想ノードリスト
@@ -41,6 +43,41 @@ private:
     std::string  cgns_writegridcoordnates;        ///< 出力CGNS:GrdiCoordinates名
     UdmSize_t max_nodeid;
 
+    /**
+     * XYZ座標値配列 : 節点（ノード）はスロットにて座標値を参照する.
+     */
+    UdmCoordsArray coords_array;
+
+    /**
+     * 未使用XYZ座標値スロットリスト
+     */
+    std::vector<UdmSize_t> free_coords_slots;
+
+    /**
+     * 使用済みXYZ座標値スロット数（未使用スロットを含む）
+     */
+    UdmSize_t num_coords_slots;
+
+    /**
+     * XYZ座標値スロット連番フラグ : true=構成ノード(node_list[n])のスロットがnである.
+     */
+    bool coords_sequential;
+
+    /**
+     * 非同期出力のXYZ座標値退避バッファ : X[0..n-1],Y[0..n-1],Z[0..n-1]
+     */
+    void *staged_coords;
+
+    /**
+     * 非同期出力のXYZ座標値退避バッファの節点（ノード）数
+     */
+    UdmSize_t staged_coords_size;
+
+    /**
+     * 非同期出力のXYZ座標値退避バッファのデータ型
+     */
+    UdmDataType_t staged_coords_datatype;
+
 public:
     UdmGridCoordinates();
     UdmGridCoordinates(UdmZone* zone);
@@ -82,6 +119,8 @@ public:
     void setCgnsWriteGridCoordnates(const std::string& gridcoordnates_name);
     void clearCgnsWriteGridCoordnates();
     int getNumCgnsWriteGridCoordnates() const;
+    UdmError_t stageCgnsGridCoordinates();
+    void clearStagedGridCoordinates();
     static bool existsCgnsGridCoordnates(const std::string &filename, int index_base = 1, int index_zone = 1);
     UdmError_t joinCgnsGridCoordinates(UdmGridCoordinates *dest_grid);
 
@@ -133,6 +172,14 @@ public:
     UdmError_t setSolutionScalar(UdmSize_t node_id, const std::string &solution_name, VALUE_TYPE value);
     template <class VALUE_TYPE>
     UdmError_t setSolutionVector(UdmSize_t node_id, const std::string &solution_name, const VALUE_TYPE* values, unsigned int size = 3);
+    template <class VALUE_TYPE>
+    UdmError_t getSolutionScalar(UdmSize_t node_id, UdmSize_t field_id, VALUE_TYPE &value) const;
+    template <class VALUE_TYPE>
+    unsigned int getSolutionVector(UdmSize_t node_id, UdmSize_t field_id, VALUE_TYPE *value)  const;
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionScalar(UdmSize_t node_id, UdmSize_t field_id, VALUE_TYPE value);
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionVector(UdmSize_t node_id, UdmSize_t field_id, const VALUE_TYPE* values, unsigned int size = 3);
 
     // for debug
     void toString(std::string &buf) const;
@@ -148,8 +195,13 @@ private:
     UdmEntity* getEntityById(UdmSize_t entity_id);
     const UdmEntity* getEntityById(UdmSize_t entity_id) const;
     const UdmSolutionFieldConfig* getSolutionFieldConfig(const std::string &solution_name) const;
+    UdmGridLocation_t getSolutionGridLocation() const;
     UdmError_t removeRankConnectivity(const UdmEntity *node) const;
     void pushbackNode(UdmNode* node);
+    UdmSize_t allocateCoordsSlot(UdmDataType_t datatype);
+    void releaseCoordsSlot(UdmSize_t slot);
+    void clearCoordsSlots();
+    UdmError_t arrangeCoordsSlots();
 
     // MPI
     int getMpiRankno() const;
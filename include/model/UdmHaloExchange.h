@@ -0,0 +1,192 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMHALOEXCHANGE_H_
+#define _UDMHALOEXCHANGE_H_
+
+/**
+ * @file UdmHaloExchange.h
+ * 仮想要素（セル）物理量交換クラスのヘッダーファイル
+ */
+
+#include "model/UdmGeneral.h"
+
+namespace udm
+{
+class UdmZone;
+class UdmEntity;
+class UdmEntityVoxels;
+class UdmSolutionFieldConfig;
+
+/**
+ * 仮想要素（セル）物理量交換クラス.
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量を実体ランクから受信する交換計画を作成する.
+ * 交換計画はtransferVirtualCells後に１度作成し、時系列ステップ毎に指定物理量のみを確保済みバッファにて送受信する.
+ * startExchangeにて送信データの作成と送受信の開始を行い、finishExchangeにて受信完了を待って物理量を設定する.
+ * startExchangeとfinishExchangeの間は計算処理を行うことができる.
+ * 交換計画毎に複製したMPIコミュニケータにて送受信する為、startExchangeとfinishExchangeの間に他の送受信を行ってもメッセージは混在しない.
+ * 交換計画は節点（ノード）, 要素（セル）を参照する為、ゾーンの再構築、分割時に破棄される.
+ */
+class UdmHaloExchange: public UdmGeneral
+{
+private:
+    /**
+     * 親ゾーン
+     */
+    UdmZone *parent_zone;
+
+    /**
+     * 交換計画作成済みフラグ
+     */
+    bool created_plan;
+
+    /**
+     * 送信先ランク番号
+     */
+    std::vector<int> send_ranks;
+
+    /**
+     * 送信先ランク別の送信要素（セル） : 送信先ランクの仮想要素（セル）の実体要素（セル）
+     */
+    std::vector< std::vector<UdmEntity*> > send_cells;
+
+    /**
+     * 送信先ランク別の送信節点（ノード） : 送信先ランクの仮想節点（ノード）の実体節点（ノード）
+     */
+    std::vector< std::vector<UdmEntity*> > send_nodes;
+
+    /**
+     * 受信元ランク番号
+     */
+    std::vector<int> recv_ranks;
+
+    /**
+     * 受信元ランク別の仮想要素（セル）
+     */
+    std::vector< std::vector<UdmEntity*> > recv_cells;
+
+    /**
+     * 受信元ランク別の仮想節点（ノード）
+     */
+    std::vector< std::vector<UdmEntity*> > recv_nodes;
+
+    /**
+     * 送受信物理量情報
+     */
+    std::vector<const UdmSolutionFieldConfig*> exchange_fields;
+
+    /**
+     * 送受信物理量フィールドID : 送受信時の物理量名称の検索を行わない為にcreateExchangeBuffersにて取得する.
+     */
+    std::vector<UdmSize_t> exchange_field_ids;
+
+    /**
+     * 送受信物理量の節点（ノード）, 要素（セル）管理クラス
+     */
+    std::vector<UdmEntityVoxels*> exchange_voxels;
+
+    /**
+     * 送信先ランク別の送信バッファ位置(byte) : 送信先ランク数+1
+     */
+    std::vector<size_t> send_offsets;
+
+    /**
+     * 受信元ランク別の受信バッファ位置(byte) : 受信元ランク数+1
+     */
+    std::vector<size_t> recv_offsets;
+
+    char *send_buffer;            ///< 送信バッファ
+    size_t send_capacity;        ///< 送信バッファ確保サイズ(byte)
+    char *recv_buffer;            ///< 受信バッファ
+    size_t recv_capacity;        ///< 受信バッファ確保サイズ(byte)
+
+    /**
+     * 永続通信リクエスト : 送信リクエスト, 受信リクエストの順
+     */
+    std::vector<MPI_Request> requests;
+
+    /**
+     * 永続通信リクエストの受信元ランク別の受信バッファ位置 : 再作成判定用
+     */
+    std::vector<size_t> request_recv_offsets;
+
+    /**
+     * 永続通信リクエストの送信先ランク別の送信バッファ位置 : 再作成判定用
+     */
+    std::vector<size_t> request_send_offsets;
+
+    /**
+     * 送受信中フラグ : true=startExchange実行済み、finishExchange未実行
+     */
+    bool exchanging;
+
+    /**
+     * 交換計画用の複製MPIコミュニケータ.
+     * 他の送受信とメッセージが混在しないように、交換計画の作成、永続通信リクエストはこのコミュニケータにて行う.
+     * 初回のcreateExchangePlanにて複製し、デストラクタにて解放する.
+     */
+    MPI_Comm exchange_communicator;
+
+public:
+    UdmHaloExchange();
+    UdmHaloExchange(UdmZone *zone);
+    virtual ~UdmHaloExchange();
+
+    // Zone
+    UdmZone* getParentZone() const;
+    void setParentZone(UdmZone* zone);
+
+    // 交換計画
+    UdmError_t createExchangePlan();
+    void clearExchangePlan();
+    bool isCreatedPlan() const;
+    int getNumSendRanks() const;
+    int getNumRecvRanks() const;
+
+    // 送受信
+    UdmError_t startExchange(const std::vector<std::string> &field_names);
+    UdmError_t finishExchange();
+    bool isExchanging() const;
+
+private:
+    void initialize();
+    UdmError_t createExchangeBuffers(const std::vector<std::string> &field_names);
+    void createRequests();
+    void freeRequests();
+    void packSolutions();
+    void unpackSolutions();
+    template<class VALUE_TYPE> void packSolutionValues(
+                    const std::vector<UdmEntity*> &entities,
+                    const UdmSolutionFieldConfig *config,
+                    const UdmEntityVoxels *voxels,
+                    UdmSize_t field_id,
+                    char *buf) const;
+    template<class VALUE_TYPE> void unpackSolutionValues(
+                    const std::vector<UdmEntity*> &entities,
+                    const UdmSolutionFieldConfig *config,
+                    UdmEntityVoxels *voxels,
+                    UdmSize_t field_id,
+                    const char *buf) const;
+    size_t getFieldBufferSize(
+                    const std::vector<UdmEntity*> &cells,
+                    const std::vector<UdmEntity*> &nodes,
+                    const UdmSolutionFieldConfig *config) const;
+
+    // MPI
+    MPI_Comm getMpiComm() const;
+    int getMpiRankno() const;
+    int getMpiProcessSize() const;
+};
+
+} /* namespace udm */
+
+#endif /* _UDMHALOEXCHANGE_H_ */
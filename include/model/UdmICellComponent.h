@@ -90,6 +90,43 @@ public:
         return true;
     }
 
+    /**
+     * 頂点（ノード）構成、IDが同一であるかチェックする.
+     * 頂点（ノード）の順序は問わない.
+     * @param dest_nodes        比較対象頂点（ノード）リスト
+     * @return        true=同一頂点（ノード）構成
+     */
+    bool equalsNodeIds(const std::vector<UdmNode*> &dest_nodes) const
+    {
+        if (dest_nodes.size() <= 0) return (this->getNumNodes() == 0);
+        return this->equalsNodeIds(&dest_nodes[0], dest_nodes.size());
+    }
+
+    /**
+     * 頂点（ノード）構成、IDが同一であるかチェックする.
+     * 頂点（ノード）の順序は問わない.
+     * @param dest_nodes        比較対象頂点（ノード）配列
+     * @param num_nodes        比較対象頂点（ノード）数
+     * @return        true=同一頂点（ノード）構成
+     */
+    bool equalsNodeIds(UdmNode* const dest_nodes[], UdmSize_t num_nodes) const
+    {
+        if (this->getNumNodes() != num_nodes) return false;
+
+        UdmSize_t n, i;
+        for (n=1; n<=num_nodes; n++) {
+            UdmNode *src_node = this->getNode(n);
+            for (i=0; i<num_nodes; i++) {
+                if (src_node == dest_nodes[i]) break;
+                if (src_node->getMyRankno() == dest_nodes[i]->getMyRankno()
+                    && src_node->getId() == dest_nodes[i]->getId()) break;
+            }
+            if (i >= num_nodes) return false;
+        }
+
+        return true;
+    }
+
 };
 
 } /* namespace udm */
@@ -24,9 +24,11 @@
 #include "model/UdmZone.h"
 #include "partition/UdmLoadBalance.h"
 #include "utils/UdmSerialization.h"
+#include <pthread.h>
 
 namespace udm
 {
+class UdmCgnsGatherArchive;
 
 /**
  * ベースモデルクラス.
@@ -59,6 +61,7 @@ private:
     MPI_Comm mpi_communicator;        ///< MPIコミュニケータ
     int mpi_rankno;                    ///< MPIランク番号
     int mpi_num_process;            ///< MPIプロセス数
+    int aggregate_rankno;            ///< 集約CGNSファイル出力の集約ランク番号 : -1=未出力
 
     // CGNS:UdmInfo
     std::string udminfo_version;        ///< CGNS:UdmInfo:CGNS出力時のUDMlibのバージョン
@@ -68,6 +71,27 @@ private:
     // partition
     UdmLoadBalance *partition;            ///< ロードバランスクラス
 
+    // 非同期出力
+    pthread_t async_thread;                ///< 非同期出力スレッド
+    pthread_mutex_t async_mutex;        ///< 非同期出力状態の排他制御
+    bool async_pending;                    ///< 非同期出力中フラグ : true=waitModelAsync未実行
+    bool async_threaded;                ///< 非同期出力スレッド起動フラグ
+    bool async_finished;                ///< 非同期出力スレッド終了フラグ
+    UdmError_t async_error;                ///< 非同期出力スレッドのエラー番号
+    int async_step;                        ///< 非同期出力の時系列ステップ数
+    float async_time;                    ///< 非同期出力の時系列ステップ時間
+    bool async_average;                    ///< 非同期出力の平均ステップ設定フラグ
+    int async_average_step;                ///< 非同期出力の平均ステップ数
+    float async_average_time;            ///< 非同期出力の平均ステップ時間
+
+    // CGNS出力作業バッファ
+    double *scratch_buffer;                ///< CGNS出力作業バッファ : 物理量, 節点（ノード）座標値の出力データ配列
+    size_t scratch_size;                ///< CGNS出力作業バッファサイズ(byte)
+
+    // 読込物理量
+    bool load_field_filter;                ///< 読込物理量指定フラグ : true=load_field_namesの物理量のみ読み込む
+    std::vector<std::string> load_field_names;    ///< 読込物理量名称リスト
+
 public:
     UdmModel();
     UdmModel(const std::string &base_name, UdmSize_t base_id);
@@ -98,7 +122,10 @@ public:
 
     // CGNS
     UdmError_t loadModel(const char* dfi_filename, int timeslice_step = -1);
+    UdmError_t loadModel(const char* dfi_filename, const std::vector<std::string> &field_names, int timeslice_step = -1);
     UdmError_t readCgns(const char* cgns_filename, int timeslice_step = -1, const char* element_path = NULL);
+    UdmError_t readCgns(const char* cgns_filename, const std::vector<std::string> &field_names, int timeslice_step = -1, const char* element_path = NULL);
+    bool isLoadSolutionField(const std::string &field_name) const;
     UdmError_t writeTimeSlice(int timeslice_step, float timeslice_time = NAN);
     UdmError_t writeCgnsTimeSliceFile(
                             const char* cgns_filename,
@@ -116,6 +143,13 @@ public:
                             bool grid_timeslice);
     UdmError_t writeModel(int timeslice_step, float timeslice_time);
     UdmError_t writeModel(int timeslice_step, float timeslice_time, int average_step, float average_time);
+    UdmError_t writeModelAsync(int timeslice_step, float timeslice_time);
+    UdmError_t writeModelAsync(int timeslice_step, float timeslice_time, int average_step, float average_time);
+    UdmError_t waitModelAsync();
+    bool testModelAsync();
+    void* getScratchBuffer(size_t size);
+    size_t getScratchBufferSize() const;
+    void releaseScratchBuffer();
     UdmError_t initializeCgnsFile(const char *filename);
     int readCgnsBaseIterativeDatas(
                     int index_file,
@@ -127,6 +161,12 @@ public:
     bool validateCgns() const;
     UdmError_t rebuildModel();
     UdmError_t writeCgnsModel(int timeslice_step, float timeslice_time);
+    UdmError_t writeCgnsAggregateFile(
+                            int timeslice_step,
+                            float timeslice_time,
+                            bool grid_timeslice,
+                            bool write_constsolutions,
+                            bool initialize_cgns);
     UdmError_t initializeTimeSlice();
 
     int getCellDimension() const;
@@ -155,6 +195,10 @@ public:
     UdmError_t broadcastModel();
     UdmError_t transferVirtualCells(std::vector<UdmNode*> &virtual_nodes);
     UdmError_t transferVirtualCells();
+    UdmError_t createHaloExchange();
+    UdmError_t startHaloExchange(const std::vector<std::string> &field_names);
+    UdmError_t finishHaloExchange();
+    UdmError_t reduceBoundaryNodes(const std::vector<std::string> &field_names, UdmReduceType_t reduce_type);
 
     // シリアライズ
     UdmSerializeArchive& serialize(UdmSerializeArchive &archive) const;
@@ -180,14 +224,47 @@ private:
     void initialize();
 
     // CGNS
+    UdmError_t openWriteCgnsFile(const char* cgns_filename, int &index_file);
     UdmError_t writeCgnsBase(const char* cgns_filename, int &index_file, int &index_base);
+    UdmError_t writeCgnsBase(int index_file, int rankno, int &index_base);
+    UdmError_t writeCgnsTimeSliceBase(
+                    int index_file,
+                    const std::vector<UdmZone*> &write_zones,
+                    int rankno,
+                    int timeslice_step,
+                    float timeslice_time,
+                    bool grid_timeslice,
+                    bool write_constsolutions);
+    UdmError_t writeCgnsGatherFile(
+                    const char* cgns_filename,
+                    const MPI_Comm &gather_comm,
+                    int timeslice_step,
+                    float timeslice_time,
+                    bool grid_timeslice,
+                    bool write_constsolutions,
+                    bool initialize_cgns);
+    UdmError_t sendCgnsGatherData(const MPI_Comm &gather_comm, bool write_constsolutions);
+    void postRecvCgnsGatherData(
+                    const MPI_Comm &gather_comm,
+                    int src_rankno,
+                    const long long *header,
+                    UdmCgnsGatherArchive &archive,
+                    std::vector<MPI_Request> &requests);
     UdmError_t writeCgnsIterativeDatas(
                     int index_file,
                     int index_base,
                     int timeslice_step,
                     float timeslice_time,
                     bool write_gridflag);
+    UdmError_t writeCgnsIterativeDatas(
+                    int index_file,
+                    int index_base,
+                    int timeslice_step,
+                    float timeslice_time,
+                    bool write_gridflag,
+                    const std::vector<UdmZone*> &write_zones);
     int getNumCgnsIterativeDatas() const;
+    int getNumCgnsIterativeDatas(const std::vector<UdmZone*> &write_zones) const;
     bool equalsModel(const UdmModel &model) const;
     UdmError_t createModel(UdmSize_t index_base,
                     std::string name_base,
@@ -195,8 +272,16 @@ private:
                     int phys_dim,
                     UdmSimulationType_t simulation_type);
     UdmError_t readCgnsUdmInfo(int index_file, int index_base);
-    UdmError_t writeCgnsUdmInfo(int index_file, int index_base);
+    UdmError_t writeCgnsUdmInfo(int index_file, int index_base, int rankno);
     void closeWriteCgnsFile(int index_file);
+    UdmError_t startModelAsync(
+                    int timeslice_step,
+                    float timeslice_time,
+                    bool average,
+                    int average_step,
+                    float average_time);
+    void joinModelAsync();
+    static void* writeCgnsModelThread(void *arg);
     UdmError_t createComponentCells();
 
 };
@@ -31,8 +31,11 @@ class UdmICellComponent;
  */
 class UdmNode: public UdmEntity
 {
+friend class UdmGridCoordinates;
+friend class UdmMigrationArchive;
 private:
-    UdmCoordsValue *coords;            ///< XYZ座標値
+    UdmCoordsValue *coords;            ///< XYZ座標値 : 親GridCoordinates未設定時のみ保持する
+    UdmSize_t coords_slot;            ///< 親GridCoordinatesのXYZ座標値配列スロット
     UdmGridCoordinates* parent_gridcoordinates;        ///< 親GridCoordinates
     UdmNode *common_node;                ///< 同一節点（ノード）
 
@@ -101,9 +104,14 @@ public:
 private:
     void initialize();
     int compareCoords(const UdmNode &right ) const;
+    bool hasCoordsSlot() const;
+    UdmDataType_t getCoordsDataType() const;
+    void attachCoordsSlot();
+    void detachCoordsSlot();
 
 protected:
     UdmZone* getZone() const;
+    UdmEntityVoxels* getParentVoxels() const;
 
 };
 
@@ -20,6 +20,7 @@
 
 #include "model/UdmGeneral.h"
 #include "model/UdmGlobalRankid.h"
+#include "utils/UdmSearchTable.h"
 
 namespace udm
 {
@@ -51,7 +52,26 @@ private:
     /**
      * ランク番号、ID検索テーブル
      */
-    UdmGlobalRankidList  search_table;
+    UdmSearchTable  search_table;
+
+    /**
+     * 送信データ数送受信用の複製MPIコミュニケータ.
+     * 初回のmpi_exchangeSendCountsにて複製し、デストラクタにて解放する.
+     */
+    MPI_Comm exchange_communicator;
+
+    /**
+     * 送信データ数送受信の呼出回数.
+     * 前回の送受信を終了していない接続先ランクとメッセージが混在しないように、呼出毎に送受信タグを切り替える.
+     */
+    unsigned int exchange_epoch;
+
+    /**
+     * CGNS出力内部境界情報 : {自ランク番号, ノードID, 接続先ランク番号, 接続先ID}の４要素を１組とする.
+     * 集約CGNSファイル出力にて集約ランクが送信元ランクの内部境界情報を出力する為に設定する.
+     * 設定されている場合は内部境界ノードに替えて出力する.
+     */
+    std::vector<int> cgns_rankinfos;
 
 public:
     UdmRankConnectivity();
@@ -76,6 +96,10 @@ public:
     UdmError_t transferVirtualCells(std::vector<UdmNode*>& import_cells);
     UdmError_t transferRankConnectivity();
     UdmError_t exportProcess();
+    UdmError_t mpi_exchangeSendCounts(
+                    const std::map< int, std::vector<int> > &send_counts,
+                    int count_size,
+                    std::map< int, std::vector<int> > &recv_counts);
 
     // Zone
     UdmZone* getParentZone() const;
@@ -85,9 +109,11 @@ public:
     // CGNS
     UdmError_t readCgns(int index_file, int index_base, int index_zone);
     UdmError_t writeCgns(int index_file, int index_base, int index_zone);
+    void createCgnsRankInfos(std::vector<int> &info_array) const;
+    void setCgnsRankInfos(const std::vector<int> &info_array);
     UdmError_t writeRankConnectivity(int index_file, int index_base, int index_zone);
     void eraseRankConnectivity();
-    bool mpi_validateRankConnectivity() const;
+    bool mpi_validateRankConnectivity();
     UdmError_t rebuildRankConnectivity();
 
     // ランク番号,ID検索テーブル
@@ -120,7 +146,7 @@ private:
     UdmError_t updateMpiRankInfo(
                     const std::map< int, UdmGlobalRankidPairList* > &recv_infos);
     unsigned int createSendVirtualCells(std::map< int, std::vector<UdmCell*> > &parent_cells) const;
-    unsigned int getCellsBufferSize(const std::map< int, std::vector<UdmCell*> > &parent_cells, int *buf_sizes) const;
+    unsigned int getCellsBufferSize(const std::map< int, std::vector<UdmCell*> > &parent_cells, std::map<int, int> &buf_sizes) const;
     unsigned int createCellsBuffer(const std::vector<UdmCell*> &parent_cells, char *buf, size_t buf_length) const;
     UdmError_t createImportVirturalCells(
                     int num_cells, char *buf, size_t buf_length,
@@ -133,7 +159,7 @@ private:
     int getMpiProcessSize() const;
     UdmError_t mpi_sendrecvBoundaryInfos(
                     const std::map< int, UdmGlobalRankidPairList* > &send_infos,
-                    std::map< int, UdmGlobalRankidPairList* > &recv_infos) const;
+                    std::map< int, UdmGlobalRankidPairList* > &recv_infos);
     bool isBoundaryNode(const UdmNode* node) const;
 
     // ランク番号,ID検索テーブル
@@ -26,8 +26,10 @@ namespace udm
 class UdmZone;
 class UdmElements;
 class UdmCell;
+class UdmNode;
 class UdmFlowSolutions;
 class UdmComponent;
+class UdmComponentTable;
 
 /**
  * 要素管理クラス.
@@ -61,6 +63,12 @@ private:
      */
     std::vector<UdmComponent*> component_cells;
 
+    /**
+     * 部品要素（セル）検索テーブル.
+     * 部品要素（セル）の一括作成時のみ作成する.
+     */
+    UdmComponentTable *component_table;
+
     /**
      * ゾーン内の最小座標
      */
@@ -121,6 +129,7 @@ public:
     UdmError_t removeComponentCell(UdmSize_t component_cell_id);
     UdmError_t clearComponentCells();
     UdmComponent* findComponentCell(const UdmComponent* component_cell);
+    UdmComponent* findComponentCell(const std::vector<UdmNode*> &component_nodes);
 
     // 要素共通
     UdmError_t removeCell(const UdmCell* cell);
@@ -136,6 +145,8 @@ public:
     UdmError_t writeCgns(int index_file, int index_base, int index_zone, int timeslice_step);
     UdmError_t writeCgnsLinkFile(int index_file, int index_base, int index_zone, const std::string &link_output_path, const std::vector<std::string> &linked_files, int timeslice_step);
     UdmError_t initializeWriteCgns();
+    UdmError_t stageCgnsElements();
+    void clearStagedElements();
     UdmError_t writeVirtualCells(int index_file, int index_base, int index_zone);
     UdmError_t joinCgnsSections(UdmSections *dest_sections);
 
@@ -159,6 +170,14 @@ public:
     UdmError_t setSolutionScalar(UdmSize_t cell_id, const std::string &solution_name, VALUE_TYPE value);
     template <class VALUE_TYPE>
     UdmError_t setSolutionVector(UdmSize_t cell_id, const std::string &solution_name, const VALUE_TYPE* values, unsigned int size = 3);
+    template <class VALUE_TYPE>
+    UdmError_t getSolutionScalar(UdmSize_t cell_id, UdmSize_t field_id, VALUE_TYPE &value) const;
+    template <class VALUE_TYPE>
+    unsigned int getSolutionVector(UdmSize_t cell_id, UdmSize_t field_id, VALUE_TYPE *value)  const;
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionScalar(UdmSize_t cell_id, UdmSize_t field_id, VALUE_TYPE value);
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionVector(UdmSize_t cell_id, UdmSize_t field_id, const VALUE_TYPE* values, unsigned int size = 3);
 
     // 分割重み
     void clearPartitionWeight();
@@ -173,12 +192,17 @@ private:
     void finalize();
     UdmSize_t setEntityCell(UdmSize_t elem_id, UdmCell* cell);
     UdmSize_t insertEntityCell(UdmCell* cell);
+    void clearNeighborGraph();
     UdmError_t rebuildSections();
     UdmFlowSolutions* getFlowSolutions();
     UdmEntity* getEntityById(UdmSize_t entity_id);
     const UdmEntity* getEntityById(UdmSize_t entity_id) const;
     const UdmSolutionFieldConfig* getSolutionFieldConfig(const std::string &solution_name) const;
+    UdmGridLocation_t getSolutionGridLocation() const;
     UdmError_t cloneSections(const UdmSections& src);
+    UdmError_t createComponentCellsParallel(int num_threads);
+    static void partitionIndices(const std::vector<int> &groups, int num_groups, std::vector<UdmSize_t> &group_offsets, std::vector<UdmSize_t> &group_indices);
+    static bool equalsComponentNodes(UdmNode* const src_nodes[], UdmNode* const dest_nodes[], unsigned int num_nodes);
     bool equalsSections(const UdmSections &sections) const;
 
 };
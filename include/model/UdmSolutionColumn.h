@@ -0,0 +1,199 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMSOLUTIONCOLUMN_H_
+#define _UDMSOLUTIONCOLUMN_H_
+
+/**
+ * @file UdmSolutionColumn.h
+ * 物理量カラムデータクラスのヘッダーファイル
+ */
+
+#include "model/UdmGeneral.h"
+#include "model/UdmSolutionData.h"
+#include "utils/UdmSerialization.h"
+
+namespace udm
+{
+
+/**
+ * 物理量カラムデータクラス.
+ * ノード・要素構成クラス(UdmEntityVoxels)が物理量フィールド毎に保持する連続配列.
+ * 節点（ノード）、要素（セル）は格納位置（スロット）のみを保持し、
+ * 物理量データ値はスロット×成分数の位置に格納する.
+ */
+class UdmSolutionColumn: public UdmGeneral
+{
+private:
+    /**
+     * 物理量データ配列 : データ型(datatype)の配列
+     */
+    void *datas;
+
+    /**
+     * 物理量データ設定フラグ : スロット毎の設定有無
+     */
+    std::vector<char> exists_flags;
+
+    /**
+     * 確保スロット数
+     */
+    UdmSize_t capacity;
+
+    /**
+     * 物理量ベクトルデータタイプ
+     */
+    UdmVectorType_t vectortype;
+
+    /**
+     * 物理量成分数 : スロット当たりのデータ数
+     */
+    int nvector_size;
+
+public:
+    UdmSolutionColumn(
+                const std::string &name,
+                UdmDataType_t datatype,
+                UdmVectorType_t vectortype,
+                int nvector_size);
+    virtual ~UdmSolutionColumn();
+
+    UdmVectorType_t getVectorType() const;
+    int getNvectorSize() const;
+    UdmSize_t getCapacity() const;
+    UdmError_t reserveSlots(UdmSize_t size);
+    bool existsSolutionValue(UdmSize_t slot) const;
+    void clearSolutionValue(UdmSize_t slot);
+    void clearSolutionValues();
+    void* getSolutionPointer(UdmSize_t slot);
+    const void* getSolutionPointer(UdmSize_t slot) const;
+    UdmError_t setSolutionPointer(UdmSize_t slot, UdmDataType_t src_datatype, const void* values, unsigned int size);
+    unsigned int getSolutionPointer(UdmSize_t slot, UdmDataType_t dest_datatype, void* values, unsigned int size) const;
+    template<class VALUE_TYPE> VALUE_TYPE getSolutionValue(UdmSize_t slot, int vector_id = 0) const;
+    template<class VALUE_TYPE> unsigned int getSolutionValues(UdmSize_t slot, VALUE_TYPE* values) const;
+    template<class VALUE_TYPE> void setSolutionValue(UdmSize_t slot, VALUE_TYPE value, int vector_id = 0);
+    template<class VALUE_TYPE> void setSolutionValues(UdmSize_t slot, const VALUE_TYPE* values, unsigned int size);
+    template<class VALUE_TYPE> void initializeValue(UdmSize_t slot, VALUE_TYPE value);
+    UdmSerializeArchive& serializeSolutionValue(UdmSerializeArchive &archive, UdmSize_t slot) const;
+    UdmError_t setSolutionData(UdmSize_t slot, const UdmSolutionData *solution_data);
+    UdmSolutionData* factorySolutionData(UdmSize_t slot) const;
+
+    // memory size
+    size_t getMemSize() const;
+
+private:
+    void initialize();
+};
+
+/**
+ * スロットの物理量データ値を取得する.
+ * @param slot            格納スロット（０～）
+ * @param vector_id        成分インデックス（０～）
+ * @return        物理量データ値
+ */
+template<class VALUE_TYPE>
+VALUE_TYPE UdmSolutionColumn::getSolutionValue(UdmSize_t slot, int vector_id) const
+{
+    UdmSize_t pos = slot*this->nvector_size + vector_id;
+    UdmDataType_t datatype = this->getDataType();
+    if (datatype == Udm_RealSingle) {
+        return (VALUE_TYPE)((const float*)this->datas)[pos];
+    }
+    else if (datatype == Udm_RealDouble) {
+        return (VALUE_TYPE)((const double*)this->datas)[pos];
+    }
+    else if (datatype == Udm_Integer) {
+        return (VALUE_TYPE)((const int*)this->datas)[pos];
+    }
+    else if (datatype == Udm_LongInteger) {
+        return (VALUE_TYPE)((const long long*)this->datas)[pos];
+    }
+    return 0;
+}
+
+/**
+ * スロットの物理量データ値リストを取得する.
+ * @param [in]  slot            格納スロット（０～）
+ * @param [out] values        物理量データ値リスト
+ * @return        取得データ数
+ */
+template<class VALUE_TYPE>
+unsigned int UdmSolutionColumn::getSolutionValues(UdmSize_t slot, VALUE_TYPE* values) const
+{
+    int n;
+    for (n=0; n<this->nvector_size; n++) {
+        values[n] = this->getSolutionValue<VALUE_TYPE>(slot, n);
+    }
+    return this->nvector_size;
+}
+
+/**
+ * スロットに物理量データ値を設定する.
+ * @param slot            格納スロット（０～）
+ * @param value            物理量データ値
+ * @param vector_id        成分インデックス（０～）
+ */
+template<class VALUE_TYPE>
+void UdmSolutionColumn::setSolutionValue(UdmSize_t slot, VALUE_TYPE value, int vector_id)
+{
+    UdmSize_t pos = slot*this->nvector_size + vector_id;
+    UdmDataType_t datatype = this->getDataType();
+    if (datatype == Udm_RealSingle) {
+        ((float*)this->datas)[pos] = (float)value;
+    }
+    else if (datatype == Udm_RealDouble) {
+        ((double*)this->datas)[pos] = (double)value;
+    }
+    else if (datatype == Udm_Integer) {
+        ((int*)this->datas)[pos] = (int)value;
+    }
+    else if (datatype == Udm_LongInteger) {
+        ((long long*)this->datas)[pos] = (long long)value;
+    }
+    this->exists_flags[slot] = 1;
+}
+
+/**
+ * スロットに物理量データ値リストを設定する.
+ * 成分数を超えるデータは設定しない.
+ * @param slot            格納スロット（０～）
+ * @param values        物理量データ値リスト
+ * @param size            物理量データ数
+ */
+template<class VALUE_TYPE>
+void UdmSolutionColumn::setSolutionValues(UdmSize_t slot, const VALUE_TYPE* values, unsigned int size)
+{
+    unsigned int n;
+    if (size > (unsigned int)this->nvector_size) size = this->nvector_size;
+    for (n=0; n<size; n++) {
+        this->setSolutionValue<VALUE_TYPE>(slot, values[n], n);
+    }
+    this->exists_flags[slot] = 1;
+}
+
+/**
+ * スロットのすべての成分に物理量データ初期値を設定する.
+ * @param slot            格納スロット（０～）
+ * @param value            物理量データ初期値
+ */
+template<class VALUE_TYPE>
+void UdmSolutionColumn::initializeValue(UdmSize_t slot, VALUE_TYPE value)
+{
+    int n;
+    for (n=0; n<this->nvector_size; n++) {
+        this->setSolutionValue<VALUE_TYPE>(slot, value, n);
+    }
+}
+
+} /* namespace udm */
+
+#endif /* _UDMSOLUTIONCOLUMN_H_ */
@@ -28,6 +28,9 @@
 #include "model/UdmUserDefinedDatas.h"
 #include "model/UdmCell.h"
 #include "model/UdmNode.h"
+#include "utils/UdmNeighborGraph.h"
+#include "model/UdmHaloExchange.h"
+#include "model/UdmBoundaryReduction.h"
 
 namespace udm
 {
@@ -61,6 +64,29 @@ private:
      */
     UdmRankConnectivity  *inner_boundary;
 
+    /**
+     * 節点（ノード）、要素（セル）、部品要素（セル）のメモリプール
+     */
+    UdmEntityPool *entity_pool;
+
+    /**
+     * 隣接要素（セル）、隣接節点（ノード）のCSRグラフ.
+     * 初回参照時に作成して、ゾーンの再構築時に破棄する.
+     */
+    UdmNeighborGraph *neighbor_graph;
+
+    /**
+     * 仮想要素（セル）, 仮想節点（ノード）の物理量交換計画.
+     * createHaloExchangeにて作成して、ゾーンの再構築時に破棄する.
+     */
+    UdmHaloExchange *halo_exchange;
+
+    /**
+     * 内部境界節点（ノード）の物理量集約計画.
+     * 初回の集約時に作成して、ゾーンの再構築時に破棄する.
+     */
+    UdmBoundaryReduction *boundary_reduction;
+
     /**
      * 分割重み設定フラグ
      * true = 分割重み設定
@@ -84,8 +110,13 @@ public:
     UdmFlowSolutions* getFlowSolutions() const;
     // UdmUserDefinedDatas
     UdmUserDefinedDatas* getUserDefinedDatas() const;
+    UdmEntityPool* getEntityPool() const;
+    // 物理量データ格納タイプ
+    UdmSolutionStorageType_t getSolutionStorageType() const;
+    UdmError_t setSolutionStorageType(UdmSolutionStorageType_t storage_type);
     // UdmModel
     UdmModel* getParentModel() const;
+    void* getScratchBuffer(size_t size) const;
     UdmError_t setParentModel(UdmModel *model);
 
     // CGNS
@@ -110,6 +141,8 @@ public:
                             int index_file,
                             int index_base);
     UdmError_t initializeWriteCgns();
+    UdmError_t stageWriteCgns();
+    void clearStagedWriteCgns();
     int getNumCgnsIterativeDatas() const;
     UdmError_t writeCgnsIterativeDatas(int index_file, int index_base, int timeslice_step);
     int getCellDimension() const;
@@ -171,6 +204,14 @@ public:
     UdmError_t setSolutionScalarInNode(UdmSize_t node_id, const std::string &solution_name, VALUE_TYPE value);
     template <class VALUE_TYPE>
     UdmError_t setSolutionVectorInNode(UdmSize_t node_id, const std::string &solution_name, const VALUE_TYPE* values, unsigned int size = 3);
+    template <class VALUE_TYPE>
+    UdmError_t getSolutionScalarInNode(UdmSize_t node_id, UdmSize_t field_id, VALUE_TYPE &value) const;
+    template <class VALUE_TYPE>
+    unsigned int getSolutionVectorinNode(UdmSize_t node_id, UdmSize_t field_id, VALUE_TYPE *value)  const;
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionScalarInNode(UdmSize_t node_id, UdmSize_t field_id, VALUE_TYPE value);
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionVectorInNode(UdmSize_t node_id, UdmSize_t field_id, const VALUE_TYPE* values, unsigned int size = 3);
 
     // 要素（セル）
     UdmSize_t getNumCells() const;
@@ -184,19 +225,45 @@ public:
     UdmError_t setSolutionScalarInCell(UdmSize_t cell_id, const std::string &solution_name, VALUE_TYPE value);
     template <class VALUE_TYPE>
     UdmError_t setSolutionVectorInCell(UdmSize_t cell_id, const std::string &solution_name, const VALUE_TYPE* values, unsigned int size = 3);
+    template <class VALUE_TYPE>
+    UdmError_t getSolutionScalarInCell(UdmSize_t cell_id, UdmSize_t field_id, VALUE_TYPE &value) const;
+    template <class VALUE_TYPE>
+    unsigned int getSolutionVectorInCell(UdmSize_t cell_id, UdmSize_t field_id, VALUE_TYPE *value)  const;
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionScalarInCell(UdmSize_t cell_id, UdmSize_t field_id, VALUE_TYPE value);
+    template <class VALUE_TYPE>
+    UdmError_t setSolutionVectorInCell(UdmSize_t cell_id, UdmSize_t field_id, const VALUE_TYPE* values, unsigned int size = 3);
 
     // 接続要素（セル）
     int getNumConnectivityCells(UdmSize_t node_id) const;
     UdmCell* getConnectivityCell(UdmSize_t node_id, int connectivity_id) const;
+    UdmSize_t getConnectivityCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const;
     // 接続節点（ノード）
     int getNumConnectivityNodes(UdmSize_t cell_id) const;
     UdmNode* getConnectivityNode(UdmSize_t cell_id, int connectivity_id) const;
     // 隣接要素（セル）
     int getNumNeighborCells(UdmSize_t cell_id) const;
     UdmCell* getNeighborCell(UdmSize_t cell_id, int neighbor_id) const;
+    UdmSize_t getNeighborCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const;
     // 隣接節点（ノード）
     int getNumNeighborNodes(UdmSize_t node_id) const;
     UdmNode* getNeighborNode(UdmSize_t node_id, int neighbor_id) const;
+    UdmSize_t getNeighborNodesGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const;
+    void clearNeighborGraph();
+
+    // 仮想要素（セル）物理量交換
+    UdmHaloExchange* getHaloExchange() const;
+    UdmError_t createHaloExchange();
+    void clearHaloExchange();
+    UdmError_t startHaloExchange(const std::vector<std::string> &field_names);
+    UdmError_t finishHaloExchange();
+
+    // 内部境界節点（ノード）物理量集約
+    UdmBoundaryReduction* getBoundaryReduction() const;
+    void clearBoundaryReduction();
+    UdmError_t reduceBoundaryNodes(
+                    const std::vector<std::string> &field_names,
+                    UdmReduceType_t reduce_type);
 
     // 分割重み
     bool isSetPartitionWeight() const;
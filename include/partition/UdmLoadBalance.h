@@ -128,36 +128,6 @@ public:
                         int wgt_dim,
                         float *ewgts,
                         int *ierr);
-    static void zoltan_obj_size_multi (
-                        void *data,
-                        int num_gid_entries,
-                        int num_lid_entries,
-                        int num_ids,
-                        ZOLTAN_ID_PTR global_ids,
-                        ZOLTAN_ID_PTR local_ids,
-                        int *sizes,
-                        int *ierr);
-    static void zoltan_pack_obj_multi(
-                        void *data,
-                        int num_gid_entries,
-                        int num_lid_entries,
-                        int num_ids,
-                        ZOLTAN_ID_PTR global_ids,
-                        ZOLTAN_ID_PTR local_ids,
-                        int *dest,
-                        int *sizes,
-                        int *idx,
-                        char *buf,
-                        int *ierr);
-    static void zoltan_unpack_obj_multi (
-                        void *data,
-                        int num_gid_entries,
-                        int num_ids,
-                        ZOLTAN_ID_PTR global_ids,
-                        int *sizes,
-                        int *idx,
-                        char *buf,
-                        int *ierr);
 #endif
 
 private:
@@ -177,6 +147,14 @@ private:
                     int numExport,
                     ZOLTAN_ID_PTR exportGlobalGids,
                     int *exportProcs);
+    UdmError_t migrateCells(
+                    UdmScannerCells *scanner,
+                    int numGidEntries,
+                    int numImport,
+                    int *importProcs,
+                    int numExport,
+                    ZOLTAN_ID_PTR exportGlobalGids,
+                    int *exportProcs);
 #endif        /* WITHOUT_MPI */
     UdmError_t getWriteDfiFilePath(std::string &filename) const;
     UdmError_t rebuildZone(UdmScannerCells *scanner);
@@ -0,0 +1,148 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMMIGRATIONPIPELINE_H_
+#define _UDMMIGRATIONPIPELINE_H_
+
+/**
+ * @file UdmMigrationPipeline.h
+ * 分割転送パイプラインクラスのヘッダーファイル
+ */
+
+#include <list>
+#include "UdmBase.h"
+
+namespace udm
+{
+class UdmZone;
+class UdmCell;
+class UdmMigrationArchive;
+
+/**
+ * 分割転送パイプラインクラス.
+ * 転送要素（セル）を転送先ランク別にチャンク（UdmMigrationArchive）に分けてシリアライズし、
+ * 非同期送受信にて順次転送する.
+ * 受信済みのチャンクのデシリアライズは後続チャンクの受信中に行う.
+ * 同時に保持する送信チャンク、受信チャンクのバッファサイズの合計は送受信バッファ上限サイズ以下とする.
+ * 送信チャンク、受信チャンクをそれぞれ上限サイズの1/2まで保持し、チャンクサイズは上限サイズの1/4とする.
+ * チャンクの送信前にチャンクサイズ、送信元ランク番号のヘッダを送信し、受信側はヘッダにて受信バッファを確保する.
+ * 転送先ランクへの最後のチャンクの後に終了メッセージ（サイズ0のヘッダ）を送信する.
+ * ヘッダの受信は常に１つ開始しておき、送受信が進まない場合はMPI_Waitsomeにて通信の完了を待つ.
+ * インポート要素（セル）は受信順に依らず、受信元ランク番号順、チャンク順とする.
+ */
+class UdmMigrationPipeline
+{
+private:
+    /**
+     * 送信チャンク
+     */
+    struct UdmMigrationSendChunk
+    {
+        int rankno;                            ///< 転送先ランク番号
+        UdmMigrationArchive *archive;        ///< 送信データ : NULL=終了メッセージ
+        long long header[2];                ///< ヘッダ : [0]=チャンクサイズ(byte), [1]=送信元ランク番号
+        MPI_Request requests[2];            ///< 通信リクエスト : [0]=ヘッダ, [1]=チャンク
+    };
+
+    /**
+     * 受信チャンク
+     */
+    struct UdmMigrationRecvChunk
+    {
+        int rankno;                            ///< 受信元ランク番号
+        std::vector<char> buffer;            ///< 受信バッファ
+        MPI_Request request;                ///< 通信リクエスト
+    };
+
+    /**
+     * 受信チャンクヘッダ
+     */
+    struct UdmMigrationRecvHeader
+    {
+        int rankno;                            ///< 受信元ランク番号
+        size_t size;                        ///< チャンクサイズ(byte)
+    };
+
+    MPI_Comm mpi_communicator;            ///< MPIコミュニケータ : 分割転送用の複製コミュニケータ
+    int mpi_rankno;                        ///< MPIランク番号
+    size_t memory_size;                    ///< 送受信バッファ上限サイズ(byte)
+    size_t chunk_size;                    ///< チャンクサイズ(byte)
+    const UdmZone *zone;                ///< 転送元ゾーン
+
+    // 送信
+    std::vector<int> send_ranks;                            ///< 転送先ランク番号
+    std::vector< const std::vector<UdmCell*>* > send_cells;    ///< 転送先ランク別の転送要素（セル）
+    std::vector<size_t> send_positions;                        ///< 転送先ランク別の送信済み要素（セル）数
+    std::vector<bool> send_finished;                        ///< 転送先ランク別の終了メッセージ送信済みフラグ
+    size_t next_send;                                        ///< 次のチャンクを作成する転送先ランクインデックス
+    std::list<UdmMigrationSendChunk> send_chunks;            ///< 送信中チャンク
+    size_t send_inflight;                                    ///< 送信中チャンクのバッファサイズ(byte)
+    double cell_size;                                        ///< 要素（セル）あたりのシリアライズサイズの推定値(byte)
+    long long packed_size;                                    ///< シリアライズ済みサイズ(byte)
+    long long packed_cells;                                    ///< シリアライズ済み要素（セル）数
+
+    // 受信
+    std::set<int> recv_ranks;                                ///< 終了メッセージ未受信の受信元ランク番号
+    long long recv_header[2];                                ///< 受信中ヘッダ
+    MPI_Request header_request;                                ///< ヘッダの通信リクエスト
+    bool header_posted;                                        ///< ヘッダ受信開始済みフラグ
+    std::list<UdmMigrationRecvHeader> recv_headers;            ///< 受信開始待ちチャンクヘッダ
+    std::list<UdmMigrationRecvChunk> recv_chunks;            ///< 受信中チャンク
+    size_t recv_inflight;                                    ///< 受信中チャンクのバッファサイズ(byte)
+    std::map< int, std::vector<UdmCell*> > recv_cells;        ///< 受信元ランク別のインポート要素（セル）
+
+    // 転送情報
+    int num_send_chunks;                ///< 送信チャンク数
+    int num_recv_chunks;                ///< 受信チャンク数
+    long long send_size;                ///< 送信データサイズ(byte)
+    long long recv_size;                ///< 受信データサイズ(byte)
+    size_t max_inflight;                ///< 送受信チャンクの最大保持サイズ(byte)
+    bool progressed;                    ///< 送受信進行フラグ : false=今回の処理にて送受信が進まなかった
+
+public:
+    UdmMigrationPipeline();
+    UdmMigrationPipeline(size_t memory_size);
+    virtual ~UdmMigrationPipeline();
+
+    size_t getMemorySize() const;
+    void setMemorySize(size_t memory_size);
+    size_t getChunkSize() const;
+    UdmError_t migrateCells(
+                    MPI_Comm comm,
+                    const UdmZone *zone,
+                    const std::map< int, std::vector<UdmCell*> > &export_cells,
+                    const std::set<int> &import_ranks,
+                    std::vector<UdmCell*> &import_cells);
+
+    // 転送情報
+    int getNumSendChunks() const;
+    int getNumRecvChunks() const;
+    long long getSendSize() const;
+    long long getRecvSize() const;
+    size_t getMaxInflightSize() const;
+
+private:
+    void initialize();
+    void clear();
+    UdmError_t postSendChunks();
+    UdmError_t packChunk(size_t send_id, UdmMigrationArchive *archive);
+    void completeSendChunks();
+    void postRecvHeader();
+    void postRecvChunks();
+    UdmError_t unpackRecvChunks();
+    void waitChunks();
+    bool isFinished() const;
+};
+
+} /* namespace udm */
+
+#endif /* _UDMMIGRATIONPIPELINE_H_ */
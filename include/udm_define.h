@@ -71,6 +71,7 @@ typedef  int        UdmInteger_t;
 #define UDM_CGNS_FORMAT_ELEMENTS    "UdmElements_%s"
 #define UDM_CGNS_FORMAT_FLOWSOLUTION_VERTEX    "UdmSol_Node_%010d"
 #define UDM_CGNS_FORMAT_FLOWSOLUTION_CELLCENTER    "UdmSol_Cell_%010d"
+#define UDM_CGNS_FORMAT_RANKBASE    "UdmBase_id%06d"        ///< 集約CGNSファイルのランク毎のCGNS:Base名
 
 // DFI
 #define UDM_DFI_FILENAME_INDEX         "index.dfi"        ///< DFIファイル名:index.dfi
@@ -121,11 +122,14 @@ typedef  int        UdmInteger_t;
 #define UDM_DFI_PROCESS            "Process"            ///< プロセス情報
 #define UDM_DFI_RANK            "Rank"                ///< プロセス別情報
 #define UDM_DFI_ID                "ID"                ///< ランク番号
+#define UDM_DFI_FILEID            "FileID"            ///< 集約CGNSファイルのランク番号
+#define UDM_DFI_DIRECTORY        "Directory"            ///< CGNSファイルのプロセスディレクトリ
 // udmlib.tp
 #define UDM_DFI_UDMLIB            "UDMlib"            ///< UDMlib設定項目
 #define UDM_DFI_DEBUG_LEVEL        "DEBUG_LEVEL"        ///< Zoltan:デバッグレベル
 #define UDM_DFI_PARTITION        "partition"            ///< 分割情報
 #define UDM_DFI_MxM_PARTITION    "MxM_PARTITION"        ///< 分割数が同じ場合の分割実行
+#define UDM_DFI_MIGRATION_MEMORY_SIZE    "MIGRATION_MEMORY_SIZE"        ///< 分割転送の送受信バッファ上限サイズ(byte)
 // DFI:write
 #define UDM_DFI_INDENT         "    "        ///< DFIファイル出力インデント
 // index.dfi/FileInfo/フォーマット
@@ -148,9 +152,18 @@ typedef  int        UdmInteger_t;
 #define UDM_DFI_FILEFORMAT_NONE        "%s.%s"        ///< CGNS:ファイルフォーマット
 #define UDM_DFI_FORMAT_TIMESLICE        "%010d"        ///< 時系列ステップ番号フォーマット
 #define UDM_DFI_FORMAT_PROCESS        "id%06d"        ///< プロセス番号フォーマット
+#define UDM_DFI_FORMAT_PROCESSDIRECTORY        "rank%06d"        ///< プロセスディレクトリフォーマット
 
-// Zoltan:Migrate
-#define UDM_MIGRATION_MAXSIZE         0x40000000    ///< Zoltan:Migrate転送最大サイズ : INT_MAX以下とすること
+// 分割転送
+#define UDM_MIGRATION_MAXSIZE         0x40000000    ///< 分割転送の１メッセージの最大サイズ : INT_MAX以下とすること
+#define UDM_MIGRATION_MEMORY_SIZE     0x40000000    ///< 分割転送の送受信バッファ上限サイズのデフォルト値(byte)
+#define UDM_MIGRATION_HEADER_TAG      0x10          ///< 分割転送のチャンクヘッダのMPIタグ
+#define UDM_MIGRATION_CHUNK_TAG       0x11          ///< 分割転送のチャンクデータのMPIタグ
+
+// CGNS集約出力
+#define UDM_CGNS_GATHER_MAXSIZE       0x40000000    ///< CGNS集約出力の１メッセージの最大サイズ : INT_MAX以下とすること
+#define UDM_CGNS_GATHER_HEADER_TAG    0x12          ///< CGNS集約出力のヘッダのMPIタグ
+#define UDM_CGNS_GATHER_CHUNK_TAG     0x13          ///< CGNS集約出力の出力データのMPIタグ
 
 
 #endif /* _UDM_DEFINE_H_ */
@@ -79,6 +79,9 @@ typedef struct MPI_Status {
 /* MPI request opjects */
 typedef int MPI_Request;
 
+/* Point-to-point source */
+#define MPI_ANY_SOURCE     (-2)
+
 /* Collective operations */
 typedef int MPI_Op;
 
@@ -152,6 +155,21 @@ inline int udm_mpi_initialized(int *flag)
 #endif
 }
 
+/**
+ * MPI終了済みであるかチェックする.
+ * @param [out] flag        true:MPI終了済み
+ * @return
+ */
+inline int udm_mpi_finalized(int *flag)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Finalized(flag);
+#else
+    *flag = 0;
+    return MPI_SUCCESS;
+#endif
+}
+
 /**
  * MPIランク番号を取得する.
  * @param [in]  comm        MPIコミュニケータ
@@ -416,6 +434,125 @@ inline  int udm_mpi_isend(void *buf, int count, MPI_Datatype datatype, int dest,
 #endif
 }
 
+/**
+ * MPI同期送信（ノンブロッキング通信）を行う。
+ * 受信側にて受信が開始された時点で完了する.
+ * @param buf        送信するデータ
+ * @param count        データの個数
+ * @param datatype        データ型
+ * @param dest        送信先プロセスのランク
+ * @param tag            タグ（メッセージ識別番号）
+ * @param comm        MPIコミュニケータ
+ * @param request        通信リクエスト
+ * @return        成否
+ */
+inline  int udm_mpi_issend(void *buf, int count, MPI_Datatype datatype, int dest,
+                             int tag, MPI_Comm comm, MPI_Request *request)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Issend(buf, count, datatype, dest, tag, comm, request);
+#else
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * 受信メッセージの有無を確認する（ノンブロッキング）.
+ * @param source        送信元プロセスのランク : MPI_ANY_SOURCE
+ * @param tag            タグ（メッセージ識別番号）
+ * @param comm        MPIコミュニケータ
+ * @param flag        受信メッセージ有無 : 1=受信メッセージあり
+ * @param status        送信プロセスの情報
+ * @return        成否
+ */
+inline  int udm_mpi_iprobe(int source, int tag, MPI_Comm comm, int *flag, MPI_Status *status)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Iprobe(source, tag, comm, flag, status);
+#else
+    *flag = 0;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPI受信（ブロッキング通信）を行う。
+ * @param buf        受信するデータ
+ * @param count        データの個数
+ * @param datatype        データ型
+ * @param source        送信元プロセスのランク
+ * @param tag            タグ（メッセージ識別番号）
+ * @param comm        MPIコミュニケータ
+ * @param status        送信プロセスの情報
+ * @return        成否
+ */
+inline  int udm_mpi_recv(void *buf, int count, MPI_Datatype datatype, int source,
+                             int tag, MPI_Comm comm, MPI_Status *status)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Recv(buf, count, datatype, source, tag, comm, status);
+#else
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPI送信（ブロッキング通信）を行う。
+ * @param buf        送信するデータ
+ * @param count        データの個数
+ * @param datatype        データ型
+ * @param dest        送信先プロセスのランク
+ * @param tag            タグ（メッセージ識別番号）
+ * @param comm        MPIコミュニケータ
+ * @return        成否
+ */
+inline  int udm_mpi_send(void *buf, int count, MPI_Datatype datatype, int dest,
+                             int tag, MPI_Comm comm)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Send(buf, count, datatype, dest, tag, comm);
+#else
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * 共有メモリ（計算ノード）単位でMPIコミュニケータを分割する.
+ * MPI-2以前の場合は分割を行わず、１つのコミュニケータとする.
+ * @param comm        分割元MPIコミュニケータ
+ * @param key        分割後のランク順序
+ * @param newcomm        分割MPIコミュニケータ
+ * @return        成否
+ */
+inline int udm_mpi_comm_split_type(MPI_Comm comm, int key, MPI_Comm *newcomm)
+{
+#ifndef WITHOUT_MPI
+#if MPI_VERSION >= 3
+    return MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, newcomm);
+#else
+    return MPI_Comm_split(comm, 0, key, newcomm);
+#endif
+#else
+    *newcomm = comm;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPIコミュニケータを解放する.
+ * @param comm        MPIコミュニケータ
+ * @return        成否
+ */
+inline int udm_mpi_comm_free(MPI_Comm *comm)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Comm_free(comm);
+#else
+    *comm = MPI_COMM_NULL;
+    return MPI_SUCCESS;
+#endif
+}
+
 /**
  * MPI確認（ノンブロッキング通信）を行う.
  * @param count            通信リクエスト数
@@ -433,6 +570,181 @@ inline  int udm_mpi_waitall(int count, MPI_Request *array_of_requests,
 #endif
 }
 
+/**
+ * ノンブロッキング通信の完了を確認する.
+ * @param request            通信リクエスト
+ * @param flag            完了フラグ : 1=完了
+ * @param status            送信プロセスの情報
+ * @return        成否
+ */
+inline  int udm_mpi_test(MPI_Request *request, int *flag, MPI_Status *status)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Test(request, flag, status);
+#else
+    *flag = 1;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * 複数のノンブロッキング通信の完了を確認する.
+ * @param count            通信リクエスト数
+ * @param array_of_requests            通信リクエスト
+ * @param flag            完了フラグ : 1=すべて完了
+ * @param array_of_statuses            送信プロセスの情報
+ * @return        成否
+ */
+inline  int udm_mpi_testall(int count, MPI_Request *array_of_requests,
+                               int *flag, MPI_Status *array_of_statuses)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Testall(count, array_of_requests, flag, array_of_statuses);
+#else
+    *flag = 1;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * 複数のノンブロッキング通信のいずれかの完了を待つ.
+ * 完了した通信リクエストはMPI_REQUEST_NULLとなる.
+ * @param incount            通信リクエスト数
+ * @param array_of_requests            通信リクエスト
+ * @param outcount            完了した通信リクエスト数
+ * @param array_of_indices            完了した通信リクエストのインデックス
+ * @param array_of_statuses            送信プロセスの情報
+ * @return        成否
+ */
+inline  int udm_mpi_waitsome(int incount, MPI_Request *array_of_requests,
+                               int *outcount, int *array_of_indices,
+                               MPI_Status *array_of_statuses)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Waitsome(incount, array_of_requests, outcount, array_of_indices, array_of_statuses);
+#else
+    int i;
+    for (i=0; i<incount; i++) {
+        array_of_requests[i] = MPI_REQUEST_NULL;
+        array_of_indices[i] = i;
+    }
+    *outcount = incount;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * バリア同期（ノンブロッキング通信）を開始する.
+ * MPI-2以前の場合はブロッキングのバリア同期を行う.
+ * @param comm        MPIコミュニケータ
+ * @param request        通信リクエスト
+ * @return        成否
+ */
+inline  int udm_mpi_ibarrier(MPI_Comm comm, MPI_Request *request)
+{
+#ifndef WITHOUT_MPI
+#if MPI_VERSION >= 3
+    return MPI_Ibarrier(comm, request);
+#else
+    *request = MPI_REQUEST_NULL;
+    return MPI_Barrier(comm);
+#endif
+#else
+    *request = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPI永続送信リクエストを作成する.
+ * @param buf        送信するデータ
+ * @param count        データの個数
+ * @param datatype        データ型
+ * @param dest        送信先プロセスのランク
+ * @param tag            タグ（メッセージ識別番号）
+ * @param comm        MPIコミュニケータ
+ * @param request        通信リクエスト
+ * @return        成否
+ */
+inline  int udm_mpi_send_init(void *buf, int count, MPI_Datatype datatype, int dest,
+                             int tag, MPI_Comm comm, MPI_Request *request)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Send_init(buf, count, datatype, dest, tag, comm, request);
+#else
+    *request = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPI永続受信リクエストを作成する.
+ * @param buf        受信するデータ
+ * @param count        データの個数
+ * @param datatype        データ型
+ * @param source        送信元プロセスのランク
+ * @param tag            タグ（メッセージ識別番号）
+ * @param comm        MPIコミュニケータ
+ * @param request        通信リクエスト
+ * @return        成否
+ */
+inline  int udm_mpi_recv_init(void *buf, int count, MPI_Datatype datatype, int source,
+                             int tag, MPI_Comm comm, MPI_Request *request)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Recv_init(buf, count, datatype, source, tag, comm, request);
+#else
+    *request = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPI永続通信リクエストを開始する.
+ * @param count            通信リクエスト数
+ * @param array_of_requests            通信リクエスト
+ * @return        成否
+ */
+inline  int udm_mpi_startall(int count, MPI_Request *array_of_requests)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Startall(count, array_of_requests);
+#else
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPI通信リクエストを解放する.
+ * @param request            通信リクエスト
+ * @return        成否
+ */
+inline  int udm_mpi_request_free(MPI_Request *request)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Request_free(request);
+#else
+    *request = MPI_REQUEST_NULL;
+    return MPI_SUCCESS;
+#endif
+}
+
+/**
+ * MPIコミュニケータを複製する.
+ * @param comm        複製元MPIコミュニケータ
+ * @param newcomm        複製MPIコミュニケータ
+ * @return        成否
+ */
+inline int udm_mpi_comm_dup(MPI_Comm comm, MPI_Comm *newcomm)
+{
+#ifndef WITHOUT_MPI
+    return MPI_Comm_dup(comm, newcomm);
+#else
+    *newcomm = comm;
+    return MPI_SUCCESS;
+#endif
+}
+
 /**
  * MPIグループを取得する.
  * @param comm        MPIコミュニケータ
@@ -65,11 +65,13 @@ typedef enum {    Udm_DataTypeUnknown,
 
 /**
  * CGNSファイル構成タイプ
+ * Udm_AggregateFile : 計算ノード毎の集約ランクに出力データを集約し、計算ノード毎に１つのCGNSファイルを出力する.
  */
 typedef enum {    Udm_FileCompositionTypeUnknown,
                 Udm_IncludeGrid, Udm_ExcludeGrid,
                 Udm_AppendStep, Udm_EachStep,
-                Udm_GridConstant, Udm_GridTimeSlice
+                Udm_GridConstant, Udm_GridTimeSlice,
+                Udm_AggregateFile
 } UdmFileCompositionType_t;
 
 /**
@@ -101,6 +103,17 @@ typedef enum {  Udm_VectorTypeUnknown = 0,     ///< 不明
 } UdmVectorType_t;
 
 
+/**
+ * 内部境界節点（ノード）物理量集約演算タイプ
+ */
+typedef enum {  Udm_ReduceTypeUnknown = 0,     ///< 不明
+                Udm_ReduceSum = 1,             ///< 総和
+                Udm_ReduceMin = 2,             ///< 最小値
+                Udm_ReduceMax = 3,             ///< 最大値
+                Udm_ReduceOwner = 4            ///< 実体ランク（共有ランクの最小ランク番号）の値
+} UdmReduceType_t;
+
+
 /**
  * 要素形状タイプ
  */
@@ -165,6 +178,15 @@ typedef enum {
     Udm_ComponentClass        ///< 部品要素（セル）クラス
 } UdmCellClass_t;
 
+/**
+ * 物理量データ格納タイプ
+ */
+typedef enum {
+    Udm_SolutionStorageUnknown,     ///< 未定
+    Udm_EntitySolutionStorage,      ///< 節点（ノード）、要素（セル）毎の物理量データオブジェクト
+    Udm_ColumnSolutionStorage       ///< 物理量フィールド毎の連続配列（カラム）
+} UdmSolutionStorageType_t;
+
 /**
  * UDMlibライブラリのバージョンを取得する
  * @param [out] version        UDMlibライブラリのバージョン
@@ -195,12 +217,21 @@ UdmHanler_t udm_create_model();
 void udm_delete_model(UdmHanler_t udm_handler);
 UdmError_t udm_rebuild_model(UdmHanler_t udm_handler);
 UdmError_t udm_transfer_virtualcells(UdmHanler_t udm_handler);
+UdmError_t udm_create_halo_exchange(UdmHanler_t udm_handler);
+UdmError_t udm_start_halo_exchange(UdmHanler_t udm_handler, const char* const* field_names, int num_fields);
+UdmError_t udm_finish_halo_exchange(UdmHanler_t udm_handler);
+UdmError_t udm_reduce_boundary_nodes(UdmHanler_t udm_handler, const char* const* field_names, int num_fields, UdmReduceType_t reduce_type);
 
 // CGNS
 UdmError_t udm_load_model(UdmHanler_t udm_handler, const char* dfi_filename, int timeslice_step);
+UdmError_t udm_load_model_fields(UdmHanler_t udm_handler, const char* dfi_filename, int timeslice_step, const char* const* field_names, int num_fields);
 UdmError_t udm_read_cgns(UdmHanler_t udm_handler, const char* cgns_filename, int timeslice_step);
 UdmError_t udm_write_model(UdmHanler_t udm_handler, int timeslice_step, float timeslice_time);
 UdmError_t udm_write_model_average(UdmHanler_t udm_handler, int timeslice_step, float timeslice_time, int average_step, float average_time);
+UdmError_t udm_write_model_async(UdmHanler_t udm_handler, int timeslice_step, float timeslice_time);
+UdmError_t udm_write_model_average_async(UdmHanler_t udm_handler, int timeslice_step, float timeslice_time, int average_step, float average_time);
+UdmError_t udm_wait_model_async(UdmHanler_t udm_handler);
+bool udm_test_model_async(UdmHanler_t udm_handler);
 int udm_create_zone(UdmHanler_t udm_handler);
 int udm_getnum_zones(UdmHanler_t udm_handler);
 int udm_create_section(UdmHanler_t udm_handler, int zone_id, UdmElementType_t element_type);
@@ -237,6 +268,23 @@ UdmError_t udm_set_cellsolution_integer(UdmHanler_t udm_handler, int zone_id, Ud
 UdmError_t udm_set_cellsolution_real(   UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, const char *solution_name, UdmReal_t value);
 UdmError_t udm_get_cellsolution_integer(UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, const char *solution_name, UdmInteger_t *value);
 UdmError_t udm_get_cellsolution_real(   UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, const char *solution_name, UdmReal_t *value);
+UdmSize_t udm_get_solutionfieldid(UdmHanler_t udm_handler, int zone_id, const char *solution_name);
+UdmError_t udm_set_nodesolutions_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, const UdmInteger_t *values, int size);
+UdmError_t udm_set_nodesolutions_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, const UdmReal_t *values, int size);
+UdmError_t udm_get_nodesolutions_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, UdmInteger_t *values, int *size);
+UdmError_t udm_get_nodesolutions_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, UdmReal_t *values, int *size);
+UdmError_t udm_set_nodesolution_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, UdmInteger_t value);
+UdmError_t udm_set_nodesolution_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, UdmReal_t value);
+UdmError_t udm_get_nodesolution_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, UdmInteger_t *value);
+UdmError_t udm_get_nodesolution_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t node_id, UdmSize_t field_id, UdmReal_t *value);
+UdmError_t udm_set_cellsolutions_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, const UdmInteger_t *values, int size);
+UdmError_t udm_set_cellsolutions_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, const UdmReal_t *values, int size);
+UdmError_t udm_get_cellsolutions_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, UdmInteger_t *values, int *size);
+UdmError_t udm_get_cellsolutions_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, UdmReal_t *values, int *size);
+UdmError_t udm_set_cellsolution_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, UdmInteger_t value);
+UdmError_t udm_set_cellsolution_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, UdmReal_t value);
+UdmError_t udm_get_cellsolution_integer_byfield(UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, UdmInteger_t *value);
+UdmError_t udm_get_cellsolution_real_byfield(   UdmHanler_t udm_handler, int zone_id, UdmSize_t cell_id, UdmSize_t field_id, UdmReal_t *value);
 
 int udm_getnum_cellconnectivity(
                         UdmHanler_t udm_handler,
@@ -285,6 +333,24 @@ int udm_get_neighbornodes(
                         UdmSize_t *neighbor_nodeids,
                         UdmRealityType_t *neighbor_types,
                         int *num_neighbors);
+UdmError_t udm_get_neighborcells_graph(
+                        UdmHanler_t udm_handler,
+                        int zone_id,
+                        UdmSize_t *xadj,
+                        UdmSize_t *adjncy,
+                        UdmSize_t *num_adjncy);
+UdmError_t udm_get_neighbornodes_graph(
+                        UdmHanler_t udm_handler,
+                        int zone_id,
+                        UdmSize_t *xadj,
+                        UdmSize_t *adjncy,
+                        UdmSize_t *num_adjncy);
+UdmError_t udm_get_nodeconnectivity_graph(
+                        UdmHanler_t udm_handler,
+                        int zone_id,
+                        UdmSize_t *xadj,
+                        UdmSize_t *adjncy,
+                        UdmSize_t *num_adjncy);
 
 // UserDefinedData
 UdmError_t udm_user_getinfo(
@@ -389,6 +455,11 @@ void udm_config_settimeslicedirectory(
                 bool timeslice_directory);
 bool udm_config_istimeslicedirectory(
                 UdmHanler_t udm_handler);
+void udm_config_setprocessdirectory(
+                UdmHanler_t udm_handler,
+                int num_ranks);
+int udm_config_getprocessdirectory(
+                UdmHanler_t udm_handler);
 
 // partition
 UdmError_t udm_partition_zone(UdmHanler_t udm_handler, int zone_id);
@@ -0,0 +1,105 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMCGNSGATHERARCHIVE_H_
+#define _UDMCGNSGATHERARCHIVE_H_
+
+/**
+ * @file UdmCgnsGatherArchive.h
+ * CGNS集約出力アーカイブクラスのヘッダファイル
+ */
+
+#include "UdmBase.h"
+
+namespace udm
+{
+class UdmModel;
+class UdmZone;
+class UdmGridCoordinates;
+class UdmSections;
+class UdmEntityVoxels;
+class UdmUserDefinedDatas;
+class UdmRankConnectivity;
+
+/**
+ * CGNS集約出力アーカイブクラス.
+ * 集約CGNSファイル出力にて、ゾーンのCGNS出力データを集約ランクに転送する為にシリアライズ、デシリアライズする.
+ * CGNS出力データはXYZ座標値, セクション（要素構成）毎のCGNS:Elementsの接続情報（ノードID）, 物理量, ユーザ定義データ,
+ * 送信元ランク番号の内部境界情報の列データとする.
+ * デシリアライズはCGNSファイルの読込と同様にゾーンを生成し、集約ランクは生成ゾーンを通常のCGNS出力にて出力する.
+ * 列データは倍精度のアライメントにて格納し、受信バッファから直接ゾーンに設定する.
+ */
+class UdmCgnsGatherArchive
+{
+private:
+    /**
+     * シリアライズバッファ
+     */
+    std::vector<char> buffer;
+
+    /**
+     * デシリアライズ位置
+     */
+    char *read_pos;
+
+    /**
+     * デシリアライズ終了位置
+     */
+    char *read_end;
+
+public:
+    UdmCgnsGatherArchive();
+    virtual ~UdmCgnsGatherArchive();
+
+    // シリアライズ
+    UdmError_t packZones(const std::vector<UdmZone*> &zones, bool write_constsolutions);
+    const char* getBuffer() const;
+    char* getBuffer();
+    size_t getBufferSize() const;
+    void resizeBuffer(size_t size);
+    void clear();
+
+    // デシリアライズ
+    UdmError_t unpackZones(UdmModel *model, std::vector<UdmZone*> &zones);
+
+private:
+    void initialize();
+
+    // シリアライズ
+    UdmError_t packZone(UdmZone *zone, bool write_constsolutions);
+    UdmError_t packGridCoordinates(UdmGridCoordinates *grid);
+    UdmError_t packSections(UdmSections *sections);
+    UdmError_t packSolutionFields(UdmZone *zone, bool write_constsolutions);
+    UdmError_t packUserDatas(const UdmUserDefinedDatas *user_datas);
+    UdmError_t packRankConnectivity(const UdmRankConnectivity *rank_connectivity);
+    template<class VALUE_TYPE> void writeValue(VALUE_TYPE value);
+    void writeString(const std::string &value);
+    char* reserveBuffer(size_t size);
+    char* reserveColumn(size_t size);
+
+    // デシリアライズ
+    UdmError_t unpackZone(UdmZone *zone);
+    UdmError_t unpackGridCoordinates(UdmGridCoordinates *grid);
+    UdmError_t unpackSections(UdmSections *sections);
+    UdmError_t unpackSolutionFields(UdmZone *zone);
+    UdmError_t unpackUserDatas(UdmUserDefinedDatas *user_datas);
+    UdmError_t unpackRankConnectivity(UdmRankConnectivity *rank_connectivity);
+    template<class VALUE_TYPE> bool readValue(VALUE_TYPE &value);
+    char* readBuffer(size_t size);
+    char* readColumn(size_t size);
+    bool readString(std::string &value);
+    static unsigned int sizeofDataType(UdmDataType_t datatype);
+};
+
+} /* namespace udm */
+
+#endif /* _UDMCGNSGATHERARCHIVE_H_ */
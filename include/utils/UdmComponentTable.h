@@ -0,0 +1,86 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMCOMPONENTTABLE_H_
+#define _UDMCOMPONENTTABLE_H_
+
+/**
+ * @file UdmComponentTable.h
+ * 部品要素（セル）検索テーブルクラスのヘッダファイル
+ */
+
+#include "UdmBase.h"
+
+/**
+ * 部品要素（セル）検索テーブルの初期スロット数（２のべき乗）
+ */
+#define UDM_COMPONENTTABLE_MINSLOTS        16
+
+namespace udm
+{
+class UdmNode;
+class UdmComponent;
+
+/**
+ * 部品要素（セル）検索テーブルクラス.
+ * 構成節点（ノード）のランク番号、IDの組をキーとするオープンアドレス法（線形探索）のハッシュテーブル.
+ * キーは構成節点（ノード）の順序に依存しない.
+ */
+class UdmComponentTable
+{
+private:
+    /**
+     * 検索テーブルスロット
+     */
+    struct UdmComponentTableSlot {
+        unsigned long long hash_key;        ///< 構成節点（ノード）のハッシュ値
+        UdmComponent *component;            ///< 部品要素（セル） : NULL=空きスロット
+    };
+
+    /**
+     * 部品要素（セル）検索テーブル
+     */
+    std::vector<UdmComponentTableSlot>  component_slots;
+
+    /**
+     * 登録数
+     */
+    UdmSize_t num_entries;
+
+public:
+    UdmComponentTable();
+    UdmComponentTable(const std::vector<UdmComponent*> &components);
+    virtual ~UdmComponentTable();
+
+    void createComponentTable(const std::vector<UdmComponent*> &components);
+    void clearComponentTable();
+    bool addComponentCell(UdmComponent* component);
+    bool removeComponentCell(const UdmComponent* component);
+    UdmComponent* findComponentCell(const std::vector<UdmNode*> &nodes) const;
+    UdmComponent* findComponentCell(UdmNode* const nodes[], unsigned int num_nodes) const;
+    void reserve(UdmSize_t size);
+    UdmSize_t size() const;
+    size_t getMemSize() const;
+
+    static unsigned long long hashNodes(UdmNode* const nodes[], unsigned int num_nodes);
+    static unsigned long long hashNodeId(int rankno, UdmSize_t localid);
+
+private:
+    void initialize();
+    static unsigned long long hashNodes(const UdmComponent* component);
+    UdmSize_t getHomeSlot(unsigned long long hash_key) const;
+    void rehash(UdmSize_t num_slots);
+};
+
+} /* namespace udm */
+
+#endif /* _UDMCOMPONENTTABLE_H_ */
@@ -0,0 +1,78 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMENTITYPOOL_H_
+#define _UDMENTITYPOOL_H_
+
+/**
+ * @file UdmEntityPool.h
+ * 節点（ノード）、要素（セル）メモリプールクラスのヘッダファイル
+ */
+
+#include <stdlib.h>
+#include <vector>
+
+/**
+ * メモリプールの1ブロックの確保スロット数
+ */
+#define UDM_ENTITYPOOL_BLOCKSLOTS        4096
+
+namespace udm
+{
+
+/**
+ * 節点（ノード）、要素（セル）メモリプールクラス.
+ * ゾーン単位に節点（ノード）、要素（セル）、部品要素（セル）のオブジェクト領域を
+ * ブロック単位に確保して、スロットとして割り当てる.
+ * オブジェクトサイズ毎に空きスロットリストを管理する.
+ * 割当スロットがすべて解放された場合は、確保ブロックを一括解放する.
+ */
+class UdmEntityPool
+{
+private:
+    /**
+     * スロットヘッダ.
+     * 割当元メモリプールとスロットサイズインデックスを保持する.
+     */
+    struct UdmEntityPoolHeader {
+        UdmEntityPool *pool;        ///< 割当元メモリプール : NULL=ヒープ割当
+        size_t slot_index;            ///< スロットサイズインデックス
+    };
+
+    std::vector<size_t> slot_sizes;                ///< スロットサイズリスト
+    std::vector<void*> free_slots;                ///< スロットサイズ毎の空きスロットリスト
+    std::vector< std::vector<char*> > pool_blocks;        ///< スロットサイズ毎の確保ブロックリスト
+    size_t num_allocated;            ///< 割当スロット数
+    bool released;                    ///< 所有ゾーンからの解放済みフラグ
+
+public:
+    UdmEntityPool();
+    virtual ~UdmEntityPool();
+
+    void* allocate(size_t size);
+    void releasePool();
+    size_t getNumAllocated() const;
+    size_t getMemSize() const;
+
+    static void* allocateEntity(size_t size, UdmEntityPool *pool);
+    static void deallocateEntity(void *ptr);
+
+private:
+    void initialize();
+    void deallocate(UdmEntityPoolHeader *header);
+    void clearPool();
+    int getSlotIndex(size_t slot_size);
+};
+
+} /* namespace udm */
+
+#endif /* _UDMENTITYPOOL_H_ */
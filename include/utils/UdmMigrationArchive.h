@@ -0,0 +1,154 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMMIGRATIONARCHIVE_H_
+#define _UDMMIGRATIONARCHIVE_H_
+
+/**
+ * @file UdmMigrationArchive.h
+ * 分割転送アーカイブクラスのヘッダファイル
+ */
+
+#include "UdmBase.h"
+
+namespace udm
+{
+class UdmZone;
+class UdmEntity;
+class UdmCell;
+class UdmNode;
+class UdmSolutionColumn;
+
+/**
+ * 分割転送アーカイブクラス.
+ * 転送先ランクへの転送要素（セル）を列形式のテーブルにてシリアライズ、デシリアライズする.
+ * 構成節点（ノード）は要素（セル）間で重複を除いた節点（ノード）テーブルとして１度のみ転送し、
+ * 要素（セル）テーブルは節点（ノード）テーブルのインデックスにて構成節点（ノード）を参照する.
+ * ID, ランク番号, 物理量等はテーブル毎の列データとして、物理量名称はテーブル毎に１度のみ転送する.
+ * デシリアライズにて生成する要素（セル）、節点（ノード）はUdmCell::deserializeと同一形式とし、
+ * UdmCell::freeDeserializeにて開放する.
+ */
+class UdmMigrationArchive
+{
+private:
+    /**
+     * 物理量列データ
+     */
+    struct UdmMigrationField
+    {
+        std::string name;                    ///< 物理量名称
+        UdmDataType_t datatype;                ///< 物理量データ型
+        UdmVectorType_t vectortype;            ///< 物理量ベクトルデータタイプ
+        unsigned int nvector_size;            ///< 物理量データ数 : 0=エンティティ別データ数
+        std::vector<size_t> value_offsets;    ///< エンティティ別の物理量データ位置 : エンティティ数+1
+        const char *values;                    ///< 物理量データ列
+    };
+
+    /**
+     * エンティティテーブル列データ : デシリアライズ時の受信バッファ内位置
+     */
+    struct UdmMigrationTable
+    {
+        size_t num_entities;                    ///< エンティティ数
+        const char *ids;                        ///< ID列 : UdmSize_t
+        const char *ranknos;                    ///< 自ランク番号列 : int
+        const char *element_types;                ///< 要素形状タイプ列 : unsigned char
+        const char *reality_types;                ///< 実体タイプ列 : unsigned char
+        const char *weights;                    ///< 分割重み列 : float
+        std::vector<size_t> rankinfo_offsets;    ///< MPIランク番号リスト位置 : エンティティ数+1
+        const char *rankinfo_ranknos;            ///< MPIランク番号リスト:ランク番号列 : int
+        const char *rankinfo_localids;            ///< MPIランク番号リスト:ローカルID列 : UdmSize_t
+        std::vector<size_t> previous_offsets;    ///< 以前のランク番号リスト位置 : エンティティ数+1
+        const char *previous_ranknos;            ///< 以前のランク番号リスト:ランク番号列 : int
+        const char *previous_localids;            ///< 以前のランク番号リスト:ローカルID列 : UdmSize_t
+        std::vector<UdmMigrationField> fields;    ///< 物理量列データ
+    };
+
+    /**
+     * シリアライズバッファ
+     */
+    std::vector<char> buffer;
+
+    /**
+     * デシリアライズ位置
+     */
+    const char *read_pos;
+
+    /**
+     * デシリアライズ終了位置
+     */
+    const char *read_end;
+
+public:
+    UdmMigrationArchive();
+    virtual ~UdmMigrationArchive();
+
+    // シリアライズ
+    UdmError_t packCells(const UdmZone *zone, const std::vector<UdmCell*> &cells);
+    const char* getBuffer() const;
+    char* getBuffer();
+    size_t getBufferSize() const;
+    void clear();
+
+    // デシリアライズ
+    UdmError_t unpackCells(const char *buf, size_t size, std::vector<UdmCell*> &cells);
+
+private:
+    void initialize();
+
+    // シリアライズ
+    void packEntityTable(const UdmZone *zone, const std::vector<const UdmEntity*> &entities);
+    void packRankInfos(const std::vector<const UdmEntity*> &entities, bool previous);
+    bool countSolutionValues(
+                    const std::vector<const UdmEntity*> &entities,
+                    UdmSize_t field_id,
+                    const std::string &name,
+                    std::vector<unsigned int> &counts) const;
+    void packSolutionField(
+                    const std::vector<const UdmEntity*> &entities,
+                    UdmSize_t field_id,
+                    const std::string &name,
+                    UdmDataType_t datatype,
+                    UdmVectorType_t vectortype,
+                    const std::vector<unsigned int> &counts);
+    template<class VALUE_TYPE> void writeSolutionValues(
+                    const std::vector<const UdmEntity*> &entities,
+                    UdmSize_t field_id,
+                    const std::string &name,
+                    const std::vector<unsigned int> &counts);
+    const UdmSolutionColumn* getSolutionColumn(const UdmEntity *entity, UdmSize_t field_id) const;
+    template<class VALUE_TYPE> void writeValue(VALUE_TYPE value);
+    template<class VALUE_TYPE> void writeValues(const VALUE_TYPE *values, size_t size);
+    void writeString(const std::string &value);
+    char* reserveBuffer(size_t size);
+
+    // デシリアライズ
+    UdmError_t unpackEntityTable(UdmMigrationTable &table);
+    UdmError_t unpackRankInfos(
+                    size_t num_entities,
+                    std::vector<size_t> &offsets,
+                    const char *&ranknos,
+                    const char *&localids);
+    UdmError_t setEntityValues(UdmEntity *entity, const UdmMigrationTable &table, size_t index) const;
+    template<class VALUE_TYPE> UdmError_t setSolutionValues(
+                    UdmEntity *entity,
+                    const UdmMigrationField &field,
+                    size_t index) const;
+    template<class VALUE_TYPE> bool readValue(VALUE_TYPE &value);
+    const char* readColumn(size_t size);
+    bool readString(std::string &value);
+    template<class VALUE_TYPE> static VALUE_TYPE getColumnValue(const char *column, size_t index);
+};
+
+} /* namespace udm */
+
+#endif /* _UDMMIGRATIONARCHIVE_H_ */
@@ -0,0 +1,110 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+#ifndef _UDMNEIGHBORGRAPH_H_
+#define _UDMNEIGHBORGRAPH_H_
+
+/**
+ * @file UdmNeighborGraph.h
+ * 隣接グラフクラスのヘッダファイル
+ */
+
+#include "UdmBase.h"
+
+namespace udm
+{
+class UdmGridCoordinates;
+class UdmSections;
+class UdmCell;
+class UdmNode;
+class UdmEntity;
+
+/**
+ * 隣接グラフクラス.
+ * ゾーンの要素（セル）の隣接要素（セル）、節点（ノード）の隣接節点（ノード）、
+ * 節点（ノード）の接続要素（セル）をCSR形式（オフセット配列、隣接リスト）で保持する.
+ * 隣接情報は初回参照時に作成して、ゾーンの再構築時に破棄する.
+ */
+class UdmNeighborGraph
+{
+private:
+    /**
+     * 隣接要素（セル）オフセット : 要素（セル）ID-1の隣接要素（セル）は[offset[id-1], offset[id])
+     */
+    std::vector<UdmSize_t> neighbor_cell_offsets;
+
+    /**
+     * 隣接要素（セル）リスト
+     */
+    std::vector<UdmEntity*> neighbor_cells;
+
+    /**
+     * 隣接節点（ノード）オフセット : 節点（ノード）ID-1の隣接節点（ノード）は[offset[id-1], offset[id])
+     */
+    std::vector<UdmSize_t> neighbor_node_offsets;
+
+    /**
+     * 隣接節点（ノード）リスト
+     */
+    std::vector<UdmEntity*> neighbor_nodes;
+
+    /**
+     * 接続要素（セル）オフセット : 節点（ノード）ID-1の接続要素（セル）は[offset[id-1], offset[id])
+     */
+    std::vector<UdmSize_t> connectivity_cell_offsets;
+
+    /**
+     * 接続要素（セル）リスト
+     */
+    std::vector<UdmEntity*> connectivity_cells;
+
+public:
+    UdmNeighborGraph();
+    virtual ~UdmNeighborGraph();
+
+    // 隣接要素（セル）
+    void createNeighborCells(const UdmSections *sections);
+    bool isCreatedNeighborCells(const UdmSections *sections) const;
+    int getNumNeighborCells(UdmSize_t cell_id) const;
+    UdmCell* getNeighborCell(UdmSize_t cell_id, int neighbor_id) const;
+    UdmSize_t getNeighborCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const;
+
+    // 隣接節点（ノード）
+    void createNeighborNodes(const UdmGridCoordinates *grid);
+    bool isCreatedNeighborNodes(const UdmGridCoordinates *grid) const;
+    int getNumNeighborNodes(UdmSize_t node_id) const;
+    UdmNode* getNeighborNode(UdmSize_t node_id, int neighbor_id) const;
+    UdmSize_t getNeighborNodesGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const;
+
+    // 接続要素（セル）
+    void createConnectivityCells(const UdmGridCoordinates *grid);
+    bool isCreatedConnectivityCells(const UdmGridCoordinates *grid) const;
+    int getNumConnectivityCells(UdmSize_t node_id) const;
+    UdmCell* getConnectivityCell(UdmSize_t node_id, int connectivity_id) const;
+    UdmSize_t getConnectivityCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const;
+
+    void clearNeighborGraph();
+    size_t getMemSize() const;
+
+private:
+    void initialize();
+    static UdmSize_t getGraphSize(const std::vector<UdmSize_t> &offsets, UdmSize_t id);
+    static UdmSize_t exportGraph(
+                    const std::vector<UdmSize_t> &offsets,
+                    const std::vector<UdmEntity*> &entities,
+                    UdmSize_t *xadj,
+                    UdmSize_t *adjncy);
+};
+
+} /* namespace udm */
+
+#endif /* _UDMNEIGHBORGRAPH_H_ */
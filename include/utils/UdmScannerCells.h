@@ -69,6 +69,7 @@ public:
     UdmSize_t scannerElements(const std::vector<UdmICellComponent*> &cell_list);
     UdmSize_t scannerParents(const std::vector<UdmNode*> &node_list);
     UdmSize_t scannerParents(const UdmNode* node);
+    UdmSize_t getParentCells(const UdmNode* node, std::vector<UdmEntity*> &parents) const;
     UdmSize_t scannerGraph();
     UdmSize_t scannerGraph(const UdmSections *sections);
     UdmSize_t scannerGraph(const UdmCell* cell);
@@ -89,6 +90,8 @@ public:
     UdmSize_t getObjectWeights(float* obj_wgts) const;
     UdmSize_t scannerNeighborNodes(const UdmNode* node);
     UdmSize_t scannerNeighborCells(const UdmCell* cell);
+    UdmSize_t getNeighborNodes(const UdmNode* node, std::vector<UdmEntity*> &neighbors) const;
+    UdmSize_t getNeighborCells(const UdmCell* cell, std::vector<UdmEntity*> &neighbors) const;
     template <class DATA_TYPE>
     size_t scannerCellsSize( int num_gid_entries,
                                 int num_lid_entries,
@@ -18,36 +18,69 @@
  * 検索テーブルクラスのヘッダファイル
  */
 
-#include "model/UdmNode.h"
+#include "UdmBase.h"
+
+/**
+ * 検索テーブルの初期スロット数（２のべき乗）
+ */
+#define UDM_SEARCHTABLE_MINSLOTS        16
 
 namespace udm
 {
+class UdmNode;
 
 /**
- * 検索テーブルクラス
+ * 検索テーブルクラス.
+ * ランク番号、IDをキーとするオープンアドレス法（線形探索）のハッシュテーブル.
+ * 同一のランク番号、IDは先に追加した節点（ノード）を保持する.
  */
 class UdmSearchTable
 {
 private:
+    /**
+     * 検索テーブルスロット
+     */
+    struct UdmSearchTableSlot {
+        int rankno;                ///< ランク番号
+        UdmSize_t localid;        ///< ID
+        UdmNode *node;            ///< 節点（ノード） : NULL=空きスロット
+    };
 
     /**
      * ランク番号、ID検索テーブル
      */
-    UdmGlobalRankidList  search_table;
+    std::vector<UdmSearchTableSlot>  search_slots;
+
+    /**
+     * 登録数
+     */
+    UdmSize_t num_entries;
 
 public:
     UdmSearchTable();
-    UdmSearchTable(const std::vector<UdmNode*> nodes);
+    UdmSearchTable(const std::vector<UdmNode*> &nodes);
     virtual ~UdmSearchTable();
 
     // ランク番号,ID検索テーブル
-    void createSearchTable(const std::vector<UdmNode*> nodes);
-    void createMpiRankidTable(const std::vector<UdmNode*> nodes);
+    void createSearchTable(const std::vector<UdmNode*> &nodes);
+    void createMpiRankidTable(const std::vector<UdmNode*> &nodes);
     void clearSearchTable();
     void addSearchTable(UdmNode* node);
+    void removeSearchTable(const UdmNode* node);
     UdmNode* findMpiRankInfo(int rankno, UdmSize_t localid) const;
     UdmNode* findMpiRankInfo(const UdmNode *node) const;
     void addMpiRankid(UdmNode* node);
+    bool addRankid(int rankno, UdmSize_t localid, UdmNode* node);
+    bool removeRankid(int rankno, UdmSize_t localid, const UdmNode* node);
+    void reserve(UdmSize_t size);
+    UdmSize_t size() const;
+    size_t getMemSize() const;
+
+private:
+    void initialize();
+    UdmSize_t hashRankid(int rankno, UdmSize_t localid) const;
+    bool findSlot(int rankno, UdmSize_t localid, UdmSize_t &slot) const;
+    void rehash(UdmSize_t num_slots);
 };
 
 } /* namespace udm */
@@ -38,6 +38,8 @@ UdmErrorHandler::UdmErrorHandler()
 {
     this->debug_level = UDM_DEFAULT_DEBUG_LEVEL;
     this->output_target = 0x01;
+    this->queue_enabled = false;
+    pthread_mutex_init(&this->queue_mutex, NULL);
 }
 
 
@@ -46,7 +48,7 @@ UdmErrorHandler::UdmErrorHandler()
  */
 UdmErrorHandler::~UdmErrorHandler()
 {
-
+    pthread_mutex_destroy(&this->queue_mutex);
 }
 
 /**
@@ -71,6 +73,7 @@ UdmErrorHandler* UdmErrorHandler::getInstance()
  */
 UdmError_t UdmErrorHandler::error(UdmError_t error_no, const char* filename, int lineno, const char* funcname)
 {
+    if (this->queueMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, NULL)) return error_no;
     this->setMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, NULL);
     if (this->isDebugLevelPrintError()) {
         this->printMessage();
@@ -96,10 +99,12 @@ UdmError_t UdmErrorHandler::error(UdmError_t error_no, const char* filename, int
     va_start(ap, format);
         char buf[UDM_ERROR_BUFFER_SIZE] = {0x00};
         vsnprintf(buf, UDM_ERROR_BUFFER_SIZE, format, ap);
-        this->setMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, buf);
         va_end( ap );
+        if (this->queueMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, buf)) return error_no;
+        this->setMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, buf);
     }
     else {
+        if (this->queueMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, format)) return error_no;
         this->setMessage(Udm_ErrorLevel_Error, error_no, filename, lineno, funcname, format);
     }
 
@@ -117,6 +122,7 @@ UdmError_t UdmErrorHandler::error(UdmError_t error_no, const char* filename, int
  */
 UdmError_t UdmErrorHandler::error_info(UdmError_t error_no, const char* info)
 {
+    if (this->queueMessage(Udm_ErrorLevel_Error, error_no, NULL, 0, NULL, info)) return error_no;
     this->setMessage(Udm_ErrorLevel_Error, error_no, NULL, 0, NULL, info);
     if (this->isDebugLevelPrintError()) {
         this->printMessage();
@@ -399,6 +405,8 @@ void UdmErrorHandler::printMessage(UdmErrorLevel_t level, UdmError_t error_no,
     if (message != NULL) {
         len += strlen(message) + 256;
     }
+    if (this->queueMessage(level, error_no, filename, lineno, funcname, message)) return;
+
     char *buf = new char[len];
     memset(buf, 0x00, len);
     getMessage(buf, level, error_no, filename, lineno, funcname, message);
@@ -475,6 +483,82 @@ void UdmErrorHandler::setMessage(UdmErrorLevel_t level, UdmError_t error_no, con
     else this->error_funcname = std::string();
 }
 
+/**
+ * メッセージ退避スレッドのメッセージであれば退避する.
+ * @param level            エラーレベル
+ * @param error_no        エラー番号
+ * @param filename        エラーファイル名
+ * @param lineno        エラー行番号
+ * @param funcname        エラー関数名
+ * @param message        エラー追加情報
+ * @return        true=メッセージを退避した
+ */
+bool UdmErrorHandler::queueMessage(UdmErrorLevel_t level, UdmError_t error_no, const char* filename, int lineno, const char* funcname, const char* message)
+{
+    bool queued = false;
+    pthread_mutex_lock(&this->queue_mutex);
+    if (this->queue_enabled && pthread_equal(this->queue_thread, pthread_self())) {
+        UdmQueuedMessage queued_message;
+        queued_message.level = level;
+        queued_message.error_no = error_no;
+        if (filename != NULL) queued_message.filename = std::string(filename);
+        queued_message.lineno = lineno;
+        if (funcname != NULL) queued_message.funcname = std::string(funcname);
+        if (message != NULL) queued_message.message = std::string(message);
+        this->queued_messages.push_back(queued_message);
+        queued = true;
+    }
+    pthread_mutex_unlock(&this->queue_mutex);
+    return queued;
+}
+
+/**
+ * 呼出スレッドをメッセージ退避スレッドとする.
+ * 以降の呼出スレッドのメッセージはendQueueMessagesまで出力せずに退避する.
+ */
+void UdmErrorHandler::beginQueueMessages()
+{
+    pthread_mutex_lock(&this->queue_mutex);
+    this->queue_thread = pthread_self();
+    this->queue_enabled = true;
+    pthread_mutex_unlock(&this->queue_mutex);
+}
+
+/**
+ * メッセージ退避スレッドの設定を解除する.
+ */
+void UdmErrorHandler::endQueueMessages()
+{
+    pthread_mutex_lock(&this->queue_mutex);
+    this->queue_enabled = false;
+    pthread_mutex_unlock(&this->queue_mutex);
+}
+
+/**
+ * 退避メッセージを呼出スレッドにて出力して削除する.
+ * エラーメッセージはエラー番号、メッセージとして設定する.
+ */
+void UdmErrorHandler::flushQueuedMessages()
+{
+    std::vector<UdmQueuedMessage> messages;
+    pthread_mutex_lock(&this->queue_mutex);
+    messages.swap(this->queued_messages);
+    pthread_mutex_unlock(&this->queue_mutex);
+
+    std::vector<UdmQueuedMessage>::const_iterator itr;
+    for (itr=messages.begin(); itr!=messages.end(); itr++) {
+        if (itr->level == Udm_ErrorLevel_Error) {
+            this->setMessage(itr->level, itr->error_no, itr->filename.c_str(), itr->lineno, itr->funcname.c_str(), itr->message.c_str());
+            if (this->isDebugLevelPrintError()) {
+                this->printMessage();
+            }
+        }
+        else {
+            this->printMessage(itr->level, itr->error_no, itr->filename.c_str(), itr->lineno, itr->funcname.c_str(), itr->message.c_str());
+        }
+    }
+}
+
 /**
  * デバッグレベル：エラー出力なしであるかチェックする.
  * @return        true=デバッグレベル：エラー出力なし
@@ -437,6 +437,7 @@ UdmFileCompositionType_t UdmConfigBase::convertFileCompositionType(const std::st
     else if (!strcasecmp(value.c_str(), "EachStep"))  return Udm_EachStep;
     else if (!strcasecmp(value.c_str(), "GridConstant"))      return Udm_GridConstant;
     else if (!strcasecmp(value.c_str(), "GridTimeSlice"))     return Udm_GridTimeSlice;
+    else if (!strcasecmp(value.c_str(), "AggregateFile"))     return Udm_AggregateFile;
     else *ierror = UDM_ERROR;
 
     return Udm_FileCompositionTypeUnknown;
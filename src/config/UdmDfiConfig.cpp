@@ -485,6 +485,8 @@ UdmError_t UdmDfiConfig::getCgnsInputFilePath(std::string& input_path, int rank_
     if (this->fileinfo->getCgnsLinkFile(filename, rank_no) != UDM_OK) {
         return UDM_ERROR;
     }
+    // プロセスディレクトリを付加する.
+    this->connectProcessDirectory(filename, rank_no);
 
     // input.dfiからの相対パスを返す。
     std::string input_dir;
@@ -512,6 +514,8 @@ UdmError_t UdmDfiConfig::getCgnsLinkFilePath(std::string& file_path, int rank_no
     if (this->fileinfo->getCgnsLinkFile(filename, rank_no) != UDM_OK) {
         return UDM_ERROR;
     }
+    // プロセスディレクトリを付加する.
+    this->connectProcessDirectory(filename, rank_no, false);
 
     // 出力パスを追加する.
     this->connectOutputDirectory(filename, file_path);
@@ -542,6 +546,8 @@ UdmError_t UdmDfiConfig::getCgnsTimeSliceFilePath(std::string& file_path, int ra
             return UDM_ERROR;
         }
     }
+    // プロセスディレクトリを付加する.
+    this->connectProcessDirectory(filename, rank_no, false);
 
     // 出力パスを追加する.
     this->connectOutputDirectory(filename, file_path);
@@ -580,6 +586,8 @@ UdmError_t UdmDfiConfig::getCgnsGridFilePath(
             return UDM_ERROR;
         }
     }
+    // プロセスディレクトリを付加する.
+    this->connectProcessDirectory(filename, rank_no, false);
 
     // 出力パスを追加する.
     this->connectOutputDirectory(filename, file_path);
@@ -612,6 +620,8 @@ UdmError_t UdmDfiConfig::getCgnsSolutionFilePath(
             return UDM_ERROR;
         }
     }
+    // プロセスディレクトリを付加する.
+    this->connectProcessDirectory(filename, rank_no, false);
 
     // 出力パスを追加する.
     this->connectOutputDirectory(filename, file_path);
@@ -619,6 +629,53 @@ UdmError_t UdmDfiConfig::getCgnsSolutionFilePath(
     return UDM_OK;
 }
 
+/**
+ * CGNS:GridCoordinatesとFlowSolutionを同時出力した入力CGNSファイルパスを取得する.
+ * リンクファイルを出力しない集約CGNSファイルの入力に使用する.
+ * EachStepの場合、ステップ数が未指定(<0)であればindex.dfiの最終TimeSliceのステップ数とする.
+ * @param [out]  input_path            入力CGNSファイルパス
+ * @param [in] rank_no            CGNSファイルのランク番号
+ * @param [in] timeslice_step    ステップ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR,etc
+ */
+UdmError_t UdmDfiConfig::getCgnsTimeSliceInputFilePath(std::string& input_path, int rank_no, int timeslice_step)
+{
+    // 入力CGNSファイル名の作成
+    std::string filename;
+    if (this->fileinfo->existsFileCompositionType(Udm_AppendStep)) {
+        if (this->fileinfo->generateCgnsFileName(filename, rank_no) != UDM_OK) {
+            return UDM_ERROR;
+        }
+    }
+    else {
+        if (timeslice_step < 0 && this->timeslice != NULL) {
+            UdmSize_t num_slices = this->timeslice->getNumPreviousTimeSlices();
+            if (num_slices > 0) {
+                UdmSize_t step = 0;
+                float time = 0.0;
+                this->timeslice->getPreviousTimeSlice(num_slices, step, time);
+                timeslice_step = step;
+            }
+        }
+        if (this->fileinfo->generateCgnsTimeSliceName(filename, rank_no, timeslice_step) != UDM_OK) {
+            return UDM_ERROR;
+        }
+    }
+    // プロセスディレクトリを付加する.
+    this->connectProcessDirectory(filename, rank_no);
+
+    // input.dfiからの相対パスを返す。
+    std::string input_dir;
+    this->getIndexDfiFolder(input_dir);
+
+    // ファイル名を付加する
+    char path[512] = {0x00};
+    udm_connect_path(input_dir.c_str(), filename.c_str(), path);
+    input_path = path;
+
+    return UDM_OK;
+}
+
 /**
  * DFIラベルパスのパラメータの設定値を取得する.
  * @param [in]  label_path        DFIラベルパス
@@ -1114,12 +1171,112 @@ UdmError_t UdmDfiConfig::setProcessConfig(
     this->clearProcessRank();
 
     int n = 0;
+    std::string dir_name;
     for (n=0; n<num_process; n++) {
         this->setProcessRank(n, vertex_sizes[n], cell_sizes[n]);
+
+        // ランクのCGNSファイルのプロセスディレクトリ
+        this->fileinfo->generateProcessDirectoryName(dir_name, n);
+        UdmRankConfig *rank_config = this->process->getRankConfig(n);
+        if (rank_config != NULL) {
+            rank_config->setDirectory(dir_name);
+        }
     }
     return UDM_OK;
 }
 
+/**
+ * プロセス情報に集約CGNSファイルのランク番号を設定する.
+ * プロセス情報:Processは設定済みであること.
+ * @param num_process        プロセス数
+ * @param file_rankids        ランク毎の集約CGNSファイルのランク番号
+ * @return        エラー番号 : UDM_OK | UDM_ERROR,etc
+ */
+UdmError_t UdmDfiConfig::setProcessFileRanks(int num_process, const int* file_rankids)
+{
+    int n = 0;
+    for (n=0; n<num_process; n++) {
+        UdmRankConfig *rank_config = this->process->getRankConfig(n);
+        if (rank_config == NULL) {
+            return UDM_ERROR;
+        }
+        rank_config->setFileRankId(file_rankids[n]);
+    }
+    return UDM_OK;
+}
+
+/**
+ * ランクのデータを格納しているCGNSファイルのランク番号を取得する.
+ * proc.dfi:/Process/Rank[@]/FileIDが設定されている場合はFileIDを返す.
+ * @param rank_no        ランク番号
+ * @return        CGNSファイルのランク番号
+ */
+int UdmDfiConfig::getCgnsFileRankno(int rank_no) const
+{
+    if (this->process == NULL) return rank_no;
+    const UdmRankConfig *rank_config = this->process->getRankConfig(rank_no);
+    if (rank_config == NULL) return rank_no;
+    return rank_config->getFileRankId();
+}
+
+/**
+ * ランクのCGNSファイルのプロセスディレクトリ名を取得する.
+ * proc.dfi:/Process/Rank[@]が存在する場合は/Process/Rank[@]/Directoryを返す.
+ * 存在しない場合はFileInfo/ProcessDirectoryからプロセスディレクトリ名を作成する.
+ * @param [out] dir_name        プロセスディレクトリ名 : プロセスディレクトリなしの場合は空文字列
+ * @param [in] rank_no        ランク番号
+ * @return        エラー番号 : UDM_OK | UDM_ERROR,etc
+ */
+UdmError_t UdmDfiConfig::getCgnsProcessDirectory(std::string &dir_name, int rank_no) const
+{
+    dir_name.clear();
+    if (rank_no < 0) return UDM_OK;
+
+    if (this->process != NULL) {
+        const UdmRankConfig *rank_config = this->process->getRankConfig(rank_no);
+        if (rank_config != NULL) {
+            dir_name = rank_config->getDirectory();
+            return UDM_OK;
+        }
+    }
+    if (this->fileinfo == NULL) return UDM_ERROR;
+
+    return this->fileinfo->generateProcessDirectoryName(dir_name, rank_no);
+}
+
+/**
+ * CGNSファイル名のファイル名の前にプロセスディレクトリを付加する.
+ * 入力ファイルの場合はproc.dfiに記録されているプロセスディレクトリとする.
+ * 出力ファイルの場合はFileInfo/ProcessDirectoryからプロセスディレクトリを作成する.
+ * @param [in,out] file_name        CGNSファイル名
+ * @param [in] rank_no        ランク番号
+ * @param [in] input        true=入力ファイル
+ * @return        エラー番号 : UDM_OK | UDM_ERROR,etc
+ */
+UdmError_t UdmDfiConfig::connectProcessDirectory(std::string &file_name, int rank_no, bool input) const
+{
+    std::string dir_name;
+    if (input) {
+        this->getCgnsProcessDirectory(dir_name, rank_no);
+    }
+    else if (this->fileinfo != NULL) {
+        this->fileinfo->generateProcessDirectoryName(dir_name, rank_no);
+    }
+    if (dir_name.empty()) return UDM_OK;
+
+    char dirname[UDM_PATH_MAX] = {0x00};
+    char filename[UDM_PATH_MAX] = {0x00};
+    char process_dir[UDM_PATH_MAX] = {0x00};
+    char path[UDM_PATH_MAX] = {0x00};
+    udm_get_dirname(file_name.c_str(), dirname);
+    udm_get_filename(file_name.c_str(), filename);
+    udm_connect_path(dirname, dir_name.c_str(), process_dir);
+    udm_connect_path(process_dir, filename, path);
+    file_name = path;
+
+    return UDM_OK;
+}
+
 /**
  * 出力ディレクトリを取得する.
  * @return        出力ディレクトリ
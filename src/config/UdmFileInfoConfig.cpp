@@ -54,6 +54,7 @@ UdmFileInfoConfig::~UdmFileInfoConfig()
 void UdmFileInfoConfig::initialize()
 {
     this->timeslice_directory = false;
+    this->process_directory = 0;
     this->dfi_type = Udm_UnsDfiType;
     this->fileformat = "cgns";
     this->fieldfilename_format = Udm_step_rank;
@@ -126,6 +127,18 @@ UdmError_t UdmFileInfoConfig::read()
         this->timeslice_directory = false;
     }
 
+    // ProcessDirectory
+    label = "/FileInfo/ProcessDirectory";
+    if ( this->getValue(label, value ) == UDM_OK ) {
+        this->process_directory = this->convertLong(value, &ierror);
+        if (ierror != UDM_OK || this->process_directory < 0) {
+            this->process_directory = 0;
+        }
+    }
+    else {
+        this->process_directory = 0;
+    }
+
     // Prefix
     label = "/FileInfo/Prefix";
     if ( this->getValue(label, value ) == UDM_OK ) {
@@ -228,6 +241,12 @@ UdmError_t UdmFileInfoConfig::write(FILE *fp, unsigned int indent)
         this->writeNodeValue(fp, indent, label, value);
     }
 
+    // ProcessDirectory
+    if (this->process_directory > 0) {
+        label = "ProcessDirectory";
+        this->writeNodeValue(fp, indent, label, this->process_directory);
+    }
+
     // Prefix
     if (!this->prefix.empty()) {
         label = "Prefix";
@@ -388,6 +407,8 @@ void UdmFileInfoConfig::setFileCompositionTypes(
  *         CGNS:GridCoordinates出力方法            : [IncludeGrid | ExcludeGrid]
  *         CGNS:FlowSolutionのステップ出力方法    : [AppendStep | EachStep]
  *         CGNS:GridCoordinatesの時系列出力方法    : [GridConstant | GridTimeSlice]
+ * 集約ファイル出力(AggregateFile)はGridCoordinatesとFlowSolutionを同一ファイルに出力するため、
+ * ExcludeGridと同時に設定できない. AggregateFileを設定した場合はIncludeGridに置換する.
  * @param type        CGNSファイル構成タイプ
  */
 void UdmFileInfoConfig::setFileCompositionType(UdmFileCompositionType_t type)
@@ -395,6 +416,9 @@ void UdmFileInfoConfig::setFileCompositionType(UdmFileCompositionType_t type)
     if (type == Udm_IncludeGrid || type == Udm_ExcludeGrid) {
         this->removeFileCompositionType(Udm_IncludeGrid);
         this->removeFileCompositionType(Udm_ExcludeGrid);
+        if (type == Udm_ExcludeGrid) {
+            this->removeFileCompositionType(Udm_AggregateFile);
+        }
     }
     else if (type == Udm_AppendStep || type == Udm_EachStep) {
         this->removeFileCompositionType(Udm_AppendStep);
@@ -404,6 +428,12 @@ void UdmFileInfoConfig::setFileCompositionType(UdmFileCompositionType_t type)
         this->removeFileCompositionType(Udm_GridConstant);
         this->removeFileCompositionType(Udm_GridTimeSlice);
     }
+    else if (type == Udm_AggregateFile) {
+        this->removeFileCompositionType(Udm_AggregateFile);
+        if (!this->existsFileCompositionType(Udm_IncludeGrid)) {
+            this->setFileCompositionType(Udm_IncludeGrid);
+        }
+    }
 
     this->filecomposition_types.push_back(type);
 
@@ -501,6 +531,26 @@ void UdmFileInfoConfig::setTimeSliceDirectory(bool timeslice_directory)
     this->timeslice_directory = timeslice_directory;
 }
 
+/**
+ * プロセスディレクトリ作成オプションを取得する.
+ * ランク毎のCGNSファイルを、設定ランク数毎のサブディレクトリに出力する.
+ * @return        ディレクトリ当りのランク数 : 0=プロセスディレクトリを作成しない
+ */
+int UdmFileInfoConfig::getProcessDirectory() const
+{
+    return this->process_directory;
+}
+
+/**
+ * プロセスディレクトリ作成オプションを設定する.
+ * @param num_ranks        ディレクトリ当りのランク数 : 0=プロセスディレクトリを作成しない
+ */
+void UdmFileInfoConfig::setProcessDirectory(int num_ranks)
+{
+    if (num_ranks < 0) num_ranks = 0;
+    this->process_directory = num_ranks;
+}
+
 
 /**
  * DFIラベルパスのパラメータの設定値を取得する.
@@ -550,6 +600,11 @@ UdmError_t UdmFileInfoConfig::getDfiValue(const std::string &label_path, std::st
         error = this->toString(this->timeslice_directory?Udm_on:Udm_off, value);
         return error;
     }
+    // ProcessDirectory
+    else if (!strcasecmp(name.c_str(), UDM_DFI_PROCESSDIRECTORY)) {
+        error = this->toString((long long)this->process_directory, value);
+        return error;
+    }
     // Prefix
     else if (!strcasecmp(name.c_str(), UDM_DFI_PREFIX)) {
         value = this->prefix;
@@ -617,7 +672,7 @@ int UdmFileInfoConfig::getNumDfiValue(const std::string &label_path) const
     }
     // FileInfoのパラメータ数を返す
     if (count == 1) {
-        return 9;
+        return 10;
     }
     else if (count != 2) {
         return 0;
@@ -640,6 +695,10 @@ int UdmFileInfoConfig::getNumDfiValue(const std::string &label_path) const
     else if (!strcasecmp(name.c_str(), UDM_DFI_TIMESLICEDIRECTORY)) {
         return 1;
     }
+    // ProcessDirectory
+    else if (!strcasecmp(name.c_str(), UDM_DFI_PROCESSDIRECTORY)) {
+        return 1;
+    }
     // Prefix
     else if (!strcasecmp(name.c_str(), UDM_DFI_PREFIX)) {
         return 1;
@@ -713,6 +772,11 @@ UdmError_t UdmFileInfoConfig::setDfiValue(const std::string &label_path, const s
         this->timeslice_directory = this->convertBool(value, &error);
         return error;
     }
+    // ProcessDirectory
+    else if (!strcasecmp(name.c_str(), UDM_DFI_PROCESSDIRECTORY)) {
+        this->setProcessDirectory(this->convertLong(value, &error));
+        return error;
+    }
     // Prefix
     else if (!strcasecmp(name.c_str(), UDM_DFI_PREFIX)) {
         this->prefix = value;
@@ -953,6 +1017,43 @@ UdmError_t UdmFileInfoConfig::generateCgnsSolutionName(std::string& file_name, i
     return generateCgnsTimeSliceSolutionName(file_name, rank_no, -1);
 }
 
+/**
+ * 集約CGNSファイルのランク毎のCGNS:Base名を作成する.
+ * @param [out]  base_name        CGNS:Base名 : UdmBase_id%06d
+ * @param [in] rank_no            MPIランク番号
+ * @return        エラー番号 : UDM_OK | UDM_ERROR,etc
+ */
+UdmError_t UdmFileInfoConfig::generateCgnsRankBaseName(std::string& base_name, int rank_no) const
+{
+    if (rank_no < 0) return UDM_ERROR;
+
+    char name[UDM_CGNS_NAME_LENGTH] = {0x00};
+    sprintf(name, UDM_CGNS_FORMAT_RANKBASE, rank_no);
+    base_name = name;
+
+    return UDM_OK;
+}
+
+/**
+ * ランク毎のCGNSファイルを出力するプロセスディレクトリ名を作成する.
+ * プロセスディレクトリ名はディレクトリ当りのランク数で区切った先頭ランク番号とする : rank%06d
+ * @param [out]  dir_name        プロセスディレクトリ名 : プロセスディレクトリを作成しない場合は空文字列
+ * @param [in] rank_no            MPIランク番号
+ * @return        エラー番号 : UDM_OK | UDM_ERROR,etc
+ */
+UdmError_t UdmFileInfoConfig::generateProcessDirectoryName(std::string& dir_name, int rank_no) const
+{
+    dir_name.clear();
+    if (this->process_directory <= 0) return UDM_OK;
+    if (rank_no < 0) return UDM_OK;
+
+    char name[64] = {0x00};
+    sprintf(name, UDM_DFI_FORMAT_PROCESSDIRECTORY, (rank_no / this->process_directory) * this->process_directory);
+    dir_name = name;
+
+    return UDM_OK;
+}
+
 /**
  * フィールドデータディレクトリ, 時刻ディレクトリを付加する.
  * @param [out]  file_name        CGNS:ファイル名
@@ -1088,5 +1189,20 @@ bool UdmFileInfoConfig::isFileIncludeGrid() const
     return false;
 }
 
+/**
+ * ランクグループ毎に集約したCGNSファイルの出力を行うかチェックする.
+ * ファイル構成タイプにAggregateFileが存在しているかチェックする.
+ * 集約CGNSファイルはグループの集約ランク番号のファイル名とし、ランク毎にCGNS:Base(UdmBase_id%06d)を持つ.
+ * @return            true=集約CGNSファイルの出力を行う.
+ */
+bool UdmFileInfoConfig::isFileAggregate() const
+{
+    if (this->existsFileCompositionType(Udm_AggregateFile)) {
+        return true;
+    }
+
+    return false;
+}
+
 } /* namespace udm */
 
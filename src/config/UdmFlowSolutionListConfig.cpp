@@ -53,6 +53,7 @@ UdmFlowSolutionListConfig::~UdmFlowSolutionListConfig()
 void UdmFlowSolutionListConfig::initialize()
 {
     this->solution_list.clear();
+    this->solution_revision = 0;
 }
 
 /**
@@ -85,6 +86,7 @@ UdmError_t UdmFlowSolutionListConfig::read()
             solution->setSolutionId(this->solution_list.size());
         }
     }
+    this->solution_revision++;
 
     return UDM_OK;
 }
@@ -179,6 +181,7 @@ UdmError_t UdmFlowSolutionListConfig::setSolutionFieldConfig(const UdmSolutionFi
     }
     UdmSize_t solution_id = std::distance(this->solution_list.begin(), itr) + 1;
     this->solution_list[solution_name]->setSolutionId(solution_id);
+    this->solution_revision++;
 
     return UDM_OK;
 }
@@ -385,6 +388,7 @@ UdmError_t UdmFlowSolutionListConfig::setSolutionFieldInfo(
         solution->setNvectorSize(nvector_size);
         solution->setConstantFlag(constant_flag);
     }
+    this->solution_revision++;
 
     return UDM_OK;
 }
@@ -434,6 +438,7 @@ UdmError_t UdmFlowSolutionListConfig::removeSolutionConfig(const std::string &so
     if (itr != this->solution_list.end()) {
         if (itr->second != NULL) delete itr->second;
         this->solution_list.erase(itr);
+        this->solution_revision++;
         return UDM_OK;
     }
     return UDM_ERROR;
@@ -456,6 +461,7 @@ UdmError_t UdmFlowSolutionListConfig::clear()
         ritr = this->solution_list.rbegin();
     }
     this->solution_list.clear();
+    this->solution_revision++;
     return UDM_OK;
 }
 
@@ -574,6 +580,7 @@ UdmError_t UdmFlowSolutionListConfig::setDfiValue(const std::string &label_path,
         }
         this->solution_list.insert(std::make_pair(name, solution));
         solution->setSolutionId(this->solution_list.size());
+        this->solution_revision++;
     }
 
     return UDM_OK;
@@ -591,9 +598,21 @@ UdmError_t UdmFlowSolutionListConfig::rebuildSolutionList()
     for (itr=this->solution_list.begin(); itr!= this->solution_list.end(); itr++) {
         itr->second->setSolutionId(++solution_id);
     }
+    this->solution_revision++;
     return UDM_OK;
 }
 
+/**
+ * 物理量情報リストの更新番号を取得する.
+ * 物理量情報の追加、削除により物理量ID（=物理量情報リストの順序）は変更される.
+ * 物理量IDを保持する場合は、更新番号の変更により物理量IDの再取得を行うこと.
+ * @return        物理量情報リストの更新番号
+ */
+UdmSize_t UdmFlowSolutionListConfig::getSolutionRevision() const
+{
+    return this->solution_revision;
+}
+
 /**
  * CGNS:FlowSolutionの物理量名称と一致する[物理量名称]データクラスを取得する.
  * 成分名(Vector, Nvector)を付加（成分prefix）した物理量名称と一致しているかチェックする.
@@ -26,7 +26,7 @@ namespace udm {
 /**
  * コンストラクタ
  */
-UdmRankConfig::UdmRankConfig() : UdmConfigBase(NULL), rankid(0), vertex_size(0), cell_size(0)
+UdmRankConfig::UdmRankConfig() : UdmConfigBase(NULL), rankid(0), vertex_size(0), cell_size(0), file_rankid(-1)
 {
     this->initialize();
 }
@@ -35,7 +35,7 @@ UdmRankConfig::UdmRankConfig() : UdmConfigBase(NULL), rankid(0), vertex_size(0),
  * コンストラクタ:TextParser
  * @param  parser        TextParser
  */
-UdmRankConfig::UdmRankConfig(TextParser *parser) : UdmConfigBase(parser), rankid(0), vertex_size(0), cell_size(0)
+UdmRankConfig::UdmRankConfig(TextParser *parser) : UdmConfigBase(parser), rankid(0), vertex_size(0), cell_size(0), file_rankid(-1)
 {
     this->initialize();
 }
@@ -79,6 +79,8 @@ void UdmRankConfig::initialize()
     this->rankid = 0;
     this->vertex_size = 0;
     this->cell_size = 0;
+    this->file_rankid = -1;
+    this->directory.clear();
 }
 
 /**
@@ -124,6 +126,18 @@ UdmError_t UdmRankConfig::read(const std::string& rank_label)
         this->cell_size = this->convertLong(value, &ierror);
     }
 
+    // Process/Rank[@]/FileID : 集約CGNSファイルのランク番号
+    label = rank_label + "/" + UDM_DFI_FILEID;
+    if ( this->getValue(label, value ) == UDM_OK ) {
+        this->file_rankid = this->convertLong(value, &ierror);
+    }
+
+    // Process/Rank[@]/Directory : CGNSファイルのプロセスディレクトリ
+    label = rank_label + "/" + UDM_DFI_DIRECTORY;
+    if ( this->getValue(label, value ) == UDM_OK ) {
+        this->directory = value;
+    }
+
     return UDM_OK;
 }
 
@@ -157,6 +171,18 @@ UdmError_t UdmRankConfig::write(FILE *fp, unsigned int indent)
     label = UDM_DFI_CELLSIZE;
     this->writeNodeValue(fp, indent, label, this->cell_size );
 
+    // Process/Rank[@]/FileID : 集約CGNSファイルのランク番号
+    if (this->file_rankid >= 0) {
+        label = UDM_DFI_FILEID;
+        this->writeNodeValue(fp, indent, label, this->file_rankid );
+    }
+
+    // Process/Rank[@]/Directory : CGNSファイルのプロセスディレクトリ
+    if (!this->directory.empty()) {
+        label = UDM_DFI_DIRECTORY;
+        this->writeNodeValue(fp, indent, label, this->directory );
+    }
+
     // Process/Rank[@] : close
     if (this->writeCloseTab(fp, --indent) != UDM_OK) {
         return UDM_ERROR_WRITE_DFIFILE_WRITENODE;
@@ -219,6 +245,45 @@ void UdmRankConfig::setCellSize(UdmSize_t cell_size)
     this->cell_size = cell_size;
 }
 
+/**
+ * CGNSファイルのランク番号を取得する.
+ * 集約CGNSファイル(AggregateFile)の場合は、ランクのCGNS:Baseを出力した集約ランク番号を返す.
+ * 集約ランク番号が未設定の場合はランク番号を返す.
+ * @return        CGNSファイルのランク番号
+ */
+int UdmRankConfig::getFileRankId() const
+{
+    if (this->file_rankid < 0) return this->rankid;
+    return this->file_rankid;
+}
+
+/**
+ * 集約CGNSファイルのランク番号を設定する.
+ * @param file_rankid        集約CGNSファイルのランク番号 : -1=ランク番号のCGNSファイル
+ */
+void UdmRankConfig::setFileRankId(int file_rankid)
+{
+    this->file_rankid = file_rankid;
+}
+
+/**
+ * CGNSファイルのプロセスディレクトリを取得する.
+ * @return        プロセスディレクトリ : 空文字列=プロセスディレクトリなし
+ */
+const std::string& UdmRankConfig::getDirectory() const
+{
+    return this->directory;
+}
+
+/**
+ * CGNSファイルのプロセスディレクトリを設定する.
+ * @param directory        プロセスディレクトリ : 空文字列=プロセスディレクトリなし
+ */
+void UdmRankConfig::setDirectory(const std::string& directory)
+{
+    this->directory = directory;
+}
+
 /**
  * ランク情報を設定する.
  * @param src_rank_config        元ランク情報
@@ -230,6 +295,8 @@ UdmError_t UdmRankConfig::setRankConfig(const UdmRankConfig &src_rank_config)
     this->rankid = src_rank_config.rankid;
     this->vertex_size = src_rank_config.vertex_size;
     this->cell_size = src_rank_config.cell_size;
+    this->file_rankid = src_rank_config.file_rankid;
+    this->directory = src_rank_config.directory;
 
     return UDM_OK;
 }
@@ -279,6 +346,18 @@ UdmError_t UdmRankConfig::getDfiValue(const std::string &label_path, std::string
         error = this->toString(this->cell_size, value);
         return error;
     }
+    // Process/Rank[@]/FileID  : 集約CGNSファイルのランク番号
+    else if (!strcasecmp(name.c_str(), UDM_DFI_FILEID)) {
+        if (this->file_rankid < 0) return UDM_ERROR;
+        error = this->toString((long long)this->file_rankid, value);
+        return error;
+    }
+    // Process/Rank[@]/Directory  : CGNSファイルのプロセスディレクトリ
+    else if (!strcasecmp(name.c_str(), UDM_DFI_DIRECTORY)) {
+        if (this->directory.empty()) return UDM_ERROR;
+        value = this->directory;
+        return UDM_OK;
+    }
 
     return UDM_OK;
 }
@@ -314,7 +393,10 @@ int UdmRankConfig::getNumDfiValue(const std::string &label_path) const
 
     // Process/Rank[@]のパラメータ数を返す
     if (count == 2) {
-        return 3;
+        int num_values = 3;
+        if (this->file_rankid >= 0) num_values++;
+        if (!this->directory.empty()) num_values++;
+        return num_values;
     }
     if (count != 3) return 0;
     name = labels[2];
@@ -331,6 +413,14 @@ int UdmRankConfig::getNumDfiValue(const std::string &label_path) const
     else if (!strcasecmp(name.c_str(), UDM_DFI_CELLSIZE)) {
         return 1;
     }
+    // Process/Rank[@]/FileID  : 集約CGNSファイルのランク番号
+    else if (!strcasecmp(name.c_str(), UDM_DFI_FILEID)) {
+        return (this->file_rankid >= 0) ? 1 : 0;
+    }
+    // Process/Rank[@]/Directory  : CGNSファイルのプロセスディレクトリ
+    else if (!strcasecmp(name.c_str(), UDM_DFI_DIRECTORY)) {
+        return (!this->directory.empty()) ? 1 : 0;
+    }
 
     return 0;
 }
@@ -380,6 +470,16 @@ UdmError_t UdmRankConfig::setDfiValue(const std::string &label_path, const std::
         this->cell_size = this->convertLong(value, &error);
         return error;
     }
+    // Process/Rank[@]/FileID  : 集約CGNSファイルのランク番号
+    else if (!strcasecmp(name.c_str(), UDM_DFI_FILEID)) {
+        this->file_rankid = this->convertLong(value, &error);
+        return error;
+    }
+    // Process/Rank[@]/Directory  : CGNSファイルのプロセスディレクトリ
+    else if (!strcasecmp(name.c_str(), UDM_DFI_DIRECTORY)) {
+        this->directory = value;
+        return UDM_OK;
+    }
     else {
         return UDM_ERROR;
     }
@@ -52,6 +52,7 @@ void UdmSettingsConfig::initialize()
 {
     this->debug_level = 0;
     this->mxm_partition = udm_disable;
+    this->migration_memory_size = UDM_MIGRATION_MEMORY_SIZE;
     this->clearZoltanParameters();
     this->filename_udm_dfi = std::string();
 
@@ -119,6 +120,13 @@ UdmError_t UdmSettingsConfig::read(const char* filename)
                     else  this->mxm_partition = udm_disable;
                 }
             }
+            // MIGRATION_MEMORY_SIZE
+            else if ( !strcasecmp((*itr).c_str(), UDM_DFI_MIGRATION_MEMORY_SIZE) ) {
+                if ( this->getValue((*itr), value ) == UDM_OK ) {
+                    long long memory_size = this->convertLong(value, &ierror);
+                    if (memory_size > 0) this->migration_memory_size = memory_size;
+                }
+            }
             else {
                 if ( this->getValue((*itr), value ) == UDM_OK ) {
                     this->setZoltanParameter((*itr), value);
@@ -195,6 +203,11 @@ UdmError_t UdmSettingsConfig::write(const char* filename)
     error = this->toString(this->mxm_partition, value);
     this->writeNodeValue(fp, indent, label, value);
 
+    // MIGRATION_MEMORY_SIZE:分割転送の送受信バッファ上限サイズ
+    label = UDM_DFI_MIGRATION_MEMORY_SIZE;
+    error = this->toString((long long)this->migration_memory_size, value);
+    this->writeNodeValue(fp, indent, label, value);
+
     // Zoltanパラメータ
     std::map<std::string, std::string>::const_iterator itr;
     for (itr = this->zoltan_parameters.begin(); itr != this->zoltan_parameters.end(); itr++) {
@@ -275,6 +288,32 @@ UdmError_t UdmSettingsConfig::setMxMPartition(bool mxm_partition)
     return UDM_OK;
 }
 
+/**
+ * MIGRATION_MEMORY_SIZEパラメータの設定値を取得する.
+ * MIGRATION_MEMORY_SIZE = 分割転送にて同時に保持する送受信バッファの上限サイズ(byte)
+ * @return    分割転送の送受信バッファ上限サイズ(byte)
+ */
+size_t UdmSettingsConfig::getMigrationMemorySize() const
+{
+    return this->migration_memory_size;
+}
+
+/**
+ * MIGRATION_MEMORY_SIZEパラメータの設定値を設定する.
+ * MIGRATION_MEMORY_SIZE = 分割転送にて同時に保持する送受信バッファの上限サイズ(byte)
+ * @param memory_size        分割転送の送受信バッファ上限サイズ(byte) : 1以上
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmSettingsConfig::setMigrationMemorySize(size_t memory_size)
+{
+    if (memory_size == 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "%s is zero.", UDM_DFI_MIGRATION_MEMORY_SIZE);
+    }
+    this->migration_memory_size = memory_size;
+
+    return UDM_OK;
+}
+
 /**
  * Zoltanパラメータを取得する
  * @param name        Zoltanパラメータ名
@@ -320,6 +359,7 @@ UdmError_t UdmSettingsConfig::setZoltanParameter(const std::string &name, const
 /**
  * Zoltanパラメータを削除する.
  * "MxM_PARTITION"を指定した場合は、setMxMPartition(false)と同じとする。
+ * "MIGRATION_MEMORY_SIZE"を指定した場合は、デフォルト値とする。
  * @param param_name        Zoltanパラメータ名
  * @return        エラー番号 : UDM_OK | UDM_ERROR
  */
@@ -330,6 +370,10 @@ UdmError_t UdmSettingsConfig::removeZoltanParameter(const std::string& param_nam
         this->setMxMPartition(false);
         return UDM_OK;
     }
+    if (!strcasecmp(param_name.c_str(), UDM_DFI_MIGRATION_MEMORY_SIZE)) {
+        this->migration_memory_size = UDM_MIGRATION_MEMORY_SIZE;
+        return UDM_OK;
+    }
 
     std::map<std::string, std::string>::iterator  itr;
     itr = this->zoltan_parameters.find(param_name);
@@ -395,6 +439,12 @@ UdmError_t UdmSettingsConfig::getDfiValue(const std::string &label_path, std::st
             return error;
         }
 
+        // MIGRATION_MEMORY_SIZE:分割転送の送受信バッファ上限サイズ
+        if (!strcasecmp(name.c_str(), UDM_DFI_MIGRATION_MEMORY_SIZE)) {
+            error = this->toString((long long)this->migration_memory_size, value);
+            return error;
+        }
+
         // Zoltanパラメータ
         std::map<std::string, std::string>::const_iterator itr;
         itr = this->zoltan_parameters.find(name);
@@ -433,7 +483,7 @@ int UdmSettingsConfig::getNumDfiValue(const std::string &label_path) const
     }
     // UDMlibのパラメータ数を返す
     if (count == 1) {
-        return 2 + this->zoltan_parameters.size();
+        return 3 + this->zoltan_parameters.size();
     }
     else if (count == 2) {
         // debug_lebel
@@ -451,6 +501,11 @@ int UdmSettingsConfig::getNumDfiValue(const std::string &label_path) const
             return 1;
         }
 
+        // MIGRATION_MEMORY_SIZE:分割転送の送受信バッファ上限サイズ
+        if (!strcasecmp(name.c_str(), UDM_DFI_MIGRATION_MEMORY_SIZE)) {
+            return 1;
+        }
+
         // Zoltanパラメータ
         std::map<std::string, std::string>::const_iterator itr;
         itr = this->zoltan_parameters.find(name);
@@ -505,6 +560,16 @@ UdmError_t UdmSettingsConfig::setDfiValue(const std::string &label_path, const s
             return error;
         }
 
+        // MIGRATION_MEMORY_SIZE:分割転送の送受信バッファ上限サイズ
+        if (!strcasecmp(name.c_str(), UDM_DFI_MIGRATION_MEMORY_SIZE)) {
+            long long memory_size = this->convertLong(value, &error);
+            if (error != UDM_OK) return error;
+            if (memory_size <= 0) {
+                return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "%s=%s is invalid.", UDM_DFI_MIGRATION_MEMORY_SIZE, value.c_str());
+            }
+            return this->setMigrationMemorySize(memory_size);
+        }
+
         // Zoltanパラメータ
         return setZoltanParameter(name, value);
     }
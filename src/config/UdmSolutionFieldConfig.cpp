@@ -69,6 +69,7 @@ UdmSolutionFieldConfig::UdmSolutionFieldConfig(
                     int                   nvector_size,
                     bool                  constant_flag)
 {
+    this->initialize();
     this->setSolutionName(solution_name);        ///< 物理量名称
     this->setGridLocation(grid_location);            ///< 物理量適用位置
     this->setDataType(data_type);            ///< データ型
@@ -88,6 +89,7 @@ UdmSolutionFieldConfig::UdmSolutionFieldConfig(
                     UdmGridLocation_t    grid_location,
                     UdmDataType_t        data_type)
 {
+    this->initialize();
     this->setSolutionName(solution_name);        ///< 物理量名称
     this->setGridLocation(grid_location);            ///< 物理量適用位置
     this->setDataType(data_type);            ///< データ型
@@ -0,0 +1,654 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmBoundaryReduction.cpp
+ * 内部境界節点（ノード）物理量集約クラスのソースファイル
+ */
+
+#include "model/UdmBoundaryReduction.h"
+#include "model/UdmZone.h"
+#include "model/UdmGridCoordinates.h"
+#include "model/UdmFlowSolutions.h"
+#include "model/UdmEntityVoxels.h"
+#include "model/UdmRankConnectivity.h"
+#include "model/UdmNode.h"
+
+namespace udm
+{
+
+/**
+ * 送受信バッファ, 物理量バッファのデータ境界(byte) : 物理量毎の先頭位置を揃える.
+ */
+#define UDM_BOUNDARYREDUCTION_ALIGNMENT        8
+
+/**
+ * コンストラクタ
+ */
+UdmBoundaryReduction::UdmBoundaryReduction()
+{
+    this->initialize();
+}
+
+/**
+ * コンストラクタ
+ * @param zone        親ゾーン
+ */
+UdmBoundaryReduction::UdmBoundaryReduction(UdmZone *zone)
+{
+    this->initialize();
+    this->parent_zone = zone;
+}
+
+/**
+ * デストラクタ
+ */
+UdmBoundaryReduction::~UdmBoundaryReduction()
+{
+    this->clearReductionPlan();
+    if (this->send_buffer != NULL) delete []this->send_buffer;
+    if (this->recv_buffer != NULL) delete []this->recv_buffer;
+    if (this->value_buffer != NULL) delete []this->value_buffer;
+    this->send_buffer = NULL;
+    this->recv_buffer = NULL;
+    this->value_buffer = NULL;
+
+    // 集約用の複製MPIコミュニケータの解放 : MPI終了後は解放しない.
+    if (this->reduction_communicator != MPI_COMM_NULL) {
+        int finalized = 0;
+        udm_mpi_finalized(&finalized);
+        if (!finalized) udm_mpi_comm_free(&this->reduction_communicator);
+        this->reduction_communicator = MPI_COMM_NULL;
+    }
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmBoundaryReduction::initialize()
+{
+    this->parent_zone = NULL;
+    this->created_plan = false;
+    this->send_buffer = NULL;
+    this->send_capacity = 0;
+    this->recv_buffer = NULL;
+    this->recv_capacity = 0;
+    this->value_buffer = NULL;
+    this->value_capacity = 0;
+    this->reduction_communicator = MPI_COMM_NULL;
+}
+
+/**
+ * 親ゾーンを取得する.
+ * @return        親ゾーン
+ */
+UdmZone* UdmBoundaryReduction::getParentZone() const
+{
+    return this->parent_zone;
+}
+
+/**
+ * 親ゾーンを設定する.
+ * @param zone        親ゾーン
+ */
+void UdmBoundaryReduction::setParentZone(UdmZone* zone)
+{
+    this->parent_zone = zone;
+}
+
+/**
+ * 集約計画が作成済みであるかチェックする.
+ * @return        true=集約計画作成済み
+ */
+bool UdmBoundaryReduction::isCreatedPlan() const
+{
+    return this->created_plan;
+}
+
+/**
+ * 集約対象の内部境界節点（ノード）数を取得する.
+ * @return        内部境界節点（ノード）数
+ */
+UdmSize_t UdmBoundaryReduction::getNumBoundaryNodes() const
+{
+    return this->boundary_nodes.size();
+}
+
+/**
+ * 接続ランク数を取得する.
+ * @return        接続ランク数
+ */
+int UdmBoundaryReduction::getNumNeighborRanks() const
+{
+    return this->neighbor_ranks.size();
+}
+
+/**
+ * 集約計画を作成する.
+ * 内部境界節点（ノード）を接続ランク別に分類して、小さいランク番号側の節点（ノード）ID順に並べる.
+ * 接続ランクとの節点（ノード）数が一致しない場合は内部境界情報の不整合としてエラーとする.
+ * 全ランクで実行すること.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmBoundaryReduction::createReductionPlan()
+{
+#ifdef _UDM_PROFILER
+    UDM_STOPWATCH_START(__FUNCTION__);
+#endif
+
+    UdmError_t error = UDM_OK;
+    this->clearReductionPlan();
+
+    UdmZone *zone = this->getParentZone();
+    if (zone == NULL) return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "parent_zone is null.");
+    UdmRankConnectivity *inner = zone->getRankConnectivity();
+    if (inner == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmRankConnectivity is null.");
+    }
+
+    MPI_Comm comm = this->getMpiComm();
+    int my_rankno = this->getMpiRankno();
+    int num_process = this->getMpiProcessSize();
+    int rankno;
+
+    // 集約用のMPIコミュニケータを複製する : 初回のみ.
+    if (this->reduction_communicator == MPI_COMM_NULL) {
+        if (udm_mpi_comm_dup(comm, &this->reduction_communicator) != MPI_SUCCESS) {
+            this->reduction_communicator = MPI_COMM_NULL;
+            return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_MPI, "failure : MPI_Comm_dup");
+        }
+    }
+    UdmSize_t localid;
+    UdmSize_t n;
+    int i;
+
+    // 接続ランク別の{小さいランク番号側の節点（ノード）ID, 大きいランク番号側の節点（ノード）ID}, 節点（ノード）インデックス
+    typedef std::pair< std::pair<UdmSize_t, UdmSize_t>, size_t > UdmBoundaryKey;
+    std::map<int, std::vector<UdmBoundaryKey> > neighbor_keys;
+    std::map<int, std::vector<UdmBoundaryKey> >::iterator key_itr;
+    UdmSize_t num_nodes = inner->getNumBoundaryNodes();
+    for (n=1; n<=num_nodes; n++) {
+        UdmNode *node = inner->getBoundaryNode(n);
+        if (node == NULL) continue;
+        int num_infos = node->getNumMpiRankInfos();
+        int owner_rankno = my_rankno;
+        size_t index = this->boundary_nodes.size();
+        bool is_shared = false;
+        for (i=1; i<=num_infos; i++) {
+            if (node->getMpiRankInfo(i, rankno, localid) != UDM_OK) continue;
+            if (rankno == my_rankno || rankno < 0 || rankno >= num_process) continue;
+            UdmBoundaryKey key;
+            if (rankno < my_rankno) key.first = std::make_pair(localid, node->getId());
+            else key.first = std::make_pair(node->getId(), localid);
+            key.second = index;
+            neighbor_keys[rankno].push_back(key);
+            if (rankno < owner_rankno) owner_rankno = rankno;
+            is_shared = true;
+        }
+        if (!is_shared) continue;
+        this->boundary_nodes.push_back(node);
+        this->owner_ranks.push_back(owner_rankno);
+    }
+
+    // 接続ランク別の節点（ノード）インデックス
+    std::map<int, std::vector<int> > send_counts;
+    std::map<int, std::vector<int> > recv_counts;
+    this->neighbor_offsets.push_back(0);
+    for (key_itr=neighbor_keys.begin(); key_itr!=neighbor_keys.end(); key_itr++) {
+        std::vector<UdmBoundaryKey> &keys = key_itr->second;
+        std::sort(keys.begin(), keys.end());
+        std::vector<UdmBoundaryKey>::const_iterator itr;
+        for (itr=keys.begin(); itr!=keys.end(); itr++) {
+            this->neighbor_indices.push_back(itr->second);
+        }
+        this->neighbor_ranks.push_back(key_itr->first);
+        this->neighbor_offsets.push_back(this->neighbor_indices.size());
+        send_counts[key_itr->first].assign(1, keys.size());
+    }
+
+    // 接続ランクとの節点（ノード）数の整合チェック
+    error = inner->mpi_exchangeSendCounts(send_counts, 1, recv_counts);
+    if (error == UDM_OK) {
+        if (recv_counts.size() != send_counts.size()) {
+            error = UDM_ERROR_HANDLER(UDM_ERROR_INVALID_RANKNO, "unmatched neighbor ranks[send=%d,recv=%d].",
+                                        (int)send_counts.size(), (int)recv_counts.size());
+        }
+        std::map<int, std::vector<int> >::const_iterator count_itr;
+        for (count_itr=send_counts.begin(); count_itr!=send_counts.end() && error == UDM_OK; count_itr++) {
+            std::map<int, std::vector<int> >::const_iterator recv_itr = recv_counts.find(count_itr->first);
+            if (recv_itr == recv_counts.end() || recv_itr->second[0] != count_itr->second[0]) {
+                error = UDM_ERROR_HANDLER(UDM_ERROR_INVALID_RANKNO, "unmatched boundary nodes[rankno=%d,num_nodes=%d].",
+                                            count_itr->first, count_itr->second[0]);
+            }
+        }
+    }
+
+    // ACK
+    if (udm_mpi_ack(&error, comm) != UDM_OK) {
+        this->clearReductionPlan();
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    this->created_plan = true;
+
+#ifdef _UDM_PROFILER
+    UDM_STOPWATCH_STOP(__FUNCTION__);
+    char info[128] = {0x00};
+    sprintf(info, "boundary_nodes=%d,neighbor_ranks=%d", (int)this->boundary_nodes.size(), (int)this->neighbor_ranks.size());
+    UDM_STOPWATCH_INFORMATION(__FUNCTION__, info);
+#endif
+
+    return UDM_OK;
+}
+
+/**
+ * 集約計画を破棄する.
+ * 送受信バッファ, 物理量バッファは再利用する為、解放しない.
+ */
+void UdmBoundaryReduction::clearReductionPlan()
+{
+    this->created_plan = false;
+    this->boundary_nodes.clear();
+    this->owner_ranks.clear();
+    this->neighbor_ranks.clear();
+    this->neighbor_offsets.clear();
+    this->neighbor_indices.clear();
+}
+
+/**
+ * 内部境界節点（ノード）の指定物理量を接続ランク間で集約する.
+ * 物理量は節点（ノード）物理量(Udm_Vertex)であること.
+ * 全ランクで同一の物理量名称リスト, 集約演算タイプにて実行すること.
+ * 総和は共有ランクのランク番号順に加算するので、共有ランクで同一の値となる.
+ * @param field_names        集約物理量名称リスト
+ * @param reduce_type        集約演算タイプ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmBoundaryReduction::reduceSolutions(
+                const std::vector<std::string> &field_names,
+                UdmReduceType_t reduce_type)
+{
+#ifdef _UDM_PROFILER
+    UDM_STOPWATCH_START(__FUNCTION__);
+#endif
+
+    UdmError_t error = UDM_OK;
+    if (!this->created_plan) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "not created reduction plan.");
+    }
+    if (reduce_type != Udm_ReduceSum && reduce_type != Udm_ReduceMin
+        && reduce_type != Udm_ReduceMax && reduce_type != Udm_ReduceOwner) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid reduce_type=%d.", (int)reduce_type);
+    }
+
+    // 集約物理量情報 : 物理量フィールドID, 節点（ノード）管理クラスは１度のみ取得する.
+    std::vector<const UdmSolutionFieldConfig*> fields;
+    std::vector<UdmSize_t> field_ids;
+    error = this->getReductionFields(field_names, fields, field_ids);
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    UdmEntityVoxels *voxels = this->getParentZone()->getGridCoordinates();
+    if (voxels == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmGridCoordinates is null.");
+    }
+
+    // 接続ランク別のバッファ位置, 物理量別の物理量バッファ位置
+    int i;
+    int num_ranks = this->neighbor_ranks.size();
+    size_t num_nodes = this->boundary_nodes.size();
+    std::vector<const UdmSolutionFieldConfig*>::const_iterator field_itr;
+    std::vector<size_t> offsets(num_ranks+1, 0);
+    for (i=0; i<num_ranks; i++) {
+        size_t num_indices = this->neighbor_offsets[i+1] - this->neighbor_offsets[i];
+        size_t size = 0;
+        for (field_itr=fields.begin(); field_itr!=fields.end(); field_itr++) {
+            size += this->getFieldBufferSize(num_indices, *field_itr);
+        }
+        offsets[i+1] = offsets[i] + size;
+    }
+    std::vector<size_t> value_offsets(fields.size()+1, 0);
+    for (i=0; i<(int)fields.size(); i++) {
+        value_offsets[i+1] = value_offsets[i] + this->getFieldBufferSize(num_nodes, fields[i])*2;
+    }
+
+    // 送受信バッファ, 物理量バッファ
+    this->reserveBuffer(this->send_buffer, this->send_capacity, offsets.back());
+    this->reserveBuffer(this->recv_buffer, this->recv_capacity, offsets.back());
+    this->reserveBuffer(this->value_buffer, this->value_capacity, value_offsets.back());
+
+    // 送信データの作成
+    std::vector<size_t> positions(offsets.begin(), offsets.end()-1);
+    for (i=0; i<(int)fields.size(); i++) {
+        const UdmSolutionFieldConfig *config = fields[i];
+        char *values = this->value_buffer + value_offsets[i];
+        UdmDataType_t datatype = config->getDataType();
+        if (datatype == Udm_Integer) {
+            this->packSolutionValues<int>(config, voxels, field_ids[i], (int*)values, positions);
+        }
+        else if (datatype == Udm_LongInteger) {
+            this->packSolutionValues<long long>(config, voxels, field_ids[i], (long long*)values, positions);
+        }
+        else if (datatype == Udm_RealSingle) {
+            this->packSolutionValues<float>(config, voxels, field_ids[i], (float*)values, positions);
+        }
+        else if (datatype == Udm_RealDouble) {
+            this->packSolutionValues<double>(config, voxels, field_ids[i], (double*)values, positions);
+        }
+        int n;
+        for (n=0; n<num_ranks; n++) {
+            positions[n] += this->getFieldBufferSize(this->neighbor_offsets[n+1] - this->neighbor_offsets[n], config);
+        }
+    }
+
+    // 接続ランクとの送受信 : 複製MPIコミュニケータにて行う.
+    MPI_Comm comm = this->reduction_communicator;
+    std::vector<MPI_Request> requests(num_ranks*2+1, MPI_REQUEST_NULL);
+    std::vector<MPI_Status> status(num_ranks*2+1);
+    int num_requests = 0;
+    for (i=0; i<num_ranks; i++) {
+        int count = offsets[i+1] - offsets[i];
+        if (count <= 0) continue;
+        udm_mpi_irecv(this->recv_buffer + offsets[i], count, MPI_BYTE, this->neighbor_ranks[i], 0, comm, &requests[num_requests++]);
+    }
+    for (i=0; i<num_ranks; i++) {
+        int count = offsets[i+1] - offsets[i];
+        if (count <= 0) continue;
+        udm_mpi_isend(this->send_buffer + offsets[i], count, MPI_BYTE, this->neighbor_ranks[i], 0, comm, &requests[num_requests++]);
+    }
+    udm_mpi_waitall(num_requests, &requests[0], &status[0]);
+
+    // 受信データの集約
+    positions.assign(offsets.begin(), offsets.end()-1);
+    for (i=0; i<(int)fields.size(); i++) {
+        const UdmSolutionFieldConfig *config = fields[i];
+        char *values = this->value_buffer + value_offsets[i];
+        UdmDataType_t datatype = config->getDataType();
+        if (datatype == Udm_Integer) {
+            this->unpackSolutionValues<int>(config, voxels, field_ids[i], reduce_type, (int*)values, positions);
+        }
+        else if (datatype == Udm_LongInteger) {
+            this->unpackSolutionValues<long long>(config, voxels, field_ids[i], reduce_type, (long long*)values, positions);
+        }
+        else if (datatype == Udm_RealSingle) {
+            this->unpackSolutionValues<float>(config, voxels, field_ids[i], reduce_type, (float*)values, positions);
+        }
+        else if (datatype == Udm_RealDouble) {
+            this->unpackSolutionValues<double>(config, voxels, field_ids[i], reduce_type, (double*)values, positions);
+        }
+        int n;
+        for (n=0; n<num_ranks; n++) {
+            positions[n] += this->getFieldBufferSize(this->neighbor_offsets[n+1] - this->neighbor_offsets[n], config);
+        }
+    }
+
+#ifdef _UDM_PROFILER
+    UDM_STOPWATCH_STOP(__FUNCTION__);
+    char info[128] = {0x00};
+    sprintf(info, "num_fields=%d,send_size=%ld", (int)fields.size(), (long)offsets.back());
+    UDM_STOPWATCH_INFORMATION(__FUNCTION__, info);
+#endif
+
+    return UDM_OK;
+}
+
+/**
+ * 集約物理量情報を取得する.
+ * @param [in]  field_names        集約物理量名称リスト
+ * @param [out] fields            集約物理量情報
+ * @param [out] field_ids        集約物理量フィールドID（１～）
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmBoundaryReduction::getReductionFields(
+                const std::vector<std::string> &field_names,
+                std::vector<const UdmSolutionFieldConfig*> &fields,
+                std::vector<UdmSize_t> &field_ids) const
+{
+    UdmFlowSolutions *solutions = this->getParentZone()->getFlowSolutions();
+    if (solutions == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmFlowSolutions is null.");
+    }
+
+    std::vector<std::string>::const_iterator name_itr;
+    for (name_itr=field_names.begin(); name_itr!=field_names.end(); name_itr++) {
+        const UdmSolutionFieldConfig *config = solutions->getSolutionField(*name_itr);
+        UdmSize_t field_id = solutions->getFieldId(*name_itr);
+        if (config == NULL || field_id == 0) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NOTFOUND_FLOWSOLUTION_NAME, "solution_name=%s", name_itr->c_str());
+        }
+        if (config->getGridLocation() != Udm_Vertex) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_FLOWSOLUTION_GRIDLOCATION, "solution_name=%s", name_itr->c_str());
+        }
+        fields.push_back(config);
+        field_ids.push_back(field_id);
+    }
+    return UDM_OK;
+}
+
+/**
+ * 物理量のバッファサイズ(byte)を取得する.
+ * 物理量毎の先頭位置をUDM_BOUNDARYREDUCTION_ALIGNMENTに揃える.
+ * @param num_nodes        節点（ノード）数
+ * @param config        物理量情報
+ * @return        バッファサイズ(byte)
+ */
+size_t UdmBoundaryReduction::getFieldBufferSize(size_t num_nodes, const UdmSolutionFieldConfig *config) const
+{
+    size_t size = num_nodes * config->getNvectorSize() * this->sizeofDataType(config->getDataType());
+    return (size + UDM_BOUNDARYREDUCTION_ALIGNMENT - 1) / UDM_BOUNDARYREDUCTION_ALIGNMENT * UDM_BOUNDARYREDUCTION_ALIGNMENT;
+}
+
+/**
+ * バッファを確保する.
+ * 確保済みサイズ以下であれば再確保しない.
+ * @param [in,out] buffer        バッファ
+ * @param [in,out] capacity        バッファ確保サイズ(byte)
+ * @param [in]     size            必要サイズ(byte)
+ */
+void UdmBoundaryReduction::reserveBuffer(char *&buffer, size_t &capacity, size_t size)
+{
+    if (size <= capacity) return;
+    if (buffer != NULL) delete []buffer;
+    buffer = new char[size];
+    capacity = size;
+}
+
+/**
+ * 内部境界節点（ノード）の物理量を物理量バッファに取得して、接続ランク別に送信バッファに作成する.
+ * 物理量は物理量フィールドIDにて物理量カラムデータから直接取得する.
+ * 物理量が未設定の節点（ノード）は0とする.
+ * @param [in]     config        物理量情報
+ * @param [in]     voxels        節点（ノード）管理クラス
+ * @param [in]     field_id        物理量フィールドID（１～）
+ * @param [out]    values        物理量バッファ : 自ランクの値
+ * @param [in]     positions    接続ランク別の送信バッファ位置
+ */
+template<class VALUE_TYPE>
+void UdmBoundaryReduction::packSolutionValues(
+                const UdmSolutionFieldConfig *config,
+                const UdmEntityVoxels *voxels,
+                UdmSize_t field_id,
+                VALUE_TYPE *values,
+                const std::vector<size_t> &positions)
+{
+    int nvector_size = config->getNvectorSize();
+    size_t num_nodes = this->boundary_nodes.size();
+    memset(values, 0x00, num_nodes*nvector_size*sizeof(VALUE_TYPE));
+
+    size_t n, k;
+    int v;
+    for (n=0; n<num_nodes; n++) {
+        voxels->getEntitySolutionVector<VALUE_TYPE>(this->boundary_nodes[n], field_id, values + n*nvector_size);
+    }
+
+    int i;
+    for (i=0; i<(int)this->neighbor_ranks.size(); i++) {
+        VALUE_TYPE *buf = (VALUE_TYPE*)(this->send_buffer + positions[i]);
+        const size_t *indices = &this->neighbor_indices[0] + this->neighbor_offsets[i];
+        size_t num_indices = this->neighbor_offsets[i+1] - this->neighbor_offsets[i];
+        for (k=0; k<num_indices; k++) {
+            const VALUE_TYPE *src = values + indices[k]*nvector_size;
+            for (v=0; v<nvector_size; v++) {
+                buf[k*nvector_size+v] = src[v];
+            }
+        }
+    }
+}
+
+/**
+ * 接続ランク別の受信データを集約して、内部境界節点（ノード）に設定する.
+ * 総和は共有ランクのランク番号順に加算する.
+ * 集約値は物理量フィールドIDにて物理量カラムデータに直接設定する.
+ * @param [in]     config        物理量情報
+ * @param [in]     voxels        節点（ノード）管理クラス
+ * @param [in]     field_id        物理量フィールドID（１～）
+ * @param [in]     reduce_type    集約演算タイプ
+ * @param [in,out] values        物理量バッファ : 自ランクの値, 集約値の順
+ * @param [in]     positions    接続ランク別の受信バッファ位置
+ */
+template<class VALUE_TYPE>
+void UdmBoundaryReduction::unpackSolutionValues(
+                const UdmSolutionFieldConfig *config,
+                UdmEntityVoxels *voxels,
+                UdmSize_t field_id,
+                UdmReduceType_t reduce_type,
+                VALUE_TYPE *values,
+                const std::vector<size_t> &positions)
+{
+    int nvector_size = config->getNvectorSize();
+    size_t num_nodes = this->boundary_nodes.size();
+    size_t num_values = num_nodes*nvector_size;
+    VALUE_TYPE *results = (VALUE_TYPE*)((char*)values + this->getFieldBufferSize(num_nodes, config));
+    int my_rankno = this->getMpiRankno();
+    int num_ranks = this->neighbor_ranks.size();
+    size_t n;
+    int i;
+
+    // 集約値の初期値 : 総和は0から共有ランクのランク番号順に加算する.
+    if (reduce_type == Udm_ReduceSum) {
+        memset(results, 0x00, num_values*sizeof(VALUE_TYPE));
+    }
+    else {
+        memcpy(results, values, num_values*sizeof(VALUE_TYPE));
+    }
+
+    bool added_myrank = (reduce_type != Udm_ReduceSum);
+    for (i=0; i<num_ranks; i++) {
+        if (!added_myrank && this->neighbor_ranks[i] > my_rankno) {
+            for (n=0; n<num_values; n++) results[n] += values[n];
+            added_myrank = true;
+        }
+        const VALUE_TYPE *buf = (const VALUE_TYPE*)(this->recv_buffer + positions[i]);
+        const size_t *indices = &this->neighbor_indices[0] + this->neighbor_offsets[i];
+        size_t num_indices = this->neighbor_offsets[i+1] - this->neighbor_offsets[i];
+        this->reduceSolutionValues<VALUE_TYPE>(reduce_type, this->neighbor_ranks[i], nvector_size,
+                                    indices, num_indices, buf, results);
+    }
+    if (!added_myrank) {
+        for (n=0; n<num_values; n++) results[n] += values[n];
+    }
+
+    // 内部境界節点（ノード）に設定する.
+    for (n=0; n<num_nodes; n++) {
+        if (nvector_size == 1) {
+            voxels->setEntitySolutionScalar<VALUE_TYPE>(this->boundary_nodes[n], field_id, results[n]);
+        }
+        else {
+            voxels->setEntitySolutionVector<VALUE_TYPE>(this->boundary_nodes[n], field_id, results + n*nvector_size, nvector_size);
+        }
+    }
+}
+
+/**
+ * 接続ランクからの受信データを集約値に演算する.
+ * @param [in]     reduce_type    集約演算タイプ
+ * @param [in]     rankno        接続ランク番号
+ * @param [in]     nvector_size    成分数
+ * @param [in]     indices        節点（ノード）インデックス
+ * @param [in]     num_indices    節点（ノード）インデックス数
+ * @param [in]     recv_values    受信データ
+ * @param [in,out] results        集約値
+ */
+template<class VALUE_TYPE>
+void UdmBoundaryReduction::reduceSolutionValues(
+                UdmReduceType_t reduce_type,
+                int rankno,
+                int nvector_size,
+                const size_t *indices,
+                size_t num_indices,
+                const VALUE_TYPE *recv_values,
+                VALUE_TYPE *results) const
+{
+    size_t k;
+    int v;
+    if (reduce_type == Udm_ReduceSum) {
+        for (k=0; k<num_indices; k++) {
+            VALUE_TYPE *dest = results + indices[k]*nvector_size;
+            const VALUE_TYPE *src = recv_values + k*nvector_size;
+            for (v=0; v<nvector_size; v++) dest[v] += src[v];
+        }
+    }
+    else if (reduce_type == Udm_ReduceMin) {
+        for (k=0; k<num_indices; k++) {
+            VALUE_TYPE *dest = results + indices[k]*nvector_size;
+            const VALUE_TYPE *src = recv_values + k*nvector_size;
+            for (v=0; v<nvector_size; v++) dest[v] = (src[v] < dest[v]) ? src[v] : dest[v];
+        }
+    }
+    else if (reduce_type == Udm_ReduceMax) {
+        for (k=0; k<num_indices; k++) {
+            VALUE_TYPE *dest = results + indices[k]*nvector_size;
+            const VALUE_TYPE *src = recv_values + k*nvector_size;
+            for (v=0; v<nvector_size; v++) dest[v] = (src[v] > dest[v]) ? src[v] : dest[v];
+        }
+    }
+    else if (reduce_type == Udm_ReduceOwner) {
+        for (k=0; k<num_indices; k++) {
+            if (this->owner_ranks[indices[k]] != rankno) continue;
+            VALUE_TYPE *dest = results + indices[k]*nvector_size;
+            const VALUE_TYPE *src = recv_values + k*nvector_size;
+            for (v=0; v<nvector_size; v++) dest[v] = src[v];
+        }
+    }
+}
+
+/**
+ * MPIコミュニケータを取得する.
+ * @return        MPIコミュニケータ
+ */
+MPI_Comm UdmBoundaryReduction::getMpiComm() const
+{
+    if (this->getParentZone() == NULL) return MPI_COMM_NULL;
+    return this->getParentZone()->getMpiComm();
+}
+
+/**
+ * MPIランク番号を取得する.
+ * @return        MPIランク番号
+ */
+int UdmBoundaryReduction::getMpiRankno() const
+{
+    if (this->getParentZone() == NULL) return -1;
+    return this->getParentZone()->getMpiRankno();
+}
+
+/**
+ * MPIプロセス数を取得する.
+ * @return        MPIプロセス数
+ */
+int UdmBoundaryReduction::getMpiProcessSize() const
+{
+    if (this->getParentZone() == NULL) return -1;
+    return this->getParentZone()->getMpiProcessSize();
+}
+
+} /* namespace udm */
@@ -33,7 +33,7 @@ namespace udm
 /**
  * コンストラクタ
  */
-UdmCell::UdmCell()
+UdmCell::UdmCell() : connectivity_elements(NULL), connectivity_offset(0), connectivity_size(0)
 {
     this->initialize();
 }
@@ -42,7 +42,7 @@ UdmCell::UdmCell()
  * コンストラクタ
  * @param   element_type        要素形状タイプ
  */
-UdmCell::UdmCell(UdmElementType_t element_type) : UdmEntity(element_type)
+UdmCell::UdmCell(UdmElementType_t element_type) : UdmEntity(element_type), connectivity_elements(NULL), connectivity_offset(0), connectivity_size(0)
 {
     this->initialize();
 }
@@ -54,6 +54,12 @@ UdmCell::~UdmCell()
 {
     // この要素を参照しているノード、要素からこの要素を削除する.
     this->removeReferencedCells();
+
+    // セクション（要素構成）の接続情報配列を解放する.
+    if (this->connectivity_elements != NULL) {
+        this->connectivity_elements->releaseConnectivity(this);
+        this->connectivity_elements = NULL;
+    }
 }
 
 /**
@@ -63,6 +69,9 @@ void UdmCell::initialize()
 {
     this->elem_id = 0;
     this->nodes.clear();
+    this->connectivity_elements = NULL;
+    this->connectivity_offset = 0;
+    this->connectivity_size = 0;
     this->components.clear();
     this->parent_elements = NULL;
     this->parent_sections = NULL;
@@ -103,6 +112,9 @@ void UdmCell::setElemId(UdmSize_t elem_id)
  */
 UdmSize_t UdmCell::getNumNodes() const
 {
+    if (this->connectivity_elements != NULL) {
+        return this->connectivity_size;
+    }
     return this->nodes.size();
 }
 
@@ -114,6 +126,10 @@ UdmSize_t UdmCell::getNumNodes() const
 UdmNode* UdmCell::getNode(UdmSize_t node_id)  const
 {
     if (node_id <= 0) return NULL;
+    if (this->connectivity_elements != NULL) {
+        if (node_id > this->connectivity_size) return NULL;
+        return this->connectivity_elements->connectivity_nodes[this->connectivity_offset + node_id - 1];
+    }
     if (node_id > this->nodes.size()) return NULL;
     return this->nodes[node_id-1];
 }
@@ -155,11 +171,18 @@ UdmError_t UdmCell::setNodes(const std::vector<UdmNode*> &nodes)
 
 /**
  * 構成ノード（節点）リストを取得する.
- * @return        構成ノード（節点）リスト
+ * @param [out] nodes        構成ノード（節点）リスト
+ * @return        構成ノード（節点）数
  */
-const std::vector<UdmNode*>& UdmCell::getNodes() const
+UdmSize_t UdmCell::getNodes(std::vector<UdmNode*> &nodes) const
 {
-    return this->nodes;
+    UdmSize_t n, num_nodes = this->getNumNodes();
+    nodes.clear();
+    nodes.reserve(num_nodes);
+    for (n=1; n<=num_nodes; n++) {
+        nodes.push_back(this->getNode(n));
+    }
+    return num_nodes;
 }
 
 /**
@@ -170,7 +193,13 @@ const std::vector<UdmNode*>& UdmCell::getNodes() const
 UdmError_t UdmCell::insertNode(UdmNode* node)
 {
     if (node == NULL) return UDM_ERROR;
-    this->nodes.push_back(node);
+    if (this->connectivity_elements != NULL) {
+        // セクション（要素構成）の接続情報配列に追加する.
+        this->connectivity_elements->appendConnectivityNode(this, node);
+    }
+    else {
+        this->nodes.push_back(node);
+    }
 
     // 親要素（セル）を追加する.
     node->insertParentCell(this);
@@ -184,6 +213,9 @@ UdmError_t UdmCell::insertNode(UdmNode* node)
  */
 UdmError_t UdmCell::clearNodes()
 {
+    if (this->connectivity_elements != NULL) {
+        this->connectivity_elements->clearConnectivity(this);
+    }
     this->nodes.clear();
     return UDM_OK;
 }
@@ -205,10 +237,46 @@ UdmElements* UdmCell::getParentElements() const
  */
 UdmError_t UdmCell::setParentElements(UdmElements* parent_elements)
 {
+    if (this->connectivity_elements != parent_elements) {
+        this->detachConnectivity();
+        this->attachConnectivity(parent_elements);
+    }
     this->parent_elements = parent_elements;
+    this->updateSolutionVoxels();
     return UDM_OK;
 }
 
+/**
+ * 構成ノードをセクション（要素構成）の接続情報配列に移動する.
+ * @param elements        接続情報配列を保持するセクション（要素構成）
+ */
+void UdmCell::attachConnectivity(UdmElements *elements)
+{
+    if (elements == NULL) return;
+    if (this->connectivity_elements != NULL) return;
+
+    elements->attachConnectivity(this, this->nodes);
+    this->connectivity_elements = elements;
+
+    // 構成ノードリストのメモリを解放する.
+    std::vector<UdmNode*>().swap(this->nodes);
+    return;
+}
+
+/**
+ * セクション（要素構成）の接続情報配列から構成ノードを要素（セル）に移動する.
+ */
+void UdmCell::detachConnectivity()
+{
+    if (this->connectivity_elements == NULL) return;
+
+    UdmElements *elements = this->connectivity_elements;
+    this->getNodes(this->nodes);
+    elements->releaseConnectivity(this);
+    this->connectivity_elements = NULL;
+    return;
+}
+
 /**
  * 所属ゾーンを取得する.
  * @return        所属ゾーン
@@ -225,6 +293,18 @@ UdmZone* UdmCell::getZone() const
     return NULL;
 }
 
+/**
+ * 物理量データを格納する親ノード・要素構成クラスを取得する.
+ * @return        親要素管理クラス
+ */
+UdmEntityVoxels* UdmCell::getParentVoxels() const
+{
+    if (this->parent_elements != NULL) {
+        return this->parent_elements->getParentSections();
+    }
+    return this->parent_sections;
+}
+
 /**
  * 要素クラスタイプを取得する.
  * @return        要素クラスタイプ=Udm_ComponentClass:部品要素クラス
@@ -258,13 +338,15 @@ void UdmCell::toString(std::string& buf) const
     sprintf(fmt_buf, "%-8s", type_buf.c_str());
     stream <<  fmt_buf << " ";
 
-    for (itr=this->nodes.begin(); itr!=this->nodes.end(); itr++) {
-        if (itr!=this->nodes.begin()) stream << ", ";
-        if ((*itr)->getRealityType() == Udm_Virtual) {
-            stream << (*itr)->getId() << "[" << (*itr)->getMyRankno() << "]";
+    UdmSize_t n, num_nodes = this->getNumNodes();
+    for (n=1; n<=num_nodes; n++) {
+        const UdmNode *node = this->getNode(n);
+        if (n > 1) stream << ", ";
+        if (node->getRealityType() == Udm_Virtual) {
+            stream << node->getId() << "[" << node->getMyRankno() << "]";
         }
         else {
-            stream << (*itr)->getId();
+            stream << node->getId();
         }
     }
     stream << std::endl;
@@ -297,11 +379,12 @@ void UdmCell::toString(std::string& buf) const
 bool UdmCell::equalsNodeIds(const UdmCell* dest_cell) const
 {
     if (dest_cell == NULL) return false;
-    if (this->nodes.size() != dest_cell->nodes.size()) return false;
+    if (this->getNumNodes() != dest_cell->getNumNodes()) return false;
 
     std::set<UdmSize_t> src_ids;
     std::vector<UdmNode*>::const_iterator src_itr;
     std::vector<UdmNode*>::const_iterator dest_itr;
+    UdmSize_t n, num_nodes = this->getNumNodes();
 
 #if 0
     for (dest_itr=dest_cell->nodes.begin(); dest_itr!=dest_cell->nodes.end(); dest_itr++) {
@@ -323,13 +406,13 @@ bool UdmCell::equalsNodeIds(const UdmCell* dest_cell) const
     UdmGlobalRankidList src_rankids(this->getNumNodes());
     UdmGlobalRankidList dest_rankids(this->getNumNodes());
 
-    for (src_itr=this->nodes.begin(); src_itr!=this->nodes.end(); src_itr++) {
-        UdmNode *src_node = (*src_itr);
+    for (n=1; n<=num_nodes; n++) {
+        UdmNode *src_node = this->getNode(n);
         src_rankids.addGlobalRankid(src_node->getMyRankno(), src_node->getId());
     }
 
-    for (dest_itr=dest_cell->nodes.begin(); dest_itr!=dest_cell->nodes.end(); dest_itr++) {
-        UdmNode *dest_node = (*dest_itr);
+    for (n=1; n<=num_nodes; n++) {
+        UdmNode *dest_node = dest_cell->getNode(n);
         dest_rankids.addGlobalRankid(dest_node->getMyRankno(), dest_node->getId());
     }
 
@@ -344,32 +427,36 @@ bool UdmCell::equalsNodeIds(const UdmCell* dest_cell) const
 /**
  * 要素（セル）を生成する.
  * @param elem_type        要素タイプ
+ * @param pool        メモリプール : NULLの場合はヒープから割り当てる.
  * @return        生成要素（セル）
  */
-UdmCell* UdmCell::factoryCell(UdmElementType_t elem_type)
+UdmCell* UdmCell::factoryCell(UdmElementType_t elem_type, UdmEntityPool *pool)
 {
-
-    int num_vertex = UdmGeneral::getNumVertexOfElementType(elem_type);
-    if (num_vertex <= 0) return NULL;
-
-    UdmCell* cell = NULL;
-    if (elem_type == Udm_BAR_2) {
-        cell = new UdmBar(elem_type);
-    }
-    else if (elem_type == Udm_TRI_3 || elem_type == Udm_QUAD_4) {
-        cell = new UdmShell(elem_type);
-    }
-    else if (elem_type == Udm_TETRA_4
-            || elem_type == Udm_PYRA_5
-            || elem_type == Udm_PENTA_6
-            || elem_type == Udm_HEXA_8) {
-        cell = new UdmSolid(elem_type);
-    }
-    else {
-        return NULL;
+    switch (elem_type) {
+    case Udm_BAR_2:   return UdmCell::factoryCell<Udm_BAR_2>(pool);
+    case Udm_TRI_3:   return UdmCell::factoryCell<Udm_TRI_3>(pool);
+    case Udm_QUAD_4:  return UdmCell::factoryCell<Udm_QUAD_4>(pool);
+    case Udm_TETRA_4: return UdmCell::factoryCell<Udm_TETRA_4>(pool);
+    case Udm_PYRA_5:  return UdmCell::factoryCell<Udm_PYRA_5>(pool);
+    case Udm_PENTA_6: return UdmCell::factoryCell<Udm_PENTA_6>(pool);
+    case Udm_HEXA_8:  return UdmCell::factoryCell<Udm_HEXA_8>(pool);
+    default:
+        break;
     }
 
-    return cell;
+    return NULL;
+}
+
+/**
+ * 要素形状タイプを指定して要素（セル）を生成する.
+ * 生成クラスはUdmElementTraits<ELEMENT_TYPE>::cell_typeとする.
+ * @param pool        メモリプール : NULLの場合はヒープから割り当てる.
+ * @return        生成要素（セル）
+ */
+template <UdmElementType_t ELEMENT_TYPE>
+UdmCell* UdmCell::factoryCell(UdmEntityPool *pool)
+{
+    return new (pool) typename UdmElementTraits<ELEMENT_TYPE>::cell_type(ELEMENT_TYPE);
 }
 
 
@@ -384,12 +471,33 @@ UdmComponent* UdmCell::factoryComponentCell(UdmElementType_t elem_type)
     int num_vertex = UdmGeneral::getNumVertexOfElementType(elem_type);
     if (num_vertex <= 0) return NULL;
 
-    UdmComponent *component = new UdmComponent(elem_type);
+    // 所属ゾーンのメモリプールから生成する.
+    UdmEntityPool *pool = NULL;
+    if (this->getParentSections() != NULL) {
+        pool = this->getParentSections()->getEntityPool();
+    }
+    UdmComponent *component = new (pool) UdmComponent(elem_type);
 
     return component;
 }
 
 
+/**
+ * 部品要素（セル）の構成節点（ノード）を取得する.
+ * 構成節点（ノード）は要素（セル）内の頂点番号（１～）とする.
+ * @param [in]  component_id        部品要素ID（１～）
+ * @param [out] component_type        部品要素形状タイプ
+ * @param [out] component_nodes        部品要素-頂点テーブル : UDM_CELL_MAXCOMPONENTNODES以上
+ * @return        部品要素の頂点（ノード）数 : 部品要素が存在しない場合は0を返す。
+ */
+unsigned int UdmCell::getComponentNodes(
+                    unsigned int component_id,
+                    UdmElementType_t &component_type,
+                    UdmSize_t component_nodes[]) const
+{
+    return UdmElementTopology::getComponentNodes(this->getElementType(), component_id, component_type, component_nodes);
+}
+
 /**
  * 部品要素（セル）の数を取得する.
  * @return        部品要素（セル）数
@@ -425,20 +533,26 @@ UdmSize_t UdmCell::createComponentCell(UdmElementType_t element_type, unsigned i
     UdmSections* sections = this->getParentSections();
     if (sections == NULL) return 0;
 
-    // 部品要素（セル）の生成
-    UdmComponent *component = this->factoryComponentCell(element_type);
+    // 部品要素（セル）の構成節点（ノード）
+    std::vector<UdmNode*> component_nodes;
+    component_nodes.reserve(num_nodes);
     for (i=0; i<num_nodes; i++) {
         UdmNode* node = this->getNode(face_nodes[i]);
         if (node == NULL) {
-            delete component;
             return 0;
         }
-        component->insertNode(node);
+        component_nodes.push_back(node);
     }
 
     // 同一部品要素（セル）が追加済みであるかチェックする.
-    UdmComponent* found_cell = sections->findComponentCell(component);
+    UdmComponent* found_cell = sections->findComponentCell(component_nodes);
     if (found_cell == NULL) {
+        // 部品要素（セル）の生成
+        UdmComponent *component = this->factoryComponentCell(element_type);
+        if (component == NULL) return 0;
+        for (i=0; i<num_nodes; i++) {
+            component->insertNode(component_nodes[i]);
+        }
         UdmSize_t cell_id = sections->insertComponentCell(component);
         if (cell_id <= 0) {
             delete component;
@@ -446,11 +560,6 @@ UdmSize_t UdmCell::createComponentCell(UdmElementType_t element_type, unsigned i
         }
         found_cell = component;
     }
-    else {
-        // 追加済みの部品要素（セル）を用いる
-        delete component;
-    }
-
 
     // 親要素を追加
     found_cell->insertParentCell(this);
@@ -615,16 +724,15 @@ UdmError_t UdmCell::freeDeserialize(UdmCell *cell)
         cell->parent_elements = NULL;
     }
 
-    int n = 0;
     // デシリアライズにて生成された要素（セル）を削除する.
-    std::vector<UdmNode*>::iterator itr = cell->nodes.begin();
-    for (itr=cell->nodes.begin(); itr!=cell->nodes.end(); itr++) {
-        UdmNode* node = (*itr);
+    UdmSize_t n, num_nodes = cell->getNumNodes();
+    for (n=1; n<=num_nodes; n++) {
+        UdmNode* node = cell->getNode(n);
         if (node != NULL) {
             UdmNode::freeDeserialize(node);
         }
     }
-    cell->nodes.clear();
+    cell->clearNodes();
 
     delete cell;
     cell = NULL;
@@ -662,9 +770,9 @@ UdmError_t UdmCell::removeReferencedCells()
     }
 
     // 構成節点（ノード）から親要素（セル）を削除する.
-    std::vector<UdmNode*>::iterator  itr_node;
-    for (itr_node=this->nodes.begin(); itr_node!=this->nodes.end(); itr_node++) {
-        UdmNode* node = (*itr_node);
+    UdmSize_t n, num_nodes = this->getNumNodes();
+    for (n=1; n<=num_nodes; n++) {
+        UdmNode* node = this->getNode(n);
         // 親要素（セル）を削除する.
         num_parents = node->removeReferencedCell(this);
     }
@@ -749,9 +857,9 @@ void UdmCell::setExportRankno(int rankno)
     // 要素（セル）に対してエクスポート先ランク番号を設定する.
     this->addMpiRankInfo(rankno, 0);
 
-    std::vector<UdmNode*>::const_iterator itr;
-    for (itr=this->nodes.begin(); itr!=this->nodes.end(); itr++) {
-        (*itr)->addMpiRankInfo(rankno, 0);
+    UdmSize_t n, num_nodes = this->getNumNodes();
+    for (n=1; n<=num_nodes; n++) {
+        this->getNode(n)->addMpiRankInfo(rankno, 0);
     }
 }
 
@@ -777,6 +885,7 @@ UdmSections* UdmCell::getParentSections() const
 void UdmCell::setParentSections(UdmSections* sections)
 {
     this->parent_sections = sections;
+    this->updateSolutionVoxels();
 }
 
 
@@ -799,14 +908,11 @@ UdmSize_t UdmCell::getNumNeighborCells() const
  */
 UdmCell* UdmCell::getNeighborCell(int neighbor_id) const
 {
+    if (neighbor_id <= 0) return NULL;
     UdmScannerCells scanner;
-    UdmSize_t num_cells = scanner.scannerNeighborCells(this);
-    if (num_cells <= 0) return 0;
-    const std::vector<std::vector<UdmEntity*> > scan_array = scanner.getScanArrays();
-    if (scan_array.size() <= 0) return 0;
-    std::vector<UdmEntity*> cell_array = scan_array[0];
+    std::vector<UdmEntity*> cell_array;
+    scanner.getNeighborCells(this, cell_array);
 
-    if (neighbor_id <= 0) return NULL;
     if (neighbor_id > cell_array.size()) return NULL;
     return static_cast<UdmCell*>(cell_array[neighbor_id-1]);
 }
@@ -823,12 +929,15 @@ size_t UdmCell::getMemSize() const
     printf("this size=%ld\n", sizeof(*this));
     printf("elem_id size=%ld [offset=%ld]\n", sizeof(this->elem_id), offsetof(UdmCell, elem_id));
     printf("nodes size=%ld [count=%d] [offset=%ld]\n", sizeof(this->nodes), this->nodes.size(), offsetof(UdmCell, nodes));
+    printf("connectivity_elements pointer size=%ld [offset=%ld]\n", sizeof(this->connectivity_elements), offsetof(UdmCell, connectivity_elements));
+    printf("connectivity_offset size=%ld [offset=%ld]\n", sizeof(this->connectivity_offset), offsetof(UdmCell, connectivity_offset));
+    printf("connectivity_size size=%ld [count=%ld] [offset=%ld]\n", sizeof(this->connectivity_size), this->connectivity_size, offsetof(UdmCell, connectivity_size));
     printf("parent_elements pointer size=%ld [offset=%ld]\n", sizeof(this->parent_elements), offsetof(UdmCell, parent_elements));
     printf("parent_sections pointer size=%ld [offset=%ld]\n", sizeof(this->parent_sections), offsetof(UdmCell, parent_sections));
     printf("components size=%ld [count=%d] [offset=%ld]\n", sizeof(this->components), this->components.size(), offsetof(UdmCell, components));
 
     size += this->getNumParentCells()*sizeof(UdmCell*);
-    size += this->nodes.size()*sizeof(UdmNode*) + this->components.size()*sizeof(UdmCell*);
+    size += this->getNumNodes()*sizeof(UdmNode*) + this->components.size()*sizeof(UdmCell*);
 #endif
 
     return size;
@@ -881,6 +990,11 @@ UdmElementType_t UdmCell::getElementType() const
  */
 void UdmCell::removeNode(const UdmNode* node)
 {
+    if (this->connectivity_elements != NULL) {
+        this->connectivity_elements->removeConnectivityNode(this, node);
+        return;
+    }
+
     std::vector<UdmNode*>::iterator itr;
     for (itr=this->nodes.begin(); itr!=this->nodes.end(); itr++) {
         if ((*itr) == node) {
@@ -899,6 +1013,10 @@ void UdmCell::removeNode(const UdmNode* node)
  */
 void UdmCell::finalize()
 {
+    if (this->connectivity_elements != NULL) {
+        this->connectivity_elements->releaseConnectivity(this);
+        this->connectivity_elements = NULL;
+    }
     this->nodes.clear();
     this->components.clear();
     this->parent_elements = NULL;
@@ -906,4 +1024,12 @@ void UdmCell::finalize()
 
     return;
 }
+
+template UdmCell* UdmCell::factoryCell<Udm_BAR_2>(UdmEntityPool *pool);
+template UdmCell* UdmCell::factoryCell<Udm_TRI_3>(UdmEntityPool *pool);
+template UdmCell* UdmCell::factoryCell<Udm_QUAD_4>(UdmEntityPool *pool);
+template UdmCell* UdmCell::factoryCell<Udm_TETRA_4>(UdmEntityPool *pool);
+template UdmCell* UdmCell::factoryCell<Udm_PYRA_5>(UdmEntityPool *pool);
+template UdmCell* UdmCell::factoryCell<Udm_PENTA_6>(UdmEntityPool *pool);
+template UdmCell* UdmCell::factoryCell<Udm_HEXA_8>(UdmEntityPool *pool);
 } /* namespace udm */
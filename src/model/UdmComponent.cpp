@@ -49,6 +49,46 @@ UdmComponent::~UdmComponent()
     this->removeReferencedCells();
 }
 
+/**
+ * 部品要素（セル）のオブジェクト領域をヒープから割り当てる.
+ * @param size        オブジェクトサイズ
+ * @return        オブジェクト領域
+ */
+void* UdmComponent::operator new(size_t size)
+{
+    return UdmEntityPool::allocateEntity(size, NULL);
+}
+
+/**
+ * 部品要素（セル）のオブジェクト領域をメモリプールから割り当てる.
+ * @param size        オブジェクトサイズ
+ * @param pool        メモリプール : NULLの場合はヒープから割り当てる.
+ * @return        オブジェクト領域
+ */
+void* UdmComponent::operator new(size_t size, UdmEntityPool *pool)
+{
+    return UdmEntityPool::allocateEntity(size, pool);
+}
+
+/**
+ * 部品要素（セル）のオブジェクト領域を解放する.
+ * @param ptr        オブジェクト領域
+ */
+void UdmComponent::operator delete(void *ptr)
+{
+    UdmEntityPool::deallocateEntity(ptr);
+}
+
+/**
+ * 部品要素（セル）のオブジェクト領域を解放する:コンストラクタ例外時.
+ * @param ptr        オブジェクト領域
+ * @param pool        メモリプール
+ */
+void UdmComponent::operator delete(void *ptr, UdmEntityPool *pool)
+{
+    UdmEntityPool::deallocateEntity(ptr);
+}
+
 
 /**
  * IDを取得する.
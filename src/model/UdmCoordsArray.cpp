@@ -0,0 +1,394 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmCoordsArray.cpp
+ * 座標値配列クラスのソースファイル
+ */
+
+#include "model/UdmCoordsArray.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ : Udm_RealSingle
+ */
+UdmCoordsArray::UdmCoordsArray() : UdmGeneral(Udm_RealSingle)
+{
+    this->initialize();
+}
+
+/**
+ * コンストラクタ
+ * @param datatype        座標値データ型 : Udm_RealSingle | Udm_RealDouble
+ */
+UdmCoordsArray::UdmCoordsArray(UdmDataType_t datatype) : UdmGeneral(datatype)
+{
+    this->initialize();
+    if (datatype != Udm_RealDouble) {
+        this->setDataType(Udm_RealSingle);
+    }
+}
+
+/**
+ * デストラクタ
+ */
+UdmCoordsArray::~UdmCoordsArray()
+{
+    this->clearCoordsArray();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmCoordsArray::initialize()
+{
+    this->coords_x = NULL;
+    this->coords_y = NULL;
+    this->coords_z = NULL;
+    this->capacity = 0;
+}
+
+/**
+ * 座標値配列を破棄する.
+ */
+void UdmCoordsArray::clearCoordsArray()
+{
+    this->deleteDataArray(this->coords_x, this->getDataType());
+    this->deleteDataArray(this->coords_y, this->getDataType());
+    this->deleteDataArray(this->coords_z, this->getDataType());
+    this->initialize();
+}
+
+/**
+ * 確保スロット数を取得する.
+ * @return        確保スロット数
+ */
+UdmSize_t UdmCoordsArray::getCapacity() const
+{
+    return this->capacity;
+}
+
+/**
+ * 格納スロットを確保する.
+ * 確保済みの座標値はコピーする.
+ * @param size        確保スロット数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCoordsArray::reserveSlots(UdmSize_t size)
+{
+    if (size <= this->capacity) return UDM_OK;
+
+    UdmDataType_t datatype = this->getDataType();
+    unsigned int sizeofdata = this->sizeofDataType(datatype);
+    void *new_x = this->createDataArray(datatype, size);
+    void *new_y = this->createDataArray(datatype, size);
+    void *new_z = this->createDataArray(datatype, size);
+    if (new_x == NULL || new_y == NULL || new_z == NULL) {
+        this->deleteDataArray(new_x, datatype);
+        this->deleteDataArray(new_y, datatype);
+        this->deleteDataArray(new_z, datatype);
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid coordinates datatype[datatype=%d].", datatype);
+    }
+    if (this->capacity > 0) {
+        memcpy(new_x, this->coords_x, this->capacity*sizeofdata);
+        memcpy(new_y, this->coords_y, this->capacity*sizeofdata);
+        memcpy(new_z, this->coords_z, this->capacity*sizeofdata);
+    }
+    this->deleteDataArray(this->coords_x, datatype);
+    this->deleteDataArray(this->coords_y, datatype);
+    this->deleteDataArray(this->coords_z, datatype);
+    this->coords_x = new_x;
+    this->coords_y = new_y;
+    this->coords_z = new_z;
+    this->capacity = size;
+
+    return UDM_OK;
+}
+
+/**
+ * 座標値データ型を変更する.
+ * 確保済みの座標値は変更データ型に変換する.
+ * @param datatype        座標値データ型 : Udm_RealSingle | Udm_RealDouble
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCoordsArray::changeDataType(UdmDataType_t datatype)
+{
+    if (datatype != Udm_RealSingle && datatype != Udm_RealDouble) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid coordinates datatype[datatype=%d].", datatype);
+    }
+    if (datatype == this->getDataType()) return UDM_OK;
+
+    UdmSize_t size = this->capacity;
+    if (size <= 0) {
+        this->clearCoordsArray();
+        this->setDataType(datatype);
+        return UDM_OK;
+    }
+
+    void *new_x = this->createDataArray(datatype, size);
+    void *new_y = this->createDataArray(datatype, size);
+    void *new_z = this->createDataArray(datatype, size);
+    if (datatype == Udm_RealDouble) {
+        this->getCoordinatesArray(0, size, (double*)new_x, (double*)new_y, (double*)new_z);
+    }
+    else {
+        this->getCoordinatesArray(0, size, (float*)new_x, (float*)new_y, (float*)new_z);
+    }
+    this->clearCoordsArray();
+    this->setDataType(datatype);
+    this->coords_x = new_x;
+    this->coords_y = new_y;
+    this->coords_z = new_z;
+    this->capacity = size;
+
+    return UDM_OK;
+}
+
+/**
+ * 格納スロットを並び替える.
+ * 並び替え後のスロット(n)に並び替え前のスロット(src_slots[n])の座標値を格納する.
+ * @param src_slots        並び替え前のスロットリスト
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCoordsArray::rearrangeSlots(const std::vector<UdmSize_t> &src_slots)
+{
+    UdmDataType_t datatype = this->getDataType();
+    UdmSize_t size = this->capacity;
+    if (size < src_slots.size()) size = src_slots.size();
+    if (size <= 0) return UDM_OK;
+
+    void *new_x = this->createDataArray(datatype, size);
+    void *new_y = this->createDataArray(datatype, size);
+    void *new_z = this->createDataArray(datatype, size);
+    UdmSize_t n, num_slots = src_slots.size();
+    for (n=0; n<num_slots; n++) {
+        UdmSize_t src = src_slots[n];
+        if (src >= this->capacity) continue;
+        if (datatype == Udm_RealDouble) {
+            ((double*)new_x)[n] = ((const double*)this->coords_x)[src];
+            ((double*)new_y)[n] = ((const double*)this->coords_y)[src];
+            ((double*)new_z)[n] = ((const double*)this->coords_z)[src];
+        }
+        else {
+            ((float*)new_x)[n] = ((const float*)this->coords_x)[src];
+            ((float*)new_y)[n] = ((const float*)this->coords_y)[src];
+            ((float*)new_z)[n] = ((const float*)this->coords_z)[src];
+        }
+    }
+    this->clearCoordsArray();
+    this->coords_x = new_x;
+    this->coords_y = new_y;
+    this->coords_z = new_z;
+    this->capacity = size;
+
+    return UDM_OK;
+}
+
+/**
+ * X座標配列の先頭ポインタを取得する.
+ * 座標値データ型(getDataType())の配列である.
+ * @return        X座標配列
+ */
+const void* UdmCoordsArray::getCoordinatesXPointer() const
+{
+    return this->coords_x;
+}
+
+/**
+ * Y座標配列の先頭ポインタを取得する.
+ * 座標値データ型(getDataType())の配列である.
+ * @return        Y座標配列
+ */
+const void* UdmCoordsArray::getCoordinatesYPointer() const
+{
+    return this->coords_y;
+}
+
+/**
+ * Z座標配列の先頭ポインタを取得する.
+ * 座標値データ型(getDataType())の配列である.
+ * @return        Z座標配列
+ */
+const void* UdmCoordsArray::getCoordinatesZPointer() const
+{
+    return this->coords_z;
+}
+
+/**
+ * 連続スロットのXYZ座標を取得する.
+ * @param [in]  start_slot        取得開始スロット（０～）
+ * @param [in]  size            取得スロット数
+ * @param [out] x        X座標配列
+ * @param [out] y        Y座標配列
+ * @param [out] z        Z座標配列
+ * @return        取得スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::getCoordinatesArray(
+                    UdmSize_t start_slot,
+                    UdmSize_t size,
+                    VALUE_TYPE *x,
+                    VALUE_TYPE *y,
+                    VALUE_TYPE *z) const
+{
+    this->copyCoordinates(this->coords_x, start_slot, size, x);
+    this->copyCoordinates(this->coords_y, start_slot, size, y);
+    return this->copyCoordinates(this->coords_z, start_slot, size, z);
+}
+template UdmSize_t UdmCoordsArray::getCoordinatesArray<float>(UdmSize_t start_slot, UdmSize_t size, float *x, float *y, float *z) const;
+template UdmSize_t UdmCoordsArray::getCoordinatesArray<double>(UdmSize_t start_slot, UdmSize_t size, double *x, double *y, double *z) const;
+
+/**
+ * 連続スロットのX座標を取得する.
+ * @param [in]  start_slot        取得開始スロット（０～）
+ * @param [in]  size            取得スロット数
+ * @param [out] coords        X座標配列
+ * @return        取得スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::getCoordinatesX(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *coords) const
+{
+    return this->copyCoordinates(this->coords_x, start_slot, size, coords);
+}
+template UdmSize_t UdmCoordsArray::getCoordinatesX<float>(UdmSize_t start_slot, UdmSize_t size, float *coords) const;
+template UdmSize_t UdmCoordsArray::getCoordinatesX<double>(UdmSize_t start_slot, UdmSize_t size, double *coords) const;
+
+/**
+ * 連続スロットのY座標を取得する.
+ * @param [in]  start_slot        取得開始スロット（０～）
+ * @param [in]  size            取得スロット数
+ * @param [out] coords        Y座標配列
+ * @return        取得スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::getCoordinatesY(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *coords) const
+{
+    return this->copyCoordinates(this->coords_y, start_slot, size, coords);
+}
+template UdmSize_t UdmCoordsArray::getCoordinatesY<float>(UdmSize_t start_slot, UdmSize_t size, float *coords) const;
+template UdmSize_t UdmCoordsArray::getCoordinatesY<double>(UdmSize_t start_slot, UdmSize_t size, double *coords) const;
+
+/**
+ * 連続スロットのZ座標を取得する.
+ * @param [in]  start_slot        取得開始スロット（０～）
+ * @param [in]  size            取得スロット数
+ * @param [out] coords        Z座標配列
+ * @return        取得スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::getCoordinatesZ(UdmSize_t start_slot, UdmSize_t size, VALUE_TYPE *coords) const
+{
+    return this->copyCoordinates(this->coords_z, start_slot, size, coords);
+}
+template UdmSize_t UdmCoordsArray::getCoordinatesZ<float>(UdmSize_t start_slot, UdmSize_t size, float *coords) const;
+template UdmSize_t UdmCoordsArray::getCoordinatesZ<double>(UdmSize_t start_slot, UdmSize_t size, double *coords) const;
+
+/**
+ * 連続スロットにXYZ座標を設定する.
+ * 確保スロット数が不足する場合は、確保スロット数を拡張する.
+ * @param start_slot        設定開始スロット（０～）
+ * @param size            設定スロット数
+ * @param x        X座標配列
+ * @param y        Y座標配列
+ * @param z        Z座標配列
+ * @return        設定スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::setCoordinatesArray(
+                    UdmSize_t start_slot,
+                    UdmSize_t size,
+                    const VALUE_TYPE *x,
+                    const VALUE_TYPE *y,
+                    const VALUE_TYPE *z)
+{
+    if (this->reserveSlots(start_slot+size) != UDM_OK) return 0;
+    this->storeCoordinates(this->coords_x, start_slot, size, x);
+    this->storeCoordinates(this->coords_y, start_slot, size, y);
+    return this->storeCoordinates(this->coords_z, start_slot, size, z);
+}
+template UdmSize_t UdmCoordsArray::setCoordinatesArray<float>(UdmSize_t start_slot, UdmSize_t size, const float *x, const float *y, const float *z);
+template UdmSize_t UdmCoordsArray::setCoordinatesArray<double>(UdmSize_t start_slot, UdmSize_t size, const double *x, const double *y, const double *z);
+
+/**
+ * 座標配列から連続スロットの座標値をコピーする.
+ * @param [in]  src        座標配列
+ * @param [in]  start_slot        取得開始スロット（０～）
+ * @param [in]  size            取得スロット数
+ * @param [out] dest        取得座標値
+ * @return        取得スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::copyCoordinates(
+                    const void *src,
+                    UdmSize_t start_slot,
+                    UdmSize_t size,
+                    VALUE_TYPE *dest) const
+{
+    UdmSize_t n;
+    if (src == NULL || dest == NULL) return 0;
+    if (start_slot >= this->capacity) return 0;
+    if (start_slot + size > this->capacity) size = this->capacity - start_slot;
+
+    if (this->getDataType() == Udm_RealDouble) {
+        const double *values = (const double*)src + start_slot;
+        for (n=0; n<size; n++) dest[n] = (VALUE_TYPE)values[n];
+    }
+    else {
+        const float *values = (const float*)src + start_slot;
+        for (n=0; n<size; n++) dest[n] = (VALUE_TYPE)values[n];
+    }
+    return size;
+}
+
+/**
+ * 座標配列の連続スロットに座標値を格納する.
+ * @param dest        座標配列
+ * @param start_slot        設定開始スロット（０～）
+ * @param size            設定スロット数
+ * @param src        設定座標値
+ * @return        設定スロット数
+ */
+template<class VALUE_TYPE>
+UdmSize_t UdmCoordsArray::storeCoordinates(
+                    void *dest,
+                    UdmSize_t start_slot,
+                    UdmSize_t size,
+                    const VALUE_TYPE *src)
+{
+    UdmSize_t n;
+    if (src == NULL || dest == NULL) return 0;
+
+    if (this->getDataType() == Udm_RealDouble) {
+        double *values = (double*)dest + start_slot;
+        for (n=0; n<size; n++) values[n] = (double)src[n];
+    }
+    else {
+        float *values = (float*)dest + start_slot;
+        for (n=0; n<size; n++) values[n] = (float)src[n];
+    }
+    return size;
+}
+
+/**
+ * メモリサイズを取得する.
+ * @return        メモリサイズ
+ */
+size_t UdmCoordsArray::getMemSize() const
+{
+    size_t size = sizeof(*this);
+    size += 3*this->capacity*this->sizeofDataType(this->getDataType());
+    return size;
+}
+
+} /* namespace udm */
@@ -0,0 +1,173 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmElementTopology.cpp
+ * 要素形状タイプ位相情報クラスのソースファイル
+ */
+
+#include "model/UdmElementTopology.h"
+
+namespace udm
+{
+
+// エッジID | 接続ノードID
+//    E1   |   N1, N2
+//    E2   |   N2, N3
+//    E3   |   N3, N1
+const UdmSize_t UdmElementTraits<Udm_TRI_3>::component_nodes[][UDM_TOPOLOGY_COMPONENTSTRIDE] = {
+                                            {Udm_BAR_2, 1,2,0,0},
+                                            {Udm_BAR_2, 2,3,0,0},
+                                            {Udm_BAR_2, 3,1,0,0} };
+
+// エッジID | 接続ノードID
+//    E1   |   N1, N2
+//    E2   |   N2, N3
+//    E3   |   N3, N4
+//    E4   |   N4, N1
+const UdmSize_t UdmElementTraits<Udm_QUAD_4>::component_nodes[][UDM_TOPOLOGY_COMPONENTSTRIDE] = {
+                                            {Udm_BAR_2, 1,2,0,0},
+                                            {Udm_BAR_2, 2,3,0,0},
+                                            {Udm_BAR_2, 3,4,0,0},
+                                            {Udm_BAR_2, 4,1,0,0} };
+
+// 面ID |  接続ノードID
+//  F1  |  N1,N3,N2
+//  F2  |  N1,N2,N4
+//  F3  |  N2,N3,N4
+//  F4  |  N3,N1,N4
+const UdmSize_t UdmElementTraits<Udm_TETRA_4>::component_nodes[][UDM_TOPOLOGY_COMPONENTSTRIDE] = {
+                                            {Udm_TRI_3, 1,3,2,0},
+                                            {Udm_TRI_3, 1,2,4,0},
+                                            {Udm_TRI_3, 2,3,4,0},
+                                            {Udm_TRI_3, 3,1,4,0} };
+
+// 面ID |  接続ノードID
+//  F1  |  N1,N4,N3,N2
+//  F2  |  N1,N2,N5
+//  F3  |  N2,N3,N5
+//  F4  |  N3,N4,N5
+//  F5  |  N4,N1,N5
+const UdmSize_t UdmElementTraits<Udm_PYRA_5>::component_nodes[][UDM_TOPOLOGY_COMPONENTSTRIDE] = {
+                                            {Udm_QUAD_4, 1,4,3,2},
+                                            {Udm_TRI_3,  1,2,5,0},
+                                            {Udm_TRI_3,  2,3,5,0},
+                                            {Udm_TRI_3,  3,4,5,0},
+                                            {Udm_TRI_3,  4,1,5,0} };
+
+// 面ID |  接続ノードID
+//  F1  |  N1,N2,N5,N4
+//  F2  |  N2,N3,N6,N5
+//  F3  |  N3,N1,N4,N6
+//  F4  |  N1,N3,N2
+//  F5  |  N4,N5,N6
+const UdmSize_t UdmElementTraits<Udm_PENTA_6>::component_nodes[][UDM_TOPOLOGY_COMPONENTSTRIDE] = {
+                                            {Udm_QUAD_4, 1,2,5,4},
+                                            {Udm_QUAD_4, 2,3,6,5},
+                                            {Udm_QUAD_4, 3,1,4,6},
+                                            {Udm_TRI_3,  1,3,2,0},
+                                            {Udm_TRI_3,  4,5,6,0} };
+
+// 面ID |  接続ノードID
+//  F1  |  N1,N4,N3,N2
+//  F2  |  N1,N2,N6,N5
+//  F3  |  N2,N3,N7,N6
+//  F4  |  N3,N4,N8,N7
+//  F5  |  N1,N5,N8,N4
+//  F6  |  N5,N6,N7,N8
+const UdmSize_t UdmElementTraits<Udm_HEXA_8>::component_nodes[][UDM_TOPOLOGY_COMPONENTSTRIDE] = {
+                                            {Udm_QUAD_4, 1,4,3,2},
+                                            {Udm_QUAD_4, 1,2,6,5},
+                                            {Udm_QUAD_4, 2,3,7,6},
+                                            {Udm_QUAD_4, 3,4,8,7},
+                                            {Udm_QUAD_4, 1,5,8,4},
+                                            {Udm_QUAD_4, 5,6,7,8} };
+
+/**
+ * 位相情報テーブル : 要素形状タイプ = インデックス
+ */
+const UdmElementTopology::UdmTopologyInfo UdmElementTopology::topology_table[Udm_MIXED+1] = {
+    // Udm_ElementTypeUnknown
+    {0, 0, 0, NULL},
+    // Udm_NODE
+    {UdmElementTraits<Udm_NODE>::NUM_VERTEX,
+     UdmElementTraits<Udm_NODE>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_NODE>::DIMENSIONS,
+     NULL},
+    // Udm_BAR_2
+    {UdmElementTraits<Udm_BAR_2>::NUM_VERTEX,
+     UdmElementTraits<Udm_BAR_2>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_BAR_2>::DIMENSIONS,
+     NULL},
+    // Udm_TRI_3
+    {UdmElementTraits<Udm_TRI_3>::NUM_VERTEX,
+     UdmElementTraits<Udm_TRI_3>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_TRI_3>::DIMENSIONS,
+     UdmElementTraits<Udm_TRI_3>::component_nodes[0]},
+    // Udm_QUAD_4
+    {UdmElementTraits<Udm_QUAD_4>::NUM_VERTEX,
+     UdmElementTraits<Udm_QUAD_4>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_QUAD_4>::DIMENSIONS,
+     UdmElementTraits<Udm_QUAD_4>::component_nodes[0]},
+    // Udm_TETRA_4
+    {UdmElementTraits<Udm_TETRA_4>::NUM_VERTEX,
+     UdmElementTraits<Udm_TETRA_4>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_TETRA_4>::DIMENSIONS,
+     UdmElementTraits<Udm_TETRA_4>::component_nodes[0]},
+    // Udm_PYRA_5
+    {UdmElementTraits<Udm_PYRA_5>::NUM_VERTEX,
+     UdmElementTraits<Udm_PYRA_5>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_PYRA_5>::DIMENSIONS,
+     UdmElementTraits<Udm_PYRA_5>::component_nodes[0]},
+    // Udm_PENTA_6
+    {UdmElementTraits<Udm_PENTA_6>::NUM_VERTEX,
+     UdmElementTraits<Udm_PENTA_6>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_PENTA_6>::DIMENSIONS,
+     UdmElementTraits<Udm_PENTA_6>::component_nodes[0]},
+    // Udm_HEXA_8
+    {UdmElementTraits<Udm_HEXA_8>::NUM_VERTEX,
+     UdmElementTraits<Udm_HEXA_8>::NUM_COMPONENTS,
+     UdmElementTraits<Udm_HEXA_8>::DIMENSIONS,
+     UdmElementTraits<Udm_HEXA_8>::component_nodes[0]},
+    // Udm_MIXED
+    {0, 0, 0, NULL}
+};
+
+/**
+ * 要素形状タイプの部品要素の構成節点（ノード）を取得する.
+ * 構成節点（ノード）は要素（セル）内の頂点番号（１～）とする.
+ * @param [in]  elem_type        要素形状タイプ
+ * @param [in]  component_id        部品要素ID（１～）
+ * @param [out] component_type        部品要素形状タイプ : Udm_BAR_2 | Udm_TRI_3 | Udm_QUAD_4
+ * @param [out] component_nodes        部品要素-頂点テーブル : UDM_CELL_MAXCOMPONENTNODES以上
+ * @return        部品要素の頂点（ノード）数 : 部品要素が存在しない場合は0を返す。
+ */
+unsigned int UdmElementTopology::getComponentNodes(
+                    UdmElementType_t elem_type,
+                    unsigned int component_id,
+                    UdmElementType_t &component_type,
+                    UdmSize_t component_nodes[])
+{
+    const UdmSize_t *table = UdmElementTopology::getComponentTable(elem_type);
+    if (table == NULL) return 0;
+    if (component_id <= 0 || component_id > (unsigned int)topology_table[elem_type].num_components) return 0;
+
+    const UdmSize_t *component = table + (component_id-1)*UDM_TOPOLOGY_COMPONENTSTRIDE;
+    component_type = (UdmElementType_t)component[0];
+    unsigned int n, num_nodes = (unsigned int)topology_table[component_type].num_vertex;
+    for (n=0; n<num_nodes; n++) {
+        component_nodes[n] = component[n+1];
+    }
+    return num_nodes;
+}
+
+} /* namespace udm */
@@ -64,7 +64,17 @@ UdmElements::UdmElements(UdmSections* parent_sections)
  */
 UdmElements::~UdmElements()
 {
+    // 接続情報配列を参照している要素（セル）の構成ノードを要素（セル）に戻す.
+    if (this->num_connectivity_cells > 0) {
+        std::vector<UdmCell*>::iterator itr;
+        for (itr=this->cell_list.begin(); itr!=this->cell_list.end(); itr++) {
+            if ((*itr)->connectivity_elements == this) {
+                (*itr)->detachConnectivity();
+            }
+        }
+    }
     this->clearCells();
+    this->clearStagedElements();
 }
 
 /**
@@ -72,6 +82,10 @@ UdmElements::~UdmElements()
  */
 void UdmElements::initialize()
 {
+    this->connectivity_nodes.clear();
+    this->num_connectivity_cells = 0;
+    this->unused_connectivity = 0;
+    this->staged_element_ids = NULL;
     this->clearCells();
 }
 
@@ -283,8 +297,6 @@ UdmError_t UdmElements::readCgns(int index_file, int index_base, int index_zone,
     cgsize_t start, end, cell_size;
     int nbndry, parent_flag;
     cgsize_t element_size;
-    cgsize_t n;
-    int next_vertex = 0;
     std::string buf;
 
     // セクションの読込
@@ -321,43 +333,13 @@ UdmError_t UdmElements::readCgns(int index_file, int index_base, int index_zone,
     // Udm_PYRA_5 = 6,                //!< Solid:ピラミッド要素
     // Udm_PENTA_6 = 7,               //!< Solid:五面体要素
     // Udm_HEXA_8 = 8,                //!< Solid:六面体要素
-    if (elem_type != Udm_MIXED && this->isSupportElementType(elem_type)) {
-        for (n=0; n<cell_size; n++) {
-            UdmCell *cell = this->factoryCell(elem_type, elements+next_vertex);
-            if (cell == NULL) {
-                if (elements != NULL) delete[]elements;
-                return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL, "elem_type=%d", (int)elem_type);
-            }
-            next_vertex += cell->getNumNodes();
-            // 作成セルの格納
-            this->setCellByElemId(start+n, cell);
-        }
-    }
     // Udm_MIXED = 9,                 //!< 混合要素
-    else if (elem_type == Udm_MIXED) {
-        for (n=0; n<cell_size; n++) {
-            ElementType_t cgns_cell_type = (ElementType_t)elements[next_vertex];
-            UdmElementType_t cell_type = this->toElementType(cgns_cell_type);
-
-            // 要素タイプチェック
-            // modify by @hira at 2015/08/04
-            // if (elem_type == Udm_MIXED || !this->isSupportElementType(elem_type)) {
-            if (cell_type == Udm_MIXED || !this->isSupportElementType(cell_type)) {
-                this->toStringElementType(cell_type, buf);
-                error = UDM_WARNING_HANDLER(UDM_WARNING_CGNS_NOTSUPPORT_ELEMENTTYPE, "read CGNS ElementType=%s", buf.c_str());
-                break;
-            }
+    // 接続情報配列の確保
+    this->connectivity_nodes.reserve(this->connectivity_nodes.size() + element_size);
 
-            next_vertex++;
-            UdmCell *cell = this->factoryCell(cell_type, elements+next_vertex);
-            if (cell == NULL) {
-                if (elements != NULL) delete[]elements;
-                return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL,  "elem_type=%d", (int)elem_type);
-            }
-            next_vertex += cell->getNumNodes();
-            // 作成セルの格納
-            this->setCellByElemId(start+n, cell);
-        }
+    if (elem_type == Udm_MIXED || this->isSupportElementType(elem_type)) {
+        // 要素（セル）の作成、格納
+        error = this->readCgnsElements(elem_type, start, cell_size, elements);
     }
     else {
         this->toStringElementType(elem_type, buf);
@@ -368,6 +350,174 @@ UdmError_t UdmElements::readCgns(int index_file, int index_base, int index_zone,
     return error;
 }
 
+/**
+ * CGNS:Elementsの要素接続情報から要素（セル）を生成して、セクション（要素構成）に格納する.
+ * 混合要素以外は要素形状タイプ毎に一括して生成する.
+ * 混合要素は要素（セル）毎の要素タイプ、構成ノード（節点）IDの並びとする.
+ * @param [in] elem_type        セクション（要素構成）の要素タイプ
+ * @param [in] start        先頭の管理要素（セル）ID
+ * @param [in] cell_size        要素（セル）数
+ * @param [in] elements        要素接続情報（ノードリスト）
+ * @return        エラー番号 : UDM_OK | UDM_ERROR | UDM_WARNING_CGNS_NOTSUPPORT_ELEMENTTYPE
+ */
+UdmError_t UdmElements::readCgnsElements(
+                        UdmElementType_t elem_type,
+                        UdmSize_t start,
+                        UdmSize_t cell_size,
+                        const cgsize_t *elements)
+{
+    UdmSize_t n;
+    size_t next_vertex = 0;
+    std::vector<UdmNode*> cell_nodes;
+    std::string buf;
+
+    if (elem_type != Udm_MIXED) {
+        // 要素（セル）の作成、格納 : 要素形状タイプ毎に一括して作成する.
+        if (this->readCgnsCells(elem_type, start, cell_size, elements) != cell_size) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL, "elem_type=%d", (int)elem_type);
+        }
+        return UDM_OK;
+    }
+
+    for (n=0; n<cell_size; n++) {
+        ElementType_t cgns_cell_type = (ElementType_t)elements[next_vertex];
+        UdmElementType_t cell_type = this->toElementType(cgns_cell_type);
+
+        // 要素タイプチェック
+        // modify by @hira at 2015/08/04
+        // if (elem_type == Udm_MIXED || !this->isSupportElementType(elem_type)) {
+        if (cell_type == Udm_MIXED || !this->isSupportElementType(cell_type)) {
+            this->toStringElementType(cell_type, buf);
+            return UDM_WARNING_HANDLER(UDM_WARNING_CGNS_NOTSUPPORT_ELEMENTTYPE, "read CGNS ElementType=%s", buf.c_str());
+        }
+
+        next_vertex++;
+        // 要素（セル）の作成、格納
+        UdmCell *cell = this->readCgnsCell(start+n, cell_type, elements+next_vertex, cell_nodes);
+        if (cell == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL,  "elem_type=%d", (int)elem_type);
+        }
+        next_vertex += cell->getNumNodes();
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * CGNSファイルから読み込んだ要素接続情報から要素（セル）を生成して、セクション（要素構成）に格納する.
+ * 構成ノード（節点）はセクション（要素構成）の接続情報配列に直接追加する.
+ * @param [in] elem_id        管理要素（セル）ID
+ * @param [in] elem_type        要素タイプ
+ * @param [in] elements        要素接続情報（ノードリスト）
+ * @param [out] cell_nodes        構成ノード（節点）の作業領域
+ * @return        生成要素（セル）
+ */
+UdmCell* UdmElements::readCgnsCell(
+                        UdmSize_t elem_id,
+                        UdmElementType_t elem_type,
+                        const cgsize_t *elements,
+                        std::vector<UdmNode*> &cell_nodes)
+{
+    int n;
+
+    int num_vertex = this->getNumVertexOfElementType(elem_type);
+    if (num_vertex <= 0) return NULL;
+    if (elements == NULL) return NULL;
+
+    UdmGridCoordinates *grid = this->getGridCoordinates();
+    if (grid == NULL) return NULL;
+
+    // 構成ノード（節点）の取得
+    cell_nodes.clear();
+    for (n=0; n<num_vertex; n++) {
+        UdmNode* node = grid->getNodeById((UdmSize_t)(elements[n]));
+        if (node == NULL) return NULL;
+        cell_nodes.push_back(node);
+    }
+
+    UdmCell* cell = UdmCell::factoryCell(elem_type, this->getEntityPool());
+    if (cell == NULL) return NULL;
+
+    // 作成セルの格納 : 接続情報配列の最後に構成ノード（節点）を追加する.
+    this->setCellByElemId(elem_id, cell);
+    for (n=0; n<num_vertex; n++) {
+        cell->insertNode(cell_nodes[n]);
+    }
+
+    return cell;
+}
+
+/**
+ * CGNSファイルから読み込んだ同一要素形状タイプの要素接続情報から要素（セル）を一括生成して、セクション（要素構成）に格納する.
+ * @param [in] elem_type        要素タイプ
+ * @param [in] start        先頭の管理要素（セル）ID
+ * @param [in] cell_size        要素（セル）数
+ * @param [in] elements        要素接続情報（ノードリスト）
+ * @return        生成要素（セル）数 : cell_size未満の場合は生成エラー
+ */
+UdmSize_t UdmElements::readCgnsCells(
+                        UdmElementType_t elem_type,
+                        UdmSize_t start,
+                        UdmSize_t cell_size,
+                        const cgsize_t *elements)
+{
+    switch (elem_type) {
+    case Udm_BAR_2:   return this->readCgnsCells<Udm_BAR_2>(start, cell_size, elements);
+    case Udm_TRI_3:   return this->readCgnsCells<Udm_TRI_3>(start, cell_size, elements);
+    case Udm_QUAD_4:  return this->readCgnsCells<Udm_QUAD_4>(start, cell_size, elements);
+    case Udm_TETRA_4: return this->readCgnsCells<Udm_TETRA_4>(start, cell_size, elements);
+    case Udm_PYRA_5:  return this->readCgnsCells<Udm_PYRA_5>(start, cell_size, elements);
+    case Udm_PENTA_6: return this->readCgnsCells<Udm_PENTA_6>(start, cell_size, elements);
+    case Udm_HEXA_8:  return this->readCgnsCells<Udm_HEXA_8>(start, cell_size, elements);
+    default:
+        break;
+    }
+    return 0;
+}
+
+/**
+ * CGNSファイルから読み込んだ要素接続情報から要素形状タイプ:ELEMENT_TYPEの要素（セル）を一括生成して、セクション（要素構成）に格納する.
+ * 頂点（ノード）数、生成クラスはUdmElementTraits<ELEMENT_TYPE>から取得する.
+ * @param [in] start        先頭の管理要素（セル）ID
+ * @param [in] cell_size        要素（セル）数
+ * @param [in] elements        要素接続情報（ノードリスト）
+ * @return        生成要素（セル）数 : cell_size未満の場合は生成エラー
+ */
+template <UdmElementType_t ELEMENT_TYPE>
+UdmSize_t UdmElements::readCgnsCells(
+                        UdmSize_t start,
+                        UdmSize_t cell_size,
+                        const cgsize_t *elements)
+{
+    UdmSize_t n;
+    int m;
+    const int num_vertex = UdmElementTraits<ELEMENT_TYPE>::NUM_VERTEX;
+    UdmNode* cell_nodes[UdmElementTraits<ELEMENT_TYPE>::NUM_VERTEX];
+
+    if (elements == NULL) return 0;
+    UdmGridCoordinates *grid = this->getGridCoordinates();
+    if (grid == NULL) return 0;
+    UdmEntityPool *pool = this->getEntityPool();
+
+    for (n=0; n<cell_size; n++) {
+        // 構成ノード（節点）の取得
+        const cgsize_t *cell_elements = elements + n*num_vertex;
+        for (m=0; m<num_vertex; m++) {
+            cell_nodes[m] = grid->getNodeById((UdmSize_t)(cell_elements[m]));
+            if (cell_nodes[m] == NULL) return n;
+        }
+
+        // 作成セルの格納 : 接続情報配列の最後に構成ノード（節点）を追加する.
+        UdmCell* cell = UdmCell::factoryCell<ELEMENT_TYPE>(pool);
+        this->setCellByElemId(start+n, cell);
+        for (m=0; m<num_vertex; m++) {
+            cell->insertNode(cell_nodes[m]);
+        }
+    }
+
+    return cell_size;
+}
+
 /**
  * CGNS:要素形状タイプをUDMlib:要素形状タイプとして設定する.
  * @param cgns_elementtype        CGNS:要素形状タイプ
@@ -393,7 +543,7 @@ UdmCell* UdmElements::factoryCell(UdmElementType_t elem_type, DATA_TYPE *element
     int num_vertex = this->getNumVertexOfElementType(elem_type);
     if (num_vertex <= 0) return NULL;
 
-    UdmCell* cell = UdmCell::factoryCell(elem_type);
+    UdmCell* cell = UdmCell::factoryCell(elem_type, this->getEntityPool());
     if (cell == NULL) return NULL;
 
     if (elements != NULL) {
@@ -426,6 +576,16 @@ UdmZone* UdmElements::getZone() const
     return this->parent_sections->getParentZone();
 }
 
+/**
+ * 所属ゾーンの節点（ノード）、要素（セル）メモリプールを取得する.
+ * @return        メモリプール : 所属ゾーンが存在しない場合はNULL
+ */
+UdmEntityPool* UdmElements::getEntityPool() const
+{
+    if (this->parent_sections == NULL) return NULL;
+    return this->parent_sections->getEntityPool();
+}
+
 /**
  * GridCoordinatesクラスを取得する.
  * @return        GridCoordinatesクラス
@@ -530,23 +690,79 @@ UdmError_t UdmElements::writeCgns(int index_file, int index_base, int index_zone
     }
 #endif
 
-    UdmScannerCells scanner_cells;
-    scanner_cells.scannerElements(this->cell_list);
-
-    size_t data_size = scanner_cells.getNumElementsDatas(this->element_type);
-    cgsize_t *element_ids = new cgsize_t[data_size];
-    scanner_cells.getScanCgnsElementsIds<cgsize_t>(this->element_type, element_ids);
+    // 非同期出力の場合は退避バッファから出力する.
+    cgsize_t *element_ids = this->staged_element_ids;
+    if (element_ids == NULL) {
+        size_t data_size = 0;
+        element_ids = this->createCgnsElementIds(data_size);
+    }
 
     // 要素の接続情報の設定 : cg_section_write
     if (cg_section_write(index_file,index_base,index_zone, elem_name, cgns_elemtype,start,end,nbndry,element_ids, &index_section) != CG_OK) {
+        if (element_ids != this->staged_element_ids) delete []element_ids;
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_ELEMENTS, "failure : cg_section_write, cgns_error=%s", cg_get_error());
     }
 
-    delete []element_ids;
+    if (element_ids != this->staged_element_ids) delete []element_ids;
 
     return UDM_OK;
 }
 
+/**
+ * CGNS:Elementsの接続情報（ノードID）配列を作成する.
+ * 混合要素以外は接続情報配列を詰めてから作成する.
+ * @param [out] data_size        接続情報（ノードID）配列サイズ
+ * @return        接続情報（ノードID）配列 : 呼出元にて削除すること
+ */
+cgsize_t* UdmElements::createCgnsElementIds(size_t &data_size)
+{
+    cgsize_t *element_ids = NULL;
+    if (this->element_type != Udm_MIXED && this->arrangeConnectivity() == UDM_OK) {
+        // 接続情報配列から作成する.
+        size_t n;
+        data_size = this->connectivity_nodes.size();
+        element_ids = new cgsize_t[data_size];
+        for (n=0; n<data_size; n++) {
+            element_ids[n] = (cgsize_t)this->connectivity_nodes[n]->getId();
+        }
+    }
+    else {
+        UdmScannerCells scanner_cells;
+        scanner_cells.scannerElements(this->cell_list);
+
+        data_size = scanner_cells.getNumElementsDatas(this->element_type);
+        element_ids = new cgsize_t[data_size];
+        scanner_cells.getScanCgnsElementsIds<cgsize_t>(this->element_type, element_ids);
+    }
+    return element_ids;
+}
+
+/**
+ * 非同期出力のため、CGNS:Elementsの接続情報（ノードID）を退避バッファに作成する.
+ * 接続情報配列を詰める処理は本関数（呼出スレッド）にて行い、出力スレッドでは要素（セル）の接続情報を参照しない.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmElements::stageCgnsElements()
+{
+    this->clearStagedElements();
+    if (this->getNumCells() <= 0) return UDM_OK;
+
+    size_t data_size = 0;
+    this->staged_element_ids = this->createCgnsElementIds(data_size);
+    return UDM_OK;
+}
+
+/**
+ * 非同期出力の接続情報（ノードID）退避バッファを削除する.
+ */
+void UdmElements::clearStagedElements()
+{
+    if (this->staged_element_ids != NULL) {
+        delete []this->staged_element_ids;
+    }
+    this->staged_element_ids = NULL;
+}
+
 /**
  * CGNS:Elementsのリンクを出力する.
  * @param index_file        CGNSファイルインデックス
@@ -678,6 +894,8 @@ UdmError_t UdmElements::removeCell(const UdmCell* cell)
         if ((*itr) == cell) {
             std::vector<UdmCell*>::iterator rm_itr = this->cell_list.begin() + (itr - this->cell_list.begin());
             this->cell_list.erase(rm_itr);
+            // 隣接情報を破棄する.
+            if (this->getZone() != NULL) this->getZone()->clearNeighborGraph();
             return UDM_OK;
         }
     }
@@ -782,7 +1000,7 @@ UdmError_t UdmElements::importCell(UdmCell* src_cell, const std::vector<UdmNode*
     }
 
     // 要素（セル）の作成
-    UdmCell *dest_cell = UdmCell::factoryCell(src_cell->getElementType());
+    UdmCell *dest_cell = UdmCell::factoryCell(src_cell->getElementType(), sections->getEntityPool());
     if (dest_cell == NULL) {
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL,  "elem_type=%d", (int)src_cell->getElementType());
     }
@@ -859,13 +1077,7 @@ UdmSize_t UdmElements::setCellsConnectivity(
     UdmSize_t cell_id;
 
     if (elem_type != Udm_MIXED) {
-        int num_vertex = this->getNumVertexOfElementType(elem_type);
-        for (n=0; n<cell_size; n++) {
-            cell_id = this->insertCellConnectivity(elem_type, elements+n*num_vertex);
-            if (cell_id > 0) {
-                count++;
-            }
-        }
+        count = this->insertCellsConnectivity(elem_type, cell_size, elements);
     }
     else if (elem_type == Udm_MIXED) {
         UdmSize_t next_vertex = 0;
@@ -882,6 +1094,76 @@ UdmSize_t UdmElements::setCellsConnectivity(
     return count;
 }
 
+/**
+ * 同一要素形状タイプの要素（セル）リストをセクション（要素構成）に追加する.
+ * @param elem_type            要素タイプ
+ * @param cell_size            要素（セル）数
+ * @param elements            要素接続情報リスト（ノードリスト）
+ * @return                    追加要素（セル）数
+ */
+UdmSize_t UdmElements::insertCellsConnectivity(
+                        UdmElementType_t elem_type,
+                        UdmSize_t cell_size,
+                        UdmSize_t* elements)
+{
+    switch (elem_type) {
+    case Udm_BAR_2:   return this->insertCellsConnectivity<Udm_BAR_2>(cell_size, elements);
+    case Udm_TRI_3:   return this->insertCellsConnectivity<Udm_TRI_3>(cell_size, elements);
+    case Udm_QUAD_4:  return this->insertCellsConnectivity<Udm_QUAD_4>(cell_size, elements);
+    case Udm_TETRA_4: return this->insertCellsConnectivity<Udm_TETRA_4>(cell_size, elements);
+    case Udm_PYRA_5:  return this->insertCellsConnectivity<Udm_PYRA_5>(cell_size, elements);
+    case Udm_PENTA_6: return this->insertCellsConnectivity<Udm_PENTA_6>(cell_size, elements);
+    case Udm_HEXA_8:  return this->insertCellsConnectivity<Udm_HEXA_8>(cell_size, elements);
+    default:
+        break;
+    }
+    return 0;
+}
+
+/**
+ * 要素形状タイプ:ELEMENT_TYPEの要素（セル）リストをセクション（要素構成）に追加する.
+ * 頂点（ノード）数、生成クラスはUdmElementTraits<ELEMENT_TYPE>から取得する.
+ * 構成節点（ノード）が存在しない要素（セル）は追加しない.
+ * @param cell_size            要素（セル）数
+ * @param elements            要素接続情報リスト（ノードリスト）
+ * @return                    追加要素（セル）数
+ */
+template <UdmElementType_t ELEMENT_TYPE>
+UdmSize_t UdmElements::insertCellsConnectivity(
+                        UdmSize_t cell_size,
+                        UdmSize_t* elements)
+{
+    UdmSize_t n;
+    int m;
+    UdmSize_t count = 0;
+    const int num_vertex = UdmElementTraits<ELEMENT_TYPE>::NUM_VERTEX;
+    UdmNode* cell_nodes[UdmElementTraits<ELEMENT_TYPE>::NUM_VERTEX];
+
+    if (elements == NULL) return 0;
+    UdmGridCoordinates *grid = this->getGridCoordinates();
+    if (grid == NULL) return 0;
+    UdmEntityPool *pool = this->getEntityPool();
+
+    for (n=0; n<cell_size; n++) {
+        // 構成ノード（節点）の取得
+        const UdmSize_t *cell_elements = elements + n*num_vertex;
+        for (m=0; m<num_vertex; m++) {
+            cell_nodes[m] = grid->getNodeById(cell_elements[m]);
+            if (cell_nodes[m] == NULL) break;
+        }
+        if (m < num_vertex) continue;
+
+        UdmCell* cell = UdmCell::factoryCell<ELEMENT_TYPE>(pool);
+        for (m=0; m<num_vertex; m++) {
+            cell->insertNode(cell_nodes[m]);
+        }
+        if (this->insertCell(cell) > 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
 /**
  * CGNS:要素（セル）を結合する.
  * @param dest_elements        結合要素（セル）
@@ -964,10 +1246,189 @@ UdmError_t UdmElements::removeCells(const std::vector<UdmCell*>& remove_cells)
             this->cell_list.end());
     erase_size -= this->cell_list.size();
 
+    // 隣接情報を破棄する.
+    if (erase_size > 0 && this->getZone() != NULL) {
+        this->getZone()->clearNeighborGraph();
+    }
+
     return UDM_OK;
 }
 
 
+/**
+ * 要素（セル）の構成ノード（節点）を接続情報配列の最後に追加する.
+ * @param cell        要素（セル）
+ * @param nodes        構成ノード（節点）リスト
+ */
+void UdmElements::attachConnectivity(UdmCell *cell, const std::vector<UdmNode*> &nodes)
+{
+    if (cell == NULL) return;
+
+    // 未使用領域が多い場合は接続情報配列を詰める.
+    if (this->unused_connectivity*2 > this->connectivity_nodes.size()) {
+        this->arrangeConnectivity();
+    }
+
+    cell->connectivity_offset = this->connectivity_nodes.size();
+    cell->connectivity_size = nodes.size();
+    this->connectivity_nodes.insert(this->connectivity_nodes.end(), nodes.begin(), nodes.end());
+    this->num_connectivity_cells++;
+
+    return;
+}
+
+/**
+ * 要素（セル）の構成ノード（節点）を追加する.
+ * 要素（セル）の構成ノードが接続情報配列の最後でない場合は、最後に移動してから追加する.
+ * @param cell        要素（セル）
+ * @param node        追加構成ノード（節点）
+ */
+void UdmElements::appendConnectivityNode(UdmCell *cell, UdmNode *node)
+{
+    if (cell == NULL) return;
+    UdmSize_t offset = cell->connectivity_offset;
+    UdmSize_t size = cell->connectivity_size;
+    UdmSize_t n;
+
+    if (offset + size != this->connectivity_nodes.size()) {
+        // 接続情報配列の最後に移動する.
+        UdmSize_t new_offset = this->connectivity_nodes.size();
+        this->connectivity_nodes.reserve(new_offset + size + 1);
+        for (n=0; n<size; n++) {
+            this->connectivity_nodes.push_back(this->connectivity_nodes[offset+n]);
+            this->connectivity_nodes[offset+n] = NULL;
+        }
+        this->unused_connectivity += size;
+        cell->connectivity_offset = new_offset;
+    }
+
+    this->connectivity_nodes.push_back(node);
+    cell->connectivity_size++;
+
+    return;
+}
+
+/**
+ * 要素（セル）の構成ノード（節点）を削除する.
+ * @param cell        要素（セル）
+ * @param node        削除構成ノード（節点）
+ */
+void UdmElements::removeConnectivityNode(UdmCell *cell, const UdmNode *node)
+{
+    if (cell == NULL) return;
+    UdmSize_t offset = cell->connectivity_offset;
+    UdmSize_t size = cell->connectivity_size;
+    UdmSize_t n;
+
+    for (n=0; n<size; n++) {
+        if (this->connectivity_nodes[offset+n] == node) break;
+    }
+    if (n >= size) return;
+
+    for (; n+1<size; n++) {
+        this->connectivity_nodes[offset+n] = this->connectivity_nodes[offset+n+1];
+    }
+    if (offset + size == this->connectivity_nodes.size()) {
+        this->connectivity_nodes.pop_back();
+    }
+    else {
+        this->connectivity_nodes[offset+size-1] = NULL;
+        this->unused_connectivity++;
+    }
+    cell->connectivity_size--;
+
+    return;
+}
+
+/**
+ * 要素（セル）の構成ノード（節点）をクリアする.
+ * 要素（セル）は接続情報配列を引き続き参照する.
+ * @param cell        要素（セル）
+ */
+void UdmElements::clearConnectivity(UdmCell *cell)
+{
+    if (cell == NULL) return;
+    UdmSize_t offset = cell->connectivity_offset;
+    UdmSize_t size = cell->connectivity_size;
+
+    if (offset + size == this->connectivity_nodes.size()) {
+        this->connectivity_nodes.resize(offset);
+    }
+    else {
+        std::fill(this->connectivity_nodes.begin()+offset, this->connectivity_nodes.begin()+offset+size, (UdmNode*)NULL);
+        this->unused_connectivity += size;
+    }
+    cell->connectivity_size = 0;
+
+    return;
+}
+
+/**
+ * 要素（セル）の接続情報配列の参照を解放する.
+ * 参照している要素（セル）が無くなった場合は、接続情報配列を破棄する.
+ * 要素（セル）の削除中にも呼び出されるため、接続情報配列を詰める処理は行わない.
+ * @param cell        要素（セル）
+ */
+void UdmElements::releaseConnectivity(UdmCell *cell)
+{
+    if (cell == NULL) return;
+
+    this->clearConnectivity(cell);
+    cell->connectivity_offset = 0;
+    if (this->num_connectivity_cells > 0) {
+        this->num_connectivity_cells--;
+    }
+    if (this->num_connectivity_cells == 0) {
+        std::vector<UdmNode*>().swap(this->connectivity_nodes);
+        this->unused_connectivity = 0;
+    }
+
+    return;
+}
+
+/**
+ * 接続情報配列を要素（セル）リストの順に詰める.
+ * 接続情報配列を参照している要素（セル）がすべて要素（セル）リストに存在しない場合は詰めない.
+ * @return        UDM_OK=要素（セル）リストのすべての要素（セル）の構成ノードが接続情報配列に連続して格納されている.
+ */
+UdmError_t UdmElements::arrangeConnectivity()
+{
+    UdmSize_t num_cells = 0;
+    UdmSize_t offset = 0;
+    bool sequential = true;
+    std::vector<UdmCell*>::iterator itr;
+
+    for (itr=this->cell_list.begin(); itr!=this->cell_list.end(); itr++) {
+        UdmCell *cell = (*itr);
+        if (cell->connectivity_elements != this) continue;
+        if (cell->connectivity_offset != offset) sequential = false;
+        offset += cell->connectivity_size;
+        num_cells++;
+    }
+    if (num_cells != this->num_connectivity_cells) {
+        return UDM_ERROR;
+    }
+
+    if (!sequential || offset != this->connectivity_nodes.size()) {
+        std::vector<UdmNode*> arrange_nodes;
+        arrange_nodes.reserve(offset);
+        for (itr=this->cell_list.begin(); itr!=this->cell_list.end(); itr++) {
+            UdmCell *cell = (*itr);
+            if (cell->connectivity_elements != this) continue;
+            std::vector<UdmNode*>::iterator begin = this->connectivity_nodes.begin() + cell->connectivity_offset;
+            cell->connectivity_offset = arrange_nodes.size();
+            arrange_nodes.insert(arrange_nodes.end(), begin, begin + cell->connectivity_size);
+        }
+        this->connectivity_nodes.swap(arrange_nodes);
+        this->unused_connectivity = 0;
+    }
+
+    if (num_cells != this->cell_list.size()) {
+        return UDM_ERROR;
+    }
+    return UDM_OK;
+}
+
 /**
  * メモリサイズを取得する.
  * @return        メモリサイズ
@@ -985,8 +1446,13 @@ size_t UdmElements::getMemSize() const
     printf("element_type size=%ld [offset=%ld]\n", sizeof(this->element_type), offsetof(UdmElements, element_type));
     printf("start_elemid size=%ld [offset=%ld]\n", sizeof(this->start_elemid), offsetof(UdmElements, start_elemid));
     printf("end_elemid size=%ld [offset=%ld]\n", sizeof(this->end_elemid), offsetof(UdmElements, end_elemid));
+    printf("connectivity_nodes size=%ld [count=%ld] [offset=%ld]\n",
+                            sizeof(this->connectivity_nodes),
+                            this->connectivity_nodes.size(),
+                            offsetof(UdmElements, connectivity_nodes));
 
     size += this->cell_list.size()*sizeof(UdmCell*);
+    size += this->connectivity_nodes.capacity()*sizeof(UdmNode*);
 #endif
 
     return size;
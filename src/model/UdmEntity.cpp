@@ -17,6 +17,7 @@
 
 #include "config/UdmSolutionFieldConfig.h"
 #include "model/UdmEntity.h"
+#include "model/UdmEntityVoxels.h"
 #include "model/UdmZone.h"
 #include "model/UdmFlowSolutions.h"
 #include "model/UdmSolutionData.h"
@@ -27,7 +28,7 @@ namespace udm
 /**
  * コンストラクタ
  */
-UdmEntity::UdmEntity()
+UdmEntity::UdmEntity() : id(0), solution_voxels(NULL), solution_slot(0)
 {
     this->initialize();
 }
@@ -36,7 +37,7 @@ UdmEntity::UdmEntity()
  * コンストラクタ
  * @param element_type        要素形状タイプ
  */
-UdmEntity::UdmEntity(UdmElementType_t element_type)
+UdmEntity::UdmEntity(UdmElementType_t element_type) : id(0), solution_voxels(NULL), solution_slot(0)
 {
     this->initialize();
     this->element_type = element_type;
@@ -51,6 +52,46 @@ UdmEntity::~UdmEntity()
     this->initialize();
 }
 
+/**
+ * 節点（ノード）、要素（セル）のオブジェクト領域をヒープから割り当てる.
+ * @param size        オブジェクトサイズ
+ * @return        オブジェクト領域
+ */
+void* UdmEntity::operator new(size_t size)
+{
+    return UdmEntityPool::allocateEntity(size, NULL);
+}
+
+/**
+ * 節点（ノード）、要素（セル）のオブジェクト領域をメモリプールから割り当てる.
+ * @param size        オブジェクトサイズ
+ * @param pool        メモリプール : NULLの場合はヒープから割り当てる.
+ * @return        オブジェクト領域
+ */
+void* UdmEntity::operator new(size_t size, UdmEntityPool *pool)
+{
+    return UdmEntityPool::allocateEntity(size, pool);
+}
+
+/**
+ * 節点（ノード）、要素（セル）のオブジェクト領域を解放する.
+ * @param ptr        オブジェクト領域
+ */
+void UdmEntity::operator delete(void *ptr)
+{
+    UdmEntityPool::deallocateEntity(ptr);
+}
+
+/**
+ * 節点（ノード）、要素（セル）のオブジェクト領域を解放する:コンストラクタ例外時.
+ * @param ptr        オブジェクト領域
+ * @param pool        メモリプール
+ */
+void UdmEntity::operator delete(void *ptr, UdmEntityPool *pool)
+{
+    UdmEntityPool::deallocateEntity(ptr);
+}
+
 
 /**
  * 初期化を行う.
@@ -93,7 +134,15 @@ void UdmEntity::setId(UdmSize_t id)
  */
 unsigned int UdmEntity::getNumSolutionDatas() const
 {
-    return this->solution_fields.size();
+    unsigned int num_datas = this->solution_fields.size();
+    if (this->solution_voxels != NULL) {
+        int n, num_columns = this->solution_voxels->getNumSolutionColumns();
+        for (n=1; n<=num_columns; n++) {
+            const UdmSolutionColumn *column = this->solution_voxels->getSolutionColumn(n);
+            if (column->existsSolutionValue(this->solution_slot)) num_datas++;
+        }
+    }
+    return num_datas;
 }
 
 /**
@@ -104,6 +153,10 @@ unsigned int UdmEntity::getNumSolutionDatas() const
  */
 unsigned int UdmEntity::getNumSolutionValue(const std::string& solution_name) const
 {
+    const UdmSolutionColumn *column = this->getSolutionColumn(solution_name);
+    if (column != NULL) {
+        return column->getNvectorSize();
+    }
     std::vector<UdmSolutionData*>::const_iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -120,6 +173,9 @@ unsigned int UdmEntity::getNumSolutionValue(const std::string& solution_name) co
  */
 bool UdmEntity::existsSolutionData(const std::string &solution_name) const
 {
+    if (this->getSolutionColumn(solution_name) != NULL) {
+        return true;
+    }
     std::vector<UdmSolutionData*>::const_iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -135,6 +191,12 @@ bool UdmEntity::existsSolutionData(const std::string &solution_name) const
  */
 UdmError_t UdmEntity::clearSolutionData()
 {
+    // 物理量カラムデータのスロットを解放する
+    if (this->solution_voxels != NULL) {
+        this->solution_voxels->releaseSolutionSlot(this->solution_slot);
+        this->solution_voxels = NULL;
+        this->solution_slot = 0;
+    }
     if (this->solution_fields.size() <= 0) return UDM_OK;
 
 /************************
@@ -167,6 +229,10 @@ UdmError_t UdmEntity::clearSolutionData()
  */
 UdmError_t UdmEntity::removeSolutionData(const std::string &solution_name)
 {
+    if (this->getSolutionColumn(solution_name) != NULL) {
+        this->solution_voxels->getSolutionColumn(solution_name)->clearSolutionValue(this->solution_slot);
+        return UDM_OK;
+    }
     std::vector<UdmSolutionData*>::iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -306,6 +372,134 @@ UdmSolutionData* UdmEntity::factorySolutionData(const std::string& solution_name
     return solution_data;
 }
 
+/**
+ * 物理量データが設定済みの物理量カラムデータを取得する.
+ * @param solution_name        物理量データ名称
+ * @return        物理量カラムデータ : 物理量カラムデータを使用していない、又は物理量データが未設定の場合はNULL
+ */
+const UdmSolutionColumn* UdmEntity::getSolutionColumn(const std::string &solution_name) const
+{
+    if (this->solution_voxels == NULL) return NULL;
+    const UdmSolutionColumn *column = this->solution_voxels->getSolutionColumn(solution_name);
+    if (column == NULL) return NULL;
+    if (!column->existsSolutionValue(this->solution_slot)) return NULL;
+    return column;
+}
+
+/**
+ * 物理量データを設定する物理量カラムデータを取得する.
+ * 物理量カラムデータのスロットが未確保の場合は、親ノード・要素構成クラスにスロットを確保する.
+ * 物理量カラムデータが存在しない場合は、物理量フィールド情報から生成する.
+ * @param solution_name        物理量データ名称
+ * @return        物理量カラムデータ : 物理量カラムデータを使用しない場合はNULL
+ */
+UdmSolutionColumn* UdmEntity::createSolutionColumn(const std::string &solution_name)
+{
+    UdmEntityVoxels *voxels = this->solution_voxels;
+    if (voxels == NULL) {
+        voxels = this->getParentVoxels();
+        if (voxels == NULL) return NULL;
+        if (!voxels->isColumnSolutionStorage()) return NULL;
+        if (this->attachSolutionVoxels(voxels) != UDM_OK) return NULL;
+    }
+    return voxels->createSolutionColumn(solution_name);
+}
+
+/**
+ * 物理量カラムデータのスロットを確保して、物理量データリストを物理量カラムデータに移行する.
+ * @param voxels        物理量カラムデータ格納ノード・要素構成クラス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmEntity::attachSolutionVoxels(UdmEntityVoxels *voxels)
+{
+    if (voxels == NULL) return UDM_ERROR;
+    if (this->solution_voxels == voxels) return UDM_OK;
+    if (this->solution_voxels != NULL) {
+        this->detachSolutionVoxels();
+    }
+
+    this->solution_slot = voxels->allocateSolutionSlot(this);
+    this->solution_voxels = voxels;
+
+    // 物理量データリストを物理量カラムデータに移行する
+    std::vector<UdmSolutionData*>::iterator itr;
+    for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
+        UdmSolutionData* data = (*itr);
+        if (data == NULL) continue;
+        this->importSolutionData(data);
+        delete data;
+    }
+    this->solution_fields.clear();
+
+    return UDM_OK;
+}
+
+/**
+ * 物理量カラムデータを物理量データリストに戻して、物理量カラムデータのスロットを解放する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmEntity::detachSolutionVoxels()
+{
+    UdmEntityVoxels *voxels = this->solution_voxels;
+    if (voxels == NULL) return UDM_OK;
+
+    int n, num_columns = voxels->getNumSolutionColumns();
+    for (n=1; n<=num_columns; n++) {
+        const UdmSolutionColumn *column = voxels->getSolutionColumn(n);
+        UdmSolutionData* data = column->factorySolutionData(this->solution_slot);
+        if (data != NULL) {
+            this->solution_fields.push_back(data);
+        }
+    }
+    voxels->releaseSolutionSlot(this->solution_slot);
+    this->solution_voxels = NULL;
+    this->solution_slot = 0;
+
+    return UDM_OK;
+}
+
+/**
+ * 物理量データを物理量カラムデータに設定する.
+ * 物理量フィールド情報が存在しない場合は、物理量データのデータ型で物理量カラムデータを生成する.
+ * @param field        物理量データ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmEntity::importSolutionData(const UdmSolutionData *field)
+{
+    if (this->solution_voxels == NULL) return UDM_ERROR;
+    if (field == NULL) return UDM_ERROR;
+
+    UdmSolutionColumn *column = this->solution_voxels->createSolutionColumn(field->getName());
+    if (column == NULL) {
+        column = this->solution_voxels->createSolutionColumn(
+                                    field->getName(),
+                                    field->getDataType(),
+                                    field->getVectorType(),
+                                    field->getNumSolutionDatas());
+    }
+    if (column == NULL) return UDM_ERROR;
+
+    return column->setSolutionData(this->solution_slot, field);
+}
+
+/**
+ * 親ノード・要素構成クラスの変更に合わせて物理量カラムデータの格納先を更新する.
+ * 親ノード・要素構成クラスが物理量カラムデータを使用する場合は、物理量データリストを移行する.
+ */
+void UdmEntity::updateSolutionVoxels()
+{
+    UdmEntityVoxels *voxels = this->getParentVoxels();
+    if (voxels == this->solution_voxels) return;
+
+    this->detachSolutionVoxels();
+    if (voxels == NULL) return;
+    if (!voxels->isColumnSolutionStorage()) return;
+    if (this->solution_fields.size() <= 0) return;
+
+    this->attachSolutionVoxels(voxels);
+    return;
+}
+
 /**
  * 物理量データ値を設定する.
  * 物理量データ名称が存在しない場合は、追加する.
@@ -390,6 +584,19 @@ void UdmEntity::toString(std::string& buf) const
 #ifdef _DEBUG_TRACE
     std::stringstream stream;
 
+    if (this->solution_voxels != NULL) {
+        int n, num_columns = this->solution_voxels->getNumSolutionColumns();
+        for (n=1; n<=num_columns; n++) {
+            const UdmSolutionColumn *column = this->solution_voxels->getSolutionColumn(n);
+            UdmSolutionData* data = column->factorySolutionData(this->solution_slot);
+            if (data == NULL) continue;
+            std::string field_buf;
+            data->toString(field_buf);
+            stream << field_buf << std::endl;
+            delete data;
+        }
+    }
+
     std::vector<UdmSolutionData*>::const_iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         std::string field_buf;
@@ -410,6 +617,11 @@ void UdmEntity::toString(std::string& buf) const
  */
 UdmError_t UdmEntity::getSolutionValues(const std::string& solution_name, void* values) const
 {
+    const UdmSolutionColumn *column = this->getSolutionColumn(solution_name);
+    if (column != NULL) {
+        column->getSolutionPointer(this->solution_slot, column->getDataType(), values, column->getNvectorSize());
+        return UDM_OK;
+    }
     std::vector<UdmSolutionData*>::const_iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -445,6 +657,11 @@ UdmError_t UdmEntity::initializeValue(const std::string& solution_name, VALUE_TY
     if (!this->validateSolutionData(solution_name)) {
         return UDM_ERROR;
     }
+    UdmSolutionColumn *column = this->createSolutionColumn(solution_name);
+    if (column != NULL) {
+        column->initializeValue<VALUE_TYPE>(this->solution_slot, value);
+        return UDM_OK;
+    }
     std::vector<UdmSolutionData*>::iterator itr;
     for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
         if ((*itr)->equalsName(solution_name)) {
@@ -536,6 +753,29 @@ UdmError_t UdmEntity::addMpiRankInfo(int rankno, UdmSize_t localid)
     return this->mpi_rankinfos.addGlobalRankid(rankno, localid);
 }
 
+/**
+ * MPIランク番号を一括追加する.
+ * 重複チェック、ソートは行わない. 追加終了後にfinalizeMpiRankInfosを呼び出すこと.
+ * @param  rankno        MPIランク番号
+ * @param  localid       ローカルID
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmEntity::appendMpiRankInfo(int rankno, UdmSize_t localid)
+{
+    if (rankno < 0) return UDM_ERROR;
+
+    this->mpi_rankinfos.appendGlobalRankid(rankno, localid);
+    return UDM_OK;
+}
+
+/**
+ * 一括追加、一括変更したMPIランク番号のソート、重複削除を行う.
+ */
+void UdmEntity::finalizeMpiRankInfos()
+{
+    this->mpi_rankinfos.finalizeGlobalRankids();
+}
+
 /**
  * MPIランク番号を削除する.
  * @param  rankno        MPIランク番号
@@ -643,7 +883,7 @@ UdmSerializeArchive& UdmEntity::serialize(UdmSerializeArchive& archive) const
     archive << this->my_rankno;
 
     // 以前のID、ランク番号
-    archive << this->previous_rankinfos;
+    this->previous_rankinfos.serialize(archive);
 
     // 仮想ノード,要素タイプ
     archive << this->getRealityType();
@@ -651,6 +891,14 @@ UdmSerializeArchive& UdmEntity::serialize(UdmSerializeArchive& archive) const
     int num_fields = this->getNumSolutionDatas();
     if (num_fields > 0) {
         archive << num_fields;        // 物理量データ数
+        if (this->solution_voxels != NULL) {
+            int num_columns = this->solution_voxels->getNumSolutionColumns();
+            for (n=1; n<=num_columns; n++) {
+                const UdmSolutionColumn *column = this->solution_voxels->getSolutionColumn(n);
+                if (!column->existsSolutionValue(this->solution_slot)) continue;
+                column->serializeSolutionValue(archive, this->solution_slot);
+            }
+        }
         std::vector<UdmSolutionData*>::const_iterator itr;
         for (itr = this->solution_fields.begin(); itr != this->solution_fields.end(); itr++) {
             const UdmSolutionData* field = (*itr);
@@ -661,7 +909,7 @@ UdmSerializeArchive& UdmEntity::serialize(UdmSerializeArchive& archive) const
         archive << (int)0;
     }
     // MPI:ランク番号リスト
-    archive << this->mpi_rankinfos;
+    this->mpi_rankinfos.serialize(archive);
 
     // 分割重み
     archive << this->partition_weight;
@@ -703,7 +951,7 @@ UdmSerializeArchive& UdmEntity::deserialize(UdmSerializeArchive& archive)
     this->setMyRankno(my_rankno);
 
     // 以前のID、ランク番号
-    archive >> this->previous_rankinfos;
+    this->previous_rankinfos.deserialize(archive);
 
     // 仮想ノード,要素タイプ
     archive.read(reality_type, sizeof(reality_type));
@@ -751,7 +999,7 @@ UdmSerializeArchive& UdmEntity::deserialize(UdmSerializeArchive& archive)
     }
 
     // MPI:ランク番号リスト
-    archive >> this->mpi_rankinfos;
+    this->mpi_rankinfos.deserialize(archive);
 
     // 分割重み
     float weight = 0.0;
@@ -877,6 +1125,17 @@ UdmError_t UdmEntity::cloneEntity(const UdmEntity& src)
         // 物理量データを追加する
         this->insertSolutionData(dest_solution);
     }
+    // 物理量カラムデータ
+    if (src.solution_voxels != NULL) {
+        int n, num_columns = src.solution_voxels->getNumSolutionColumns();
+        for (n=1; n<=num_columns; n++) {
+            const UdmSolutionColumn *src_column = src.solution_voxels->getSolutionColumn(n);
+            UdmSolutionData* dest_solution = src_column->factorySolutionData(src.solution_slot);
+            if (dest_solution == NULL) continue;
+            // 物理量データを追加する
+            this->insertSolutionData(dest_solution);
+        }
+    }
     // 自ランク番号
     this->my_rankno = src.my_rankno;
     // 要素形状タイプ
@@ -890,6 +1149,9 @@ UdmError_t UdmEntity::cloneEntity(const UdmEntity& src)
     this->clearMpiRankInfos();
     this->mpi_rankinfos.cloneGlobalRankidList(src.mpi_rankinfos);
 
+    // 親ノード・要素構成クラスの物理量カラムデータに移行する
+    this->updateSolutionVoxels();
+
     return UDM_OK;
 }
 
@@ -900,8 +1162,15 @@ UdmError_t UdmEntity::cloneEntity(const UdmEntity& src)
  */
 unsigned int UdmEntity::insertSolutionData(UdmSolutionData* field)
 {
+    // 物理量カラムデータを使用している場合は、物理量カラムデータに設定する
+    if (this->solution_voxels != NULL) {
+        if (this->importSolutionData(field) == UDM_OK) {
+            delete field;
+            return this->getNumSolutionDatas();
+        }
+    }
     this->solution_fields.push_back(field);
-    return this->solution_fields.size();
+    return this->getNumSolutionDatas();
 }
 
 /**
@@ -979,6 +1248,25 @@ UdmError_t UdmEntity::updateMpiRankInfo(
     return this->mpi_rankinfos.updateGlobalRankid(old_rankno, old_localid, new_rankno, new_localid);
 }
 
+/**
+ * MPI:ランク番号、ローカル番号を一括変更する.
+ * ソートは行わない. 変更終了後にfinalizeMpiRankInfosを呼び出すこと.
+ * @param old_rankno        以前のランク番号
+ * @param old_localid        以前のID
+ * @param new_rankno        新しいランク番号
+ * @param new_localid        新しいID
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmEntity::replaceMpiRankInfo(
+                int old_rankno, UdmSize_t old_localid,
+                int new_rankno, UdmSize_t new_localid)
+{
+    if (new_rankno < 0) return UDM_ERROR;
+    if (new_localid <= 0) return UDM_ERROR;
+
+    return this->mpi_rankinfos.replaceGlobalRankid(old_rankno, old_localid, new_rankno, new_localid);
+}
+
 /**
  * 以前のID、ランク番号をクリアする.
  */
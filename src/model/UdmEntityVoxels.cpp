@@ -15,7 +15,6 @@
  * ノード・要素構成クラスのソースファイル
  */
 
-#include "config/UdmSolutionFieldConfig.h"
 #include "model/UdmEntityVoxels.h"
 #include "model/UdmZone.h"
 
@@ -27,7 +26,9 @@ namespace udm
  */
 UdmEntityVoxels::UdmEntityVoxels()
 {
-
+    this->solution_storage = Udm_ColumnSolutionStorage;
+    this->slot_capacity = 0;
+    this->field_revision = 0;
 }
 
 /**
@@ -35,6 +36,15 @@ UdmEntityVoxels::UdmEntityVoxels()
  */
 UdmEntityVoxels::~UdmEntityVoxels()
 {
+    // スロット使用中のノード・要素の参照を解除する
+    std::vector<UdmEntity*>::iterator itr;
+    for (itr = this->slot_entities.begin(); itr != this->slot_entities.end(); itr++) {
+        if ((*itr) != NULL) {
+            (*itr)->solution_voxels = NULL;
+        }
+    }
+    this->slot_entities.clear();
+    this->clearSolutionColumns();
 }
 
 /**
@@ -71,27 +81,47 @@ UdmError_t UdmEntityVoxels::setEntitySolutionArray(
     if (vector_size <= 0) {
         return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "vector_size is zero.");
     }
+    // 物理量カラムデータ : 物理量名称の検索は一度のみとする.
+    UdmSolutionColumn *column = NULL;
+    if (this->getSolutionFieldConfig(field_name) != NULL) {
+        column = this->getSolutionColumn(field_name);
+    }
     next_pos = 0;
     void *node_datas = this->createDataArray(datatype, vector_size);
     for (n=1; n<=data_size; n++) {
         UdmEntity *node = this->getEntityById(n);
+        const void *values = NULL;
         if (vector_size == 1) {
-            error = node->setSolutionScalar(field_name, datatype, (char*)solution_array+next_pos);
+            values = (char*)solution_array+next_pos;
+            next_pos += sizeofdata;
+        }
+        else if (memtype == Udm_MemSequentialArray) {
+            for (i=0; i<vector_size; i++) {
+                memcpy((char*)node_datas+i*sizeofdata,
+                        (char*)solution_array+next_pos + i*data_size*sizeofdata,
+                        sizeofdata);
+            }
+            values = node_datas;
             next_pos += sizeofdata;
         }
-        else if (vector_size > 1) {
-            if (memtype == Udm_MemSequentialArray) {
-                for (i=0; i<vector_size; i++) {
-                    memcpy((char*)node_datas+i*sizeofdata,
-                            (char*)solution_array+next_pos + i*data_size*sizeofdata,
-                            sizeofdata);
-                }
-                error = node->setSolutionVector(field_name, datatype, node_datas, vector_size);
-                next_pos += sizeofdata;
+        else {
+            values = (char*)solution_array+next_pos;
+            next_pos += sizeofdata*vector_size;
+        }
+
+        if (column != NULL && node->solution_voxels == this) {
+            // 物理量カラムデータに直接設定する
+            error = column->setSolutionPointer(node->solution_slot, datatype, values, vector_size);
+        }
+        else {
+            if (vector_size == 1) {
+                error = node->setSolutionScalar(field_name, datatype, values);
             }
             else {
-                error = node->setSolutionVector(field_name, datatype, (char*)solution_array+next_pos, vector_size);
-                next_pos += sizeofdata*vector_size;
+                error = node->setSolutionVector(field_name, datatype, values, vector_size);
+            }
+            if (column == NULL && error == UDM_OK) {
+                column = this->getSolutionColumn(field_name);
             }
         }
         if (error != UDM_OK) {
@@ -149,18 +179,40 @@ UdmError_t UdmEntityVoxels::getEntitySolutionArray(
     }
     int config_sizeofdata = this->sizeofDataType(config->getDataType());
     config_nvectorsize = config->getNvectorSize();
+    if (config_nvectorsize <= 0) config_nvectorsize = 1;
     UdmDataType_t config_datatype = config->getDataType();
     void *node_datas = this->createDataArray(config_datatype, config_nvectorsize);
     len = end_id-start_id+1;
     next_pos = 0;
+    // 物理量カラムデータ : 物理量名称の検索は一度のみとする.
+    const UdmSolutionColumn *column = this->getSolutionColumn(field_name);
+    bool direct_column = (column != NULL
+                        && column->getDataType() == config_datatype
+                        && column->getNvectorSize() == config_nvectorsize);
     for (n=start_id; n<=end_id; n++) {
-        UdmEntity *node = this->getEntityById(n);
-        memset(node_datas, 0x00, config_nvectorsize*config_sizeofdata);
+        const UdmEntity *node = this->getEntityById(n);
+        const void *src_datas = node_datas;
         // 物理量データの取得
-        node->getSolutionValues(field_name, node_datas);
+        if (column != NULL && node->solution_voxels == this) {
+            if (!column->existsSolutionValue(node->solution_slot)) {
+                memset(node_datas, 0x00, config_nvectorsize*config_sizeofdata);
+            }
+            else if (direct_column) {
+                // 物理量カラムデータから取得データ配列に直接コピーする.
+                src_datas = column->getSolutionPointer(node->solution_slot);
+            }
+            else {
+                memset(node_datas, 0x00, config_nvectorsize*config_sizeofdata);
+                column->getSolutionPointer(node->solution_slot, config_datatype, node_datas, config_nvectorsize);
+            }
+        }
+        else {
+            memset(node_datas, 0x00, config_nvectorsize*config_sizeofdata);
+            node->getSolutionValues(field_name, node_datas);
+        }
 
         if (vector_size == 1 || memtype == Udm_MemIndexesArray) {
-            this->copyDataArray((char*)solution_array+next_pos, datatype, node_datas, config_datatype, vector_size);
+            this->copyDataArray((char*)solution_array+next_pos, datatype, src_datas, config_datatype, vector_size);
             next_pos += sizeofdata*vector_size;
         }
         else if (memtype == Udm_MemSequentialArray) {
@@ -168,16 +220,373 @@ UdmError_t UdmEntityVoxels::getEntitySolutionArray(
                 this->copyDataArray(
                                 (char*)solution_array+next_pos+i*len*sizeofdata,
                                 datatype,
-                                (char*)node_datas+i*config_sizeofdata,
+                                (const char*)src_datas+i*config_sizeofdata,
                                 config_datatype, 1);
             }
             next_pos += sizeofdata;
         }
     }
-    this->deleteDataArray(node_datas, datatype);
+    this->deleteDataArray(node_datas, config_datatype);
+    return UDM_OK;
+}
+
+/**
+ * 所属ゾーンの節点（ノード）、要素（セル）メモリプールを取得する.
+ * @return        メモリプール : 所属ゾーンが存在しない場合はNULL
+ */
+UdmEntityPool* UdmEntityVoxels::getEntityPool() const
+{
+    if (this->getParentZone() == NULL) return NULL;
+    return this->getParentZone()->getEntityPool();
+}
+
+/**
+ * 物理量データ格納タイプを取得する.
+ * @return        物理量データ格納タイプ
+ */
+UdmSolutionStorageType_t UdmEntityVoxels::getSolutionStorageType() const
+{
+    return this->solution_storage;
+}
+
+/**
+ * 物理量データ格納タイプを設定する.
+ * Udm_EntitySolutionStorageを設定した場合は、物理量カラムデータをノード・要素の物理量データに戻して、
+ * 物理量カラムデータを破棄する.
+ * Udm_ColumnSolutionStorageを設定した場合は、次回の物理量データ設定時に物理量カラムデータに移行する.
+ * @param storage_type        物理量データ格納タイプ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmEntityVoxels::setSolutionStorageType(UdmSolutionStorageType_t storage_type)
+{
+    if (storage_type == Udm_ColumnSolutionStorage) {
+        this->solution_storage = storage_type;
+        return UDM_OK;
+    }
+    if (storage_type != Udm_EntitySolutionStorage) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid solution storage type[%d].", storage_type);
+    }
+
+    this->solution_storage = storage_type;
+    std::vector<UdmEntity*> entities = this->slot_entities;
+    std::vector<UdmEntity*>::iterator itr;
+    for (itr = entities.begin(); itr != entities.end(); itr++) {
+        if ((*itr) == NULL) continue;
+        (*itr)->detachSolutionVoxels();
+    }
+    this->slot_entities.clear();
+    this->free_slots.clear();
+    this->clearSolutionColumns();
+
     return UDM_OK;
 }
 
+/**
+ * 物理量カラムデータを使用するかチェックする.
+ * @return        true=物理量カラムデータを使用する.
+ */
+bool UdmEntityVoxels::isColumnSolutionStorage() const
+{
+    return (this->solution_storage == Udm_ColumnSolutionStorage);
+}
+
+/**
+ * 物理量カラムデータ数を取得する.
+ * @return        物理量カラムデータ数
+ */
+int UdmEntityVoxels::getNumSolutionColumns() const
+{
+    return this->solution_columns.size();
+}
+
+/**
+ * 物理量カラムデータを取得する.
+ * @param column_id        物理量カラムデータID（１～）
+ * @return        物理量カラムデータ
+ */
+UdmSolutionColumn* UdmEntityVoxels::getSolutionColumn(int column_id)
+{
+    if (column_id <= 0) return NULL;
+    if ((size_t)column_id > this->solution_columns.size()) return NULL;
+    return this->solution_columns[column_id-1];
+}
+
+/**
+ * 物理量カラムデータを取得する:const.
+ * @param column_id        物理量カラムデータID（１～）
+ * @return        物理量カラムデータ
+ */
+const UdmSolutionColumn* UdmEntityVoxels::getSolutionColumn(int column_id) const
+{
+    if (column_id <= 0) return NULL;
+    if ((size_t)column_id > this->solution_columns.size()) return NULL;
+    return this->solution_columns[column_id-1];
+}
+
+/**
+ * 物理量カラムデータを取得する.
+ * @param solution_name        物理量名称
+ * @return        物理量カラムデータ
+ */
+UdmSolutionColumn* UdmEntityVoxels::getSolutionColumn(const std::string &solution_name)
+{
+    std::vector<UdmSolutionColumn*>::iterator itr;
+    for (itr = this->solution_columns.begin(); itr != this->solution_columns.end(); itr++) {
+        if ((*itr)->equalsName(solution_name)) {
+            return (*itr);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * 物理量カラムデータを取得する:const.
+ * @param solution_name        物理量名称
+ * @return        物理量カラムデータ
+ */
+const UdmSolutionColumn* UdmEntityVoxels::getSolutionColumn(const std::string &solution_name) const
+{
+    std::vector<UdmSolutionColumn*>::const_iterator itr;
+    for (itr = this->solution_columns.begin(); itr != this->solution_columns.end(); itr++) {
+        if ((*itr)->equalsName(solution_name)) {
+            return (*itr);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * 物理量カラムデータの使用スロット数を取得する.
+ * @return        使用スロット数
+ */
+UdmSize_t UdmEntityVoxels::getNumSolutionSlots() const
+{
+    return this->slot_entities.size() - this->free_slots.size();
+}
+
+/**
+ * 物理量カラムデータを破棄する.
+ * ノード・要素のスロットは解放しない.
+ */
+void UdmEntityVoxels::clearSolutionColumns()
+{
+    std::vector<UdmSolutionColumn*>::iterator itr;
+    for (itr = this->solution_columns.begin(); itr != this->solution_columns.end(); itr++) {
+        if ((*itr) != NULL) delete (*itr);
+    }
+    this->solution_columns.clear();
+    this->field_columns.clear();
+    if (this->slot_entities.size() <= 0) {
+        this->slot_capacity = 0;
+    }
+}
+
+/**
+ * 物理量フィールド情報から物理量カラムデータを生成する.
+ * 生成済みの場合は、生成済みの物理量カラムデータを返す.
+ * @param solution_name        物理量名称
+ * @return        物理量カラムデータ : 物理量フィールド情報が存在しない場合はNULL
+ */
+UdmSolutionColumn* UdmEntityVoxels::createSolutionColumn(const std::string &solution_name)
+{
+    UdmSolutionColumn *column = this->getSolutionColumn(solution_name);
+    if (column != NULL) return column;
+
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfig(solution_name);
+    if (config == NULL) return NULL;
+
+    return this->createSolutionColumn(
+                        config->getSolutionName(),
+                        config->getDataType(),
+                        config->getVectorType(),
+                        config->getNvectorSize());
+}
+
+/**
+ * 物理量カラムデータを生成する.
+ * 生成済みの場合は、生成済みの物理量カラムデータを返す.
+ * @param solution_name        物理量名称
+ * @param datatype            データ型
+ * @param vectortype            ベクトルタイプ
+ * @param nvector_size        物理量成分数
+ * @return        物理量カラムデータ
+ */
+UdmSolutionColumn* UdmEntityVoxels::createSolutionColumn(
+                        const std::string &solution_name,
+                        UdmDataType_t datatype,
+                        UdmVectorType_t vectortype,
+                        int nvector_size)
+{
+    UdmSolutionColumn *column = this->getSolutionColumn(solution_name);
+    if (column != NULL) return column;
+
+    column = new UdmSolutionColumn(solution_name, datatype, vectortype, nvector_size);
+    if (column->reserveSlots(this->slot_capacity) != UDM_OK) {
+        delete column;
+        return NULL;
+    }
+    this->solution_columns.push_back(column);
+    column->setId(this->solution_columns.size());
+    this->rebuildFieldColumns();
+    return column;
+}
+
+/**
+ * 物理量カラムデータのスロットを確保する.
+ * 確保スロット数が不足する場合は、すべての物理量カラムデータを拡張する.
+ * @param entity        スロット使用ノード・要素
+ * @return        確保スロット（０～）
+ */
+UdmSize_t UdmEntityVoxels::allocateSolutionSlot(UdmEntity *entity)
+{
+    UdmSize_t slot;
+    if (this->free_slots.size() > 0) {
+        slot = this->free_slots.back();
+        this->free_slots.pop_back();
+        this->slot_entities[slot] = entity;
+        return slot;
+    }
+
+    slot = this->slot_entities.size();
+    this->slot_entities.push_back(entity);
+    if (slot >= this->slot_capacity) {
+        UdmSize_t capacity = this->slot_capacity*2;
+        if (capacity < this->getNumEntities()) capacity = this->getNumEntities();
+        if (capacity <= slot) capacity = slot+1;
+        std::vector<UdmSolutionColumn*>::iterator itr;
+        for (itr = this->solution_columns.begin(); itr != this->solution_columns.end(); itr++) {
+            (*itr)->reserveSlots(capacity);
+        }
+        this->slot_capacity = capacity;
+    }
+    return slot;
+}
+
+/**
+ * 物理量カラムデータのスロットを解放する.
+ * すべての物理量カラムデータのスロットの物理量データをクリアする.
+ * @param slot        解放スロット（０～）
+ */
+void UdmEntityVoxels::releaseSolutionSlot(UdmSize_t slot)
+{
+    if (slot >= this->slot_entities.size()) return;
+    if (this->slot_entities[slot] == NULL) return;
+
+    std::vector<UdmSolutionColumn*>::iterator itr;
+    for (itr = this->solution_columns.begin(); itr != this->solution_columns.end(); itr++) {
+        (*itr)->clearSolutionValue(slot);
+    }
+    this->slot_entities[slot] = NULL;
+    this->free_slots.push_back(slot);
+
+    // すべてのスロットが未使用であれば初期化する
+    if (this->free_slots.size() == this->slot_entities.size()) {
+        this->slot_entities.clear();
+        this->free_slots.clear();
+    }
+}
+
+/**
+ * 物理量フィールドIDの物理量カラムデータを取得する.
+ * 物理量カラムデータが存在しない場合は、物理量フィールド情報から生成する.
+ * 物理量フィールドIDは物理量情報リストの更新（物理量の追加、削除）により変更されるため、
+ * 物理量情報リストの更新番号が変更された場合は、物理量フィールドID毎の物理量カラムデータを再作成する.
+ * @param field_id        物理量フィールドID（１～）
+ * @return        物理量カラムデータ : 物理量カラムデータを使用しない場合はNULL
+ */
+UdmSolutionColumn* UdmEntityVoxels::getSolutionColumnByFieldId(UdmSize_t field_id)
+{
+    if (field_id <= 0) return NULL;
+    if (this->field_revision != this->getSolutionFieldsRevision()) {
+        this->rebuildFieldColumns();
+    }
+    if (field_id <= this->field_columns.size() && this->field_columns[field_id-1] != NULL) {
+        return this->field_columns[field_id-1];
+    }
+    if (!this->isColumnSolutionStorage()) return NULL;
+
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfigById(field_id);
+    if (config == NULL) return NULL;
+    if (config->getGridLocation() != this->getSolutionGridLocation()) return NULL;
+
+    // 物理量カラムデータの生成時に物理量フィールドID毎の物理量カラムデータを再作成する
+    return this->createSolutionColumn(config->getSolutionName());
+}
+
+/**
+ * 物理量フィールドIDの物理量カラムデータを取得する:const.
+ * 物理量情報リストの更新番号が変更されている場合は、物理量名称により検索する.
+ * @param field_id        物理量フィールドID（１～）
+ * @return        物理量カラムデータ
+ */
+const UdmSolutionColumn* UdmEntityVoxels::getSolutionColumnByFieldId(UdmSize_t field_id) const
+{
+    if (field_id <= 0) return NULL;
+    if (this->field_revision == this->getSolutionFieldsRevision()) {
+        if (field_id > this->field_columns.size()) return NULL;
+        return this->field_columns[field_id-1];
+    }
+
+    const UdmSolutionFieldConfig *config = this->getSolutionFieldConfigById(field_id);
+    if (config == NULL) return NULL;
+    return this->getSolutionColumn(config->getSolutionName());
+}
+
+/**
+ * 物理量フィールドIDの物理量フィールド情報を取得する.
+ * @param field_id        物理量フィールドID（１～）
+ * @return        物理量フィールド情報
+ */
+const UdmSolutionFieldConfig* UdmEntityVoxels::getSolutionFieldConfigById(UdmSize_t field_id) const
+{
+    const UdmZone* zone = this->getParentZone();
+    if (zone == NULL) return NULL;
+    const UdmFlowSolutions* solutions = zone->getFlowSolutions();
+    if (solutions == NULL) return NULL;
+
+    return solutions->getSolutionField(field_id);
+}
+
+/**
+ * 物理量情報リストの更新番号を取得する.
+ * @return        物理量情報リストの更新番号
+ */
+UdmSize_t UdmEntityVoxels::getSolutionFieldsRevision() const
+{
+    const UdmZone* zone = this->getParentZone();
+    if (zone == NULL) return 0;
+    const UdmFlowSolutions* solutions = zone->getFlowSolutions();
+    if (solutions == NULL) return 0;
+    const UdmFlowSolutionListConfig* config = solutions->getFlowSolutionsConfig();
+    if (config == NULL) return 0;
+
+    return config->getSolutionRevision();
+}
+
+/**
+ * 物理量フィールドID毎の物理量カラムデータを再作成する.
+ */
+void UdmEntityVoxels::rebuildFieldColumns()
+{
+    this->field_columns.clear();
+    this->field_revision = this->getSolutionFieldsRevision();
+
+    const UdmZone* zone = this->getParentZone();
+    if (zone == NULL) return;
+    const UdmFlowSolutions* solutions = zone->getFlowSolutions();
+    if (solutions == NULL) return;
+
+    std::vector<UdmSolutionColumn*>::iterator itr;
+    for (itr = this->solution_columns.begin(); itr != this->solution_columns.end(); itr++) {
+        UdmSize_t field_id = solutions->getFieldId((*itr)->getName());
+        if (field_id <= 0) continue;
+        if (this->field_columns.size() < field_id) {
+            this->field_columns.resize(field_id, NULL);
+        }
+        this->field_columns[field_id-1] = (*itr);
+    }
+}
+
 /**
  * MPIコミュニケータを取得する.
  * @return        MPIコミュニケータ
@@ -47,6 +47,7 @@ UdmFlowSolutions::UdmFlowSolutions(UdmZone *parent_zone)
  */
 UdmFlowSolutions::~UdmFlowSolutions()
 {
+    this->clearStagedSolutionFields();
 }
 
 /**
@@ -146,7 +147,7 @@ UdmSize_t UdmFlowSolutions::createSolutionField(
     }
     UdmSolutionFieldConfig *field = new UdmSolutionFieldConfig(field_name, location, data_type);
     this->getFlowSolutionsConfig()->setSolutionFieldConfig(field);
-    return this->getNumSolutionFields();
+    return this->getFieldId(field_name);
 }
 
 /**
@@ -181,7 +182,7 @@ UdmSize_t UdmFlowSolutions::createSolutionField(
                                         nvector_size,
                                         constant_flag);
     this->getFlowSolutionsConfig()->setSolutionFieldConfig(field);
-    return this->getNumSolutionFields();
+    return this->getFieldId(field_name);
 }
 
 /**
@@ -296,6 +297,9 @@ int UdmFlowSolutions::getCgnsSolutionFieldNames(const std::string& field_name, s
 
 /**
  * 物理量フィールド名称の物理量フィールドIDを取得する.
+ * 物理量フィールドIDにより、物理量名称の検索を行わずに物理量データの取得、設定を行うことができる.
+ * 物理量フィールドIDは物理量フィールドの追加、削除により変更されるため、
+ * 物理量フィールドの追加、削除後は再取得すること.
  * @param field_name        物理量フィールド名称
  * @return        物理量フィールドID : 存在しない場合は0を返す
  */
@@ -544,6 +548,13 @@ UdmError_t UdmFlowSolutions::readCgns(int index_file, int index_base, int index_
         // 物理量名称
         this->getFieldName(index_dfi_field, dif_filed_name);
 
+        // 読込対象外の物理量はCGNS:FlowSolution/Fieldを読み込まない.
+        if (this->getParentZone() != NULL
+            && this->getParentZone()->getParentModel() != NULL
+            && !this->getParentZone()->getParentModel()->isLoadSolutionField(dif_filed_name)) {
+            continue;
+        }
+
         // 取得対象のCGNS:FlowSolutionとCGNS:SolutionFieldのIDを取得する.
         int index_solution = 0;
         std::vector<int> index_fields;
@@ -1083,8 +1094,8 @@ UdmError_t UdmFlowSolutions::writeCgnsSolutionField(
     GridLocation_t cgns_location;
     UdmDataType_t datatype;
     DataType_t cgns_datatype;
-    UdmSize_t data_size;
-    UdmEntityVoxels* voxels = NULL;
+    UdmSize_t data_size = 0;
+    void *field_datas = NULL;
     int sizeofdata;
 
     // CGNS:FlowSolution名
@@ -1113,20 +1124,100 @@ UdmError_t UdmFlowSolutions::writeCgnsSolutionField(
     datatype = config->getDataType();
     cgns_datatype = this->toCgnsDataType(datatype);
     sizeofdata = this->sizeofDataType(datatype);
-    voxels = NULL;
+
+    // 非同期出力の退避バッファが存在すれば退避バッファを出力する.
+    std::map<std::string, std::pair<UdmDataType_t, void*> >::const_iterator staged_itr;
+    staged_itr = this->staged_fields.find(config->getSolutionName());
+    UdmEntityVoxels* voxels = this->getSolutionFieldVoxels(config);
+    if (voxels == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmEntityVoxels is null.[GridLocation=%d]", config->getGridLocation());
+    }
+    data_size = voxels->getNumEntities();
+    if (staged_itr != this->staged_fields.end() && staged_itr->second.first == datatype) {
+        field_datas = staged_itr->second.second;
+    }
+    else {
+        // モデルのCGNS出力作業バッファに物理量データを取得する.
+        field_datas = this->getParentZone()->getScratchBuffer((size_t)data_size*vector_size*sizeofdata);
+        if (field_datas == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmModel is null.");
+        }
+        if (voxels->getEntitySolutionArray(
+                                config->getSolutionName(),
+                                1, data_size,
+                                vector_size,
+                                datatype,
+                                field_datas,
+                                Udm_MemSequentialArray) != UDM_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : getEntitySolutionArray(field name=%s)", config->getSolutionName().c_str());
+        }
+    }
+
+    // CGNS:SolutionFieldの出力
+    next_pos = 0;
+    for (n=0; n<vector_size; n++) {
+        if (cg_field_write(index_file, index_base, index_zone, index_solution,
+                            cgns_datatype,
+                            vector_names[n].c_str(),
+                            (char*)field_datas+next_pos,
+                            &index_field) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : cg_field_write(field name=%s)", vector_names[n].c_str());
+        }
+        next_pos += data_size*sizeofdata;
+    }
+
+    // CGNS:FlowSolution出力名を追加する.
+    this->addCgnsWriteSolutions(flowsolution_name);
+
+    return UDM_OK;
+}
+
+
+/**
+ * 物理量の適用位置の節点（ノード）又は要素（セル）の構成クラスを取得する.
+ * @param config            物理量情報
+ * @return        節点（ノード）又は要素（セル）の構成クラス : 適用位置が不正の場合はNULL
+ */
+UdmEntityVoxels* UdmFlowSolutions::getSolutionFieldVoxels(const UdmSolutionFieldConfig* config)
+{
+    if (config == NULL) return NULL;
+    if (this->getParentZone() == NULL) return NULL;
     if (config->getGridLocation() == Udm_Vertex) {
-        voxels = this->getParentZone()->getGridCoordinates();
+        return this->getParentZone()->getGridCoordinates();
     }
     else if (config->getGridLocation() == Udm_CellCenter) {
-        voxels = this->getParentZone()->getSections();
+        return this->getParentZone()->getSections();
     }
+    return NULL;
+}
+
+/**
+ * 物理量の出力データ配列を作成する.
+ * 物理量の全節点（ノード）又は全要素（セル）のデータを成分毎の連続配列(Udm_MemSequentialArray)で取得する.
+ * 作成データ配列は呼出元にてdeleteDataArrayにより削除すること.
+ * @param [in]  config            物理量情報
+ * @param [out] field_datas        出力データ配列
+ * @param [out] data_size        フィールドサイズ（節点（ノード）数又は要素（セル）数）
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmFlowSolutions::createSolutionFieldArray(
+                        const UdmSolutionFieldConfig* config,
+                        void* &field_datas,
+                        UdmSize_t &data_size)
+{
+    UdmDataType_t datatype = config->getDataType();
+    int vector_size = config->getNvectorSize();
+    UdmEntityVoxels* voxels = this->getSolutionFieldVoxels(config);
+
+    field_datas = NULL;
+    data_size = 0;
     if (voxels == NULL) {
         return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmEntityVoxels is null.[GridLocation=%d]", config->getGridLocation());
     }
     data_size = voxels->getNumEntities();
 
     // データサイズ = フィールドサイズ*成分数
-    void *field_datas = this->createDataArray(datatype, data_size*vector_size);
+    field_datas = this->createDataArray(datatype, data_size*vector_size);
     // データの取得
     if (voxels->getEntitySolutionArray(
                             config->getSolutionName(),
@@ -1136,31 +1227,62 @@ UdmError_t UdmFlowSolutions::writeCgnsSolutionField(
                             field_datas,
                             Udm_MemSequentialArray) != UDM_OK) {
         this->deleteDataArray(field_datas, datatype);
+        field_datas = NULL;
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : getEntitySolutionArray(field name=%s)", config->getSolutionName().c_str());
     }
 
-    // CGNS:SolutionFieldの出力
-    next_pos = 0;
-    for (n=0; n<vector_size; n++) {
-        if (cg_field_write(index_file, index_base, index_zone, index_solution,
-                            cgns_datatype,
-                            vector_names[n].c_str(),
-                            (char*)field_datas+next_pos,
-                            &index_field) != CG_OK) {
-            this->deleteDataArray(field_datas, datatype);
-            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : cg_field_write(field name=%s)", vector_names[n].c_str());
-        }
-        next_pos += data_size*sizeofdata;
-    }
+    return UDM_OK;
+}
 
-    this->deleteDataArray(field_datas, datatype);
+/**
+ * 非同期出力のため、全物理量の出力データを退避バッファにコピーする.
+ * 退避後のCGNS:FlowSolution出力は退避バッファから行うため、出力中に物理量データを更新することができる.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmFlowSolutions::stageCgnsSolutionFields()
+{
+    UdmSize_t field_id, num_fields;
+    UdmSize_t data_size = 0;
 
-    // CGNS:FlowSolution出力名を追加する.
-    this->addCgnsWriteSolutions(flowsolution_name);
+    this->clearStagedSolutionFields();
+
+    num_fields = this->getNumSolutionFields();
+    for (field_id=1; field_id<=num_fields; field_id++) {
+        const UdmSolutionFieldConfig* config = this->getSolutionField(field_id);
+        if (config == NULL) continue;
+        void *field_datas = NULL;
+        if (this->createSolutionFieldArray(config, field_datas, data_size) != UDM_OK) {
+            this->clearStagedSolutionFields();
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : createSolutionFieldArray(field name=%s)", config->getSolutionName().c_str());
+        }
+        this->staged_fields.insert(std::make_pair(
+                        config->getSolutionName(),
+                        std::make_pair(config->getDataType(), field_datas)));
+    }
 
     return UDM_OK;
 }
 
+/**
+ * 非同期出力の物理量データ退避バッファを削除する.
+ */
+void UdmFlowSolutions::clearStagedSolutionFields()
+{
+    std::map<std::string, std::pair<UdmDataType_t, void*> >::iterator itr;
+    for (itr=this->staged_fields.begin(); itr!=this->staged_fields.end(); itr++) {
+        this->deleteDataArray(itr->second.second, itr->second.first);
+    }
+    this->staged_fields.clear();
+}
+
+/**
+ * 非同期出力の物理量データ退避バッファが存在するかチェックする.
+ * @return        true=退避バッファが存在する
+ */
+bool UdmFlowSolutions::isStagedSolutionFields() const
+{
+    return (!this->staged_fields.empty());
+}
 
 /**
  * 固定値物理量が出力済みであるかチェックする.
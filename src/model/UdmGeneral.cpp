@@ -16,6 +16,7 @@
  */
 
 #include "model/UdmGeneral.h"
+#include "model/UdmElementTopology.h"
 #include "model/UdmNode.h"
 #include "model/UdmCell.h"
 #include "model/UdmComponent.h"
@@ -278,17 +279,7 @@ ElementType_t UdmGeneral::toCgnsElementType(UdmElementType_t elementtype)
  */
 int UdmGeneral::getNumVertexOfElementType(UdmElementType_t elementtype)
 {
-    if (elementtype == Udm_NODE) return 1;
-    else if (elementtype == Udm_BAR_2) return 2;
-    else if (elementtype == Udm_TRI_3) return 3;
-    else if (elementtype == Udm_QUAD_4) return 4;
-    else if (elementtype == Udm_TETRA_4) return 4;
-    else if (elementtype == Udm_PYRA_5) return 5;
-    else if (elementtype == Udm_PENTA_6) return 6;
-    else if (elementtype == Udm_HEXA_8) return 8;
-    else if (elementtype == Udm_MIXED) return 0;
-
-    return 0;
+    return UdmElementTopology::getNumVertex(elementtype);
 }
 
 
@@ -300,17 +291,7 @@ int UdmGeneral::getNumVertexOfElementType(UdmElementType_t elementtype)
  */
 int UdmGeneral::getNumComponentOfElementType(UdmElementType_t elementtype)
 {
-    if (elementtype == Udm_NODE) return 0;
-    else if (elementtype == Udm_BAR_2) return 0;
-    else if (elementtype == Udm_TRI_3) return 3;
-    else if (elementtype == Udm_QUAD_4) return 4;
-    else if (elementtype == Udm_TETRA_4) return 4;
-    else if (elementtype == Udm_PYRA_5) return 5;
-    else if (elementtype == Udm_PENTA_6) return 5;
-    else if (elementtype == Udm_HEXA_8) return 6;
-    else if (elementtype == Udm_MIXED) return 0;
-
-    return 0;
+    return UdmElementTopology::getNumComponents(elementtype);
 }
 
 /**
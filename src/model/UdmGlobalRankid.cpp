@@ -18,6 +18,7 @@
 #include "UdmBase.h"
 #include "model/UdmGlobalRankid.h"
 #include "model/UdmEntity.h"
+#include <algorithm>
 
 namespace udm
 {
@@ -27,7 +28,7 @@ namespace udm
  */
 UdmGlobalRankidList::UdmGlobalRankidList()
 {
-    this->globalid_list.clear();
+    this->initialize();
 };
 
 /**
@@ -36,18 +37,170 @@ UdmGlobalRankidList::UdmGlobalRankidList()
  */
 UdmGlobalRankidList::UdmGlobalRankidList(UdmSize_t size)
 {
-    this->globalid_list.clear();
+    this->initialize();
     this->reserve(size);
 }
 
+/**
+ * コピーコンストラクタ
+ * @param    src        コピー元グローバルIDリスト
+ */
+UdmGlobalRankidList::UdmGlobalRankidList(const UdmGlobalRankidList &src)
+{
+    this->initialize();
+    *this = src;
+}
+
 /**
  * デストラクタ
  */
 UdmGlobalRankidList::~UdmGlobalRankidList()
 {
-    this->globalid_list.clear();
+    this->clear();
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        delete [] this->heap_globalids;
+    }
 };
 
+/**
+ * 初期化を行う.
+ */
+void UdmGlobalRankidList::initialize()
+{
+    this->num_globalids = 0;
+    this->capacity_globalids = UDM_GLOBALRANKID_INLINESIZE;
+    memset(&this->inline_globalids, 0x00, sizeof(this->inline_globalids));
+}
+
+/**
+ * 代入オペレータ
+ * @param src        コピー元グローバルIDリスト
+ * @return        グローバルIDリスト
+ */
+UdmGlobalRankidList& UdmGlobalRankidList::operator = (const UdmGlobalRankidList &src)
+{
+    if (this == &src) return *this;
+
+    this->clear();
+    this->reserve(src.num_globalids);
+    memcpy(this->getLocalids(), src.getLocalids(), src.num_globalids*sizeof(UdmSize_t));
+    memcpy(this->getRanknos(), src.getRanknos(), src.num_globalids*sizeof(int));
+    this->num_globalids = src.num_globalids;
+
+    return *this;
+}
+
+/**
+ * ローカルID配列の先頭ポインタを取得する.
+ * @return        ローカルID配列の先頭ポインタ
+ */
+UdmSize_t* UdmGlobalRankidList::getLocalids()
+{
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        return (UdmSize_t*)this->heap_globalids;
+    }
+    return this->inline_globalids.localids;
+}
+
+/**
+ * ローカルID配列の先頭ポインタを取得する:const.
+ * @return        ローカルID配列の先頭ポインタ
+ */
+const UdmSize_t* UdmGlobalRankidList::getLocalids() const
+{
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        return (const UdmSize_t*)this->heap_globalids;
+    }
+    return this->inline_globalids.localids;
+}
+
+/**
+ * ランク番号配列の先頭ポインタを取得する.
+ * ヒープ領域ではローカルID配列の後にランク番号配列を配置する.
+ * @return        ランク番号配列の先頭ポインタ
+ */
+int* UdmGlobalRankidList::getRanknos()
+{
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        return (int*)(this->heap_globalids + this->capacity_globalids*sizeof(UdmSize_t));
+    }
+    return this->inline_globalids.ranknos;
+}
+
+/**
+ * ランク番号配列の先頭ポインタを取得する:const.
+ * @return        ランク番号配列の先頭ポインタ
+ */
+const int* UdmGlobalRankidList::getRanknos() const
+{
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        return (const int*)(this->heap_globalids + this->capacity_globalids*sizeof(UdmSize_t));
+    }
+    return this->inline_globalids.ranknos;
+}
+
+/**
+ * 格納位置のグローバルIDを取得する.
+ * @param pos        格納位置（０～）
+ * @return        グローバルID
+ */
+UdmGlobalRankid UdmGlobalRankidList::getGlobalRankidAt(UdmSize_t pos) const
+{
+    return UdmGlobalRankid(this->getRanknos()[pos], this->getLocalids()[pos]);
+}
+
+/**
+ * 格納位置にグローバルIDを設定する.
+ * @param pos        格納位置（０～）
+ * @param rankno        ランク番号
+ * @param localid        ローカルID
+ */
+void UdmGlobalRankidList::setGlobalRankidAt(UdmSize_t pos, int rankno, UdmSize_t localid)
+{
+    this->getRanknos()[pos] = rankno;
+    this->getLocalids()[pos] = localid;
+}
+
+/**
+ * グローバルIDを挿入する.
+ * @param pos        挿入位置（０～）
+ * @param globalid        グローバルID
+ */
+void UdmGlobalRankidList::insertGlobalRankid(UdmSize_t pos, const UdmGlobalRankid &globalid)
+{
+    if (this->num_globalids >= this->capacity_globalids) {
+        this->reserve(this->capacity_globalids*2);
+    }
+
+    if (pos < this->num_globalids) {
+        UdmSize_t *localids = this->getLocalids();
+        int *ranknos = this->getRanknos();
+        memmove(localids+pos+1, localids+pos, (this->num_globalids-pos)*sizeof(UdmSize_t));
+        memmove(ranknos+pos+1, ranknos+pos, (this->num_globalids-pos)*sizeof(int));
+    }
+    this->setGlobalRankidAt(pos, globalid.rankno, globalid.localid);
+    this->num_globalids++;
+
+    return;
+}
+
+/**
+ * グローバルIDを削除する.
+ * @param pos        削除位置（０～）
+ */
+void UdmGlobalRankidList::eraseGlobalRankid(UdmSize_t pos)
+{
+    if (pos >= this->num_globalids) return;
+
+    UdmSize_t *localids = this->getLocalids();
+    int *ranknos = this->getRanknos();
+    memmove(localids+pos, localids+pos+1, (this->num_globalids-pos-1)*sizeof(UdmSize_t));
+    memmove(ranknos+pos, ranknos+pos+1, (this->num_globalids-pos-1)*sizeof(int));
+    this->num_globalids--;
+
+    return;
+}
+
 /**
  * グローバルIDを追加する.
  * @param globalid        グローバルID
@@ -55,19 +208,12 @@ UdmGlobalRankidList::~UdmGlobalRankidList()
  */
 UdmError_t UdmGlobalRankidList::addGlobalRankid(const UdmGlobalRankid &globalid)
 {
-    std::vector<UdmGlobalRankid>::const_iterator found_itr;
-    bool found = this->findGlobalRankid(globalid, found_itr);
+    UdmSize_t found_pos;
+    bool found = this->findGlobalRankid(globalid, found_pos);
     if (found) {
         return UDM_ERROR;
     }
-    if (found_itr == this->globalid_list.end()) {
-        this->globalid_list.push_back(globalid);
-    }
-    else {
-        std::vector<UdmGlobalRankid>::iterator insert_itr;
-        insert_itr = this->globalid_list.begin() + (found_itr - this->globalid_list.begin());
-        this->globalid_list.insert(insert_itr, globalid);
-    }
+    this->insertGlobalRankid(found_pos, globalid);
     return UDM_OK;
 };
 
@@ -82,138 +228,136 @@ UdmError_t UdmGlobalRankidList::addGlobalRankid(int rankno, UdmSize_t localid)
     return this->addGlobalRankid(UdmGlobalRankid(rankno, localid));
 };
 
+/**
+ * 以前のランク番号、ローカルIDをリストの最後に追加する.
+ * 重複チェック、ソートは行わない.
+ * @param rankno        ランク番号
+ * @param localid        ローカルID
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
 UdmError_t UdmGlobalRankidList::addPreviousRankInfo(int rankno, UdmSize_t localid)
 {
-    UdmGlobalRankid src_rank = UdmGlobalRankid(rankno, localid);
+    this->insertGlobalRankid(this->num_globalids, UdmGlobalRankid(rankno, localid));
+    return UDM_OK;
+};
 
-    std::vector<UdmGlobalRankid>::iterator insert_itr = this->globalid_list.end();
-    bool found = true;
-    // bool found = this->findGlobalRankid(globalid, found_itr);
 
-    printf("addPreviousRankInfo : %d, %ld, %ld\n", rankno, (long long)localid, this->globalid_list.size());
-    if (!found) {
-        if (this->globalid_list.size() <= 0) {
-            insert_itr = this->globalid_list.end();
-            found = false;
-        }
-        if (found == true) {
-            UdmSize_t left = 0;
-            UdmSize_t right = this->globalid_list.size();
-            UdmSize_t mid;
-            UdmSize_t size = this->globalid_list.size();
-            UdmGlobalRankid first = this->globalid_list[left];
-            UdmGlobalRankid last = this->globalid_list[right-1];
-            UdmGlobalRankid mid_rank;
-            UdmSize_t first_id = first.localid;
-            UdmSize_t last_id = last.localid;
-            UdmSize_t src_id = src_rank.localid;
-
-            if (first  > src_rank) {
-                insert_itr = this->globalid_list.begin();
-                found = false;
-            }
-            if (last < src_rank) {
-                insert_itr = this->globalid_list.end();
-                found = false;
-            }
-            if (found == true) {
-                found = false;
-#if 0
-                // id位置で検索
-                if (src_id>=first_id && src_id-first_id < size) {
-                    UdmGlobalRankid list_rank = this->globalid_list[src_id-first_id];
-                    insert_itr = this->globalid_list.begin() + (src_id-first_id);
-                    if (list_rank == src_rank) {
-                        found = true;
-                    }
-                    else if (list_rank > src_rank) {
-                        right = std::distance(this->globalid_list.begin(), insert_itr);
-                    }
-                    else {
-                        left = std::distance(this->globalid_list.begin(), insert_itr);
-                    }
-                }
-#endif
-                if (found == false) {
-                    long long diff = 0;
-                    while (left <= right) {
-                        mid = (left + right) / 2;
-                        if (mid >= size) {
-                            break;
-                        }
-                        mid_rank = this->globalid_list[mid];
-                        diff = mid_rank.compare(src_rank);
-                        if (diff == 0) {
-                            insert_itr = this->globalid_list.begin() + mid;
-                            found = true;
-                            break;
-                        }
-                        else if (diff < 0) {
-                            left = mid + 1;
-                        }
-                        else {
-                            right = mid - 1;
-                        }
-                    }
-                    if (found == false) {
-                        if (diff < 0) {
-                            insert_itr = this->globalid_list.begin() + mid + 1;
-                        }
-                        else {
-                            insert_itr = this->globalid_list.begin() + mid;
-                        }
-                    }
-                }
-            }
-        }
-    }
+/**
+ * グローバルIDリストを追加する.
+ * @param globalids       追加グローバルIDリスト
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmGlobalRankidList::addGlobalRankids(const UdmGlobalRankidList &globalids)
+{
+    if (globalids.size() <= 0) return UDM_ERROR;
 
-//    if (found) {
-//        return UDM_ERROR;
-//    }
-    /*
-    if (insert_itr == this->globalid_list.end()) {
-        this->globalid_list.push_back(src_rank);
-    }
-    else {
-        std::vector<UdmGlobalRankid>::iterator itr;
-        itr = this->globalid_list.begin() + (insert_itr - this->globalid_list.begin());
-        this->globalid_list.insert(itr, src_rank);
+    UdmSize_t n;
+    this->reserve(this->num_globalids + globalids.num_globalids);
+    for (n=0; n<globalids.num_globalids; n++) {
+        this->insertGlobalRankid(this->num_globalids, globalids.getGlobalRankidAt(n));
     }
-*/
-    this->globalid_list.push_back(src_rank);
+    this->finalizeGlobalRankids();
     return UDM_OK;
 };
 
-
 /**
- * グローバルIDリストを追加する.
+ * グローバルIDリストを一括追加する.
+ * 未ソートのまま追加した後に、ソート、重複削除を一括して行う.
  * @param globalids       追加グローバルIDリスト
  * @return        エラー番号 : UDM_OK | UDM_ERROR
  */
-UdmError_t UdmGlobalRankidList::addGlobalRankids(const UdmGlobalRankidList &globalids)
+UdmError_t UdmGlobalRankidList::addGlobalRankids(const std::vector<UdmGlobalRankid> &globalids)
 {
     if (globalids.size() <= 0) return UDM_ERROR;
 
     std::vector<UdmGlobalRankid>::const_iterator itr;
-    for (itr=globalids.globalid_list.begin(); itr!=globalids.globalid_list.end(); itr++) {
-        addGlobalRankid(*itr);
+    this->reserve(this->num_globalids + globalids.size());
+    for (itr=globalids.begin(); itr!=globalids.end(); itr++) {
+        this->insertGlobalRankid(this->num_globalids, *itr);
     }
+    this->finalizeGlobalRankids();
     return UDM_OK;
-};
+}
 
 /**
- * グローバルID, 関連オブジェクトを追加する.
+ * グローバルIDをリストの最後に追加する.
+ * 重複チェック、ソートは行わない. 追加終了後にfinalizeGlobalRankidsを呼び出すこと.
  * @param rankno        ランク番号
  * @param localid        ローカルID
- * @param entity        関連オブジェクト
+ */
+void UdmGlobalRankidList::appendGlobalRankid(int rankno, UdmSize_t localid)
+{
+    this->insertGlobalRankid(this->num_globalids, UdmGlobalRankid(rankno, localid));
+}
+
+/**
+ * グローバルIDを置き換える.
+ * 置換後のグローバルIDが存在する場合は、置換前のグローバルIDを削除する.
+ * 未ソートのリストに対して線形探索を行う. 置換終了後にfinalizeGlobalRankidsを呼び出すこと.
+ * @param old_rankno        以前のランク番号
+ * @param old_localid        以前のID
+ * @param new_rankno        新しいランク番号
+ * @param new_localid        新しいID
  * @return        エラー番号 : UDM_OK | UDM_ERROR
  */
-UdmError_t UdmGlobalRankidList::addGlobalRankid(int rankno, UdmSize_t localid, UdmEntity* entity)
+UdmError_t UdmGlobalRankidList::replaceGlobalRankid(
+        int old_rankno, UdmSize_t old_localid,
+        int new_rankno, UdmSize_t new_localid)
 {
-    return this->addGlobalRankid(UdmGlobalRankid(rankno, localid, entity));
+    UdmSize_t n;
+    UdmSize_t old_pos = this->num_globalids;
+    bool exists_new = false;
+    for (n=0; n<this->num_globalids; n++) {
+        UdmGlobalRankid globalid = this->getGlobalRankidAt(n);
+        if (old_pos >= this->num_globalids && globalid.equals(old_rankno, old_localid)) {
+            old_pos = n;
+        }
+        if (globalid.equals(new_rankno, new_localid)) {
+            exists_new = true;
+        }
+    }
+    if (old_pos >= this->num_globalids) return UDM_ERROR;
+
+    if (exists_new) {
+        // 存在するので更新しない。削除する
+        this->eraseGlobalRankid(old_pos);
+        return UDM_OK;
+    }
+    this->setGlobalRankidAt(old_pos, new_rankno, new_localid);
+    return UDM_OK;
 }
 
+/**
+ * 一括追加したグローバルIDリストのソート、重複削除を行う.
+ * 重複するグローバルIDは１つのみ残す.
+ */
+void UdmGlobalRankidList::finalizeGlobalRankids()
+{
+    if (this->num_globalids <= 1) return;
+
+    UdmSize_t n;
+
+    // ソート済みであれば何もしない.
+    for (n=1; n<this->num_globalids; n++) {
+        if (!(this->getGlobalRankidAt(n-1) < this->getGlobalRankidAt(n))) break;
+    }
+    if (n >= this->num_globalids) return;
+
+    std::vector<UdmGlobalRankid> sorted_globalids;
+    sorted_globalids.reserve(this->num_globalids);
+    for (n=0; n<this->num_globalids; n++) {
+        sorted_globalids.push_back(this->getGlobalRankidAt(n));
+    }
+    std::sort(sorted_globalids.begin(), sorted_globalids.end());
+    sorted_globalids.erase(std::unique(sorted_globalids.begin(), sorted_globalids.end()), sorted_globalids.end());
+
+    this->num_globalids = sorted_globalids.size();
+    for (n=0; n<this->num_globalids; n++) {
+        this->setGlobalRankidAt(n, sorted_globalids[n].rankno, sorted_globalids[n].localid);
+    }
+
+    return;
+}
 
 /**
  * グローバルIDが存在するかチェックする.
@@ -222,8 +366,8 @@ UdmError_t UdmGlobalRankidList::addGlobalRankid(int rankno, UdmSize_t localid, U
  */
 bool UdmGlobalRankidList::existsGlobalRankid(const UdmGlobalRankid &globalid) const
 {
-    std::vector<UdmGlobalRankid>::const_iterator insert_itr;
-    bool found = this->findGlobalRankid(globalid, insert_itr);
+    UdmSize_t insert_pos;
+    bool found = this->findGlobalRankid(globalid, insert_pos);
     return found;
 };
 
@@ -240,10 +384,11 @@ bool UdmGlobalRankidList::existsGlobalRankid(int rankno, UdmSize_t localid) cons
 
 /**
  * グローバルIDリストをクリアする.
+ * 確保領域は解放しない.
  */
 void UdmGlobalRankidList::clear()
 {
-    this->globalid_list.clear();
+    this->num_globalids = 0;
 };
 
 /**
@@ -253,15 +398,13 @@ void UdmGlobalRankidList::clear()
  */
 UdmError_t UdmGlobalRankidList::removeGlobalRankid(const UdmGlobalRankid &globalid)
 {
-    std::vector<UdmGlobalRankid>::const_iterator found_itr;
-    bool found = this->findGlobalRankid(globalid, found_itr);
+    UdmSize_t found_pos;
+    bool found = this->findGlobalRankid(globalid, found_pos);
     if (!found) {
         return UDM_ERROR;
     }
 
-    std::vector<UdmGlobalRankid>::iterator insert_itr;
-    insert_itr = this->globalid_list.begin() + (found_itr - this->globalid_list.begin());
-    this->globalid_list.erase(insert_itr);
+    this->eraseGlobalRankid(found_pos);
 
     return UDM_OK;
 }
@@ -283,7 +426,7 @@ UdmError_t UdmGlobalRankidList::removeGlobalRankid(int rankno, UdmSize_t localid
  */
 UdmSize_t UdmGlobalRankidList::getNumGlobalRankids() const
 {
-    return this->globalid_list.size();
+    return this->num_globalids;
 };
 
 /**
@@ -308,8 +451,8 @@ UdmError_t UdmGlobalRankidList::getGlobalRankid(UdmSize_t id, int &rankno, UdmSi
     if (id <= 0) return UDM_ERROR;
     if (id > this->getNumGlobalRankids()) return UDM_ERROR;
 
-    rankno = this->globalid_list[id-1].rankno;
-    localid = this->globalid_list[id-1].localid;
+    rankno = this->getRanknos()[id-1];
+    localid = this->getLocalids()[id-1];
 
     return UDM_OK;
 };
@@ -325,7 +468,7 @@ UdmError_t UdmGlobalRankidList::getGlobalRankid(UdmSize_t id, UdmGlobalRankid &g
     if (id <= 0) return UDM_ERROR;
     if (id > this->getNumGlobalRankids()) return UDM_ERROR;
 
-    globalid = this->globalid_list[id-1];
+    globalid = this->getGlobalRankidAt(id-1);
     return UDM_OK;
 };
 
@@ -384,35 +527,20 @@ UdmSerializeArchive& UdmGlobalRankidList::deserialize(UdmSerializeArchive& archi
  */
 void UdmGlobalRankidList::eraseInvalidGlobalRankids(int invalid_rankno)
 {
-/*************************
-    std::vector<UdmGlobalRankid>::reverse_iterator rev_itr;
-    for (rev_itr=this->globalid_list.rbegin(); rev_itr!=this->globalid_list.rend(); rev_itr++) {
-        if ((*rev_itr).localid <= 0 || (*rev_itr).rankno < 0) {
+    UdmSize_t n = 0;
+    while (n < this->num_globalids) {
+        UdmGlobalRankid globalid = this->getGlobalRankidAt(n);
+        if (globalid.localid <= 0 || globalid.rankno < 0) {
             // 不正グローバルIDの削除
-            this->globalid_list.erase( --(rev_itr.base()));
+            this->eraseGlobalRankid(n);
             continue;
         }
-        if ((*rev_itr).rankno == invalid_rankno) {
+        if (globalid.rankno == invalid_rankno) {
             // MPI接続情報の削除
-            this->globalid_list.erase( --(rev_itr.base()));
+            this->eraseGlobalRankid(n);
             continue;
         }
-    }
-***************************/
-
-    std::vector<UdmGlobalRankid>::iterator itr;
-    for (itr=this->globalid_list.begin(); itr!=this->globalid_list.end(); ) {
-        if ((*itr).localid <= 0 || (*itr).rankno < 0) {
-            // 不正グローバルIDの削除
-            itr = this->globalid_list.erase( itr);
-            continue;
-        }
-        if ((*itr).rankno == invalid_rankno) {
-            // MPI接続情報の削除
-            itr = this->globalid_list.erase( itr );
-            continue;
-        }
-        itr++;
+        n++;
     }
     return;
 }
@@ -429,16 +557,15 @@ UdmError_t UdmGlobalRankidList::updateGlobalRankid(
         int old_rankno, UdmSize_t old_localid,
         int new_rankno, UdmSize_t new_localid)
 {
-    std::vector<UdmGlobalRankid>::iterator itr;
-    for (itr=this->globalid_list.begin(); itr!=this->globalid_list.end(); itr++) {
-        if (itr->equals(old_rankno, old_localid)) {
+    UdmSize_t n;
+    for (n=0; n<this->num_globalids; n++) {
+        if (this->getGlobalRankidAt(n).equals(old_rankno, old_localid)) {
             if (this->existsGlobalRankid(new_rankno, new_localid)) {
                 // 存在するので更新しない。削除する
-                this->globalid_list.erase(itr);
+                this->eraseGlobalRankid(n);
                 return UDM_OK;
             }
-            itr->rankno = new_rankno;
-            itr->localid = new_localid;
+            this->setGlobalRankidAt(n, new_rankno, new_localid);
             return UDM_OK;
         }
     }
@@ -455,10 +582,9 @@ UdmError_t UdmGlobalRankidList::cloneGlobalRankidList(const UdmGlobalRankidList&
     // グローバルIDリストクリア
     this->clear();
 
-    std::vector<UdmGlobalRankid>::const_iterator itr;
-    for (itr=src.globalid_list.begin(); itr!=src.globalid_list.end(); itr++) {
-        UdmGlobalRankid info = (*itr);
-        this->addGlobalRankid(info.rankno, info.localid);
+    UdmSize_t n;
+    for (n=0; n<src.num_globalids; n++) {
+        this->addGlobalRankid(src.getGlobalRankidAt(n));
     }
 
     return UDM_OK;
@@ -473,12 +599,11 @@ void UdmGlobalRankidList::toString(std::string &buf) const
 #ifdef _DEBUG_TRACE
     std::stringstream stream;
     std::string info_buf;
-    std::vector<UdmGlobalRankid>::const_iterator itr;
-    for (itr=this->globalid_list.begin(); itr!=this->globalid_list.end(); itr++) {
-        UdmGlobalRankid info = (*itr);
+    UdmSize_t n;
+    for (n=0; n<this->num_globalids; n++) {
         info_buf.clear();
-        info.toString(info_buf);
-        if (itr != this->globalid_list.begin()) {
+        this->getGlobalRankidAt(n).toString(info_buf);
+        if (n > 0) {
             stream << ", ";
         }
         stream << info_buf;
@@ -492,53 +617,51 @@ void UdmGlobalRankidList::toString(std::string &buf) const
 
 /**
  * グローバルIDリストから一致するグローバルIDを検索する.
- * 昇順に並んでいるグローバルIDリストから一致するイテレータを返す。
- * 一致するグローバルIDが存在しない場合は、挿入位置のイテレータを返す。
+ * 昇順に並んでいるグローバルIDリストから一致する位置を返す。
+ * 一致するグローバルIDが存在しない場合は、挿入位置を返す。
  * @param [in]  src                検索グローバルID
- * @param [out] insert_itr        一致、挿入位置のイテレータ
+ * @param [out] insert_pos        一致、挿入位置（０～）
  * @return        true=一致するグローバルIDが存在する.
  */
 bool UdmGlobalRankidList::findGlobalRankid(
                 const UdmGlobalRankid &src_rank,
-                std::vector<UdmGlobalRankid>::const_iterator &insert_itr) const
+                UdmSize_t &insert_pos) const
 {
-    if (this->globalid_list.size() <= 0) {
-        insert_itr = this->globalid_list.end();
+    if (this->num_globalids <= 0) {
+        insert_pos = 0;
         return false;
     }
 
     UdmSize_t left = 0;
-    UdmSize_t right = this->globalid_list.size();
+    UdmSize_t right = this->num_globalids;
     UdmSize_t mid;
-    UdmSize_t size = this->globalid_list.size();
-    UdmGlobalRankid first = this->globalid_list[left];
-    UdmGlobalRankid last = this->globalid_list[right-1];
-    UdmGlobalRankid mid_rank;
+    UdmSize_t size = this->num_globalids;
+    const UdmGlobalRankid first = this->getGlobalRankidAt(left);
+    const UdmGlobalRankid last = this->getGlobalRankidAt(right-1);
     UdmSize_t first_id = first.localid;
-    UdmSize_t last_id = last.localid;
     UdmSize_t src_id = src_rank.localid;
 
     if (first  > src_rank) {
-        insert_itr = this->globalid_list.begin();
+        insert_pos = 0;
         return false;
     }
     if (last < src_rank) {
-        insert_itr = this->globalid_list.end();
+        insert_pos = size;
         return false;
     }
 
     // id位置で検索
     if (src_id>=first_id && src_id-first_id < size) {
-        UdmGlobalRankid list_rank = this->globalid_list[src_id-first_id];
-        insert_itr = this->globalid_list.begin() + (src_id-first_id);
+        const UdmGlobalRankid list_rank = this->getGlobalRankidAt(src_id-first_id);
+        insert_pos = src_id-first_id;
         if (list_rank == src_rank) {
             return true;
         }
         else if (list_rank > src_rank) {
-            right = std::distance(this->globalid_list.begin(), insert_itr);
+            right = insert_pos;
         }
         else {
-            left = std::distance(this->globalid_list.begin(), insert_itr);
+            left = insert_pos;
         }
     }
     long long diff = 0;
@@ -547,10 +670,9 @@ bool UdmGlobalRankidList::findGlobalRankid(
         if (mid >= size) {
             break;
         }
-        mid_rank = this->globalid_list[mid];
-        diff = mid_rank.compare(src_rank);
+        diff = this->getGlobalRankidAt(mid).compare(src_rank);
         if (diff == 0) {
-            insert_itr = this->globalid_list.begin() + mid;
+            insert_pos = mid;
             return true;
         }
         else if (diff < 0) {
@@ -562,83 +684,34 @@ bool UdmGlobalRankidList::findGlobalRankid(
     }
 
     if (diff < 0) {
-        insert_itr = this->globalid_list.begin() + mid + 1;
+        insert_pos = mid + 1;
     }
     else {
-        insert_itr = this->globalid_list.begin() + mid;
+        insert_pos = mid;
     }
 
     return false;
 };
 
-/**
- * グローバルIDの関連オブジェクトを取得する
- * @param [in] rankno        ランク番号
- * @param [in] localid        ローカルID
- * @param [out] entity        関連オブジェクト
- * @return        true=ランク番号、ローカルIDが存在する.
- */
-UdmEntity* UdmGlobalRankidList::getReferenceEntity(
-                const int rankno,
-                const UdmSize_t localid) const
-{
-    std::vector<UdmGlobalRankid>::const_iterator found_itr;
-    bool found = this->findGlobalRankid(UdmGlobalRankid(rankno, localid), found_itr);
-    if (!found) {
-        return NULL;
-    }
-    UdmEntity* entity = found_itr->getReferenceEntity();
-
-    return entity;
-}
-
-/**
- * グローバルID, 関連オブジェクトを削除する.
- * @param rankno        ランク番号
- * @param localid        ローカルID
- * @param entity        関連オブジェクト
- */
-void UdmGlobalRankidList::removeReferenceEntity(int rankno, UdmSize_t localid, UdmEntity* entity)
-{
-    std::vector<UdmGlobalRankid>::const_iterator found_itr;
-    bool found = this->findGlobalRankid(UdmGlobalRankid(rankno, localid), found_itr);
-    if (!found) {
-        return;
-    }
-
-    std::vector<UdmGlobalRankid>::const_iterator dest_itr;
-    for (dest_itr=found_itr; dest_itr!=this->globalid_list.end(); dest_itr++) {
-        if (!dest_itr->equals(rankno, localid)) {
-            break;
-        }
-        UdmEntity* del_entity = dest_itr->getReferenceEntity();
-        if (del_entity != entity) {
-            break;
-        }
-    }
-
-    std::vector<UdmGlobalRankid>::iterator erase_itr;
-    for (dest_itr=dest_itr-1; dest_itr!=this->globalid_list.begin(); dest_itr--) {
-        UdmEntity* del_entity = dest_itr->getReferenceEntity();
-        if (dest_itr->equals(rankno, localid) && del_entity == entity) {
-            erase_itr = this->globalid_list.begin() + (dest_itr - this->globalid_list.begin());
-            this->globalid_list.erase(erase_itr);
-        }
-        else {
-            break;
-        }
-    }
-
-    return;
-}
-
 /**
  * グローバルIDリストの容量を確保する.
+ * UDM_GLOBALRANKID_INLINESIZE以下の場合は内部配列を使用する.
  * @param size        確保容量サイズ
  */
 void UdmGlobalRankidList::reserve(UdmSize_t size)
 {
-    this->globalid_list.reserve(size);
+    if (size <= this->capacity_globalids) return;
+
+    // ヒープ領域 : ローカルID配列, ランク番号配列の順
+    char *globalids = new char[size*(sizeof(UdmSize_t)+sizeof(int))];
+    memcpy(globalids, this->getLocalids(), this->num_globalids*sizeof(UdmSize_t));
+    memcpy(globalids + size*sizeof(UdmSize_t), this->getRanknos(), this->num_globalids*sizeof(int));
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        delete [] this->heap_globalids;
+    }
+    this->heap_globalids = globalids;
+    this->capacity_globalids = size;
+
     return;
 }
 
@@ -655,12 +728,8 @@ bool UdmGlobalRankidList::equals(const UdmGlobalRankidList& dest_list) const
     dest_len = dest_list.getNumGlobalRankids();
     if (src_len != dest_len) return false;
 
-    for (n=1; n<=src_len; n++) {
-        UdmGlobalRankid src_rankid;
-        UdmGlobalRankid dest_rankid;
-        this->getGlobalRankid(n, src_rankid);
-        dest_list.getGlobalRankid(n, dest_rankid);
-        if (src_rankid != dest_rankid) {
+    for (n=0; n<src_len; n++) {
+        if (this->getGlobalRankidAt(n) != dest_list.getGlobalRankidAt(n)) {
             return false;
         }
     }
@@ -676,12 +745,14 @@ bool UdmGlobalRankidList::equals(const UdmGlobalRankidList& dest_list) const
 size_t UdmGlobalRankidList::getMemSize() const
 {
     UdmSize_t size = sizeof(*this);
+    if (this->capacity_globalids > UDM_GLOBALRANKID_INLINESIZE) {
+        size += this->capacity_globalids*(sizeof(UdmSize_t)+sizeof(int));
+    }
 #ifdef _DEBUG
-    printf("globalid_list size=%ld [count=%d] [capacity=%d] [offset=%ld] \n",
-                        sizeof(this->globalid_list),
-                        this->globalid_list.size(),
-                        this->globalid_list.capacity(),
-                        offsetof(UdmGlobalRankidList, globalid_list));
+    printf("globalid_list [count=%d] [capacity=%d] [offset=%ld] \n",
+                        this->num_globalids,
+                        this->capacity_globalids,
+                        offsetof(UdmGlobalRankidList, num_globalids));
     printf("UdmGlobalRankid size=%ld \n", sizeof(UdmGlobalRankid));
 #endif
     return size;
@@ -58,9 +58,14 @@ UdmGridCoordinates::~UdmGridCoordinates()
 void UdmGridCoordinates::initialize()
 {
     this->setDataType(Udm_RealSingle);
+    this->num_coords_slots = 0;
+    this->coords_sequential = true;
     this->clearNodes();
     this->parent_zone = NULL;
     this->max_nodeid = 0;
+    this->staged_coords = NULL;
+    this->staged_coords_size = 0;
+    this->staged_coords_datatype = Udm_RealSingle;
 }
 
 /**
@@ -113,6 +118,8 @@ void UdmGridCoordinates::finalize()
         }
     }
     this->virtual_nodes.clear();
+    this->clearCoordsSlots();
+    this->clearStagedGridCoordinates();
 
     return;
 }
@@ -184,6 +191,9 @@ UdmSize_t UdmGridCoordinates::insertNode(UdmNode* node)
     node->setId(node_id);
     this->max_nodeid = node_id;
     node->setParentGridcoordinates(this);
+    if (node->coords_slot != this->node_list.size()-1) {
+        this->coords_sequential = false;
+    }
     // MPIランク番号
     node->setMyRankno(this->getMpiRankno());
 
@@ -214,6 +224,9 @@ void UdmGridCoordinates::pushbackNode(UdmNode* node)
     UdmSize_t node_id = node->getId();
     this->max_nodeid = node_id;
     node->setParentGridcoordinates(this);
+    if (node->coords_slot != this->node_list.size()-1) {
+        this->coords_sequential = false;
+    }
 
     // ランク番号,IDを退避する.
     node->addPreviousRankInfo(node->getMyRankno(), node->getId());
@@ -228,6 +241,113 @@ void UdmGridCoordinates::pushbackNode(UdmNode* node)
     return;
 }
 
+/**
+ * XYZ座標値スロットを確保する.
+ * グリッド座標データ型, 確保節点（ノード）のXYZ座標値データ型のどちらかがUdm_RealDoubleであれば、
+ * XYZ座標値配列をUdm_RealDoubleとする.
+ * @param datatype        確保節点（ノード）のXYZ座標値データ型
+ * @return        XYZ座標値スロット（０～）
+ */
+UdmSize_t UdmGridCoordinates::allocateCoordsSlot(UdmDataType_t datatype)
+{
+    if (this->coords_array.getDataType() != Udm_RealDouble) {
+        if (datatype == Udm_RealDouble || this->getDataType() == Udm_RealDouble) {
+            this->coords_array.changeDataType(Udm_RealDouble);
+        }
+    }
+
+    UdmSize_t slot;
+    if (!this->free_coords_slots.empty()) {
+        // 未使用スロットを再利用する.
+        slot = this->free_coords_slots.back();
+        this->free_coords_slots.pop_back();
+        return slot;
+    }
+
+    slot = this->num_coords_slots++;
+    if (slot >= this->coords_array.getCapacity()) {
+        UdmSize_t capacity = this->coords_array.getCapacity()*2;
+        UdmSize_t num_nodes = this->node_list.size() + this->virtual_nodes.size();
+        if (capacity < num_nodes) capacity = num_nodes;
+        if (capacity < slot+1) capacity = slot+1;
+        this->coords_array.reserveSlots(capacity);
+    }
+
+    return slot;
+}
+
+/**
+ * XYZ座標値スロットを解放する.
+ * すべてのスロットが解放された場合は、XYZ座標値配列を破棄する.
+ * @param slot        XYZ座標値スロット（０～）
+ */
+void UdmGridCoordinates::releaseCoordsSlot(UdmSize_t slot)
+{
+    this->free_coords_slots.push_back(slot);
+    this->coords_sequential = false;
+    if (this->free_coords_slots.size() >= this->num_coords_slots) {
+        this->clearCoordsSlots();
+    }
+    return;
+}
+
+/**
+ * XYZ座標値配列を破棄する.
+ * XYZ座標値配列のデータ型はグリッド座標データ型に戻す.
+ */
+void UdmGridCoordinates::clearCoordsSlots()
+{
+    this->coords_array.clearCoordsArray();
+    if (this->getDataType() == Udm_RealDouble) {
+        this->coords_array.changeDataType(Udm_RealDouble);
+    }
+    else {
+        this->coords_array.changeDataType(Udm_RealSingle);
+    }
+    this->free_coords_slots.clear();
+    this->num_coords_slots = 0;
+    this->coords_sequential = true;
+    return;
+}
+
+/**
+ * XYZ座標値スロットを構成節点（ノード）, 仮想節点（ノード）の順に並び替える.
+ * 構成節点（ノード）(node_list[n])のスロットはnとなる.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmGridCoordinates::arrangeCoordsSlots()
+{
+    if (this->coords_sequential) return UDM_OK;
+
+    std::vector<UdmSize_t> src_slots;
+    src_slots.reserve(this->node_list.size() + this->virtual_nodes.size());
+    std::vector<UdmNode*>::const_iterator itr;
+    for (itr=this->node_list.begin(); itr!=this->node_list.end(); itr++) {
+        if ((*itr)->getParentGridcoordinates() != this) return UDM_ERROR;
+        src_slots.push_back((*itr)->coords_slot);
+    }
+    for (itr=this->virtual_nodes.begin(); itr!=this->virtual_nodes.end(); itr++) {
+        if ((*itr)->getParentGridcoordinates() != this) return UDM_ERROR;
+        src_slots.push_back((*itr)->coords_slot);
+    }
+    if (this->coords_array.rearrangeSlots(src_slots) != UDM_OK) {
+        return UDM_ERROR;
+    }
+
+    UdmSize_t slot = 0;
+    for (itr=this->node_list.begin(); itr!=this->node_list.end(); itr++) {
+        (*itr)->coords_slot = slot++;
+    }
+    for (itr=this->virtual_nodes.begin(); itr!=this->virtual_nodes.end(); itr++) {
+        (*itr)->coords_slot = slot++;
+    }
+    this->num_coords_slots = slot;
+    this->free_coords_slots.clear();
+    this->coords_sequential = true;
+
+    return UDM_OK;
+}
+
 
 /**
  * 仮想ノードリスト数を取得する.
@@ -329,6 +449,7 @@ UdmError_t UdmGridCoordinates::clearNodes()
         }
     }
     this->virtual_nodes.clear();
+    this->clearCoordsSlots();
 
     return UDM_OK;
 }
@@ -827,8 +948,43 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
     cgns_datatype = this->toCgnsDataType(datatype);
     coords_size = this->getNumNodes();
 
-    if (datatype == Udm_RealSingle) {
-        float *coords = new float[coords_size];
+    if (coords_size > 0
+        && this->staged_coords != NULL
+        && this->staged_coords_size == (UdmSize_t)coords_size
+        && this->staged_coords_datatype == datatype) {
+        // 非同期出力の退避バッファを出力する.
+        int sizeofdata = this->sizeofDataType(datatype);
+        const char *coords = (const char*)this->staged_coords;
+        if (cg_array_write("CoordinateX", cgns_datatype, 1, &coords_size, coords) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateX)");
+        }
+        if (cg_array_write("CoordinateY", cgns_datatype, 1, &coords_size, coords + coords_size*sizeofdata) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateY)");
+        }
+        if (cg_array_write("CoordinateZ", cgns_datatype, 1, &coords_size, coords + 2*coords_size*sizeofdata) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateZ)");
+        }
+    }
+    else if (coords_size > 0
+        && this->arrangeCoordsSlots() == UDM_OK
+        && this->coords_array.getDataType() == datatype) {
+        // XYZ座標値配列を直接出力する.
+        if (cg_array_write("CoordinateX", cgns_datatype, 1, &coords_size, this->coords_array.getCoordinatesXPointer()) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateX)");
+        }
+        if (cg_array_write("CoordinateY", cgns_datatype, 1, &coords_size, this->coords_array.getCoordinatesYPointer()) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateY)");
+        }
+        if (cg_array_write("CoordinateZ", cgns_datatype, 1, &coords_size, this->coords_array.getCoordinatesZPointer()) != CG_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateZ)");
+        }
+    }
+    else if (datatype == Udm_RealSingle) {
+        // モデルのCGNS出力作業バッファを使用する.
+        float *coords = (float*)this->getParentZone()->getScratchBuffer(coords_size*sizeof(float));
+        if (coords == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmModel is null.");
+        }
 
         // CoordinateX出力
         this->getGridCoordinatesX(1, coords_size, (float*)coords);
@@ -836,7 +992,6 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateX)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -846,7 +1001,6 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateY)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -856,14 +1010,16 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateZ)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
-        delete  []coords;
     }
     else if (datatype == Udm_RealDouble) {
-        double *coords = new double[coords_size];
+        // モデルのCGNS出力作業バッファを使用する.
+        double *coords = (double*)this->getParentZone()->getScratchBuffer(coords_size*sizeof(double));
+        if (coords == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmModel is null.");
+        }
 
         // CoordinateX出力
         this->getGridCoordinatesX(1, coords_size, (double*)coords);
@@ -871,7 +1027,6 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateX)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -881,7 +1036,6 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateY)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -891,11 +1045,9 @@ UdmError_t UdmGridCoordinates::writeCgns(int index_file, int index_base, int ind
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateZ)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
-        delete  []coords;
     }
     else {
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "invalid coordinates datatype");
@@ -1045,10 +1197,17 @@ UdmSize_t UdmGridCoordinates::setGridCoordinatesArray(
     // 節点（ノード）をクリアする.
     this->clearNodes();
 
+    // XYZ座標値配列のデータ型 : グリッド座標データ型, 設定座標データ型のどちらかがUdm_RealDoubleであればUdm_RealDouble
+    UdmDataType_t datatype = this->getDataType();
+    if (this->getDataType<DATA_TYPE>() == Udm_RealDouble) datatype = Udm_RealDouble;
+    this->coords_array.changeDataType(datatype);
+    this->coords_array.reserveSlots(num_nodes);
+
     // ノードデータの作成
+    UdmEntityPool *pool = this->getEntityPool();
     for (n=0; n<num_nodes; n++) {
         UdmNode *node = NULL;
-        node = new UdmNode(coords_x[n], coords_y[n], coords_z[n]);
+        node = new (pool) UdmNode();
         // ノードID、ランク番号を設定する
         node->addPreviousRankInfo(this->getCgnsRankno(), n+1);
         node->setId(n+1);
@@ -1057,6 +1216,16 @@ UdmSize_t UdmGridCoordinates::setGridCoordinatesArray(
         // 節点（ノード）の挿入
         this->pushbackNode(node);
     }
+
+    // XYZ座標値の一括設定
+    if (this->coords_sequential) {
+        this->coords_array.setCoordinatesArray(0, num_nodes, coords_x, coords_y, coords_z);
+    }
+    else {
+        for (n=0; n<num_nodes; n++) {
+            this->node_list[n]->setCoords(coords_x[n], coords_y[n], coords_z[n]);
+        }
+    }
     return num_nodes;
 }
 template UdmSize_t UdmGridCoordinates::setGridCoordinatesArray(UdmSize_t num_nodes, float* coords_x, float* coords_y, float* coords_z);
@@ -1133,7 +1302,7 @@ UdmSize_t UdmGridCoordinates::insertGridCoordinates(
 {
     UdmSize_t n;
     // ノードデータの作成
-    UdmNode *node = new UdmNode(x, y, z);
+    UdmNode *node = new (this->getEntityPool()) UdmNode(x, y, z);
     return this->insertNode(node);;
 }
 template UdmSize_t UdmGridCoordinates::insertGridCoordinates(float x, float y, float z);
@@ -1162,6 +1331,12 @@ UdmSize_t UdmGridCoordinates::getGridCoordinatesArray(
     if (start_id > end_id) return 0;
     if (this->node_list.size() <= 0) return 0;
     if (end_id > this->node_list.size()) return 0;
+
+    // XYZ座標値配列から一括取得する.
+    if (this->arrangeCoordsSlots() == UDM_OK) {
+        return this->coords_array.getCoordinatesArray(start_id-1, end_id-start_id+1, coords_x, coords_y, coords_z);
+    }
+
     UdmSize_t n;
     UdmSize_t id = 0;
     for (n=start_id-1; n<=end_id-1; n++) {
@@ -1191,6 +1366,12 @@ UdmSize_t UdmGridCoordinates::getGridCoordinatesX(
     if (start_id > end_id) return 0;
     if (this->node_list.size() <= 0) return 0;
     if (end_id > this->node_list.size()) return 0;
+
+    // XYZ座標値配列から一括取得する.
+    if (this->arrangeCoordsSlots() == UDM_OK) {
+        return this->coords_array.getCoordinatesX(start_id-1, end_id-start_id+1, coords);
+    }
+
     UdmSize_t n;
     UdmSize_t id = 0;
     DATA_TYPE coords_x, coords_y, coords_z;
@@ -1221,6 +1402,12 @@ UdmSize_t UdmGridCoordinates::getGridCoordinatesY(
     if (start_id > end_id) return 0;
     if (this->node_list.size() <= 0) return 0;
     if (end_id > this->node_list.size()) return 0;
+
+    // XYZ座標値配列から一括取得する.
+    if (this->arrangeCoordsSlots() == UDM_OK) {
+        return this->coords_array.getCoordinatesY(start_id-1, end_id-start_id+1, coords);
+    }
+
     UdmSize_t n;
     UdmSize_t id = 0;
     DATA_TYPE coords_x, coords_y, coords_z;
@@ -1250,6 +1437,12 @@ UdmSize_t UdmGridCoordinates::getGridCoordinatesZ(
     if (start_id > end_id) return 0;
     if (this->node_list.size() <= 0) return 0;
     if (end_id > this->node_list.size()) return 0;
+
+    // XYZ座標値配列から一括取得する.
+    if (this->arrangeCoordsSlots() == UDM_OK) {
+        return this->coords_array.getCoordinatesZ(start_id-1, end_id-start_id+1, coords);
+    }
+
     UdmSize_t n;
     UdmSize_t id = 0;
     DATA_TYPE coords_x, coords_y, coords_z;
@@ -1399,6 +1592,15 @@ const UdmSolutionFieldConfig* UdmGridCoordinates::getSolutionFieldConfig(const s
     return solutions->getSolutionField(solution_name);
 }
 
+/**
+ * 物理量データの定義位置を取得する.
+ * @return        物理量定義位置 : Udm_Vertex
+ */
+UdmGridLocation_t UdmGridCoordinates::getSolutionGridLocation() const
+{
+    return Udm_Vertex;
+}
+
 /**
  * 出力CGNS:GrdiCoordinates名を取得する.
  * @return        出力CGNS:GrdiCoordinates名
@@ -1679,6 +1881,9 @@ UdmError_t UdmGridCoordinates::rebuildNodes()
     // 設定済み最大節点（ノード）ID
     this->max_nodeid = node_id;
 
+    // XYZ座標値スロットを構成節点（ノード）順に並び替える.
+    this->arrangeCoordsSlots();
+
     return UDM_OK;
 }
 
@@ -1820,6 +2025,55 @@ UdmError_t UdmGridCoordinates::cloneGridCoordinates(const UdmGridCoordinates& sr
     return UDM_OK;
 }
 
+/**
+ * 非同期出力のため、XYZ座標値を退避バッファにコピーする.
+ * 退避後のCGNS:GridCoordinates出力は退避バッファから行うため、出力中に座標値を更新することができる.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmGridCoordinates::stageCgnsGridCoordinates()
+{
+    UdmSize_t num_nodes = this->getNumNodes();
+    UdmDataType_t datatype = this->getDataType();
+
+    this->clearStagedGridCoordinates();
+    if (num_nodes <= 0) return UDM_OK;
+
+    if (datatype == Udm_RealSingle) {
+        float *coords = new float[num_nodes*3];
+        this->getGridCoordinatesArray(1, num_nodes, coords, coords+num_nodes, coords+2*num_nodes);
+        this->staged_coords = coords;
+    }
+    else if (datatype == Udm_RealDouble) {
+        double *coords = new double[num_nodes*3];
+        this->getGridCoordinatesArray(1, num_nodes, coords, coords+num_nodes, coords+2*num_nodes);
+        this->staged_coords = coords;
+    }
+    else {
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "invalid coordinates datatype");
+    }
+    this->staged_coords_size = num_nodes;
+    this->staged_coords_datatype = datatype;
+
+    return UDM_OK;
+}
+
+/**
+ * 非同期出力のXYZ座標値退避バッファを削除する.
+ */
+void UdmGridCoordinates::clearStagedGridCoordinates()
+{
+    if (this->staged_coords != NULL) {
+        if (this->staged_coords_datatype == Udm_RealDouble) {
+            delete [](double*)this->staged_coords;
+        }
+        else {
+            delete [](float*)this->staged_coords;
+        }
+    }
+    this->staged_coords = NULL;
+    this->staged_coords_size = 0;
+}
+
 /**
  * 同一グリッド座標情報であるかチェックする.
  * グリッド座標情報の基本情報が同じであるかチェックする.
@@ -2023,6 +2277,103 @@ template UdmError_t UdmGridCoordinates::setSolutionVector<long long>(UdmSize_t n
 template UdmError_t UdmGridCoordinates::setSolutionVector<float>(UdmSize_t node_id, const std::string& solution_name, const float* values, unsigned int size);
 template UdmError_t UdmGridCoordinates::setSolutionVector<double>(UdmSize_t node_id, const std::string& solution_name, const double* values, unsigned int size);
 
+/**
+ * 節点（ノード）の物理量データ値を取得する:スカラデータ, 物理量フィールドID.
+ * 物理量フィールドIDはUdmFlowSolutions::getFieldIdにて取得すること.
+ * @param [in]  node_id        節点（ノード）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  value                物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmGridCoordinates::getSolutionScalar(
+                    UdmSize_t node_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE& value) const
+{
+    UdmEntity *entity = this->getNodeById(node_id);
+    if (entity == NULL) return UDM_ERROR;
+    return this->getEntitySolutionScalar<VALUE_TYPE>(entity, field_id, value);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を取得する:ベクトルデータ, 物理量フィールドID.
+ * @param [in]  node_id        節点（ノード）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  values                物理量データ値リスト
+ * @return      ベクトルデータ数
+ */
+template<class VALUE_TYPE>
+unsigned int UdmGridCoordinates::getSolutionVector(
+                    UdmSize_t node_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE* values) const
+{
+    UdmEntity *entity = this->getNodeById(node_id);
+    if (entity == NULL) return 0;
+    return this->getEntitySolutionVector<VALUE_TYPE>(entity, field_id, values);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を設定する:スカラデータ, 物理量フィールドID.
+ * @param node_id                節点（ノード）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param value                    物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmGridCoordinates::setSolutionScalar(
+                        UdmSize_t node_id,
+                        UdmSize_t field_id,
+                        VALUE_TYPE value)
+{
+    UdmEntity *entity = this->getNodeById(node_id);
+    if (entity == NULL) return UDM_ERROR;
+
+    return this->setEntitySolutionScalar<VALUE_TYPE>(entity, field_id, value);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を設定する:ベクトルデータ, 物理量フィールドID.
+ * @param node_id                節点（ノード）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param values                    物理量データリスト
+ * @param size                    物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmGridCoordinates::setSolutionVector(
+                        UdmSize_t node_id,
+                        UdmSize_t field_id,
+                        const VALUE_TYPE* values,
+                        unsigned int size)
+{
+    UdmEntity *entity = this->getNodeById(node_id);
+    if (entity == NULL) return UDM_ERROR;
+
+    return this->setEntitySolutionVector<VALUE_TYPE>(entity, field_id, values, size);
+}
+
+template UdmError_t UdmGridCoordinates::getSolutionScalar<int>(UdmSize_t node_id, UdmSize_t field_id, int& value) const;
+template UdmError_t UdmGridCoordinates::getSolutionScalar<long long>(UdmSize_t node_id, UdmSize_t field_id, long long& value) const;
+template UdmError_t UdmGridCoordinates::getSolutionScalar<float>(UdmSize_t node_id, UdmSize_t field_id, float& value) const;
+template UdmError_t UdmGridCoordinates::getSolutionScalar<double>(UdmSize_t node_id, UdmSize_t field_id, double& value) const;
+
+template unsigned int UdmGridCoordinates::getSolutionVector<int>(UdmSize_t node_id, UdmSize_t field_id, int* values) const;
+template unsigned int UdmGridCoordinates::getSolutionVector<long long>(UdmSize_t node_id, UdmSize_t field_id, long long* values) const;
+template unsigned int UdmGridCoordinates::getSolutionVector<float>(UdmSize_t node_id, UdmSize_t field_id, float* values) const;
+template unsigned int UdmGridCoordinates::getSolutionVector<double>(UdmSize_t node_id, UdmSize_t field_id, double* values) const;
+
+template UdmError_t UdmGridCoordinates::setSolutionScalar<int>(UdmSize_t node_id, UdmSize_t field_id, int value);
+template UdmError_t UdmGridCoordinates::setSolutionScalar<long long>(UdmSize_t node_id, UdmSize_t field_id, long long value);
+template UdmError_t UdmGridCoordinates::setSolutionScalar<float>(UdmSize_t node_id, UdmSize_t field_id, float value);
+template UdmError_t UdmGridCoordinates::setSolutionScalar<double>(UdmSize_t node_id, UdmSize_t field_id, double value);
+
+template UdmError_t UdmGridCoordinates::setSolutionVector<int>(UdmSize_t node_id, UdmSize_t field_id, const int* values, unsigned int size);
+template UdmError_t UdmGridCoordinates::setSolutionVector<long long>(UdmSize_t node_id, UdmSize_t field_id, const long long* values, unsigned int size);
+template UdmError_t UdmGridCoordinates::setSolutionVector<float>(UdmSize_t node_id, UdmSize_t field_id, const float* values, unsigned int size);
+template UdmError_t UdmGridCoordinates::setSolutionVector<double>(UdmSize_t node_id, UdmSize_t field_id, const double* values, unsigned int size);
+
 /**
  * CGNS:GridCoordinatesを出力する.
  * @param index_file        CGNSファイルインデックス
@@ -2070,7 +2421,11 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
     virtual_size = this->getNumVirtualNodes();
     coords_size = actual_size + virtual_size;
     if (datatype == Udm_RealSingle) {
-        float *coords = new float[coords_size];
+        // モデルのCGNS出力作業バッファを使用する.
+        float *coords = (float*)this->getParentZone()->getScratchBuffer(coords_size*sizeof(float));
+        if (coords == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmModel is null.");
+        }
 
         // CoordinateX出力
         this->getGridCoordinatesX(1, actual_size, (float*)coords);
@@ -2079,7 +2434,6 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateX)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -2090,7 +2444,6 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateY)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -2101,13 +2454,15 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateZ)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
-        delete  []coords;
     }
     else if (datatype == Udm_RealDouble) {
-        double *coords = new double[coords_size];
+        // モデルのCGNS出力作業バッファを使用する.
+        double *coords = (double*)this->getParentZone()->getScratchBuffer(coords_size*sizeof(double));
+        if (coords == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmModel is null.");
+        }
 
         // CoordinateX出力
         this->getGridCoordinatesX(1, actual_size, (double*)coords);
@@ -2116,7 +2471,6 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateX)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -2127,7 +2481,6 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateY)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
@@ -2138,11 +2491,9 @@ UdmError_t UdmGridCoordinates::writeVirtualNodes(int index_file, int index_base,
             udm_error = UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : cg_array_write(CoordinateZ)");
         }
         if (udm_error != UDM_OK) {
-            delete  []coords;
             return udm_error;
         }
 
-        delete  []coords;
     }
     else {
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "invalid coordinates datatype");
@@ -2414,9 +2765,15 @@ size_t UdmGridCoordinates::getMemSize() const
     printf("parent_zone pointer size=%ld [offset=%ld]\n", sizeof(this->parent_zone), offsetof(UdmGridCoordinates, parent_zone));
     printf("cgns_writegridcoordnates size=%ld [offset=%ld]\n", sizeof(this->cgns_writegridcoordnates), offsetof(UdmGridCoordinates, cgns_writegridcoordnates));
     printf("max_nodeid size=%ld [offset=%ld]\n", sizeof(this->max_nodeid), offsetof(UdmGridCoordinates, max_nodeid));
+    printf("coords_array size=%ld [capacity=%ld] [offset=%ld]\n",
+                            this->coords_array.getMemSize(),
+                            this->coords_array.getCapacity(),
+                            offsetof(UdmGridCoordinates, coords_array));
 
     size += this->node_list.size()*sizeof(UdmNode*);
     size += this->virtual_nodes.size()*sizeof(UdmNode*);
+    size += this->coords_array.getMemSize() - sizeof(this->coords_array);
+    size += this->free_coords_slots.size()*sizeof(UdmSize_t);
 #endif
 
     return size;
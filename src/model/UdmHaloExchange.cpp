@@ -0,0 +1,706 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmHaloExchange.cpp
+ * 仮想要素（セル）物理量交換クラスのソースファイル
+ */
+
+#include "model/UdmHaloExchange.h"
+#include "model/UdmZone.h"
+#include "model/UdmGridCoordinates.h"
+#include "model/UdmSections.h"
+#include "model/UdmFlowSolutions.h"
+#include "model/UdmEntityVoxels.h"
+#include "model/UdmRankConnectivity.h"
+#include "model/UdmCell.h"
+#include "model/UdmNode.h"
+
+namespace udm
+{
+
+/**
+ * 送受信バッファのデータ境界(byte) : 物理量毎の先頭位置を揃える.
+ */
+#define UDM_HALOEXCHANGE_ALIGNMENT        8
+
+/**
+ * コンストラクタ
+ */
+UdmHaloExchange::UdmHaloExchange()
+{
+    this->initialize();
+}
+
+/**
+ * コンストラクタ
+ * @param zone        親ゾーン
+ */
+UdmHaloExchange::UdmHaloExchange(UdmZone *zone)
+{
+    this->initialize();
+    this->parent_zone = zone;
+}
+
+/**
+ * デストラクタ
+ */
+UdmHaloExchange::~UdmHaloExchange()
+{
+    this->clearExchangePlan();
+    if (this->send_buffer != NULL) delete []this->send_buffer;
+    if (this->recv_buffer != NULL) delete []this->recv_buffer;
+    this->send_buffer = NULL;
+    this->recv_buffer = NULL;
+
+    // 交換計画用の複製MPIコミュニケータの解放 : MPI終了後は解放しない.
+    if (this->exchange_communicator != MPI_COMM_NULL) {
+        int finalized = 0;
+        udm_mpi_finalized(&finalized);
+        if (!finalized) udm_mpi_comm_free(&this->exchange_communicator);
+        this->exchange_communicator = MPI_COMM_NULL;
+    }
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmHaloExchange::initialize()
+{
+    this->parent_zone = NULL;
+    this->created_plan = false;
+    this->send_buffer = NULL;
+    this->send_capacity = 0;
+    this->recv_buffer = NULL;
+    this->recv_capacity = 0;
+    this->exchanging = false;
+    this->exchange_communicator = MPI_COMM_NULL;
+}
+
+/**
+ * 親ゾーンを取得する.
+ * @return        親ゾーン
+ */
+UdmZone* UdmHaloExchange::getParentZone() const
+{
+    return this->parent_zone;
+}
+
+/**
+ * 親ゾーンを設定する.
+ * @param zone        親ゾーン
+ */
+void UdmHaloExchange::setParentZone(UdmZone* zone)
+{
+    this->parent_zone = zone;
+}
+
+/**
+ * 交換計画が作成済みであるかチェックする.
+ * @return        true=交換計画作成済み
+ */
+bool UdmHaloExchange::isCreatedPlan() const
+{
+    return this->created_plan;
+}
+
+/**
+ * 送信先ランク数を取得する.
+ * @return        送信先ランク数
+ */
+int UdmHaloExchange::getNumSendRanks() const
+{
+    return this->send_ranks.size();
+}
+
+/**
+ * 受信元ランク数を取得する.
+ * @return        受信元ランク数
+ */
+int UdmHaloExchange::getNumRecvRanks() const
+{
+    return this->recv_ranks.size();
+}
+
+/**
+ * 送受信中であるかチェックする.
+ * @return        true=startExchange実行済み、finishExchange未実行
+ */
+bool UdmHaloExchange::isExchanging() const
+{
+    return this->exchanging;
+}
+
+/**
+ * 交換計画を作成する.
+ * 仮想要素（セル）, 仮想節点（ノード）を実体ランク番号別に分類して、実体ランクに実体IDを送信する.
+ * 実体ランクは受信した実体IDから送信要素（セル）, 送信節点（ノード）を取得する.
+ * 実体IDが存在しない場合は警告とし、該当する仮想要素（セル）, 仮想節点（ノード）には0を送信する.
+ * 全ランクで実行すること.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmHaloExchange::createExchangePlan()
+{
+#ifdef _UDM_PROFILER
+    UDM_STOPWATCH_START(__FUNCTION__);
+#endif
+
+    UdmError_t error = UDM_OK;
+    this->clearExchangePlan();
+
+    UdmZone *zone = this->getParentZone();
+    if (zone == NULL) return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "parent_zone is null.");
+    UdmSections *sections = zone->getSections();
+    UdmGridCoordinates *grid = zone->getGridCoordinates();
+    UdmRankConnectivity *inner = zone->getRankConnectivity();
+    if (sections == NULL || grid == NULL || inner == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmSections or UdmGridCoordinates or UdmRankConnectivity is null.");
+    }
+
+    // 交換計画用にMPIコミュニケータを複製する.
+    if (this->exchange_communicator == MPI_COMM_NULL) {
+        if (udm_mpi_comm_dup(this->getMpiComm(), &this->exchange_communicator) != MPI_SUCCESS) {
+            this->exchange_communicator = MPI_COMM_NULL;
+            return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_MPI, "failure : MPI_Comm_dup");
+        }
+    }
+    MPI_Comm comm = this->exchange_communicator;
+    int my_rankno = this->getMpiRankno();
+    int num_process = this->getMpiProcessSize();
+    UdmSize_t n;
+    int i;
+
+    // 実体ランク番号別の仮想要素（セル）, 仮想節点（ノード）
+    std::map<int, std::vector<UdmEntity*> > virtual_cells;
+    std::map<int, std::vector<UdmEntity*> > virtual_nodes;
+    std::map<int, std::vector<UdmEntity*> >::const_iterator entity_itr;
+    UdmSize_t num_cells = sections->getNumVirtualCells();
+    for (n=1; n<=num_cells; n++) {
+        UdmCell *cell = sections->getVirtualCell(n);
+        if (cell == NULL) continue;
+        int rankno = cell->getMyRankno();
+        if (rankno == my_rankno || rankno < 0 || rankno >= num_process) continue;
+        virtual_cells[rankno].push_back(cell);
+    }
+    const std::vector<UdmNode*> &nodes = grid->getVirtualNodes();
+    std::vector<UdmNode*>::const_iterator node_itr;
+    for (node_itr=nodes.begin(); node_itr!=nodes.end(); node_itr++) {
+        UdmNode *node = (*node_itr);
+        if (node->getRealityType() != Udm_Virtual) continue;
+        int rankno = node->getMyRankno();
+        if (rankno == my_rankno || rankno < 0 || rankno >= num_process) continue;
+        virtual_nodes[rankno].push_back(node);
+    }
+
+    // 受信元ランク別の仮想要素（セル）数, 仮想節点（ノード）数 = 実体ランクへの要求数
+    std::map<int, std::vector<int> > request_counts;
+    std::map<int, std::vector<int> > requested_counts;
+    std::map<int, std::vector<int> >::const_iterator count_itr;
+    for (entity_itr=virtual_cells.begin(); entity_itr!=virtual_cells.end(); entity_itr++) {
+        request_counts[entity_itr->first].resize(2, 0);
+        request_counts[entity_itr->first][0] = entity_itr->second.size();
+    }
+    for (entity_itr=virtual_nodes.begin(); entity_itr!=virtual_nodes.end(); entity_itr++) {
+        request_counts[entity_itr->first].resize(2, 0);
+        request_counts[entity_itr->first][1] = entity_itr->second.size();
+    }
+    for (count_itr=request_counts.begin(); count_itr!=request_counts.end(); count_itr++) {
+        int rankno = count_itr->first;
+        this->recv_ranks.push_back(rankno);
+        this->recv_cells.push_back(virtual_cells[rankno]);
+        this->recv_nodes.push_back(virtual_nodes[rankno]);
+    }
+
+    // 要求数を実体ランクに送受信する.
+    error = inner->mpi_exchangeSendCounts(request_counts, 2, requested_counts);
+    if (error != UDM_OK) {
+        this->clearExchangePlan();
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    // 要求実体IDの送受信 : {要素（セル）ID..., 節点（ノード）ID...}
+    size_t request_size = 0, requested_size = 0;
+    for (i=0; i<(int)this->recv_ranks.size(); i++) {
+        request_size += this->recv_cells[i].size() + this->recv_nodes[i].size();
+    }
+    for (count_itr=requested_counts.begin(); count_itr!=requested_counts.end(); count_itr++) {
+        requested_size += count_itr->second[0] + count_itr->second[1];
+    }
+    std::vector<UdmSize_t> request_ids(request_size+1, 0);
+    std::vector<UdmSize_t> requested_ids(requested_size+1, 0);
+    size_t pos = 0;
+    for (i=0; i<(int)this->recv_ranks.size(); i++) {
+        std::vector<UdmEntity*>::const_iterator itr;
+        for (itr=this->recv_cells[i].begin(); itr!=this->recv_cells[i].end(); itr++) {
+            request_ids[pos++] = (*itr)->getId();
+        }
+        for (itr=this->recv_nodes[i].begin(); itr!=this->recv_nodes[i].end(); itr++) {
+            request_ids[pos++] = (*itr)->getId();
+        }
+    }
+
+    MPI_Datatype mpi_size_type = udm_udmSize_to_mpiType();
+    int num_requests = this->recv_ranks.size() + requested_counts.size();
+    std::vector<MPI_Request> mpi_requests(num_requests+1, MPI_REQUEST_NULL);
+    std::vector<MPI_Status> mpi_status(num_requests+1);
+    int num_posts = 0;
+    pos = 0;
+    for (i=0; i<(int)this->recv_ranks.size(); i++) {
+        int count = this->recv_cells[i].size() + this->recv_nodes[i].size();
+        udm_mpi_isend(&request_ids[pos], count, mpi_size_type, this->recv_ranks[i], 0, comm, &mpi_requests[num_posts++]);
+        pos += count;
+    }
+    pos = 0;
+    for (count_itr=requested_counts.begin(); count_itr!=requested_counts.end(); count_itr++) {
+        int count = count_itr->second[0] + count_itr->second[1];
+        udm_mpi_irecv(&requested_ids[pos], count, mpi_size_type, count_itr->first, 0, comm, &mpi_requests[num_posts++]);
+        pos += count;
+    }
+    udm_mpi_waitall(num_posts, &mpi_requests[0], &mpi_status[0]);
+
+    // 送信先ランク別の送信要素（セル）, 送信節点（ノード）
+    pos = 0;
+    for (count_itr=requested_counts.begin(); count_itr!=requested_counts.end(); count_itr++) {
+        int rankno = count_itr->first;
+        int cell_count = count_itr->second[0];
+        int node_count = count_itr->second[1];
+        std::vector<UdmEntity*> cells(cell_count, (UdmEntity*)NULL);
+        std::vector<UdmEntity*> send_nodes(node_count, (UdmEntity*)NULL);
+        for (i=0; i<cell_count; i++) {
+            UdmSize_t cell_id = requested_ids[pos++];
+            cells[i] = sections->getEntityCell(cell_id);
+            if (cells[i] == NULL) {
+                UDM_WARNING_HANDLER(UDM_WARNING_INVALID_CELL, "not found cell[rankno=%d,cell_id=%ld].", rankno, cell_id);
+            }
+        }
+        for (i=0; i<node_count; i++) {
+            UdmSize_t node_id = requested_ids[pos++];
+            send_nodes[i] = grid->getNodeById(node_id);
+            if (send_nodes[i] == NULL) {
+                UDM_WARNING_HANDLER(UDM_WARNING_INVALID_NODE, "not found node[rankno=%d,node_id=%ld].", rankno, node_id);
+            }
+        }
+        this->send_ranks.push_back(rankno);
+        this->send_cells.push_back(cells);
+        this->send_nodes.push_back(send_nodes);
+    }
+
+    // ACK
+    if (udm_mpi_ack(&error, comm) != UDM_OK) {
+        this->clearExchangePlan();
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    this->created_plan = true;
+
+#ifdef _UDM_PROFILER
+    UDM_STOPWATCH_STOP(__FUNCTION__);
+    char info[128] = {0x00};
+    sprintf(info, "send_ranks=%d,recv_ranks=%d", (int)this->send_ranks.size(), (int)this->recv_ranks.size());
+    UDM_STOPWATCH_INFORMATION(__FUNCTION__, info);
+#endif
+
+    return UDM_OK;
+}
+
+/**
+ * 交換計画を破棄する.
+ * 送受信中の場合は送受信の完了を待ち、受信データは破棄する.
+ * 送受信バッファは再利用する為、解放しない.
+ */
+void UdmHaloExchange::clearExchangePlan()
+{
+    if (this->exchanging && this->requests.size() > 0) {
+        std::vector<MPI_Status> status(this->requests.size());
+        udm_mpi_waitall(this->requests.size(), &this->requests[0], &status[0]);
+    }
+    this->exchanging = false;
+    this->freeRequests();
+
+    this->created_plan = false;
+    this->send_ranks.clear();
+    this->send_cells.clear();
+    this->send_nodes.clear();
+    this->recv_ranks.clear();
+    this->recv_cells.clear();
+    this->recv_nodes.clear();
+    this->exchange_fields.clear();
+    this->exchange_field_ids.clear();
+    this->exchange_voxels.clear();
+    this->send_offsets.clear();
+    this->recv_offsets.clear();
+}
+
+/**
+ * 指定物理量の送受信を開始する.
+ * 送信データを確保済み送信バッファに作成して、永続通信リクエストを開始する.
+ * 物理量の構成（物理量数, 成分数, データ型）が前回と同じであれば送受信バッファ、通信リクエストを再利用する.
+ * 全ランクで同一の物理量名称リストにて実行すること.
+ * @param field_names        送受信物理量名称リスト
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmHaloExchange::startExchange(const std::vector<std::string> &field_names)
+{
+    UdmError_t error = UDM_OK;
+    if (!this->created_plan) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "not created exchange plan.");
+    }
+    if (this->exchanging) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "already started exchange.");
+    }
+
+    // 送受信バッファの作成
+    error = this->createExchangeBuffers(field_names);
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    // 永続通信リクエストの作成 : バッファ位置が変更された場合のみ再作成する.
+    if (this->request_send_offsets != this->send_offsets
+        || this->request_recv_offsets != this->recv_offsets) {
+        this->createRequests();
+    }
+
+    // 送信データの作成
+    this->packSolutions();
+
+    // 送受信開始
+    if (this->requests.size() > 0) {
+        udm_mpi_startall(this->requests.size(), &this->requests[0]);
+    }
+    this->exchanging = true;
+
+    return UDM_OK;
+}
+
+/**
+ * 送受信の完了を待って、受信物理量を仮想要素（セル）, 仮想節点（ノード）に設定する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmHaloExchange::finishExchange()
+{
+    if (!this->exchanging) return UDM_OK;
+
+    if (this->requests.size() > 0) {
+        std::vector<MPI_Status> status(this->requests.size());
+        udm_mpi_waitall(this->requests.size(), &this->requests[0], &status[0]);
+    }
+    this->exchanging = false;
+
+    // 受信データの設定
+    this->unpackSolutions();
+
+    return UDM_OK;
+}
+
+/**
+ * 送受信物理量情報と送受信バッファを作成する.
+ * 送受信バッファは確保済みサイズ以下であれば再確保しない.
+ * @param field_names        送受信物理量名称リスト
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmHaloExchange::createExchangeBuffers(const std::vector<std::string> &field_names)
+{
+    UdmFlowSolutions *solutions = this->getParentZone()->getFlowSolutions();
+    if (solutions == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmFlowSolutions is null.");
+    }
+
+    // 送受信物理量情報 : 物理量フィールドID, 節点（ノード）, 要素（セル）管理クラスは物理量毎に１度のみ取得する.
+    this->exchange_fields.clear();
+    this->exchange_field_ids.clear();
+    this->exchange_voxels.clear();
+    std::vector<std::string>::const_iterator name_itr;
+    for (name_itr=field_names.begin(); name_itr!=field_names.end(); name_itr++) {
+        const UdmSolutionFieldConfig *config = solutions->getSolutionField(*name_itr);
+        UdmSize_t field_id = solutions->getFieldId(*name_itr);
+        if (config == NULL || field_id == 0) {
+            this->exchange_fields.clear();
+            this->exchange_field_ids.clear();
+            this->exchange_voxels.clear();
+            return UDM_ERROR_HANDLER(UDM_ERROR_NOTFOUND_FLOWSOLUTION_NAME, "solution_name=%s", name_itr->c_str());
+        }
+        UdmEntityVoxels *voxels = NULL;
+        if (config->getGridLocation() == Udm_Vertex) {
+            voxels = this->getParentZone()->getGridCoordinates();
+        }
+        else if (config->getGridLocation() == Udm_CellCenter) {
+            voxels = this->getParentZone()->getSections();
+        }
+        if (voxels == NULL) {
+            this->exchange_fields.clear();
+            this->exchange_field_ids.clear();
+            this->exchange_voxels.clear();
+            return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_FLOWSOLUTION_GRIDLOCATION, "solution_name=%s", name_itr->c_str());
+        }
+        this->exchange_fields.push_back(config);
+        this->exchange_field_ids.push_back(field_id);
+        this->exchange_voxels.push_back(voxels);
+    }
+
+    // ランク別のバッファ位置
+    int i;
+    std::vector<const UdmSolutionFieldConfig*>::const_iterator field_itr;
+    this->send_offsets.assign(this->send_ranks.size()+1, 0);
+    for (i=0; i<(int)this->send_ranks.size(); i++) {
+        size_t size = 0;
+        for (field_itr=this->exchange_fields.begin(); field_itr!=this->exchange_fields.end(); field_itr++) {
+            size += this->getFieldBufferSize(this->send_cells[i], this->send_nodes[i], *field_itr);
+        }
+        this->send_offsets[i+1] = this->send_offsets[i] + size;
+    }
+    this->recv_offsets.assign(this->recv_ranks.size()+1, 0);
+    for (i=0; i<(int)this->recv_ranks.size(); i++) {
+        size_t size = 0;
+        for (field_itr=this->exchange_fields.begin(); field_itr!=this->exchange_fields.end(); field_itr++) {
+            size += this->getFieldBufferSize(this->recv_cells[i], this->recv_nodes[i], *field_itr);
+        }
+        this->recv_offsets[i+1] = this->recv_offsets[i] + size;
+    }
+
+    // 送受信バッファ : バッファを再確保した場合は通信リクエストを再作成する.
+    size_t send_size = this->send_offsets.back();
+    size_t recv_size = this->recv_offsets.back();
+    if (send_size > this->send_capacity) {
+        this->freeRequests();
+        if (this->send_buffer != NULL) delete []this->send_buffer;
+        this->send_buffer = new char[send_size];
+        this->send_capacity = send_size;
+    }
+    if (recv_size > this->recv_capacity) {
+        this->freeRequests();
+        if (this->recv_buffer != NULL) delete []this->recv_buffer;
+        this->recv_buffer = new char[recv_size];
+        this->recv_capacity = recv_size;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 物理量の送受信バッファサイズ(byte)を取得する.
+ * 物理量毎の先頭位置をUDM_HALOEXCHANGE_ALIGNMENTに揃える.
+ * @param cells        送受信要素（セル）
+ * @param nodes        送受信節点（ノード）
+ * @param config        物理量情報
+ * @return        送受信バッファサイズ(byte)
+ */
+size_t UdmHaloExchange::getFieldBufferSize(
+                const std::vector<UdmEntity*> &cells,
+                const std::vector<UdmEntity*> &nodes,
+                const UdmSolutionFieldConfig *config) const
+{
+    size_t num_entities = (config->getGridLocation() == Udm_Vertex) ? nodes.size() : cells.size();
+    size_t size = num_entities * config->getNvectorSize() * this->sizeofDataType(config->getDataType());
+    return (size + UDM_HALOEXCHANGE_ALIGNMENT - 1) / UDM_HALOEXCHANGE_ALIGNMENT * UDM_HALOEXCHANGE_ALIGNMENT;
+}
+
+/**
+ * 永続通信リクエストを作成する.
+ * 送受信データの無いランクの通信リクエストは作成しない.
+ */
+void UdmHaloExchange::createRequests()
+{
+    int i;
+    MPI_Comm comm = this->exchange_communicator;
+    this->freeRequests();
+
+    for (i=0; i<(int)this->send_ranks.size(); i++) {
+        int count = this->send_offsets[i+1] - this->send_offsets[i];
+        if (count <= 0) continue;
+        MPI_Request request = MPI_REQUEST_NULL;
+        udm_mpi_send_init(this->send_buffer + this->send_offsets[i], count, MPI_BYTE, this->send_ranks[i], 0, comm, &request);
+        this->requests.push_back(request);
+    }
+    for (i=0; i<(int)this->recv_ranks.size(); i++) {
+        int count = this->recv_offsets[i+1] - this->recv_offsets[i];
+        if (count <= 0) continue;
+        MPI_Request request = MPI_REQUEST_NULL;
+        udm_mpi_recv_init(this->recv_buffer + this->recv_offsets[i], count, MPI_BYTE, this->recv_ranks[i], 0, comm, &request);
+        this->requests.push_back(request);
+    }
+    this->request_send_offsets = this->send_offsets;
+    this->request_recv_offsets = this->recv_offsets;
+}
+
+/**
+ * 永続通信リクエストを解放する.
+ */
+void UdmHaloExchange::freeRequests()
+{
+    std::vector<MPI_Request>::iterator itr;
+    for (itr=this->requests.begin(); itr!=this->requests.end(); itr++) {
+        if ((*itr) != MPI_REQUEST_NULL) {
+            udm_mpi_request_free(&(*itr));
+        }
+    }
+    this->requests.clear();
+    this->request_send_offsets.clear();
+    this->request_recv_offsets.clear();
+}
+
+/**
+ * 送信先ランク別に送信物理量を送信バッファに作成する.
+ */
+void UdmHaloExchange::packSolutions()
+{
+    int i, m;
+    for (i=0; i<(int)this->send_ranks.size(); i++) {
+        char *buf = this->send_buffer + this->send_offsets[i];
+        for (m=0; m<(int)this->exchange_fields.size(); m++) {
+            const UdmSolutionFieldConfig *config = this->exchange_fields[m];
+            UdmEntityVoxels *voxels = this->exchange_voxels[m];
+            UdmSize_t field_id = this->exchange_field_ids[m];
+            const std::vector<UdmEntity*> &entities = (config->getGridLocation() == Udm_Vertex) ? this->send_nodes[i] : this->send_cells[i];
+            UdmDataType_t datatype = config->getDataType();
+            if (datatype == Udm_Integer) {
+                this->packSolutionValues<int>(entities, config, voxels, field_id, buf);
+            }
+            else if (datatype == Udm_LongInteger) {
+                this->packSolutionValues<long long>(entities, config, voxels, field_id, buf);
+            }
+            else if (datatype == Udm_RealSingle) {
+                this->packSolutionValues<float>(entities, config, voxels, field_id, buf);
+            }
+            else if (datatype == Udm_RealDouble) {
+                this->packSolutionValues<double>(entities, config, voxels, field_id, buf);
+            }
+            buf += this->getFieldBufferSize(this->send_cells[i], this->send_nodes[i], config);
+        }
+    }
+}
+
+/**
+ * 受信元ランク別の受信物理量を仮想要素（セル）, 仮想節点（ノード）に設定する.
+ */
+void UdmHaloExchange::unpackSolutions()
+{
+    int i, m;
+    for (i=0; i<(int)this->recv_ranks.size(); i++) {
+        const char *buf = this->recv_buffer + this->recv_offsets[i];
+        for (m=0; m<(int)this->exchange_fields.size(); m++) {
+            const UdmSolutionFieldConfig *config = this->exchange_fields[m];
+            UdmEntityVoxels *voxels = this->exchange_voxels[m];
+            UdmSize_t field_id = this->exchange_field_ids[m];
+            const std::vector<UdmEntity*> &entities = (config->getGridLocation() == Udm_Vertex) ? this->recv_nodes[i] : this->recv_cells[i];
+            UdmDataType_t datatype = config->getDataType();
+            if (datatype == Udm_Integer) {
+                this->unpackSolutionValues<int>(entities, config, voxels, field_id, buf);
+            }
+            else if (datatype == Udm_LongInteger) {
+                this->unpackSolutionValues<long long>(entities, config, voxels, field_id, buf);
+            }
+            else if (datatype == Udm_RealSingle) {
+                this->unpackSolutionValues<float>(entities, config, voxels, field_id, buf);
+            }
+            else if (datatype == Udm_RealDouble) {
+                this->unpackSolutionValues<double>(entities, config, voxels, field_id, buf);
+            }
+            buf += this->getFieldBufferSize(this->recv_cells[i], this->recv_nodes[i], config);
+        }
+    }
+}
+
+/**
+ * 物理量を送信バッファに作成する.
+ * 物理量が未設定の節点（ノード）, 要素（セル）は0とする.
+ * 物理量は物理量フィールドIDにて物理量カラムデータから直接取得する.
+ * @param [in]  entities        送信節点（ノード）, 送信要素（セル）
+ * @param [in]  config        物理量情報
+ * @param [in]  voxels        節点（ノード）, 要素（セル）管理クラス
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] buf            送信バッファ
+ */
+template<class VALUE_TYPE>
+void UdmHaloExchange::packSolutionValues(
+                const std::vector<UdmEntity*> &entities,
+                const UdmSolutionFieldConfig *config,
+                const UdmEntityVoxels *voxels,
+                UdmSize_t field_id,
+                char *buf) const
+{
+    int nvector_size = config->getNvectorSize();
+    VALUE_TYPE *values = (VALUE_TYPE*)buf;
+    size_t num_entities = entities.size();
+    memset(values, 0x00, num_entities*nvector_size*sizeof(VALUE_TYPE));
+
+    size_t n;
+    for (n=0; n<num_entities; n++) {
+        if (entities[n] == NULL) continue;
+        voxels->getEntitySolutionVector<VALUE_TYPE>(entities[n], field_id, values + n*nvector_size);
+    }
+}
+
+/**
+ * 受信バッファの物理量を節点（ノード）, 要素（セル）に設定する.
+ * 物理量は物理量フィールドIDにて物理量カラムデータに直接設定する.
+ * @param [in]  entities        受信仮想節点（ノード）, 仮想要素（セル）
+ * @param [in]  config        物理量情報
+ * @param [in]  voxels        節点（ノード）, 要素（セル）管理クラス
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [in]  buf            受信バッファ
+ */
+template<class VALUE_TYPE>
+void UdmHaloExchange::unpackSolutionValues(
+                const std::vector<UdmEntity*> &entities,
+                const UdmSolutionFieldConfig *config,
+                UdmEntityVoxels *voxels,
+                UdmSize_t field_id,
+                const char *buf) const
+{
+    int nvector_size = config->getNvectorSize();
+    const VALUE_TYPE *values = (const VALUE_TYPE*)buf;
+    size_t num_entities = entities.size();
+
+    size_t n;
+    for (n=0; n<num_entities; n++) {
+        if (entities[n] == NULL) continue;
+        if (nvector_size == 1) {
+            voxels->setEntitySolutionScalar<VALUE_TYPE>(entities[n], field_id, values[n]);
+        }
+        else {
+            voxels->setEntitySolutionVector<VALUE_TYPE>(entities[n], field_id, values + n*nvector_size, nvector_size);
+        }
+    }
+}
+
+/**
+ * MPIコミュニケータを取得する.
+ * @return        MPIコミュニケータ
+ */
+MPI_Comm UdmHaloExchange::getMpiComm() const
+{
+    if (this->getParentZone() == NULL) return MPI_COMM_NULL;
+    return this->getParentZone()->getMpiComm();
+}
+
+/**
+ * MPIランク番号を取得する.
+ * @return        MPIランク番号
+ */
+int UdmHaloExchange::getMpiRankno() const
+{
+    if (this->getParentZone() == NULL) return -1;
+    return this->getParentZone()->getMpiRankno();
+}
+
+/**
+ * MPIプロセス数を取得する.
+ * @return        MPIプロセス数
+ */
+int UdmHaloExchange::getMpiProcessSize() const
+{
+    if (this->getParentZone() == NULL) return -1;
+    return this->getParentZone()->getMpiProcessSize();
+}
+
+} /* namespace udm */
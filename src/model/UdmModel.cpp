@@ -15,6 +15,7 @@
  */
 
 #include "model/UdmModel.h"
+#include "utils/UdmCgnsGatherArchive.h"
 
 #ifdef isnan
   #define ISNAN(_X) isnan(_X)
@@ -71,6 +72,15 @@ UdmModel::UdmModel(const MPI_Comm& comm) : UdmGeneral(), iterator(NULL)
  */
 UdmModel::~UdmModel()
 {
+    // 非同期出力スレッドの終了を待つ
+    this->joinModelAsync();
+    pthread_mutex_destroy(&this->async_mutex);
+    // 出力スレッドのエラー、警告メッセージを出力する : MPI終了後は出力しない.
+    int finalized = 0;
+    udm_mpi_finalized(&finalized);
+    if (!finalized) {
+        UdmErrorHandler::getInstance()->flushQueuedMessages();
+    }
     // ゾーンの削除
     this->clearZone();
     // 時系列データの削除
@@ -78,6 +88,8 @@ UdmModel::~UdmModel()
     // ロードバランスクラスの削除
     if (this->partition != NULL) delete this->partition;
     if (this->config != NULL) delete this->config;
+    // CGNS出力作業バッファの削除
+    this->releaseScratchBuffer();
 }
 
 /**
@@ -99,6 +111,7 @@ void UdmModel::initialize()
 
     // MPI
     this->setMpiComm(MPI_COMM_WORLD);
+    this->aggregate_rankno = -1;
 
     // UdmInfo
     this->udminfo_version.clear();
@@ -107,6 +120,26 @@ void UdmModel::initialize()
 
     // ロードバランスクラス
     this->partition = new UdmLoadBalance();
+
+    // 非同期出力
+    pthread_mutex_init(&this->async_mutex, NULL);
+    this->async_pending = false;
+    this->async_threaded = false;
+    this->async_finished = false;
+    this->async_error = UDM_OK;
+    this->async_step = 0;
+    this->async_time = 0.0;
+    this->async_average = false;
+    this->async_average_step = 0;
+    this->async_average_time = 0.0;
+
+    // CGNS出力作業バッファ
+    this->scratch_buffer = NULL;
+    this->scratch_size = 0;
+
+    // 読込物理量
+    this->load_field_filter = false;
+    this->load_field_names.clear();
 }
 
 /**
@@ -295,6 +328,47 @@ int UdmModel::getZoneId(const std::string &zone_name) const
     return 0;
 }
 
+/**
+ * 指定物理量のみCGNSファイルから読みこむ.
+ * @param cgns_filename        CGNSファイル名
+ * @param field_names          読込物理量名称リスト : 空の場合は物理量を読み込まない.
+ * @param timeslice_step       CGNS読込ステップ回数 (default=-1)
+ * @param element_path         CGNS読込パス (default=NULL)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR, etc.
+ */
+UdmError_t UdmModel::readCgns(
+                        const char* cgns_filename,
+                        const std::vector<std::string> &field_names,
+                        int timeslice_step,
+                        const char* element_path)
+{
+    this->load_field_filter = true;
+    this->load_field_names = field_names;
+
+    UdmError_t error = this->readCgns(cgns_filename, timeslice_step, element_path);
+
+    this->load_field_filter = false;
+    this->load_field_names.clear();
+
+    return error;
+}
+
+/**
+ * 読込対象の物理量であるかチェックする.
+ * loadModel, readCgnsにて読込物理量名称リストが指定されていない場合は、全物理量を読込対象とする.
+ * @param field_name        物理量名称
+ * @return        true=読込対象物理量
+ */
+bool UdmModel::isLoadSolutionField(const std::string &field_name) const
+{
+    if (!this->load_field_filter) return true;
+    std::vector<std::string>::const_iterator itr;
+    for (itr=this->load_field_names.begin(); itr!=this->load_field_names.end(); itr++) {
+        if ((*itr) == field_name) return true;
+    }
+    return false;
+}
+
 /**
  * CGNSファイルを読みこむ.
  * @param cgns_filename        CGNSファイル名
@@ -309,6 +383,13 @@ UdmError_t UdmModel::readCgns(const char* cgns_filename, int timeslice_step, con
 #endif
 
     UdmError_t error = UDM_OK;
+
+    // 非同期出力の完了を待つ
+    error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
     FILE*fp = NULL;
     if( !(fp=fopen(cgns_filename, "rb")) ) {
         return UDM_ERROR_HANDLER(UDM_ERROR_READ_CGNSFILE_OPENERROR, "Can't open file. (%s)\n", cgns_filename);
@@ -425,7 +506,7 @@ UdmError_t UdmModel::readCgns(const char* cgns_filename, int timeslice_step, con
         }
 
         bool found_zone = false;
-        if (num_paths == 0) {
+        if (num_paths <= 1) {
             found_zone = true;
         }
         // CGNS読込ゾーン名
@@ -753,6 +834,28 @@ UdmError_t UdmModel::readDfi(const char* dfi_filename)
     return error;
 }
 
+/**
+ * DFIファイルの設定情報に従って、指定物理量のみCGNSファイルから読み込む.
+ * 指定外の物理量はCGNS:FlowSolution/Fieldを読み込まず、節点（ノード）, 要素（セル）の物理量データも作成しない.
+ * DFI:FlowSolutionListの物理量情報は変更しない為、writeModelでは指定外の物理量は0値にて出力される.
+ * @param dfi_filename        index.dfiファイル名
+ * @param field_names        読込物理量名称リスト : 空の場合は物理量を読み込まない.
+ * @param timeslice_step    読込ステップ番号
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::loadModel(const char* dfi_filename, const std::vector<std::string> &field_names, int timeslice_step)
+{
+    this->load_field_filter = true;
+    this->load_field_names = field_names;
+
+    UdmError_t error = this->loadModel(dfi_filename, timeslice_step);
+
+    this->load_field_filter = false;
+    this->load_field_names.clear();
+
+    return error;
+}
+
 /**
  * DFIファイルの設定情報に従って、CGNSファイルを読み込む.
  * @param dfi_filename        index.dfiファイル名
@@ -769,6 +872,12 @@ UdmError_t UdmModel::loadModel(const char* dfi_filename, int timeslice_step)
     UdmError_t error = UDM_OK;
     int n;
 
+    // 非同期出力の完了を待つ
+    error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
     // DFIファイルの読込
     error = this->readDfi(dfi_filename);
     // ACK
@@ -776,6 +885,16 @@ UdmError_t UdmModel::loadModel(const char* dfi_filename, int timeslice_step)
         return UDM_ERRORNO_HANDLER(error);
     }
 
+    // 読込物理量名称のチェック : DFI:FlowSolutionListに存在しない物理量名称は警告とする.
+    if (this->load_field_filter && this->config->getFlowSolutionListConfig() != NULL) {
+        std::vector<std::string>::const_iterator name_itr;
+        for (name_itr=this->load_field_names.begin(); name_itr!=this->load_field_names.end(); name_itr++) {
+            if (!this->config->getFlowSolutionListConfig()->existsSolutionConfig(*name_itr)) {
+                UDM_WARNING_HANDLER(UDM_WARNING_CGNS_NOTFOUND_FLOWSOLUTION, "not found FlowSolutionList[name=%s].", name_itr->c_str());
+            }
+        }
+    }
+
     // 読込CGNSファイル名
     bool mpiexec = false;
     int myrank = 0;
@@ -800,15 +919,34 @@ UdmError_t UdmModel::loadModel(const char* dfi_filename, int timeslice_step)
         std::string element_path;
         this->getConfigFileinfo()->getElementPath(element_path);
 
+        // 集約CGNSファイル : proc.dfiの集約ランク番号(FileID)のファイルからランク番号のCGNS:Baseを読み込む.
+        bool aggregate_file = this->getConfigFileinfo()->isFileAggregate();
+        std::vector<std::string> element_paths;
+        std::string input_path;
+        if (aggregate_file) {
+            this->split(element_path, '/', element_paths);
+        }
+
         // if (timeslice_step <= 0) timeslice_step = 0;
         std::vector<int>::const_iterator itr;
         for (itr=input_rank_ids.begin(); itr!=input_rank_ids.end(); itr++) {
             int rank_no = (*itr);
-            std::string input_path;
-            this->config->getCgnsInputFilePath(input_path, rank_no);
+            std::string read_path = element_path;
+            if (aggregate_file) {
+                // CGNS読込パスのCGNS:Base名をランク番号のCGNS:Base名に置き換える.
+                this->getConfigFileinfo()->generateCgnsRankBaseName(read_path, rank_no);
+                if (element_paths.size() > 1) {
+                    read_path += "/" + element_paths[1];
+                }
+                int file_rankno = this->config->getCgnsFileRankno(rank_no);
+                this->config->getCgnsTimeSliceInputFilePath(input_path, file_rankno, timeslice_step);
+            }
+            else {
+                this->config->getCgnsInputFilePath(input_path, rank_no);
+            }
 
             // CGNSファイルの読込
-            error = this->readCgns(input_path.c_str(), timeslice_step, element_path.c_str());
+            error = this->readCgns(input_path.c_str(), timeslice_step, read_path.c_str());
             if (error != UDM_OK) {
                 UDM_ERRORNO_HANDLER(error);
                 break;
@@ -901,41 +1039,83 @@ UdmError_t UdmModel::writeCgnsTimeSliceFile(
                         bool grid_timeslice,
                         bool write_constsolutions)
 {
-    int index_file,index_base;
-    int n;
+    int index_file = 0;
+    UdmError_t error = UDM_OK;
+
+    // CGNSファイルをオープンする.
+    if (this->openWriteCgnsFile(cgns_filename, index_file) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(UDM_ERROR_CGNS_INVALID_BASE);
+    }
+
+    // CGNS:Base, CGNS:Zoneを出力する.
+    error = this->writeCgnsTimeSliceBase(
+                        index_file,
+                        this->zones,
+                        this->getMpiRankno(),
+                        timeslice_step,
+                        timeslice_time,
+                        grid_timeslice,
+                        write_constsolutions);
+
+    // CGNSファイルをクローズする。
+    this->closeWriteCgnsFile(index_file);
+
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    return UDM_OK;
+}
+
+/**
+ * オープン済みのCGNSファイルにランク番号のCGNS:Baseを出力して、CGNS:GridCoordinatesとCGNS:FlowSolutionを出力する.
+ * 集約CGNSファイル出力では集約ランクが受信ゾーンを送信元ランク番号のCGNS:Baseに出力する.
+ * @param index_file        CGNS:ファイルインデックス
+ * @param write_zones        出力ゾーン
+ * @param rankno        出力ランク番号 : CGNS:Base名, CGNS:UdmInfoのランク番号
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @param grid_timeslice        CGNS:GridCoordinatesの時系列出力の有無:true=GridCoordinates時系列出力する.
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データを出力する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeCgnsTimeSliceBase(
+                        int index_file,
+                        const std::vector<UdmZone*> &write_zones,
+                        int rankno,
+                        int timeslice_step,
+                        float timeslice_time,
+                        bool grid_timeslice,
+                        bool write_constsolutions)
+{
+    int index_base = 0;
+    size_t n;
 
     // ゾーン出力前の初期化を行う。
-    for (n=1; n<= this->getNumZones(); n++) {
-        UdmZone* zone = this->getZone(n);
+    for (n=0; n<write_zones.size(); n++) {
+        UdmZone* zone = write_zones[n];
         if (zone->initializeWriteCgns() != UDM_OK) {
-            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_BASE, "failure : UdmZone::initializeWriteCgns(zoneid=%d)", n);
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_BASE, "failure : UdmZone::initializeWriteCgns(zoneid=%d)", (int)zone->getId());
         }
     }
 
     // CGNS:Baseを出力する.
-    if (this->writeCgnsBase(cgns_filename, index_file, index_base) != UDM_OK) {
-        this->closeWriteCgnsFile(index_file);
+    if (this->writeCgnsBase(index_file, rankno, index_base) != UDM_OK) {
         return UDM_ERRORNO_HANDLER(UDM_ERROR_CGNS_INVALID_BASE);
     }
 
     // CGNS:Zoneを出力する.
-    for (n=1; n<= this->getNumZones(); n++) {
-        UdmZone* zone = this->getZone(n);
+    for (n=0; n<write_zones.size(); n++) {
+        UdmZone* zone = write_zones[n];
         if (zone->writeCgnsTimeSliceFile(index_file, index_base, timeslice_step, grid_timeslice, write_constsolutions) != UDM_OK) {
-            this->closeWriteCgnsFile(index_file);
             return UDM_ERRORNO_HANDLER(UDM_ERROR_CGNS_INVALID_ZONE);
         }
     }
 
     // CGNS:BaseIterativeDataを出力する.
-    if (this->writeCgnsIterativeDatas(index_file, index_base, timeslice_step, timeslice_time, grid_timeslice) != UDM_OK) {
-        this->closeWriteCgnsFile(index_file);
+    if (this->writeCgnsIterativeDatas(index_file, index_base, timeslice_step, timeslice_time, grid_timeslice, write_zones) != UDM_OK) {
         return UDM_ERRORNO_HANDLER(UDM_ERROR_CGNS_INVALID_BASE);
     }
 
-    // CGNSファイルをクローズする。
-    this->closeWriteCgnsFile(index_file);
-
     return UDM_OK;
 }
 
@@ -1089,19 +1269,35 @@ UdmError_t UdmModel::writeCgnsLinkFile(
 
 /**
  * CGNS:BASEを出力する.
+ * 集約CGNSファイル出力(AggregateFile)の場合は、
+ * ランク毎のCGNS:Base(UdmBase_id%06d)を出力する.
  * @param cgns_filename        CGNS出力ファイル名
  * @param index_file        CGNS:ファイルインデックス
  * @param index_base        CGNS:ベースインデックス
  * @return        エラー番号 : UDM_OK | UDM_ERROR
  */
 UdmError_t UdmModel::writeCgnsBase(const char* cgns_filename, int &index_file, int &index_base)
+{
+    // CGNSファイルをオープンする.
+    if (this->openWriteCgnsFile(cgns_filename, index_file) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(UDM_ERROR_CGNS_OPENERROR);
+    }
+
+    return this->writeCgnsBase(index_file, this->getMpiRankno(), index_base);
+}
+
+/**
+ * 出力CGNSファイルをオープンする.
+ * 出力ディレクトリを作成し、CGNSファイルが存在しなければ新規に作成して、追加モードでオープンする.
+ * @param [in] cgns_filename        CGNS出力ファイル名
+ * @param [out] index_file        CGNS:ファイルインデックス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::openWriteCgnsFile(const char* cgns_filename, int &index_file)
 {
     int open_mode = CG_MODE_WRITE;        // modes for cgns file
     FILE*fp = NULL;
-    char basename[33] = {0x00};
-    int cell_dim, phys_dim;
-    int num_bases = 0;
-    char dirname[256] = {0x00};
+    char dirname[UDM_PATH_MAX] = {0x00};
 
     if (cgns_filename == NULL) {
         return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "filename is null.");
@@ -1134,27 +1330,52 @@ UdmError_t UdmModel::writeCgnsBase(const char* cgns_filename, int &index_file, i
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_OPENERROR, "filename=%s, cgns_error=%s", cgns_filename, cg_get_error());
     }
 
+    return UDM_OK;
+}
+
+/**
+ * オープン済みのCGNSファイルにCGNS:BASEを出力する.
+ * 集約CGNSファイル出力(AggregateFile)の場合は、
+ * 出力ランク番号のCGNS:Base(UdmBase_id%06d)を出力する.
+ * @param [in] index_file        CGNS:ファイルインデックス
+ * @param [in] rankno        出力ランク番号
+ * @param [out] index_base        CGNS:ベースインデックス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeCgnsBase(int index_file, int rankno, int &index_base)
+{
+    char basename[33] = {0x00};
+    int cell_dim, phys_dim;
+    int num_bases = 0;
+    std::string write_basename = UDM_CGNS_NAME_BASE;
+
+    // 集約CGNSファイルのCGNS:Base名
+    if (this->getConfigFileinfo() != NULL
+        && this->getConfigFileinfo()->isFileAggregate()) {
+        this->getConfigFileinfo()->generateCgnsRankBaseName(write_basename, rankno);
+    }
+
     index_base = 0;
     cg_nbases(index_file, &num_bases);
     for (index_base=1; index_base<=num_bases; index_base++) {
         if (cg_base_read(index_file, index_base, basename, &cell_dim, &phys_dim) != CG_OK) {
             return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_BASE, "failure : cg_base_read.");
         }
-        if (strcmp(basename, UDM_CGNS_NAME_BASE) == 0) {
+        if (strcmp(basename, write_basename.c_str()) == 0) {
             break;
         }
     }
 
     if (index_base == 0 || index_base>num_bases) {
         // CGNS:BASEノードの作成
-        strcpy(basename, UDM_CGNS_NAME_BASE);
+        strcpy(basename, write_basename.c_str());
         if (cg_base_write(index_file, basename, this->cell_dimension,this->physical_dimension, &index_base) != CG_OK) {
-            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_BASE, "filename=%s", cgns_filename);
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_BASE, "index_file=%d, basename=%s", index_file, basename);
         }
     }
 
     // UdmInfoの出力
-    if (this->writeCgnsUdmInfo(index_file, index_base) != UDM_OK) {
+    if (this->writeCgnsUdmInfo(index_file, index_base, rankno) != UDM_OK) {
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "index_file=%d,index_base=%d", index_file, index_base);
     }
 
@@ -1179,6 +1400,29 @@ UdmError_t UdmModel::writeCgnsIterativeDatas(
                 int timeslice_step,
                 float timeslice_time,
                 bool write_gridflag)
+{
+    return this->writeCgnsIterativeDatas(index_file, index_base, timeslice_step, timeslice_time, write_gridflag, this->zones);
+}
+
+/**
+ * 出力ゾーンのCGNS:ZoneIterativeData, CGNS:BaseIterativeDataを出力する.
+ * BaseIterativeDataが存在していなければ作成する。
+ * 存在していれば、既存時系列に追加を行う.
+ * @param index_file            CGNSファイルインデックス
+ * @param index_base            CGNSベースインデックス
+ * @param timeslice_step        時系列ステップ番号
+ * @param timeslice_time        時系列ステップ時間
+ * @param write_gridflag       CGNS:GridCoordinatesの時系列出力の有無:true=GridCoordinates時系列出力する
+ * @param write_zones            出力ゾーン
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeCgnsIterativeDatas(
+                int index_file,
+                int index_base,
+                int timeslice_step,
+                float timeslice_time,
+                bool write_gridflag,
+                const std::vector<UdmZone*> &write_zones)
 {
     int steps;
     std::vector<int> timeslice_steps;
@@ -1191,8 +1435,8 @@ UdmError_t UdmModel::writeCgnsIterativeDatas(
     int count = 0;
 
     // CGNS:ZoneIterativeDatasを出力する.
-    for (n=1; n<= this->getNumZones(); n++) {
-        UdmZone* zone = this->getZone(n);
+    for (n=0; n<(int)write_zones.size(); n++) {
+        UdmZone* zone = write_zones[n];
         if (zone->writeCgnsIterativeDatas(index_file, index_base, timeslice_step) != UDM_OK) {
             return UDM_ERRORNO_HANDLER(UDM_ERROR_CGNS_INVALID_ZONE);
         }
@@ -1224,7 +1468,7 @@ UdmError_t UdmModel::writeCgnsIterativeDatas(
     }
 
     // 出力CGNS:FlowSolution分のステップ数を追加する.
-    count = this->getNumCgnsIterativeDatas();
+    count = this->getNumCgnsIterativeDatas(write_zones);
     if (count <= 0) {
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_BASE, "invalid iterativedata count.");
     }
@@ -1362,11 +1606,21 @@ int UdmModel::readCgnsBaseIterativeDatas(
  */
 int UdmModel::getNumCgnsIterativeDatas() const
 {
-    int n;
+    return this->getNumCgnsIterativeDatas(this->zones);
+}
+
+/**
+ * 出力ゾーンの出力ステップ回数を取得する.
+ * @param write_zones            出力ゾーン
+ * @return        出力ステップ回数
+ */
+int UdmModel::getNumCgnsIterativeDatas(const std::vector<UdmZone*> &write_zones) const
+{
+    size_t n;
     int max_count = 0;
     // CGNS:Zoneを出力する.
-    for (n=1; n<= this->getNumZones(); n++) {
-        const UdmZone* zone = this->getZone(n);
+    for (n=0; n<write_zones.size(); n++) {
+        const UdmZone* zone = write_zones[n];
         int count = zone->getNumCgnsIterativeDatas();
         if (max_count < count) {
             max_count = count;
@@ -1766,15 +2020,16 @@ UdmError_t UdmModel::readCgnsUdmInfo(int index_file, int index_base)
  * CGNS:UdmInfo(UDMlib情報)を出力する
  * @param index_file        CGNS:ファイルインデックス
  * @param index_base        CGNS:ベースインデックス
+ * @param rankno        出力ランク番号
  * @return        エラー番号 : UDM_OK | UDM_ERROR
  */
-UdmError_t UdmModel::writeCgnsUdmInfo(int index_file, int index_base)
+UdmError_t UdmModel::writeCgnsUdmInfo(int index_file, int index_base, int rankno)
 {
     cgsize_t user_dims[2] = {0, 0};
     char version[33] = {0x00};
     udm_get_version(version);
     char description[] = UDM_CGNS_TEXT_UDMINFO_DESCRIPTION;
-    int rank_info[2] = { this->getMpiProcessSize(), this->getMpiRankno()};
+    int rank_info[2] = { this->getMpiProcessSize(), rankno};
 
     // "UdmInfo" : UDMlib情報
     if (cg_goto(index_file, index_base, "end") != CG_OK) {
@@ -1913,6 +2168,12 @@ UdmError_t UdmModel::writeModel(
         return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_VARIABLE, "config is null.");
     }
 
+    // 非同期出力の完了を待つ
+    error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
     // CGNSファイルを出力する
     error = this->writeCgnsModel(timeslice_step, timeslice_time);
     if (error != UDM_OK) {
@@ -1955,6 +2216,12 @@ UdmError_t UdmModel::writeModel(int timeslice_step, float timeslice_time)
         return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_VARIABLE, "config is null.");
     }
 
+    // 非同期出力の完了を待つ
+    error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
     // CGNSファイルを出力する
     error = this->writeCgnsModel(timeslice_step, timeslice_time);
     if (error != UDM_OK) {
@@ -1981,6 +2248,268 @@ UdmError_t UdmModel::writeModel(int timeslice_step, float timeslice_time)
 }
 
 
+/**
+ * DFI設定に従って、CGNSファイル, index.dfiを非同期に出力する.
+ * 出力する節点（ノード）座標値と物理量データを退避バッファにコピーして、CGNSファイル出力をスレッドにて行う.
+ * 本関数の終了後は物理量データを更新することができる.
+ * 出力の完了はwaitModelAsyncにて待ち、index.dfi, proc.dfiはwaitModelAsyncにて出力する.
+ * 出力中にモデルの節点（ノード）、要素（セル）の構成を変更してはならない.
+ * 集約CGNSファイル(AggregateFile)の出力は集約ランクへの集約を行うため、同期出力を行う.
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeModelAsync(int timeslice_step, float timeslice_time)
+{
+    return this->startModelAsync(timeslice_step, timeslice_time, false, 0, 0.0);
+}
+
+/**
+ * DFI設定に従って、CGNSファイル, index.dfiを非同期に出力する.
+ * 平均ステップ数, 平均ステップ時間を設定する以外はwriteModelAsync(timeslice_step, timeslice_time)と同じ.
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @param average_step            平均ステップ数
+ * @param average_time            平均ステップ時間
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeModelAsync(
+                        int timeslice_step,
+                        float timeslice_time,
+                        int average_step,
+                        float average_time)
+{
+    return this->startModelAsync(timeslice_step, timeslice_time, true, average_step, average_time);
+}
+
+/**
+ * 非同期出力の完了を待つ.
+ * CGNSファイル出力スレッドの終了を待って、出力スレッドのエラー、警告メッセージの出力と、
+ * 時系列情報:TimeSliceの追加とindex.dfi, proc.dfiの出力を行う.
+ * 全ランクで実行すること. 非同期出力中でなければ何もしない.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::waitModelAsync()
+{
+    if (!this->async_pending) return UDM_OK;
+
+    // CGNSファイル出力スレッドの終了を待つ
+    this->joinModelAsync();
+    this->async_pending = false;
+
+    // 出力スレッドのエラー、警告メッセージを出力する.
+    UdmErrorHandler::getInstance()->flushQueuedMessages();
+
+    // 退避バッファを削除する.
+    int n;
+    for (n=1; n<= this->getNumZones(); n++) {
+        this->getZone(n)->clearStagedWriteCgns();
+    }
+
+    // ACK
+    UdmError_t error = this->async_error;
+    if (udm_mpi_ack(&error, this->getMpiComm()) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    // 時系列情報：TimeSliceを追加する
+    if (this->async_average) {
+        this->config->insertTimeSlice(
+                            this->async_step,
+                            this->async_time,
+                            this->async_average_step,
+                            this->async_average_time);
+    }
+    else {
+        this->config->insertTimeSlice(
+                            this->async_step,
+                            this->async_time);
+    }
+
+    // DFI:index.dfi出力
+    error = this->writeDfi();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 自ランクの非同期出力のCGNSファイル出力が終了しているかチェックする.
+ * 終了している場合もwaitModelAsyncを実行すること.
+ * @return        true=CGNSファイル出力終了又は非同期出力中でない
+ */
+bool UdmModel::testModelAsync()
+{
+    if (!this->async_pending) return true;
+
+    pthread_mutex_lock(&this->async_mutex);
+    bool finished = this->async_finished;
+    pthread_mutex_unlock(&this->async_mutex);
+
+    return finished;
+}
+
+/**
+ * CGNS出力作業バッファを取得する.
+ * 物理量, 節点（ノード）座標値のCGNS出力データ配列として、フィールド毎、時系列毎に再利用する.
+ * 作業バッファは最大要求サイズで確保し、要求サイズが確保済みサイズ以下であれば再確保しない.
+ * 取得したバッファは次回の取得又はreleaseScratchBufferまで有効であり、呼出元にて削除してはならない.
+ * @param size        要求サイズ(byte)
+ * @return        CGNS出力作業バッファ : 8byte境界
+ */
+void* UdmModel::getScratchBuffer(size_t size)
+{
+    if (size == 0) size = 1;
+    if (this->scratch_buffer != NULL && size <= this->scratch_size) {
+        return this->scratch_buffer;
+    }
+
+    this->releaseScratchBuffer();
+    size_t num_datas = (size + sizeof(double) - 1) / sizeof(double);
+    this->scratch_buffer = new double[num_datas];
+    this->scratch_size = num_datas*sizeof(double);
+
+    return this->scratch_buffer;
+}
+
+/**
+ * CGNS出力作業バッファの確保サイズを取得する.
+ * @return        確保サイズ(byte)
+ */
+size_t UdmModel::getScratchBufferSize() const
+{
+    return this->scratch_size;
+}
+
+/**
+ * CGNS出力作業バッファを削除する.
+ */
+void UdmModel::releaseScratchBuffer()
+{
+    if (this->scratch_buffer != NULL) {
+        delete []this->scratch_buffer;
+    }
+    this->scratch_buffer = NULL;
+    this->scratch_size = 0;
+}
+
+/**
+ * 非同期出力を開始する.
+ * 前回の非同期出力の完了を待ってから、退避バッファの作成とCGNSファイル出力スレッドの起動を行う.
+ * CGNS出力前の初期化、要素接続情報配列の整理は本関数（呼出スレッド）にて行い、出力スレッドは退避バッファから出力する.
+ * 出力スレッドのエラー、警告メッセージは退避して、waitModelAsyncにて出力する.
+ * スレッドを起動できない場合はCGNSファイル出力を本関数内にて行う.
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @param average                平均ステップ設定フラグ
+ * @param average_step            平均ステップ数
+ * @param average_time            平均ステップ時間
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::startModelAsync(
+                        int timeslice_step,
+                        float timeslice_time,
+                        bool average,
+                        int average_step,
+                        float average_time)
+{
+    UdmError_t error = UDM_OK;
+    int n;
+
+    if (this->config == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_VARIABLE, "config is null.");
+    }
+
+    // 前回の非同期出力の完了を待つ
+    error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    // 集約CGNSファイルは同期出力を行う.
+    if (this->getConfigFileinfo()->isFileAggregate()) {
+        if (average) {
+            return this->writeModel(timeslice_step, timeslice_time, average_step, average_time);
+        }
+        return this->writeModel(timeslice_step, timeslice_time);
+    }
+
+    // CGNS出力前の初期化と、節点（ノード）座標値, 要素接続情報, 物理量データの退避を行う.
+    for (n=1; n<= this->getNumZones(); n++) {
+        error = this->getZone(n)->initializeWriteCgns();
+        if (error != UDM_OK) break;
+        error = this->getZone(n)->stageWriteCgns();
+        if (error != UDM_OK) break;
+    }
+    // ACK
+    if (udm_mpi_ack(&error, this->getMpiComm()) != UDM_OK) {
+        for (n=1; n<= this->getNumZones(); n++) {
+            this->getZone(n)->clearStagedWriteCgns();
+        }
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    this->async_step = timeslice_step;
+    this->async_time = timeslice_time;
+    this->async_average = average;
+    this->async_average_step = average_step;
+    this->async_average_time = average_time;
+    this->async_error = UDM_OK;
+    this->async_finished = false;
+    this->async_pending = true;
+
+    // CGNSファイル出力スレッドを起動する : エラーハンドラは呼出スレッドにて生成しておく.
+    UdmErrorHandler::getInstance();
+    if (pthread_create(&this->async_thread, NULL, UdmModel::writeCgnsModelThread, this) == 0) {
+        this->async_threaded = true;
+    }
+    else {
+        // スレッドを起動できないので、CGNSファイルを出力する.
+        UDM_WARNING_HANDLER(UDM_ERROR, "failure : pthread_create, write cgns synchronously.");
+        this->async_threaded = false;
+        this->async_error = this->writeCgnsModel(timeslice_step, timeslice_time);
+        this->async_finished = true;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 非同期出力のCGNSファイル出力スレッドの終了を待つ.
+ */
+void UdmModel::joinModelAsync()
+{
+    if (!this->async_threaded) return;
+    pthread_join(this->async_thread, NULL);
+    this->async_threaded = false;
+}
+
+/**
+ * 非同期出力のCGNSファイル出力スレッド関数.
+ * 自ランクのCGNSファイル出力のみを行い、MPI通信は行わない.
+ * エラー、警告メッセージはMPI関数を呼び出さないように退避する.
+ * @param arg        UdmModelクラスポインタ
+ * @return        NULL
+ */
+void* UdmModel::writeCgnsModelThread(void *arg)
+{
+    UdmModel *model = static_cast<UdmModel*>(arg);
+    if (model == NULL) return NULL;
+
+    UdmErrorHandler::getInstance()->beginQueueMessages();
+    UdmError_t error = model->writeCgnsModel(model->async_step, model->async_time);
+    UdmErrorHandler::getInstance()->endQueueMessages();
+
+    pthread_mutex_lock(&model->async_mutex);
+    model->async_error = error;
+    model->async_finished = true;
+    pthread_mutex_unlock(&model->async_mutex);
+
+    return NULL;
+}
+
 /**
  * DFI設定に従って、CGNSファイルを出力する.
  * @param timeslice_step        時系列ステップ数
@@ -2053,14 +2582,21 @@ UdmError_t UdmModel::writeCgnsModel(int timeslice_step, float timeslice_time)
         UdmZone* zone = this->getZone(n);
         num_nodes += zone->getNumNodes();
 
-        // 初期化を行う。
-        zone->initializeWriteCgns();
+        // 初期化を行う。 : 非同期出力はstartModelAsyncにて初期化済み
+        if (!this->async_pending) {
+            zone->initializeWriteCgns();
+        }
     }
     if (num_nodes <= 0) {
         // 出力ノードが存在しないので、CGNSファイルを出力しない。
         UDM_WARNING_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "GridCoordinates(node) is empty.");
     }
 
+    // 集約CGNSファイル出力
+    if (this->getConfigFileinfo()->isFileAggregate()) {
+        return this->writeCgnsAggregateFile(timeslice_step, timeslice_time, !write_constgrid, write_constsolutions, initialize_cgns);
+    }
+
     // CGNS:GridCoordinates出力
     if ((num_nodes > 0)
         && this->getConfigFileinfo()->isFileGridCoordinates()) {
@@ -2139,6 +2675,270 @@ UdmError_t UdmModel::writeCgnsModel(int timeslice_step, float timeslice_time)
     return error;
 }
 
+/**
+ * 計算ノード毎のランクグループで１つの集約CGNSファイルにCGNS:GridCoordinatesとCGNS:FlowSolutionを出力する.
+ * 共有メモリ単位(MPI_Comm_split_type)でランクグループを作成し、グループ内の最小ランク番号を集約ランクとする.
+ * 集約CGNSファイルは集約ランク番号のCGNSファイル名とし、ランク毎にCGNS:Base(UdmBase_id%06d)を作成する.
+ * グループ内のランクは出力データを集約ランクに送信し、集約ランクのみが集約CGNSファイルに出力する.
+ * 集約ランク番号はproc.dfi:/Process/Rank[@]/FileIDに出力する.
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @param grid_timeslice        CGNS:GridCoordinatesの時系列出力の有無:true=GridCoordinates時系列出力する.
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データを出力する.
+ * @param initialize_cgns        集約CGNSファイルの初期化フラグ : true=集約ランクが集約CGNSファイルを初期化する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeCgnsAggregateFile(
+                        int timeslice_step,
+                        float timeslice_time,
+                        bool grid_timeslice,
+                        bool write_constsolutions,
+                        bool initialize_cgns)
+{
+    UdmError_t error = UDM_OK;
+    MPI_Comm aggregate_comm = MPI_COMM_NULL;
+
+    // 計算ノード毎のランクグループを作成する : グループ内はランク番号順とする.
+    if (udm_mpi_comm_split_type(this->getMpiComm(), this->getMpiRankno(), &aggregate_comm) != MPI_SUCCESS) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_MPI, "failure : udm_mpi_comm_split_type.");
+    }
+
+    // 集約ランク番号 : グループ内の先頭ランクのランク番号
+    int aggregate_rankno = this->getMpiRankno();
+    udm_mpi_bcast(&aggregate_rankno, 1, MPI_INT, 0, aggregate_comm);
+    this->aggregate_rankno = aggregate_rankno;
+
+    std::string aggregatefile;
+    this->config->getCgnsTimeSliceFilePath(aggregatefile, aggregate_rankno, timeslice_step);
+
+    error = this->writeCgnsGatherFile(
+                        aggregatefile.c_str(),
+                        aggregate_comm,
+                        timeslice_step,
+                        timeslice_time,
+                        grid_timeslice,
+                        write_constsolutions,
+                        initialize_cgns);
+
+    udm_mpi_comm_free(&aggregate_comm);
+
+    // ACK
+    if (udm_mpi_ack(&error, this->getMpiComm()) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * MPIコミュニケータの先頭ランク（集約ランク）に出力データを集約して、１つのCGNSファイルにCGNS:GridCoordinatesとCGNS:FlowSolutionを出力する.
+ * 集約ランク以外は出力データをシリアライズして集約ランクに送信し、CGNSファイルへの出力は行わない.
+ * 集約ランクはCGNSファイルを１度だけオープンし、自ランク、送信元ランクのランク番号順にランク毎のCGNS:Baseを出力する.
+ * 集約ランクは送信元ランクの出力中に次の送信元ランクの出力データを受信する.
+ * 出力ノードが存在しないランクは出力を行わない.
+ * @param cgns_filename        出力CGNSファイル
+ * @param gather_comm        集約出力のMPIコミュニケータ : 先頭ランクを集約ランクとする.
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @param grid_timeslice        CGNS:GridCoordinatesの時系列出力の有無:true=GridCoordinates時系列出力する.
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データを出力する.
+ * @param initialize_cgns        CGNSファイルの初期化フラグ : true=集約ランクがCGNSファイルを初期化する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::writeCgnsGatherFile(
+                        const char* cgns_filename,
+                        const MPI_Comm &gather_comm,
+                        int timeslice_step,
+                        float timeslice_time,
+                        bool grid_timeslice,
+                        bool write_constsolutions,
+                        bool initialize_cgns)
+{
+    UdmError_t error = UDM_OK;
+    int myrank = 0;
+    int num_procs = 1;
+    int index_file = 0;
+    bool opened = false;
+    UdmSize_t num_nodes = 0;
+    int n, src;
+
+    udm_mpi_comm_rank(gather_comm, &myrank);
+    udm_mpi_comm_size(gather_comm, &num_procs);
+
+    // 集約ランク以外は出力データを集約ランクに送信する.
+    if (myrank > 0) {
+        return this->sendCgnsGatherData(gather_comm, write_constsolutions);
+    }
+
+    // 送信元ランクのヘッダの受信を開始する : [0]=エラー番号, [1]=ランク番号, [2]=出力データサイズ(byte)
+    std::vector<long long> headers(num_procs*3, 0);
+    std::vector<MPI_Request> header_requests(num_procs, MPI_REQUEST_NULL);
+    for (src=1; src<num_procs; src++) {
+        udm_mpi_irecv(&headers[src*3], 3, MPI_LONG_LONG, src, UDM_CGNS_GATHER_HEADER_TAG, gather_comm, &header_requests[src]);
+    }
+
+    // CGNSファイルの初期化を行う.
+    if (initialize_cgns) {
+        error = this->initializeCgnsFile(cgns_filename);
+    }
+
+    // 自ランクのCGNS:GridCoordinates+CGNS:FlowSolution出力
+    for (n=1; n<= this->getNumZones(); n++) {
+        num_nodes += this->getZone(n)->getNumNodes();
+    }
+    if (error == UDM_OK && num_nodes > 0) {
+        error = this->openWriteCgnsFile(cgns_filename, index_file);
+        if (error == UDM_OK) {
+            opened = true;
+            error = this->writeCgnsTimeSliceBase(
+                                index_file,
+                                this->zones,
+                                this->getMpiRankno(),
+                                timeslice_step,
+                                timeslice_time,
+                                grid_timeslice,
+                                write_constsolutions);
+        }
+    }
+
+    // 送信元ランクの出力データを受信して出力する : エラーの場合も全送信元ランクから受信する.
+    UdmCgnsGatherArchive archives[2];
+    std::vector<MPI_Request> chunk_requests[2];
+    MPI_Status status;
+    if (num_procs > 1) {
+        udm_mpi_waitall(1, &header_requests[1], &status);
+        this->postRecvCgnsGatherData(gather_comm, 1, &headers[3], archives[1], chunk_requests[1]);
+    }
+    for (src=1; src<num_procs; src++) {
+        UdmCgnsGatherArchive &archive = archives[src%2];
+        std::vector<MPI_Request> &requests = chunk_requests[src%2];
+        if (!requests.empty()) {
+            std::vector<MPI_Status> statuses(requests.size());
+            udm_mpi_waitall(requests.size(), &requests[0], &statuses[0]);
+            requests.clear();
+        }
+
+        // 次の送信元ランクの出力データの受信を開始する.
+        if (src+1 < num_procs) {
+            udm_mpi_waitall(1, &header_requests[src+1], &status);
+            this->postRecvCgnsGatherData(gather_comm, src+1, &headers[(src+1)*3], archives[(src+1)%2], chunk_requests[(src+1)%2]);
+        }
+
+        const long long *header = &headers[src*3];
+        if (header[0] != UDM_OK) {
+            if (error == UDM_OK) error = (UdmError_t)header[0];
+        }
+        else if (error == UDM_OK && header[2] > 0) {
+            if (!opened) {
+                error = this->openWriteCgnsFile(cgns_filename, index_file);
+                opened = (error == UDM_OK);
+            }
+            std::vector<UdmZone*> recv_zones;
+            if (error == UDM_OK) {
+                error = archive.unpackZones(this, recv_zones);
+                if (error != UDM_OK) {
+                    UDM_ERROR_HANDLER(error, "failure : unpackZones(rankno=%d).", (int)header[1]);
+                }
+            }
+            if (error == UDM_OK) {
+                error = this->writeCgnsTimeSliceBase(
+                                    index_file,
+                                    recv_zones,
+                                    (int)header[1],
+                                    timeslice_step,
+                                    timeslice_time,
+                                    grid_timeslice,
+                                    write_constsolutions);
+            }
+            for (n=0; n<(int)recv_zones.size(); n++) {
+                delete recv_zones[n];
+            }
+        }
+        archive.clear();
+    }
+
+    // CGNSファイルをクローズする。
+    if (opened) {
+        this->closeWriteCgnsFile(index_file);
+    }
+
+    return error;
+}
+
+/**
+ * 集約CGNSファイル出力の出力データを集約ランクに送信する.
+ * ヘッダ(エラー番号, ランク番号, 出力データサイズ)を送信し、出力データをUDM_CGNS_GATHER_MAXSIZE以下に分割して送信する.
+ * 出力ノードが存在しない、又はシリアライズエラーの場合は出力データサイズを0とする.
+ * @param gather_comm        集約出力のMPIコミュニケータ : 先頭ランクを集約ランクとする.
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データを出力する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::sendCgnsGatherData(const MPI_Comm &gather_comm, bool write_constsolutions)
+{
+    UdmError_t error = UDM_OK;
+    UdmCgnsGatherArchive archive;
+    long long header[3] = {UDM_OK, this->getMpiRankno(), 0};
+    UdmSize_t num_nodes = 0;
+    int n;
+
+    for (n=1; n<= this->getNumZones(); n++) {
+        num_nodes += this->getZone(n)->getNumNodes();
+    }
+    if (num_nodes > 0) {
+        error = archive.packZones(this->zones, write_constsolutions);
+        if (error == UDM_OK) {
+            header[2] = archive.getBufferSize();
+        }
+        else {
+            archive.clear();
+        }
+    }
+    header[0] = error;
+
+    udm_mpi_send(header, 3, MPI_LONG_LONG, 0, UDM_CGNS_GATHER_HEADER_TAG, gather_comm);
+    size_t offset = 0;
+    while (offset < (size_t)header[2]) {
+        size_t size = (size_t)header[2] - offset;
+        if (size > UDM_CGNS_GATHER_MAXSIZE) size = UDM_CGNS_GATHER_MAXSIZE;
+        udm_mpi_send(archive.getBuffer() + offset, (int)size, MPI_BYTE, 0, UDM_CGNS_GATHER_CHUNK_TAG, gather_comm);
+        offset += size;
+    }
+
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    return UDM_OK;
+}
+
+/**
+ * 集約CGNSファイル出力の送信元ランクの出力データの受信を開始する.
+ * @param [in] gather_comm        集約出力のMPIコミュニケータ
+ * @param [in] src_rankno        送信元ランク番号(gather_comm)
+ * @param [in] header        送信元ランクのヘッダ : [0]=エラー番号, [1]=ランク番号, [2]=出力データサイズ(byte)
+ * @param [out] archive        受信アーカイブ
+ * @param [out] requests        通信リクエスト
+ */
+void UdmModel::postRecvCgnsGatherData(
+                        const MPI_Comm &gather_comm,
+                        int src_rankno,
+                        const long long *header,
+                        UdmCgnsGatherArchive &archive,
+                        std::vector<MPI_Request> &requests)
+{
+    requests.clear();
+    if (header[2] <= 0) return;
+
+    archive.resizeBuffer((size_t)header[2]);
+    size_t offset = 0;
+    while (offset < (size_t)header[2]) {
+        size_t size = (size_t)header[2] - offset;
+        if (size > UDM_CGNS_GATHER_MAXSIZE) size = UDM_CGNS_GATHER_MAXSIZE;
+        requests.push_back(MPI_REQUEST_NULL);
+        udm_mpi_irecv(archive.getBuffer() + offset, (int)size, MPI_BYTE, src_rankno, UDM_CGNS_GATHER_CHUNK_TAG, gather_comm, &requests.back());
+        offset += size;
+    }
+}
+
 /**
  * index.dfiファイルを出力する.
  * @return        エラー番号 : UDM_OK | UDM_ERROR
@@ -2156,6 +2956,19 @@ UdmError_t UdmModel::writeDfi()
         if (error != UDM_OK) {
             return UDM_ERRORNO_HANDLER(error);
         }
+
+        // 集約CGNSファイル出力 : ランク別の集約ランク番号をランク番号０に収集する.
+        if (this->getConfigFileinfo()->isFileAggregate()) {
+            int process_size = this->getMpiProcessSize();
+            int *file_ranks = new int[process_size];
+            memset(file_ranks, 0x00, process_size*sizeof(int));
+            int send_buf = this->aggregate_rankno;
+            udm_mpi_gather(&send_buf, 1, MPI_INT, file_ranks, 1, MPI_INT, 0, this->getMpiComm());
+            if (this->getMpiRankno() == 0) {
+                this->config->setProcessFileRanks(process_size, file_ranks);
+            }
+            delete []file_ranks;
+        }
     }
 
     // ランク０のみが出力する.
@@ -2182,6 +2995,15 @@ UdmError_t UdmModel::initializeCgnsFile(const char* cgns_filename)
 {
     int open_mode = CG_MODE_WRITE;        // modes for cgns file
     int index_file;
+    char dirname[UDM_PATH_MAX] = {0x00};
+
+    // 出力ディレクトリを作成する : プロセスディレクトリはランク毎に作成する.
+    udm_get_dirname(cgns_filename, dirname);
+    if (strlen(dirname) > 0) {
+        if (udm_make_directories(dirname) != 0) {
+            return UDM_ERROR_HANDLER(UDM_ERROR, "make directory(%s).", dirname);
+        }
+    }
 
     // CGNSファイル:open
     if (cg_open(cgns_filename, open_mode, &index_file) != CG_OK) {
@@ -2262,6 +3084,13 @@ UdmError_t UdmModel::writeVirtualCells(const char* cgns_filename)
 {
     int index_file,index_base;
     int n;
+    UdmError_t error = UDM_OK;
+
+    // 非同期出力の完了を待つ
+    error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
 
     // ゾーン出力前の初期化を行う。
     for (n=1; n<= this->getNumZones(); n++) {
@@ -2331,6 +3160,89 @@ UdmError_t UdmModel::transferVirtualCells()
     return UDM_OK;
 }
 
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量交換計画を作成する.
+ * transferVirtualCells後に全ランクで実行する.
+ * 作成した交換計画は節点（ノード）, 要素（セル）の構成が変更されるまで再利用する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::createHaloExchange()
+{
+    int n;
+    UdmError_t error = UDM_OK;
+    for (n=1; n<= this->getNumZones(); n++) {
+        UdmZone* zone = this->getZone(n);
+        error = zone->createHaloExchange();
+        if (error != UDM_OK) {
+            return UDM_ERRORNO_HANDLER(error);
+        }
+    }
+    return UDM_OK;
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量の送受信を開始する.
+ * finishHaloExchangeまでの間は送受信と計算処理を並行して行うことができる.
+ * 全ランクで同一の物理量名称リストにて実行すること.
+ * @param field_names        送受信物理量名称リスト
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::startHaloExchange(const std::vector<std::string> &field_names)
+{
+    int n;
+    UdmError_t error = UDM_OK;
+    for (n=1; n<= this->getNumZones(); n++) {
+        UdmZone* zone = this->getZone(n);
+        error = zone->startHaloExchange(field_names);
+        if (error != UDM_OK) {
+            return UDM_ERRORNO_HANDLER(error);
+        }
+    }
+    return UDM_OK;
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量の受信完了を待って、物理量を設定する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::finishHaloExchange()
+{
+    int n;
+    UdmError_t error = UDM_OK;
+    for (n=1; n<= this->getNumZones(); n++) {
+        UdmZone* zone = this->getZone(n);
+        error = zone->finishHaloExchange();
+        if (error != UDM_OK) {
+            return UDM_ERRORNO_HANDLER(error);
+        }
+    }
+    return UDM_OK;
+}
+
+/**
+ * 複数ランクで共有される内部境界節点（ノード）の物理量を接続ランク間で集約する.
+ * 集約演算は総和, 最小値, 最大値, 実体ランク（共有ランクの最小ランク番号）の値とする.
+ * 全ランクで同一の物理量名称リスト, 集約演算タイプにて実行すること.
+ * @param field_names        集約物理量名称リスト : 節点（ノード）物理量
+ * @param reduce_type        集約演算タイプ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmModel::reduceBoundaryNodes(
+                const std::vector<std::string> &field_names,
+                UdmReduceType_t reduce_type)
+{
+    int n;
+    UdmError_t error = UDM_OK;
+    for (n=1; n<= this->getNumZones(); n++) {
+        UdmZone* zone = this->getZone(n);
+        error = zone->reduceBoundaryNodes(field_names, reduce_type);
+        if (error != UDM_OK) {
+            return UDM_ERRORNO_HANDLER(error);
+        }
+    }
+    return UDM_OK;
+}
+
 /**
  * 内部CGNSデータの検証を行う.
  * @return        true=検証OK
@@ -2394,7 +3306,12 @@ UdmError_t UdmModel::partitionZone(int zone_id)
     if (zone == NULL) {
         return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmZone is null[zone_id=%d].", zone_id);
     }
-    UdmError_t error = this->partition->partitionZone(zone);
+    // 非同期出力の完了を待つ
+    UdmError_t error = this->waitModelAsync();
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    error = this->partition->partitionZone(zone);
 
     return error;
 }
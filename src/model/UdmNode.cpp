@@ -26,7 +26,7 @@ namespace udm
 /**
  * コンストラクタ
  */
-UdmNode::UdmNode() : coords(NULL), parent_gridcoordinates(NULL), common_node(NULL)
+UdmNode::UdmNode() : coords(NULL), coords_slot(0), parent_gridcoordinates(NULL), common_node(NULL)
 {
     this->initialize();
 }
@@ -37,7 +37,7 @@ UdmNode::UdmNode() : coords(NULL), parent_gridcoordinates(NULL), common_node(NUL
  * @param y        Y座標
  * @param z        Z座標
  */
-UdmNode::UdmNode(double x, double y, double z) : coords(NULL), parent_gridcoordinates(NULL), common_node(NULL)
+UdmNode::UdmNode(double x, double y, double z) : coords(NULL), coords_slot(0), parent_gridcoordinates(NULL), common_node(NULL)
 {
     this->initialize();
     this->setCoords(x, y, z);
@@ -50,7 +50,7 @@ UdmNode::UdmNode(double x, double y, double z) : coords(NULL), parent_gridcoordi
  * @param y        Y座標
  * @param z        Z座標
  */
-UdmNode::UdmNode(float x, float y, float z) : coords(NULL), parent_gridcoordinates(NULL), common_node(NULL)
+UdmNode::UdmNode(float x, float y, float z) : coords(NULL), coords_slot(0), parent_gridcoordinates(NULL), common_node(NULL)
 {
     this->initialize();
     this->setCoords(x, y, z);
@@ -65,6 +65,10 @@ UdmNode::~UdmNode()
     this->removeReferencedNode();
     this->parent_cells.clear();
 
+    // 親GridCoordinatesのXYZ座標値スロットを解放する.
+    if (this->hasCoordsSlot()) {
+        this->parent_gridcoordinates->releaseCoordsSlot(this->coords_slot);
+    }
     if (this->coords != NULL) delete this->coords;
     this->coords = NULL;
     this->common_node = NULL;
@@ -82,6 +86,10 @@ UdmNode::~UdmNode()
  */
 UdmError_t UdmNode::getCoords(double& x, double& y, double& z) const
 {
+    if (this->hasCoordsSlot()) {
+        this->parent_gridcoordinates->coords_array.getCoords<double>(this->coords_slot, x, y, z);
+        return UDM_OK;
+    }
     if (this->coords == NULL) return UDM_ERROR;
     this->coords->getCoords<double>(x, y, z);
     return UDM_OK;
@@ -96,6 +104,10 @@ UdmError_t UdmNode::getCoords(double& x, double& y, double& z) const
  */
 UdmError_t UdmNode::getCoords(float& x, float& y, float& z) const
 {
+    if (this->hasCoordsSlot()) {
+        this->parent_gridcoordinates->coords_array.getCoords<float>(this->coords_slot, x, y, z);
+        return UDM_OK;
+    }
     if (this->coords == NULL) return UDM_ERROR;
     this->coords->getCoords<float>(x, y, z);
     return UDM_OK;
@@ -111,6 +123,10 @@ UdmError_t UdmNode::getCoords(float& x, float& y, float& z) const
  */
 UdmError_t UdmNode::setCoords(double x, double y, double z)
 {
+    if (this->hasCoordsSlot()) {
+        this->parent_gridcoordinates->coords_array.setCoords<double>(this->coords_slot, x, y, z);
+        return UDM_OK;
+    }
     if (this->coords == NULL) {
         this->coords = UdmCoordsValue::factoryCoordsValue(Udm_RealDouble);
     }
@@ -127,6 +143,10 @@ UdmError_t UdmNode::setCoords(double x, double y, double z)
  */
 UdmError_t UdmNode::setCoords(float x, float y, float z)
 {
+    if (this->hasCoordsSlot()) {
+        this->parent_gridcoordinates->coords_array.setCoords<float>(this->coords_slot, x, y, z);
+        return UDM_OK;
+    }
     if (this->coords == NULL) {
         this->coords = UdmCoordsValue::factoryCoordsValue(Udm_RealSingle);
     }
@@ -141,6 +161,7 @@ UdmError_t UdmNode::setCoords(float x, float y, float z)
 void UdmNode::initialize()
 {
     this->coords = NULL;
+    this->coords_slot = 0;
     // 要素形状タイプ=NODE
     this->setElementType(Udm_NODE);
     this->parent_gridcoordinates = NULL;
@@ -160,11 +181,81 @@ UdmGridCoordinates* UdmNode::getParentGridcoordinates() const
 
 /**
  * 親GridCoordinatesを設定する.
+ * XYZ座標値は親GridCoordinatesのXYZ座標値配列に移動する.
  * @param parent_gridcoordinates        親GridCoordinates
  */
 void UdmNode::setParentGridcoordinates(UdmGridCoordinates* parent_gridcoordinates)
 {
-    this->parent_gridcoordinates = parent_gridcoordinates;
+    if (this->parent_gridcoordinates != parent_gridcoordinates) {
+        this->detachCoordsSlot();
+        this->parent_gridcoordinates = parent_gridcoordinates;
+        this->attachCoordsSlot();
+    }
+    this->updateSolutionVoxels();
+}
+
+/**
+ * 親GridCoordinatesのXYZ座標値スロットを使用しているかチェックする.
+ * @return        true=XYZ座標値スロットを使用している
+ */
+bool UdmNode::hasCoordsSlot() const
+{
+    return (this->parent_gridcoordinates != NULL);
+}
+
+/**
+ * XYZ座標値のデータ型を取得する.
+ * @return        XYZ座標値データ型 : XYZ座標値が未設定の場合はUdm_DataTypeUnknown
+ */
+UdmDataType_t UdmNode::getCoordsDataType() const
+{
+    if (this->hasCoordsSlot()) {
+        return this->parent_gridcoordinates->coords_array.getDataType();
+    }
+    if (this->coords == NULL) return Udm_DataTypeUnknown;
+    return this->coords->getDataType();
+}
+
+/**
+ * 親GridCoordinatesのXYZ座標値スロットを確保して、XYZ座標値を移動する.
+ * XYZ座標値が未設定の場合は、０を設定する.
+ */
+void UdmNode::attachCoordsSlot()
+{
+    if (this->parent_gridcoordinates == NULL) return;
+
+    double x = 0.0, y = 0.0, z = 0.0;
+    UdmDataType_t datatype = this->parent_gridcoordinates->getDataType();
+    if (this->coords != NULL) {
+        datatype = this->coords->getDataType();
+        this->coords->getCoords<double>(x, y, z);
+        delete this->coords;
+        this->coords = NULL;
+    }
+    this->coords_slot = this->parent_gridcoordinates->allocateCoordsSlot(datatype);
+    this->parent_gridcoordinates->coords_array.setCoords<double>(this->coords_slot, x, y, z);
+
+    return;
+}
+
+/**
+ * 親GridCoordinatesのXYZ座標値スロットを解放して、XYZ座標値を節点（ノード）に移動する.
+ */
+void UdmNode::detachCoordsSlot()
+{
+    if (!this->hasCoordsSlot()) return;
+
+    double x, y, z;
+    const UdmCoordsArray &coords_array = this->parent_gridcoordinates->coords_array;
+    coords_array.getCoords<double>(this->coords_slot, x, y, z);
+    if (this->coords != NULL) delete this->coords;
+    this->coords = UdmCoordsValue::factoryCoordsValue(coords_array.getDataType());
+    this->coords->setCoords<double>(x, y, z);
+
+    this->parent_gridcoordinates->releaseCoordsSlot(this->coords_slot);
+    this->coords_slot = 0;
+
+    return;
 }
 
 /**
@@ -178,9 +269,19 @@ void UdmNode::setParentGridcoordinates(UdmGridCoordinates* parent_gridcoordinate
  */
 int UdmNode::compareCoords(const UdmNode &right ) const
 {
-    if (this->coords == NULL) return -1;
-    if (right.coords == NULL) return -1;
-    return this->coords->compareCoords(*right.coords);
+    double this_x, this_y, this_z;
+    double right_x, right_y, right_z;
+    if (this->getCoords(this_x, this_y, this_z) != UDM_OK) return -1;
+    if (right.getCoords(right_x, right_y, right_z) != UDM_OK) return -1;
+
+    if (this_z < right_z) return -1;
+    else if (this_z > right_z) return 1;
+    if (this_y < right_y) return -1;
+    else if (this_y > right_y) return 1;
+    if (this_x < right_x) return -1;
+    else if (this_x > right_x) return 1;
+
+    return 0;
 }
 
 /**
@@ -193,6 +294,15 @@ UdmZone* UdmNode::getZone() const
     return this->parent_gridcoordinates->getParentZone();
 }
 
+/**
+ * 物理量データを格納する親ノード・要素構成クラスを取得する.
+ * @return        親GridCoordinates
+ */
+UdmEntityVoxels* UdmNode::getParentVoxels() const
+{
+    return this->parent_gridcoordinates;
+}
+
 
 /**
  * 座標値を文字列として出力する.
@@ -201,10 +311,9 @@ UdmZone* UdmNode::getZone() const
 void UdmNode::toString(std::string &buf) const
 {
     char tmp[128];
-    sprintf(tmp, "x,y,z = %e,%e,%e",
-            this->coords->getCoordinateX<float>(),
-            this->coords->getCoordinateY<float>(),
-            this->coords->getCoordinateZ<float>());
+    float x = 0.0, y = 0.0, z = 0.0;
+    this->getCoords(x, y, z);
+    sprintf(tmp, "x,y,z = %e,%e,%e", x, y, z);
     buf += tmp;
 
     if (this->getNumPreviousRankInfos() > 0) {
@@ -229,7 +338,29 @@ void UdmNode::toString(std::string &buf) const
  */
 UdmSerializeArchive& UdmNode::serialize(UdmSerializeArchive& archive) const
 {
-    if (this->getId() > 0 && this->coords != NULL) {
+    if (this->getId() > 0 && this->hasCoordsSlot()) {
+        // ID
+        archive << this->getId();
+
+        // UdmEntity
+        UdmEntity::serialize(archive);
+
+        // XYZ座標値 : 親GridCoordinatesのXYZ座標値配列
+        // UdmCoordsValueのシリアライズと同一形式とする. : データ型, X, Y, Z
+        UdmDataType_t datatype = this->getCoordsDataType();
+        archive << datatype;
+        if (datatype == Udm_RealDouble) {
+            double x, y, z;
+            this->getCoords(x, y, z);
+            archive << x << y << z;
+        }
+        else {
+            float x, y, z;
+            this->getCoords(x, y, z);
+            archive << x << y << z;
+        }
+    }
+    else if (this->getId() > 0 && this->coords != NULL) {
         // ID
         archive << this->getId();
 
@@ -317,8 +448,8 @@ UdmError_t UdmNode::cloneNode(const UdmNode& src)
     // 物理量データのコピー
     UdmEntity::cloneEntity(src);
 
-    if (src.coords == NULL) return UDM_ERROR;
-    UdmDataType_t src_datatype = src.coords->getDataType();
+    UdmDataType_t src_datatype = src.getCoordsDataType();
+    if (src_datatype == Udm_DataTypeUnknown) return UDM_ERROR;
     if (src_datatype == Udm_RealDouble) {
         double x, y, z;
         src.getCoords(x, y, z);
@@ -422,8 +553,8 @@ void UdmNode::setCommonNode(UdmNode* node)
 UdmSize_t UdmNode::getNumConnectivityCells() const
 {
     UdmScannerCells scanner;
-    scanner.scannerParents(this);
-    UdmSize_t num_cells = scanner.scannerParents(this);
+    std::vector<UdmEntity*> cell_array;
+    UdmSize_t num_cells = scanner.getParentCells(this, cell_array);
     return num_cells;
 }
 
@@ -436,11 +567,9 @@ UdmSize_t UdmNode::getNumConnectivityCells() const
 UdmCell* UdmNode::getConnectivityCell(int connectivity_id) const
 {
     UdmScannerCells scanner;
-    UdmSize_t num_cells = scanner.scannerParents(this);
+    std::vector<UdmEntity*> cell_array;
+    UdmSize_t num_cells = scanner.getParentCells(this, cell_array);
     if (num_cells <= 0) return NULL;
-    const std::vector<std::vector<UdmEntity*> > scan_array = scanner.getScanArrays();
-    if (scan_array.size() <= 0) return NULL;
-    std::vector<UdmEntity*> cell_array = scan_array[0];
 
     if (connectivity_id <= 0) return NULL;
     if (connectivity_id > cell_array.size()) return NULL;
@@ -466,14 +595,11 @@ UdmSize_t UdmNode::getNumNeighborNodes() const
  */
 UdmNode* UdmNode::getNeighborNode(int neighbor_id) const
 {
+    if (neighbor_id <= 0) return NULL;
     UdmScannerCells scanner;
-    UdmSize_t num_nodes = scanner.scannerNeighborNodes(this);
-    if (num_nodes <= 0) return 0;
-    const std::vector<std::vector<UdmEntity*> > scan_array = scanner.getScanArrays();
-    if (scan_array.size() <= 0) return 0;
-    std::vector<UdmEntity*> node_array = scan_array[0];
+    std::vector<UdmEntity*> node_array;
+    scanner.getNeighborNodes(this, node_array);
 
-    if (neighbor_id <= 0) return NULL;
     if (neighbor_id > node_array.size()) return NULL;
     return static_cast<UdmNode*>(node_array[neighbor_id-1]);
 }
@@ -598,13 +724,20 @@ size_t UdmNode::getMemSize() const
 {
     UdmSize_t size = sizeof(*this);
 #ifdef _DEBUG
-    size_t coords_memseize = this->coords->getMemSize();
+    size_t coords_memseize = 0;
+    if (this->coords != NULL) {
+        coords_memseize = this->coords->getMemSize();
+    }
+    else if (this->hasCoordsSlot()) {
+        coords_memseize = 3*this->sizeofDataType(this->getCoordsDataType());
+    }
 
     printf("UdmEntity size=%ld\n", UdmEntity::getMemSize());
     printf("this size=%ld\n", sizeof(*this));
     if (this->coords != NULL) {
         printf("coords size=%ld [offset=%ld]\n", this->coords->getMemSize(), offsetof(UdmNode, coords));
     }
+    printf("coords_slot size=%ld [offset=%ld]\n", sizeof(this->coords_slot), offsetof(UdmNode, coords_slot));
     printf("parent_gridcoordinates pointer size=%ld [offset=%ld]\n", sizeof(this->parent_gridcoordinates), offsetof(UdmNode, parent_gridcoordinates));
     printf("common_node common_node size=%ld [offset=%ld]\n", sizeof(this->common_node), offsetof(UdmNode, common_node));
 
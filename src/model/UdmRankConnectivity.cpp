@@ -53,6 +53,14 @@ UdmRankConnectivity::UdmRankConnectivity(UdmZone *parent_zone)
 UdmRankConnectivity::~UdmRankConnectivity()
 {
     this->boundary_nodes.clear();
+
+    // 送信データ数送受信用の複製MPIコミュニケータの解放 : MPI終了後は解放しない.
+    if (this->exchange_communicator != MPI_COMM_NULL) {
+        int finalized = 0;
+        udm_mpi_finalized(&finalized);
+        if (!finalized) udm_mpi_comm_free(&this->exchange_communicator);
+        this->exchange_communicator = MPI_COMM_NULL;
+    }
 }
 
 /**
@@ -61,7 +69,10 @@ UdmRankConnectivity::~UdmRankConnectivity()
 void UdmRankConnectivity::initialize(void)
 {
     this->boundary_nodes.clear();
-    this->search_table.clear();
+    this->search_table.clearSearchTable();
+    this->exchange_communicator = MPI_COMM_NULL;
+    this->exchange_epoch = 0;
+    this->cgns_rankinfos.clear();
 }
 
 /**
@@ -224,7 +235,7 @@ UdmNode* UdmRankConnectivity::findMpiRankInfo(int rankno, UdmSize_t localid) con
     if (localid <= 0) return NULL;
 #if 0
     if (this->search_table.size() > 0) {
-        UdmEntity *search_node = this->search_table.getReferenceEntity(rankno, localid);
+        UdmEntity *search_node = this->search_table.findMpiRankInfo(rankno, localid);
         UdmEntity *find_node = UdmNode::findMpiRankInfo(this->boundary_nodes, rankno, localid);
         if (search_node != find_node) {
             UdmSize_t search_id = 0;
@@ -246,8 +257,7 @@ UdmNode* UdmRankConnectivity::findMpiRankInfo(int rankno, UdmSize_t localid) con
 #endif
 
     if (this->search_table.size() > 0) {
-        UdmEntity *node = this->search_table.getReferenceEntity(rankno, localid);
-        return (UdmNode*)node;
+        return this->search_table.findMpiRankInfo(rankno, localid);
     }
     else {
         return UdmNode::findMpiRankInfo(this->boundary_nodes, rankno, localid);
@@ -303,14 +313,7 @@ UdmError_t UdmRankConnectivity::migrationBoundary()
     UdmError_t error = UDM_OK;
     // 内部境界数を送受信する
     MPI_Comm comm = this->getMpiComm();
-    int num_process = this->getMpiProcessSize();
     int my_rankno = this->getMpiRankno();
-    // int num_sends[num_process];
-    // int num_recvs[num_process];
-    int *num_sends = new int[num_process];
-    int *num_recvs = new int[num_process];
-    memset(num_sends, 0x00, num_process*sizeof(int));
-    memset(num_recvs, 0x00, num_process*sizeof(int));
 
 
 #ifdef _DEBUG_TRACE
@@ -373,7 +376,6 @@ UdmError_t UdmRankConnectivity::migrationBoundary()
     // ID変更情報を送信する.
     error = this->mpi_sendrecvBoundaryInfos(send_infos, recv_infos);
     if (error != UDM_OK) {
-        delete []num_sends; delete []num_recvs;
         return UDM_ERRORNO_HANDLER(error);
     }
 
@@ -440,7 +442,6 @@ UdmError_t UdmRankConnectivity::migrationBoundary()
         if (rank_infos != NULL) delete rank_infos;
     }
 
-    delete []num_sends; delete []num_recvs;
     return UDM_OK;
 }
 
@@ -613,6 +614,7 @@ void UdmRankConnectivity::addReieveMpiRankInfo(
     std::map<int, UdmGlobalRankidPairList* >::const_iterator infos_itr;
     int recv_rankno;
     UdmSize_t recv_localid;
+    std::vector<UdmNode*> update_nodes;
 
     // 自分の内部境界節点（ノード）の内、受信した節点（ノード）を検索する
     for (infos_itr=recv_infos.begin(); infos_itr!=recv_infos.end(); infos_itr++) {
@@ -624,12 +626,18 @@ void UdmRankConnectivity::addReieveMpiRankInfo(
             recv_localid = recv_itr->getSrcLocalid();
             UdmNode *node = this->findMpiRankInfo(recv_rankno, recv_localid);
             if (node != NULL) {
-                UdmSize_t node_id = node->getId();
-                node->addMpiRankInfo(recv_itr->getSrcRankno(), recv_itr->getSrcLocalid());
+                node->appendMpiRankInfo(recv_itr->getSrcRankno(), recv_itr->getSrcLocalid());
+                update_nodes.push_back(node);
             }
         }
     }
 
+    // 追加したMPIランク番号のソート、重複削除を行う.
+    std::vector<UdmNode*>::iterator node_itr;
+    for (node_itr=update_nodes.begin(); node_itr!=update_nodes.end(); node_itr++) {
+        (*node_itr)->finalizeMpiRankInfos();
+    }
+
     return;
 }
 
@@ -643,8 +651,10 @@ void UdmRankConnectivity::eraseRankConnectivity()
 
 //    std::vector<UdmNode*>::reverse_iterator rev_itr;
 //    for (rev_itr=this->boundary_nodes.rbegin(); rev_itr!=this->boundary_nodes.rend(); rev_itr++) {
+    // 削除しない節点（ノード）を前詰めして、最後に一括削除する.
     std::vector<UdmNode*>::iterator itr;
-    for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); ) {
+    std::vector<UdmNode*>::iterator keep_itr = this->boundary_nodes.begin();
+    for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); itr++) {
         UdmNode *node = (*itr);
         UdmSize_t node_id = node->getId();
         int rankno = node->getMyRankno();
@@ -657,7 +667,6 @@ void UdmRankConnectivity::eraseRankConnectivity()
         node->removeMpiRankInfo(node->getMyRankno(), node->getId());
 
         if (node->getNumMpiRankInfos() <= 0) {
-            itr = this->boundary_nodes.erase( itr );
             this->removeSearchTable(node);
             continue;
         }
@@ -667,12 +676,13 @@ void UdmRankConnectivity::eraseRankConnectivity()
             // 内部境界情報のクリア
             node->clearMpiRankInfos();
             // 内部境界節点（ノード）ではないので削除する.
-            itr = this->boundary_nodes.erase( itr );
             this->removeSearchTable(node);
             continue;
         }
-        itr++;
+        *keep_itr = node;
+        keep_itr++;
     }
+    this->boundary_nodes.erase(keep_itr, this->boundary_nodes.end());
 
     return;
 }
@@ -755,14 +765,7 @@ UdmError_t UdmRankConnectivity::transferUpdatedIds()
     const int TRANS_IDS_SIZE = 4;
     UdmError_t error = UDM_OK;
     MPI_Comm comm = this->getMpiComm();
-    int num_process = this->getMpiProcessSize();
     int my_rankno = this->getMpiRankno();
-    // int num_sends[num_process];
-    // int num_recvs[num_process];
-    int *num_sends = new int[num_process];
-    int *num_recvs = new int[num_process];
-    memset(num_sends, 0x00, num_process*sizeof(int));
-    memset(num_recvs, 0x00, num_process*sizeof(int));
 
     // ランク番号別の変更ランク番号、IDを取得する
     int n, m, i;
@@ -804,7 +807,6 @@ UdmError_t UdmRankConnectivity::transferUpdatedIds()
     // ID変更情報を送信する.
     error = this->mpi_sendrecvBoundaryInfos(send_infos, recv_infos);
     if (error != UDM_OK) {
-        delete []num_sends; delete []num_recvs;
         return UDM_ERRORNO_HANDLER(error);
     }
 
@@ -852,7 +854,6 @@ UdmError_t UdmRankConnectivity::transferUpdatedIds()
         if (rank_infos != NULL) delete rank_infos;
     }
 
-    delete []num_sends; delete []num_recvs;
     return error;
 }
 
@@ -871,61 +872,58 @@ UdmError_t UdmRankConnectivity::transferVirtualCells(std::vector<UdmNode*>& impo
 
     UdmError_t error = UDM_OK;
     MPI_Comm comm = this->getMpiComm();
-    int num_process = this->getMpiProcessSize();
     int my_rankno = this->getMpiRankno();
-    // int num_sends[num_process][2];
-    // int num_recvs[num_process][2];
-    int *num_sends = new int[num_process*2];
-    int *num_recvs = new int[num_process*2];
-    memset(num_sends, 0x00, num_process*2*sizeof(int));
-    memset(num_recvs, 0x00, num_process*2*sizeof(int));
 
     // ランク番号別の内部境界要素（セル）を取得する
-    int i, n;
-    std::vector<UdmNode*>::iterator itr;
+    int n;
     std::map<int, std::vector<UdmCell*> > parent_cells;
-    for (n=0; n<num_process; n++) {
-        std::vector<UdmCell*> ids;
-        parent_cells.insert(std::make_pair(n, ids));
-    }
+    std::map<int, std::vector<UdmCell*> >::const_iterator cells_itr;
 
     // 内部境界節点（ノード）の親要素（セル）を探索する.
     this->createSendVirtualCells(parent_cells);
 
     // 送受信バッファサイズを取得する.
-    // int buf_sizes[num_process];
-    int *buf_sizes = new int[num_process];
-    memset(buf_sizes, 0x00, num_process*sizeof(int));
+    std::map<int, int> buf_sizes;
     this->getCellsBufferSize(parent_cells, buf_sizes);
 
-    // 要素（セル）送信数の取得
-    for (n=0; n<num_process; n++) {
-        // num_sends[n][0] = parent_cells[n].size();    // 送信要素（セル）数
-        // num_sends[n][1] = buf_sizes[n];                // バッファーサイズ
-        num_sends[n*2] = parent_cells[n].size();    // 送信要素（セル）数
-        num_sends[n*2+1] = buf_sizes[n];                // バッファーサイズ
+    // 要素（セル）送信数の取得 : 送信数 = {送信要素（セル）数, バッファーサイズ}
+    std::map<int, std::vector<int> > num_sends;
+    std::map<int, std::vector<int> > num_recvs;
+    std::map<int, std::vector<int> >::const_iterator num_itr;
+    for (cells_itr=parent_cells.begin(); cells_itr!=parent_cells.end(); cells_itr++) {
+        int rankno = cells_itr->first;
+        if (rankno == my_rankno) continue;
+        if (cells_itr->second.size() == 0) continue;
+        if (buf_sizes[rankno] == 0) continue;
+        std::vector<int> counts(2);
+        counts[0] = cells_itr->second.size();       // 送信要素（セル）数
+        counts[1] = buf_sizes[rankno];              // バッファーサイズ
+        num_sends.insert(std::make_pair(rankno, counts));
     }
 
 #ifdef _UDM_PROFILER
     udm_mpi_barrier(this->getMpiComm());
-    UDM_STOPWATCH_START("MPI_Alltoall");
+    UDM_STOPWATCH_START("mpi_exchangeSendCounts");
 #endif
 
-    // ランク番号別の送受信バッファサイズを送信する.
-    udm_mpi_alltoall(num_sends, 2, MPI_INT, num_recvs, 2, MPI_INT, comm);
+    // 接続先ランク番号別の送受信バッファサイズを送受信する.
+    error = this->mpi_exchangeSendCounts(num_sends, 2, num_recvs);
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
 
 #ifdef _UDM_PROFILER
-    UDM_STOPWATCH_STOP("MPI_Alltoall");
+    UDM_STOPWATCH_STOP("mpi_exchangeSendCounts");
 #endif
 
     // 送受信バッファー作成
     int send_size = 0, recv_size = 0;
     int send_pos = 0, recv_pos = 0;
-    for (n=0; n<num_process; n++) {
-        // send_size += num_sends[n][1];
-        // recv_size += num_recvs[n][1];
-        send_size += num_sends[n*2+1];
-        recv_size += num_recvs[n*2+1];
+    for (num_itr=num_sends.begin(); num_itr!=num_sends.end(); num_itr++) {
+        send_size += num_itr->second[1];
+    }
+    for (num_itr=num_recvs.begin(); num_itr!=num_recvs.end(); num_itr++) {
+        recv_size += num_itr->second[1];
     }
     char *send_buf = NULL;
     if (send_size > 0) {
@@ -939,17 +937,12 @@ UdmError_t UdmRankConnectivity::transferVirtualCells(std::vector<UdmNode*>& impo
     }
 
     // 送信データの作成
-    send_pos = 0, recv_size = 0;
-    for (n=0; n<num_process; n++) {
-        if (n == my_rankno) continue;
-        // if (num_sends[n][0] == 0) continue;
-        // if (num_sends[n][1] == 0) continue;
-        if (num_sends[n*2] == 0) continue;
-        if (num_sends[n*2+1] == 0) continue;
+    send_pos = 0;
+    for (num_itr=num_sends.begin(); num_itr!=num_sends.end(); num_itr++) {
         if (send_buf == NULL) continue;
-
-        // send_pos += this->createCellsBuffer(parent_cells[n], send_buf + send_pos, num_sends[n][1]);
-        send_pos += this->createCellsBuffer(parent_cells[n], send_buf + send_pos, num_sends[n*2+1]);
+        cells_itr = parent_cells.find(num_itr->first);
+        this->createCellsBuffer(cells_itr->second, send_buf + send_pos, num_itr->second[1]);
+        send_pos += num_itr->second[1];
     }
 
 #ifdef _UDM_PROFILER
@@ -957,42 +950,33 @@ UdmError_t UdmRankConnectivity::transferVirtualCells(std::vector<UdmNode*>& impo
     UDM_STOPWATCH_START("MPI_Isend-MPI_Irecv");
 #endif
 
-    // ランク番号別に要素（セル）を送信する.
-    MPI_Status   *send_status = new MPI_Status[num_process];
-    MPI_Status   *recv_status = new MPI_Status[num_process];
-    MPI_Request  *send_requests = new MPI_Request[num_process];
-    MPI_Request  *recv_requests = new MPI_Request[num_process];
-
-    send_pos = 0, recv_size = 0;
-    for (n=0; n<num_process; n++) {
+    // 接続先ランク番号別に要素（セル）を送受信する.
+    int num_send_ranks = num_sends.size();
+    int num_recv_ranks = num_recvs.size();
+    MPI_Status   *send_status = new MPI_Status[num_send_ranks+1];
+    MPI_Status   *recv_status = new MPI_Status[num_recv_ranks+1];
+    MPI_Request  *send_requests = new MPI_Request[num_send_ranks+1];
+    MPI_Request  *recv_requests = new MPI_Request[num_recv_ranks+1];
+
+    send_pos = 0;
+    n = 0;
+    for (num_itr=num_sends.begin(); num_itr!=num_sends.end(); num_itr++, n++) {
         send_requests[n] = MPI_REQUEST_NULL;
+        if (send_buf == NULL) continue;
+        udm_mpi_isend(send_buf + send_pos, num_itr->second[1], MPI_CHAR, num_itr->first, 0, comm, &send_requests[n]);
+        send_pos += num_itr->second[1];
+    }
+    recv_pos = 0;
+    n = 0;
+    for (num_itr=num_recvs.begin(); num_itr!=num_recvs.end(); num_itr++, n++) {
         recv_requests[n] = MPI_REQUEST_NULL;
-        if (n == my_rankno) continue;
-        // if (num_sends[n][0] > 0) {
-        if (num_sends[n*2] > 0) {
-            if (send_buf != NULL) {
-                // udm_mpi_isend(send_buf + send_pos, num_sends[n][1], MPI_CHAR, n, 0, comm, &send_requests[n]);
-                udm_mpi_isend(send_buf + send_pos, num_sends[n*2+1], MPI_CHAR, n, 0, comm, &send_requests[n]);
-            }
-        }
-
-        // if (num_recvs[n][0] > 0) {
-        if (num_recvs[n*2] > 0) {
-            if (recv_buf != NULL) {
-                // udm_mpi_irecv(recv_buf + recv_pos, num_recvs[n][1], MPI_CHAR, n, 0, comm, &recv_requests[n]);
-                udm_mpi_irecv(recv_buf + recv_pos, num_recvs[n*2+1], MPI_CHAR, n, 0, comm, &recv_requests[n]);
-            }
-        }
-
-        // 送受信バッファー位置
-        // send_pos += num_sends[n][1];
-        // recv_pos += num_recvs[n][1];
-        send_pos += num_sends[n*2+1];
-        recv_pos += num_recvs[n*2+1];
+        if (recv_buf == NULL) continue;
+        udm_mpi_irecv(recv_buf + recv_pos, num_itr->second[1], MPI_CHAR, num_itr->first, 0, comm, &recv_requests[n]);
+        recv_pos += num_itr->second[1];
     }
 
-    udm_mpi_waitall(num_process, send_requests, send_status);
-    udm_mpi_waitall(num_process, recv_requests, recv_status);
+    udm_mpi_waitall(num_send_ranks, send_requests, send_status);
+    udm_mpi_waitall(num_recv_ranks, recv_requests, recv_status);
 
 #ifdef _UDM_PROFILER
     UDM_STOPWATCH_STOP("MPI_Isend-MPI_Irecv");
@@ -1001,22 +985,17 @@ UdmError_t UdmRankConnectivity::transferVirtualCells(std::vector<UdmNode*>& impo
     // 受信データ
     recv_pos = 0;
     std::vector<UdmCell*> import_virtuals;
-    for (n=0; n<num_process; n++) {
-        if (n == my_rankno) continue;
-        // if (num_recvs[n][0] == 0) continue;
-        if (num_recvs[n*2] == 0) continue;
+    for (num_itr=num_recvs.begin(); num_itr!=num_recvs.end(); num_itr++) {
+        if (num_itr->second[0] == 0) continue;
         if (recv_buf == NULL) continue;
 
         // 仮想要素（セル）のデシリアライズを行い、仮想要素（セル）を生成する.
-        // error = this->createImportVirturalCells(num_recvs[n][0], recv_buf + recv_pos, num_recvs[n][1], import_virtuals);
-        error = this->createImportVirturalCells(num_recvs[n*2], recv_buf + recv_pos, num_recvs[n*2+1], import_virtuals);
+        error = this->createImportVirturalCells(num_itr->second[0], recv_buf + recv_pos, num_itr->second[1], import_virtuals);
         if (error != UDM_OK) {
-            delete []num_sends; delete []num_recvs;
-            delete []buf_sizes;
-            return UDM_ERRORNO_HANDLER(error);
+            UDM_ERRORNO_HANDLER(error);
+            break;
         }
-        // recv_pos += num_recvs[n][1];
-        recv_pos += num_recvs[n*2+1];
+        recv_pos += num_itr->second[1];
     }
 
     // 仮想要素（セル）の挿入
@@ -1040,13 +1019,11 @@ UdmError_t UdmRankConnectivity::transferVirtualCells(std::vector<UdmNode*>& impo
     if (recv_status != NULL) delete []recv_status;
     if (send_requests != NULL) delete []send_requests;
     if (recv_requests != NULL) delete []recv_requests;
-    delete []num_sends; delete []num_recvs;
-    delete []buf_sizes;
 
 #ifdef _UDM_PROFILER
     UDM_STOPWATCH_STOP(__FUNCTION__);
     char info[128] = {0x00};
-    sprintf(info, "send_size=%d,recv_size=%d", send_size, recv_size);
+    sprintf(info, "send_size=%d,recv_size=%d,send_ranks=%d,recv_ranks=%d", send_size, recv_size, num_send_ranks, num_recv_ranks);
     UDM_STOPWATCH_INFORMATION(__FUNCTION__, info);
 #endif
 
@@ -1114,7 +1091,12 @@ UdmError_t UdmRankConnectivity::updateMpiRankInfo(
         UdmNode* node = update_nodes[n];
         UdmGlobalRankidPair info;
         update_ids.getGlobalRankidPair(n+1, info);
-        node->updateMpiRankInfo(info.getDestRankno(), info.getDestLocalid(), info.getSrcRankno(), info.getSrcLocalid());
+        node->replaceMpiRankInfo(info.getDestRankno(), info.getDestLocalid(), info.getSrcRankno(), info.getSrcLocalid());
+    }
+
+    // 更新したMPIランク番号のソート、重複削除を行う.
+    for (n=0; n<update_size; n++) {
+        update_nodes[n]->finalizeMpiRankInfos();
     }
 
     return UDM_OK;
@@ -1234,16 +1216,11 @@ UdmError_t UdmRankConnectivity::readCgns(int index_file, int index_base, int ind
 UdmError_t UdmRankConnectivity::writeCgns(int index_file, int index_base, int index_zone)
 {
     cgsize_t user_dims[2];
-    int *info_array;
-    std::vector<UdmNode*>::iterator itr;
-    int n, num_mpiinfo;
-    int rankno;
-    UdmSize_t localid;
-    UdmGlobalRankidPairList mpi_infos;
-    std::vector<UdmGlobalRankidPair>::iterator info_itr;
+    std::vector<int> info_array;
 
     // 出力内部境界データのチェック
-    if (this->boundary_nodes.size() <= 0) {
+    this->createCgnsRankInfos(info_array);
+    if (info_array.size() <= 0) {
         return UDM_OK;
     }
 
@@ -1260,6 +1237,46 @@ UdmError_t UdmRankConnectivity::writeCgns(int index_file, int index_base, int in
         return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GOTO, "index_file=%d,index_base=%d,index_zone=%d", index_file, index_base, index_zone);
     }
 
+    // 出力データ数
+    user_dims[0] = 4;
+    user_dims[1] = info_array.size()/4;
+
+    // CGNS:DataArray[@name="RankConnectivity"]の作成 : cg_array_write
+    if (cg_array_write( UDM_CGNS_NAME_RANKCONNECTIVITY_ARRAY,
+            Integer,
+            2,
+            user_dims,
+            &info_array[0]) != CG_OK) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "failure : cg_array_write(%s)", UDM_CGNS_NAME_RANKCONNECTIVITY_ARRAY);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * CGNS出力内部境界情報を作成する.
+ * 出力データ={自ランク番号, ノードID, 接続先ランク番号, 接続先ID}の４要素を１組とする.
+ * CGNS出力内部境界情報が設定されている場合は設定値とする.
+ * @param [out] info_array        CGNS出力内部境界情報
+ */
+void UdmRankConnectivity::createCgnsRankInfos(std::vector<int> &info_array) const
+{
+    std::vector<UdmNode*>::const_iterator itr;
+    int n, num_mpiinfo;
+    int rankno;
+    UdmSize_t localid;
+    UdmGlobalRankidPairList mpi_infos;
+    std::vector<UdmGlobalRankidPair>::iterator info_itr;
+
+    info_array.clear();
+    if (this->cgns_rankinfos.size() > 0) {
+        info_array = this->cgns_rankinfos;
+        return;
+    }
+    if (this->boundary_nodes.size() <= 0) {
+        return;
+    }
+
     // 内部境界情報の取得
     UdmSize_t array_size = 0;
     for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); itr++) {
@@ -1278,37 +1295,28 @@ UdmError_t UdmRankConnectivity::writeCgns(int index_file, int index_base, int in
             mpi_infos.addGlobalRankidPair(info);
         }
     }
-    if (mpi_infos.size() <= 0) {
-        return UDM_OK;
-    }
-
-    // 出力データ数
-    user_dims[0] = 4;
-    user_dims[1] = mpi_infos.size();
-    info_array = new int[user_dims[0]*user_dims[1]];
-    memset(info_array, 0x00, user_dims[0]*user_dims[1]*sizeof(int));
 
     // 出力データ={ノードID,ランク番号,ローカル番号}
-    n=0;
+    info_array.reserve(mpi_infos.size()*4);
     for (info_itr=mpi_infos.begin(); info_itr!=mpi_infos.end(); info_itr++) {
-        UdmGlobalRankidPair  info = (*info_itr);
-        info_array[n++] = info.getSrcRankno();
-        info_array[n++] = info.getSrcLocalid();
-        info_array[n++] = info.getDestRankno();
-        info_array[n++] = info.getDestLocalid();
-    }
-    // CGNS:DataArray[@name="RankConnectivity"]の作成 : cg_array_write
-    if (cg_array_write( UDM_CGNS_NAME_RANKCONNECTIVITY_ARRAY,
-            Integer,
-            2,
-            user_dims,
-            info_array) != CG_OK) {
-        delete[] info_array;
-        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "failure : cg_array_write(%s)", UDM_CGNS_NAME_RANKCONNECTIVITY_ARRAY);
+        const UdmGlobalRankidPair &info = (*info_itr);
+        info_array.push_back(info.getSrcRankno());
+        info_array.push_back(info.getSrcLocalid());
+        info_array.push_back(info.getDestRankno());
+        info_array.push_back(info.getDestLocalid());
     }
 
-    delete[] info_array;
-    return UDM_OK;
+    return;
+}
+
+/**
+ * CGNS出力内部境界情報を設定する.
+ * 集約CGNSファイル出力にて、集約ランクが送信元ランクの内部境界情報を送信元ランク番号のまま出力する為に設定する.
+ * @param info_array        CGNS出力内部境界情報 : {自ランク番号, ノードID, 接続先ランク番号, 接続先ID}の４要素を１組とする.
+ */
+void UdmRankConnectivity::setCgnsRankInfos(const std::vector<int> &info_array)
+{
+    this->cgns_rankinfos = info_array;
 }
 
 /**
@@ -1331,9 +1339,9 @@ unsigned int UdmRankConnectivity::createSendVirtualCells(std::map<int, std::vect
     if (scan_cells.size() <= 0) return 0;
 
     int num_process = this->getMpiProcessSize();
-    // int rank_counter[num_process];
-    int *rank_counter = new int[num_process];
-    memset(rank_counter, 0x00, num_process*sizeof(int));
+    // 接続先ランク番号別の接続節点（ノード）数 : 要素（セル）の接続先ランクのみ
+    std::map<int, int> rank_counter;
+    std::map<int, int>::const_iterator counter_itr;
 
     // セル次元数
     int dimmension = this->getParentZone()->getCellDimension();
@@ -1349,7 +1357,7 @@ unsigned int UdmRankConnectivity::createSendVirtualCells(std::map<int, std::vect
 
         UdmSize_t cell_id = cell->getId();
         int cell_rankno = cell->getMyRankno();
-        memset(rank_counter, 0x00, num_process*sizeof(int));
+        rank_counter.clear();
         num_nodes = cell->getNumNodes();
         for (n=1; n<=num_nodes; n++) {
             UdmNode *node = cell->getNode(n);
@@ -1357,19 +1365,18 @@ unsigned int UdmRankConnectivity::createSendVirtualCells(std::map<int, std::vect
             if (num_mpi == 0) continue;
             for (i=1; i<=num_mpi; i++) {
                 node->getMpiRankInfo(i, rankno, localid);
-                if (rankno >= num_process) continue;
+                if (rankno < 0 || rankno >= num_process) continue;
                 rank_counter[rankno]++;
             }
         }
         // 3点で接している（面で接している）要素（セル）を取得する.
-        for (i=0; i<num_process; i++) {
-            if (rank_counter[i] >= dimmension) {
-                parent_cells[i].push_back(cell);
+        for (counter_itr=rank_counter.begin(); counter_itr!=rank_counter.end(); counter_itr++) {
+            if (counter_itr->second >= dimmension) {
+                parent_cells[counter_itr->first].push_back(cell);
                 found_count++;
             }
         }
     }
-    delete []rank_counter;
 
     return found_count;
 }
@@ -1382,7 +1389,7 @@ unsigned int UdmRankConnectivity::createSendVirtualCells(std::map<int, std::vect
  */
 unsigned int UdmRankConnectivity::getCellsBufferSize(
         const std::map<int, std::vector<UdmCell*> >& parent_cells,
-        int* buf_sizes) const
+        std::map<int, int>& buf_sizes) const
 {
     int total_size = 0;
     int num_process = this->getMpiProcessSize();
@@ -1768,12 +1775,17 @@ UdmError_t UdmRankConnectivity::transferRankConnectivity()
 
             UdmNode *node = this->findMpiRankInfo(mpi_rankno, mpi_localid);
             if (node != NULL) {
-                node->addMpiRankInfo(src_rankno, src_localid);
+                node->appendMpiRankInfo(src_rankno, src_localid);
                 this->insertRankConnectivityNode(node);
             }
         }
     }
 
+    // 追加したMPIランク番号のソート、重複削除を行う.
+    for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); itr++) {
+        (*itr)->finalizeMpiRankInfos();
+    }
+
     // 内部境界を挿入しなかった節点（ノード）を削除する。
     this->eraseRankConnectivity();
 
@@ -1814,19 +1826,13 @@ UdmError_t UdmRankConnectivity::transferRankConnectivity()
  */
 UdmError_t UdmRankConnectivity::mpi_sendrecvBoundaryInfos(
         const std::map< int, UdmGlobalRankidPairList* > &send_infos,
-        std::map< int, UdmGlobalRankidPairList* > &recv_infos) const
+        std::map< int, UdmGlobalRankidPairList* > &recv_infos)
 {
     const int TRANS_IDS_SIZE = 4;
+    UdmError_t error = UDM_OK;
     // 内部境界数を送受信する
     MPI_Comm comm = this->getMpiComm();
-    int num_process = this->getMpiProcessSize();
     int my_rankno = this->getMpiRankno();
-    // int num_sends[num_process];
-    // int num_recvs[num_process];
-    int *num_sends = new int[num_process];
-    int *num_recvs = new int[num_process];
-    memset(num_sends, 0x00, num_process*sizeof(int));
-    memset(num_recvs, 0x00, num_process*sizeof(int));
     int n, i;
     const UdmDfiConfig *config = this->getParentZone()->getDfiConfig();
 
@@ -1851,34 +1857,41 @@ UdmError_t UdmRankConnectivity::mpi_sendrecvBoundaryInfos(
         sendranks_info = send_infos;
     }
 
-    // 内部境界数の取得
+    // 内部境界数の取得 : 接続先ランクのみ
+    std::map<int, std::vector<int> > num_sends;
+    std::map<int, std::vector<int> > num_recvs;
+    std::map<int, std::vector<int> >::const_iterator num_itr;
     std::map< int, UdmGlobalRankidPairList* >::const_iterator find_itr;
-    for (n=0; n<num_process; n++) {
-        find_itr = sendranks_info.find(n);
-        if (find_itr != sendranks_info.end()) {
-            num_sends[n] = find_itr->second->size();
-        }
+    for (find_itr=sendranks_info.begin(); find_itr!=sendranks_info.end(); find_itr++) {
+        if (find_itr->first == my_rankno) continue;
+        if (find_itr->second == NULL) continue;
+        if (find_itr->second->size() == 0) continue;
+        num_sends.insert(std::make_pair(find_itr->first, std::vector<int>(1, (int)find_itr->second->size())));
     }
 
 #ifdef _UDM_PROFILER
     udm_mpi_barrier(this->getMpiComm());
-    UDM_STOPWATCH_START("MPI_Alltoall");
+    UDM_STOPWATCH_START("mpi_exchangeSendCounts");
 #endif
 
-    // ランク番号別の内部境界数を送信する.
-    udm_mpi_alltoall(num_sends, 1, MPI_INT, num_recvs, 1, MPI_INT, comm);
+    // 接続先ランク番号別の内部境界数を送受信する.
+    error = this->mpi_exchangeSendCounts(num_sends, 1, num_recvs);
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
 
 #ifdef _UDM_PROFILER
-    UDM_STOPWATCH_STOP("MPI_Alltoall");
+    UDM_STOPWATCH_STOP("mpi_exchangeSendCounts");
 #endif
 
     // 送受信バッファー作成
     UdmSize_t send_size = 0, recv_size = 0;
     UdmSize_t send_pos = 0, recv_pos = 0;
-    for (n=0; n<num_process; n++) {
-        if (n == my_rankno) continue;
-        send_size += num_sends[n]*TRANS_IDS_SIZE;
-        recv_size += num_recvs[n]*TRANS_IDS_SIZE;
+    for (num_itr=num_sends.begin(); num_itr!=num_sends.end(); num_itr++) {
+        send_size += num_itr->second[0]*TRANS_IDS_SIZE;
+    }
+    for (num_itr=num_recvs.begin(); num_itr!=num_recvs.end(); num_itr++) {
+        recv_size += num_itr->second[0]*TRANS_IDS_SIZE;
     }
     long long *send_buf = NULL;
     long long *recv_buf = NULL;
@@ -1899,12 +1912,10 @@ UdmError_t UdmRankConnectivity::mpi_sendrecvBoundaryInfos(
 #endif
 
     // 送信データの作成={自ランク番号,ID, 接続先ランク番号,ID}
-    send_pos = 0, recv_size = 0;
-    for (n=0; n<num_process; n++) {
-        if (n == my_rankno) continue;
-        if (num_sends[n] == 0) continue;
+    send_pos = 0;
+    for (num_itr=num_sends.begin(); num_itr!=num_sends.end(); num_itr++) {
         if (send_buf == NULL) continue;
-
+        n = num_itr->first;
         find_itr = sendranks_info.find(n);
         if (find_itr == sendranks_info.end()) continue;
         UdmGlobalRankidPairList* bnd_infos = find_itr->second;
@@ -1930,37 +1941,33 @@ UdmError_t UdmRankConnectivity::mpi_sendrecvBoundaryInfos(
     UDM_STOPWATCH_START("MPI_Isend-MPI_Irecv");
 #endif
 
-    // ランク番号別に内部境界情報を送信する.
-    MPI_Status   *send_status = new MPI_Status[num_process];
-    MPI_Status   *recv_status = new MPI_Status[num_process];
-    MPI_Request  *send_requests = new MPI_Request[num_process];
-    MPI_Request  *recv_requests = new MPI_Request[num_process];
-
-    send_pos = 0, recv_size = 0;
-    for (n=0; n<num_process; n++) {
-        send_requests[n] = MPI_REQUEST_NULL;
-        recv_requests[n] = MPI_REQUEST_NULL;
-        if (n == my_rankno) continue;
-
-        if (num_sends[n] > 0) {
-            if (send_buf != NULL) {
-                udm_mpi_isend(&send_buf[send_pos], num_sends[n]*TRANS_IDS_SIZE, MPI_LONG_LONG, n, 0, comm, &send_requests[n]);
-            }
-        }
-
-        if (num_recvs[n] > 0) {
-            if (recv_buf != NULL) {
-                udm_mpi_irecv(recv_buf + recv_pos, num_recvs[n]*TRANS_IDS_SIZE, MPI_LONG_LONG, n, 0, comm, &recv_requests[n]);
-            }
-        }
-
-        // 送受信バッファー位置
-        send_pos += num_sends[n]*TRANS_IDS_SIZE;
-        recv_pos += num_recvs[n]*TRANS_IDS_SIZE;
+    // 接続先ランク番号別に内部境界情報を送受信する.
+    int num_send_ranks = num_sends.size();
+    int num_recv_ranks = num_recvs.size();
+    MPI_Status   *send_status = new MPI_Status[num_send_ranks+1];
+    MPI_Status   *recv_status = new MPI_Status[num_recv_ranks+1];
+    MPI_Request  *send_requests = new MPI_Request[num_send_ranks+1];
+    MPI_Request  *recv_requests = new MPI_Request[num_recv_ranks+1];
+
+    send_pos = 0;
+    i = 0;
+    for (num_itr=num_sends.begin(); num_itr!=num_sends.end(); num_itr++, i++) {
+        send_requests[i] = MPI_REQUEST_NULL;
+        if (send_buf == NULL) continue;
+        udm_mpi_isend(&send_buf[send_pos], num_itr->second[0]*TRANS_IDS_SIZE, MPI_LONG_LONG, num_itr->first, 0, comm, &send_requests[i]);
+        send_pos += num_itr->second[0]*TRANS_IDS_SIZE;
+    }
+    recv_pos = 0;
+    i = 0;
+    for (num_itr=num_recvs.begin(); num_itr!=num_recvs.end(); num_itr++, i++) {
+        recv_requests[i] = MPI_REQUEST_NULL;
+        if (recv_buf == NULL) continue;
+        udm_mpi_irecv(recv_buf + recv_pos, num_itr->second[0]*TRANS_IDS_SIZE, MPI_LONG_LONG, num_itr->first, 0, comm, &recv_requests[i]);
+        recv_pos += num_itr->second[0]*TRANS_IDS_SIZE;
     }
 
-    udm_mpi_waitall(num_process, send_requests, send_status);
-    udm_mpi_waitall(num_process, recv_requests, recv_status);
+    udm_mpi_waitall(num_send_ranks, send_requests, send_status);
+    udm_mpi_waitall(num_recv_ranks, recv_requests, recv_status);
 
 #ifdef _UDM_PROFILER
     UDM_STOPWATCH_STOP("MPI_Isend-MPI_Irecv");
@@ -1973,17 +1980,18 @@ UdmError_t UdmRankConnectivity::mpi_sendrecvBoundaryInfos(
 #endif
     // 受信データ
     recv_pos = 0;
-    for (n=0; n<num_process; n++) {
-        if (n == my_rankno) continue;
-        if (num_recvs[n] == 0) continue;
+    for (num_itr=num_recvs.begin(); num_itr!=num_recvs.end(); num_itr++) {
         if (recv_buf == NULL) continue;
+        n = num_itr->first;
+        int num_recv_infos = num_itr->second[0];
+        if (num_recv_infos == 0) continue;
 
         if (recv_infos.find(n) == recv_infos.end()) {
-            UdmGlobalRankidPairList *ids = new UdmGlobalRankidPairList(num_recvs[n]);
+            UdmGlobalRankidPairList *ids = new UdmGlobalRankidPairList(num_recv_infos);
             recv_infos.insert(std::make_pair(n, ids));
         }
 
-        for (i=0; i<num_recvs[n]; i++) {
+        for (i=0; i<num_recv_infos; i++) {
             int recv_rankno = recv_buf[recv_pos++];
             UdmSize_t node_id = recv_buf[recv_pos++];
             int mpi_rankno = recv_buf[recv_pos++];
@@ -2009,7 +2017,125 @@ UdmError_t UdmRankConnectivity::mpi_sendrecvBoundaryInfos(
     if (recv_status != NULL) delete []recv_status;
     if (send_requests != NULL) delete []send_requests;
     if (recv_requests != NULL) delete []recv_requests;
+
+    return UDM_OK;
+}
+
+/**
+ * 接続先ランク番号別の送信データ数を送受信する.
+ * 全プロセス間のMPI_Alltoallは行わず、送信データの存在する接続先ランクとのみ通信を行う.
+ * 送信先ランクは受信側で既知ではない為、送信数は同期送信(MPI_Issend)し、
+ * 受信側は任意の送信元(MPI_ANY_SOURCE)からのメッセージをMPI_Iprobeにて検出する.
+ * 自ランクの同期送信がすべて受信された後にMPI_Ibarrierを開始し、
+ * MPI_Ibarrierが完了した時点で全ランクの送信数の受信が完了している.
+ * 他の送受信とメッセージが混在しないように、複製したMPIコミュニケータにて送受信する.
+ * 複製したMPIコミュニケータは初回の呼出時に作成し、以降の呼出では再利用する.
+ * MPI_Ibarrierを完了したランクは次の呼出の送信を開始するが、接続先ランクは前回の呼出の受信中である場合がある.
+ * 全ランクのMPI_Ibarrierの開始を待つ為、各ランクの呼出回数の差は１以内であり、送受信タグを呼出毎に交互に切り替えて区別する.
+ * MPI-2以前の場合は従来通りMPI_Alltoallにて送受信する.
+ * @param [in]  send_counts        送信先ランク番号別の送信データ数
+ * @param [in]  count_size        ランク当たりの送信データ数の要素数
+ * @param [out] recv_counts        送信元ランク番号別の受信データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmRankConnectivity::mpi_exchangeSendCounts(
+        const std::map< int, std::vector<int> > &send_counts,
+        int count_size,
+        std::map< int, std::vector<int> > &recv_counts)
+{
+    MPI_Comm comm = this->getMpiComm();
+    int num_process = this->getMpiProcessSize();
+    int my_rankno = this->getMpiRankno();
+    std::map< int, std::vector<int> >::const_iterator itr;
+    int n, i;
+
+    recv_counts.clear();
+    if (count_size <= 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "count_size=%d", count_size);
+    }
+
+#if defined(WITHOUT_MPI) || MPI_VERSION >= 3
+    // 送受信タグ : 呼出毎に交互に切り替える.
+    const int TAG_SENDCOUNTS = (int)(this->exchange_epoch % 2);
+    this->exchange_epoch++;
+    if (this->exchange_communicator == MPI_COMM_NULL) {
+        if (udm_mpi_comm_dup(comm, &this->exchange_communicator) != MPI_SUCCESS) {
+            this->exchange_communicator = MPI_COMM_NULL;
+            return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_MPI, "failure : MPI_Comm_dup");
+        }
+    }
+    MPI_Comm exchange_comm = this->exchange_communicator;
+
+    // 送信データ数の作成
+    std::vector<int> send_ranks;
+    std::vector<int> send_buf;
+    for (itr=send_counts.begin(); itr!=send_counts.end(); itr++) {
+        if (itr->first == my_rankno) continue;
+        if (itr->first < 0 || itr->first >= num_process) continue;
+        send_ranks.push_back(itr->first);
+        for (i=0; i<count_size; i++) {
+            send_buf.push_back(i < (int)itr->second.size() ? itr->second[i] : 0);
+        }
+    }
+    int num_sends = send_ranks.size();
+    std::vector<MPI_Request> send_requests(num_sends+1, MPI_REQUEST_NULL);
+    std::vector<MPI_Status> send_status(num_sends+1);
+    for (n=0; n<num_sends; n++) {
+        udm_mpi_issend(&send_buf[n*count_size], count_size, MPI_INT, send_ranks[n], TAG_SENDCOUNTS, exchange_comm, &send_requests[n]);
+    }
+
+    // 送信元ランクからの送信データ数の受信
+    std::vector<int> recv_buf(count_size, 0);
+    MPI_Request barrier_request = MPI_REQUEST_NULL;
+    MPI_Status status;
+    bool barrier_started = false;
+    int finished = 0;
+    while (!finished) {
+        int flag = 0;
+        udm_mpi_iprobe(MPI_ANY_SOURCE, TAG_SENDCOUNTS, exchange_comm, &flag, &status);
+        if (flag) {
+            int source = status.MPI_SOURCE;
+            udm_mpi_recv(&recv_buf[0], count_size, MPI_INT, source, TAG_SENDCOUNTS, exchange_comm, &status);
+            recv_counts[source] = recv_buf;
+        }
+        if (!barrier_started) {
+            // 自ランクの送信がすべて受信されたならばバリア同期を開始する.
+            int sent = 0;
+            udm_mpi_testall(num_sends, &send_requests[0], &sent, &send_status[0]);
+            if (sent) {
+                udm_mpi_ibarrier(exchange_comm, &barrier_request);
+                barrier_started = true;
+            }
+        }
+        else {
+            udm_mpi_test(&barrier_request, &finished, &status);
+        }
+    }
+#else
+    // MPI-2以前 : MPI_Alltoall
+    int *num_sends = new int[num_process*count_size];
+    int *num_recvs = new int[num_process*count_size];
+    memset(num_sends, 0x00, num_process*count_size*sizeof(int));
+    memset(num_recvs, 0x00, num_process*count_size*sizeof(int));
+    for (itr=send_counts.begin(); itr!=send_counts.end(); itr++) {
+        if (itr->first == my_rankno) continue;
+        if (itr->first < 0 || itr->first >= num_process) continue;
+        for (i=0; i<count_size && i<(int)itr->second.size(); i++) {
+            num_sends[itr->first*count_size+i] = itr->second[i];
+        }
+    }
+    udm_mpi_alltoall(num_sends, count_size, MPI_INT, num_recvs, count_size, MPI_INT, comm);
+    for (n=0; n<num_process; n++) {
+        if (n == my_rankno) continue;
+        bool exists = false;
+        for (i=0; i<count_size; i++) {
+            if (num_recvs[n*count_size+i] != 0) exists = true;
+        }
+        if (!exists) continue;
+        recv_counts[n] = std::vector<int>(num_recvs+n*count_size, num_recvs+(n+1)*count_size);
+    }
     delete []num_sends; delete []num_recvs;
+#endif
 
     return UDM_OK;
 }
@@ -2169,7 +2295,7 @@ UdmGridCoordinates* UdmRankConnectivity::getGridCoordinates() const
  * 内部境界情報をすべてのプロセスから収集行い、整合性、過不足な節点（ノード）が存在しているかチェックする.
  * @return        true=内部境界情報のチェックOK
  */
-bool UdmRankConnectivity::mpi_validateRankConnectivity() const
+bool UdmRankConnectivity::mpi_validateRankConnectivity()
 {
     UdmError_t error = UDM_OK;
     bool validate = true;
@@ -2389,28 +2515,7 @@ bool UdmRankConnectivity::isBoundaryNode(const UdmNode* node) const
  */
 void UdmRankConnectivity::addSearchTable(UdmNode* node)
 {
-    int n;
-    int len;
-    int rankno;
-    UdmSize_t localid;
-
-    // ランク番号、ID
-    this->search_table.addGlobalRankid(node->getMyRankno(), node->getId(), node);
-
-    // 以前のランク番号, ID
-    len = node->getNumPreviousRankInfos();
-    for (n=1; n<=len; n++) {
-        node->getPreviousRankInfo(n, rankno, localid);
-        this->search_table.addGlobalRankid(rankno, localid, node);
-    }
-
-    // MPI接続ランク番号, ID
-    len = node->getNumMpiRankInfos();
-    for (n=1; n<=len; n++) {
-        node->getMpiRankInfo(n, rankno, localid);
-        this->search_table.addGlobalRankid(rankno, localid, node);
-    }
-
+    this->search_table.addSearchTable(node);
     return;
 }
 
@@ -2420,30 +2525,7 @@ void UdmRankConnectivity::addSearchTable(UdmNode* node)
  */
 void UdmRankConnectivity::removeSearchTable(UdmNode* node)
 {
-    int rankno;
-    UdmSize_t localid;
-    int len;
-    int n;
-
-    // ランク番号、ID
-    rankno = node->getMyRankno();
-    localid = node->getId();
-    this->search_table.removeReferenceEntity(rankno, localid, node);
-
-    // 以前のランク番号, ID
-    len = node->getNumPreviousRankInfos();
-    for (n=1; n<=len; n++) {
-        node->getPreviousRankInfo(n, rankno, localid);
-        this->search_table.removeReferenceEntity(rankno, localid, node);
-    }
-
-    // MPI接続ランク番号, ID
-    len = node->getNumMpiRankInfos();
-    for (n=1; n<=len; n++) {
-        node->getMpiRankInfo(n, rankno, localid);
-        this->search_table.removeReferenceEntity(rankno, localid, node);
-    }
-
+    this->search_table.removeSearchTable(node);
     return;
 }
 
@@ -2453,7 +2535,7 @@ void UdmRankConnectivity::removeSearchTable(UdmNode* node)
 void UdmRankConnectivity::clearSearchTable()
 {
     // ランク番号,ID検索テーブルをクリアする
-    this->search_table.clear();
+    this->search_table.clearSearchTable();
 
     return;
 }
@@ -2467,10 +2549,7 @@ void UdmRankConnectivity::createSearchTable()
     this->clearSearchTable();
 
     // ランク番号、ID検索テーブルを作成する。
-    std::vector<UdmNode*>::iterator itr;
-    for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); itr++) {
-        this->addSearchTable(*itr);
-    }
+    this->search_table.createSearchTable(this->boundary_nodes);
 
     return;
 }
@@ -2485,8 +2564,14 @@ void UdmRankConnectivity::createSearchMpiRankidTable()
     int n, len;
     int rankno;
     UdmSize_t localid;
+    UdmSize_t size = 0;
     std::vector<UdmNode*>::const_iterator itr;
 
+    for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); itr++) {
+        size += (*itr)->getNumMpiRankInfos();
+    }
+    this->search_table.reserve(size);
+
     for (itr=this->boundary_nodes.begin(); itr!=this->boundary_nodes.end(); itr++) {
         UdmNode *node = *itr;
         // MPI接続ランク番号, ID
@@ -2495,7 +2580,7 @@ void UdmRankConnectivity::createSearchMpiRankidTable()
             node->getMpiRankInfo(n, rankno, localid);
             if (localid <= 0) continue;
             if (rankno < 0) continue;
-            this->search_table.addGlobalRankid(rankno, localid, node);
+            this->search_table.addRankid(rankno, localid, node);
         }
     }
 
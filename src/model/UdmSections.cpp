@@ -26,6 +26,11 @@
 #include "model/UdmRankConnectivity.h"
 #include "utils/UdmScannerCells.h"
 #include "utils/UdmSearchTable.h"
+#include "utils/UdmComponentTable.h"
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 
 namespace udm
@@ -69,6 +74,7 @@ void UdmSections::initialize()
     this->entity_cells.clear();
     this->virtual_cells.clear();
     this->component_cells.clear();
+    this->component_table = NULL;
     this->parent_zone = NULL;
 }
 
@@ -452,6 +458,7 @@ UdmError_t UdmSections::removeEntityCell(UdmSize_t cell_id)
         delete (*itr);
         rm_itr = this->entity_cells.begin() + (itr - this->entity_cells.begin());
         this->entity_cells.erase(rm_itr);
+        this->clearNeighborGraph();
         return UDM_OK;
     }
 
@@ -472,6 +479,7 @@ UdmError_t UdmSections::clearEntityCells()
         }
     }
     this->entity_cells.clear();
+    this->clearNeighborGraph();
     return UDM_OK;
 }
 
@@ -538,6 +546,8 @@ UdmSize_t UdmSections::insertVirtualCell(UdmCell* virtual_cell)
     // 要素管理クラスを設定
     virtual_cell->setParentSections(this);
     virtual_cell->setRealityType(Udm_Virtual);
+    // 隣接情報を破棄する.
+    this->clearNeighborGraph();
 
     return this->virtual_cells.size();
 }
@@ -555,6 +565,7 @@ UdmError_t UdmSections::removeVirtualCell(UdmSize_t virtual_cell_id)
     std::vector<UdmCell*>::iterator itr = this->virtual_cells.begin();
     std::advance( itr, virtual_cell_id-1 );            // イテレータの移動
     this->virtual_cells.erase(itr);
+    this->clearNeighborGraph();
 
     return UDM_OK;
 }
@@ -573,6 +584,7 @@ UdmError_t UdmSections::clearVirtualCells()
         }
     }
     this->virtual_cells.clear();
+    this->clearNeighborGraph();
 
     return UDM_OK;
 }
@@ -598,6 +610,17 @@ UdmError_t UdmSections::setParentZone(UdmZone* zone)
     return UDM_OK;
 }
 
+/**
+ * 親ゾーンの隣接要素（セル）、隣接節点（ノード）、接続要素（セル）を破棄する.
+ * 要素（セル）の追加、削除時に呼び出し、要素（セル）数が変わらない追加、削除でも再作成させる.
+ */
+void UdmSections::clearNeighborGraph()
+{
+    if (this->parent_zone != NULL) {
+        this->parent_zone->clearNeighborGraph();
+    }
+}
+
 /**
  * CGNSファイルからElements（要素接続情報）の読込みを行う.
  * @param index_file        CGNSファイルインデックス
@@ -635,28 +658,343 @@ UdmError_t UdmSections::readCgns(int index_file, int index_base, int index_zone)
 
 /**
  * 部品要素（セル）を作成する.
+ * 部品要素（セル）検索テーブルを作成して、同一構成節点（ノード）の部品要素（セル）を検索する.
  * @return        エラー番号 : UDM_OK | UDM_ERROR
  */
 UdmError_t UdmSections::createComponentCells()
 {
     UdmError_t error = UDM_OK;
     std::vector<UdmCell*>::iterator itr;
+
+#ifdef _OPENMP
+    // 複数スレッドで部品要素（セル）を作成する.
+    if (omp_get_max_threads() > 1) {
+        return this->createComponentCellsParallel(omp_get_max_threads());
+    }
+#endif
+
+    // 部品要素（セル）検索テーブルの作成 : 登録数は面数の概算とする.
+    if (this->component_table != NULL) delete this->component_table;
+    this->component_table = new UdmComponentTable();
+    this->component_table->reserve(this->component_cells.size()
+                        + (this->entity_cells.size() + this->virtual_cells.size())*3);
+    this->component_table->createComponentTable(this->component_cells);
+
     for (itr=this->entity_cells.begin(); itr!=this->entity_cells.end(); itr++) {
         UdmCell* cell = (*itr);
         if ((error = cell->createComponentCells()) != UDM_OK) {
-            return error;
+            break;
         }
     }
 
-    for (itr=this->virtual_cells.begin(); itr!=this->virtual_cells.end(); itr++) {
-        UdmCell* cell = (*itr);
-        if ((error = cell->createComponentCells()) != UDM_OK) {
-            return error;
+    if (error == UDM_OK) {
+        for (itr=this->virtual_cells.begin(); itr!=this->virtual_cells.end(); itr++) {
+            UdmCell* cell = (*itr);
+            if ((error = cell->createComponentCells()) != UDM_OK) {
+                break;
+            }
+        }
+    }
+
+    // 部品要素（セル）検索テーブルの破棄
+    delete this->component_table;
+    this->component_table = NULL;
+
+    return error;
+}
+
+/**
+ * 複数スレッドで部品要素（セル）を作成する.
+ * 要素（セル）毎の面の列挙、部品要素（セル）の生成、親要素（セル）の追加をスレッド並列に行う.
+ * 同一面の検索、節点（ノード）の親要素（セル）の追加は、ハッシュ値で分割したグループ毎に行う.
+ * 部品要素（セル）ID、親要素（セル）の順序はcreateComponentCells()の逐次処理と同一とする.
+ * @param num_threads        スレッド数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmSections::createComponentCellsParallel(int num_threads)
+{
+    int k;
+    long i;
+    UdmSize_t n, f;
+    std::vector<UdmCell*>::iterator itr;
+    std::vector<UdmCell*> target_cells;
+    std::vector<UdmSize_t> face_offsets;
+
+    if (num_threads <= 0) num_threads = 1;
+
+    // 部品要素（セル）の作成対象要素（セル）
+    face_offsets.push_back(0);
+    for (k=0; k<2; k++) {
+        std::vector<UdmCell*> &cells = (k==0)?this->entity_cells:this->virtual_cells;
+        for (itr=cells.begin(); itr!=cells.end(); itr++) {
+            UdmCell* cell = (*itr);
+            UdmElementType_t elem_type = cell->getElementType();
+            if (UdmElementTopology::getDimensions(elem_type) > 1) {
+                int num_vertex = UdmElementTopology::getNumVertex(elem_type);
+                if (num_vertex < 0 || cell->getNumNodes() != (UdmSize_t)num_vertex) {
+                    return UDM_ERROR_INVALID_ELEMENTTYPE;
+                }
+            }
+            unsigned int num_faces = UdmElementTopology::getNumComponents(elem_type);
+            if (cell->getNumComponentCells() == num_faces) continue;
+
+            // 部品要素をすべて削除する.
+            cell->clearComponentCells();
+            target_cells.push_back(cell);
+            face_offsets.push_back(face_offsets.back() + num_faces);
+        }
+    }
+    UdmSize_t num_targets = target_cells.size();
+    UdmSize_t num_faces = face_offsets.back();
+    if (num_faces <= 0) return UDM_OK;
+
+    // 作成済み部品要素（セル）の検索テーブル
+    UdmComponentTable component_table(this->component_cells);
+
+    // 要素（セル）毎の面の列挙 : 面の構成節点（ノード）、ハッシュ値、作成済み部品要素（セル）
+    std::vector<UdmNode*> face_nodes(num_faces*UDM_CELL_MAXCOMPONENTNODES, (UdmNode*)NULL);
+    std::vector<UdmElementType_t> face_types(num_faces, Udm_ElementTypeUnknown);
+    std::vector<unsigned long long> face_keys(num_faces, 0);
+    std::vector<UdmComponent*> face_components(num_faces, (UdmComponent*)NULL);
+    std::vector<int> face_groups(num_faces, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)num_targets; i++) {
+        UdmCell* cell = target_cells[i];
+        const UdmSize_t *topology = UdmElementTopology::getComponentTable(cell->getElementType());
+        UdmSize_t face;
+        for (face=face_offsets[i]; face<face_offsets[i+1]; face++) {
+            // 部品要素-頂点テーブル : {部品要素形状タイプ, 頂点番号...}
+            UdmNode **nodes = &face_nodes[face*UDM_CELL_MAXCOMPONENTNODES];
+            face_types[face] = (UdmElementType_t)topology[0];
+            unsigned int m, num_nodes = UdmElementTopology::getNumVertex(face_types[face]);
+            for (m=0; m<num_nodes; m++) {
+                nodes[m] = cell->getNode(topology[m+1]);
+            }
+            topology += UDM_TOPOLOGY_COMPONENTSTRIDE;
+            face_keys[face] = UdmComponentTable::hashNodes(nodes, num_nodes);
+            face_components[face] = component_table.findComponentCell(nodes, num_nodes);
+            face_groups[face] = (int)((face_keys[face] >> 40) % num_threads);
+        }
+    }
+
+    // ハッシュ値のグループ毎に同一面を検索する : 同一面の先頭の面を代表面とする.
+    std::vector<UdmSize_t> group_offsets, group_faces;
+    std::vector<UdmSize_t> face_owners(num_faces, 0);
+    UdmSections::partitionIndices(face_groups, num_threads, group_offsets, group_faces);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)num_threads; i++) {
+        UdmSize_t n, slot, num_slots = UDM_COMPONENTTABLE_MINSLOTS;
+        while ((group_offsets[i+1]-group_offsets[i])*2 > num_slots) num_slots *= 2;
+        UdmSize_t mask = num_slots - 1;
+        // 代表面検索テーブル : 面インデックス+1, 0=空きスロット
+        std::vector<UdmSize_t> owner_slots(num_slots, 0);
+        for (n=group_offsets[i]; n<group_offsets[i+1]; n++) {
+            UdmSize_t face = group_faces[n];
+            face_owners[face] = face;
+            if (face_components[face] != NULL) continue;
+            unsigned int num_nodes = UdmElementTopology::getNumVertex(face_types[face]);
+            slot = (UdmSize_t)(face_keys[face] & mask);
+            while (owner_slots[slot] != 0) {
+                UdmSize_t owner = owner_slots[slot] - 1;
+                if (face_keys[owner] == face_keys[face]
+                    && UdmSections::equalsComponentNodes(
+                                &face_nodes[owner*UDM_CELL_MAXCOMPONENTNODES],
+                                &face_nodes[face*UDM_CELL_MAXCOMPONENTNODES],
+                                num_nodes)) {
+                    face_owners[face] = owner;
+                    break;
+                }
+                slot = (slot + 1) & mask;
+            }
+            if (owner_slots[slot] == 0) owner_slots[slot] = face + 1;
+        }
+    }
+
+    // 部品要素（セル）IDの採番 : 代表面順に最終ID+1から採番する.
+    std::vector<UdmSize_t> create_faces;
+    for (f=0; f<num_faces; f++) {
+        if (face_components[f] == NULL && face_owners[f] == f) {
+            create_faces.push_back(f);
+        }
+    }
+    UdmSize_t num_components = this->component_cells.size();
+    UdmSize_t start_id = 1;
+    if (num_components > 0) {
+        start_id = this->component_cells[num_components-1]->getId() + 1;
+    }
+    this->component_cells.resize(num_components + create_faces.size(), (UdmComponent*)NULL);
+
+    // 部品要素（セル）の生成
+    UdmEntityPool *pool = this->getEntityPool();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)create_faces.size(); i++) {
+        UdmSize_t face = create_faces[i];
+        UdmNode **nodes = &face_nodes[face*UDM_CELL_MAXCOMPONENTNODES];
+        unsigned int num_nodes = UdmElementTopology::getNumVertex(face_types[face]);
+        UdmComponent *component = new (pool) UdmComponent(face_types[face]);
+        component->setId(start_id + i);
+        component->nodes.assign(nodes, nodes + num_nodes);
+        this->component_cells[num_components + i] = component;
+        face_components[face] = component;
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)num_faces; i++) {
+        if (face_components[i] == NULL) {
+            face_components[i] = face_components[face_owners[i]];
+        }
+    }
+
+    // 部品要素（セル）の親要素（セル）の追加 : 同一面は同一グループであるので、グループ毎に面順に追加する.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)num_threads; i++) {
+        UdmSize_t n;
+        for (n=group_offsets[i]; n<group_offsets[i+1]; n++) {
+            UdmSize_t face = group_faces[n];
+            UdmSize_t target = std::upper_bound(face_offsets.begin(), face_offsets.end(), face) - face_offsets.begin() - 1;
+            face_components[face]->insertParentCell(target_cells[target]);
+        }
+    }
+
+    // 要素（セル）の部品要素（セル）の追加
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)num_targets; i++) {
+        UdmCell* cell = target_cells[i];
+        cell->components.assign(face_components.begin() + face_offsets[i],
+                                face_components.begin() + face_offsets[i+1]);
+    }
+
+    // 節点（ノード）の親要素（セル）の追加 : 節点（ノード）のハッシュ値のグループ毎に部品要素（セル）ID順に追加する.
+    std::vector<UdmSize_t> node_offsets;
+    node_offsets.reserve(create_faces.size()+1);
+    node_offsets.push_back(0);
+    for (n=0; n<create_faces.size(); n++) {
+        node_offsets.push_back(node_offsets.back() + UdmElementTopology::getNumVertex(face_types[create_faces[n]]));
+    }
+    std::vector<int> node_groups(node_offsets.back(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)create_faces.size(); i++) {
+        UdmSize_t m;
+        UdmComponent *component = this->component_cells[num_components + i];
+        for (m=node_offsets[i]; m<node_offsets[i+1]; m++) {
+            UdmNode *node = component->nodes[m-node_offsets[i]];
+            unsigned long long node_key = UdmComponentTable::hashNodeId(node->getMyRankno(), node->getId());
+            node_groups[m] = (int)((node_key >> 40) % num_threads);
         }
     }
+    UdmSections::partitionIndices(node_groups, num_threads, group_offsets, group_faces);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+#endif
+    for (i=0; i<(long)num_threads; i++) {
+        UdmSize_t n;
+        for (n=group_offsets[i]; n<group_offsets[i+1]; n++) {
+            UdmSize_t m = group_faces[n];
+            UdmSize_t c = std::upper_bound(node_offsets.begin(), node_offsets.end(), m) - node_offsets.begin() - 1;
+            UdmComponent *component = this->component_cells[num_components + c];
+            component->nodes[m-node_offsets[c]]->insertParentCell(component);
+        }
+    }
+
     return UDM_OK;
 }
 
+/**
+ * インデックスをグループ毎に分割する.
+ * グループ内のインデックスは昇順とする.
+ * @param [in]  groups        インデックス毎のグループ番号 : 0～num_groups-1
+ * @param [in]  num_groups        グループ数
+ * @param [out] group_offsets        グループ毎のインデックス位置 : group_indices[group_offsets[g]]～group_indices[group_offsets[g+1]-1]
+ * @param [out] group_indices        グループ順のインデックス
+ */
+void UdmSections::partitionIndices(
+                const std::vector<int> &groups,
+                int num_groups,
+                std::vector<UdmSize_t> &group_offsets,
+                std::vector<UdmSize_t> &group_indices)
+{
+    long t;
+    int g;
+    UdmSize_t size = groups.size();
+    UdmSize_t chunk = (size + num_groups - 1) / num_groups;
+    // チャンク毎、グループ毎のインデックス数 : [チャンク][グループ]
+    std::vector<UdmSize_t> counts((size_t)num_groups*num_groups, 0);
+
+    group_offsets.assign(num_groups+1, 0);
+    group_indices.resize(size);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(num_groups)
+#endif
+    for (t=0; t<(long)num_groups; t++) {
+        UdmSize_t n, start = chunk*t, end = chunk*(t+1);
+        if (end > size) end = size;
+        for (n=start; n<end; n++) {
+            counts[t*num_groups + groups[n]]++;
+        }
+    }
+
+    // チャンク毎、グループ毎の格納位置
+    UdmSize_t pos = 0;
+    for (g=0; g<num_groups; g++) {
+        group_offsets[g] = pos;
+        for (t=0; t<(long)num_groups; t++) {
+            UdmSize_t count = counts[t*num_groups + g];
+            counts[t*num_groups + g] = pos;
+            pos += count;
+        }
+    }
+    group_offsets[num_groups] = pos;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static, 1) num_threads(num_groups)
+#endif
+    for (t=0; t<(long)num_groups; t++) {
+        UdmSize_t n, start = chunk*t, end = chunk*(t+1);
+        if (end > size) end = size;
+        for (n=start; n<end; n++) {
+            group_indices[counts[t*num_groups + groups[n]]++] = n;
+        }
+    }
+
+    return;
+}
+
+/**
+ * 面の構成節点（ノード）のランク番号、IDが同一であるかチェックする.
+ * 節点（ノード）の順序は問わない.
+ * @param src_nodes        比較元構成節点（ノード）
+ * @param dest_nodes        比較先構成節点（ノード）
+ * @param num_nodes        構成節点（ノード）数
+ * @return        true=同一構成節点（ノード）
+ */
+bool UdmSections::equalsComponentNodes(UdmNode* const src_nodes[], UdmNode* const dest_nodes[], unsigned int num_nodes)
+{
+    unsigned int n, m;
+    for (n=0; n<num_nodes; n++) {
+        for (m=0; m<num_nodes; m++) {
+            if (src_nodes[n] == dest_nodes[m]) break;
+            if (src_nodes[n]->getMyRankno() == dest_nodes[m]->getMyRankno()
+                && src_nodes[n]->getId() == dest_nodes[m]->getId()) break;
+        }
+        if (m >= num_nodes) return false;
+    }
+    return true;
+}
+
 /**
  * 部品要素（セル）数を取得する.
  * @return        部品要素（セル）数
@@ -703,6 +1041,9 @@ UdmSize_t UdmSections::insertComponentCell(UdmComponent* component_cell)
 
     // 部品要素（セル）を追加する.
     this->component_cells.push_back(component_cell);
+    if (this->component_table != NULL) {
+        this->component_table->addComponentCell(component_cell);
+    }
 
     return cell_id;
 }
@@ -721,6 +1062,9 @@ UdmError_t UdmSections::removeComponentCell(UdmSize_t component_id)
     std::vector<UdmComponent*>::iterator rm_itr;
     itr = this->searchEntityId(this->component_cells, component_id);
     if (itr != this->component_cells.end()) {
+        if (this->component_table != NULL) {
+            this->component_table->removeComponentCell(*itr);
+        }
         delete (*itr);
         rm_itr = this->component_cells.begin() + (itr - this->component_cells.begin());
         this->component_cells.erase(rm_itr);
@@ -736,6 +1080,10 @@ UdmError_t UdmSections::removeComponentCell(UdmSize_t component_id)
  */
 UdmError_t UdmSections::clearComponentCells()
 {
+    if (this->component_table != NULL) {
+        this->component_table->clearComponentTable();
+    }
+
     // 部品要素の削除
     std::vector<UdmComponent*>::const_iterator itr;
     for (itr=this->component_cells.begin(); itr!=this->component_cells.end(); itr++) {
@@ -758,8 +1106,33 @@ UdmComponent* UdmSections::findComponentCell(const UdmComponent* dest_cell)
 {
     if (dest_cell == NULL) return NULL;
 
+    UdmSize_t n, num_nodes = dest_cell->getNumNodes();
+    std::vector<UdmNode*> component_nodes;
+    component_nodes.reserve(num_nodes);
+    for (n=1; n<=num_nodes; n++) {
+        component_nodes.push_back(dest_cell->getNode(n));
+    }
+    return this->findComponentCell(component_nodes);
+}
+
+/**
+ * 同一部品要素（セル）を検索する.
+ * 同一頂点（ノード）構成（ノードID）であるか検索する.
+ * 部品要素（セル）検索テーブルが作成済みの場合は検索テーブルから検索する.
+ * @param component_nodes        検索頂点（ノード）リスト
+ * @return            同一部品要素（セル）：同一部品要素（セル）が存在しない場合はNULLを返す。
+ */
+UdmComponent* UdmSections::findComponentCell(const std::vector<UdmNode*> &component_nodes)
+{
+    if (component_nodes.size() <= 0) return NULL;
+
+    // 部品要素（セル）検索テーブルから検索する.
+    if (this->component_table != NULL) {
+        return this->component_table->findComponentCell(component_nodes);
+    }
+
     // 先頭の１つの節点（ノード）の取得
-    UdmNode *node = dest_cell->getNode(1);
+    UdmNode *node = component_nodes[0];
 
     // 同一部品要素（セル）が存在していれば、節点（ノード）の親要素（セル）として登録済みである。
     int num_parent_cells = node->getNumParentCells();
@@ -769,7 +1142,7 @@ UdmComponent* UdmSections::findComponentCell(const UdmComponent* dest_cell)
         src_cell = node->getParentCell(n);
         if (src_cell->getId() <= 0) continue;
         if (src_cell->getCellClass() != Udm_ComponentClass) continue;
-        if (!src_cell->equalsNodeIds(dest_cell)) continue;
+        if (!src_cell->equalsNodeIds(component_nodes)) continue;
         return dynamic_cast<UdmComponent*>(src_cell);
     }
 
@@ -916,6 +1289,34 @@ UdmError_t UdmSections::initializeWriteCgns()
     return UDM_OK;
 }
 
+/**
+ * 非同期出力のため、全セクション（要素構成）のCGNS:Elementsの接続情報を退避バッファに作成する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmSections::stageCgnsElements()
+{
+    std::vector<UdmElements*>::iterator itr;
+    for (itr = this->section_list.begin(); itr != this->section_list.end(); itr++) {
+        if ((*itr)->stageCgnsElements() != UDM_OK) {
+            this->clearStagedElements();
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_ELEMENTS, "failure : UdmElements::stageCgnsElements()");
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 非同期出力の全セクション（要素構成）の接続情報退避バッファを削除する.
+ */
+void UdmSections::clearStagedElements()
+{
+    std::vector<UdmElements*>::iterator itr;
+    for (itr = this->section_list.begin(); itr != this->section_list.end(); itr++) {
+        (*itr)->clearStagedElements();
+    }
+}
+
 /**
  * 物理量フィールド情報を取得する.
  * @param solution_name        物理量データ名称
@@ -931,6 +1332,15 @@ const UdmSolutionFieldConfig* UdmSections::getSolutionFieldConfig(const std::str
     return solutions->getSolutionField(solution_name);
 }
 
+/**
+ * 物理量データの定義位置を取得する.
+ * @return        物理量定義位置 : Udm_CellCenter
+ */
+UdmGridLocation_t UdmSections::getSolutionGridLocation() const
+{
+    return Udm_CellCenter;
+}
+
 
 /**
  * 物理量データの初期化を行う.
@@ -992,6 +1402,7 @@ UdmError_t UdmSections::removeCell(const UdmCell* cell)
             delete cell;
             rm_itr = this->entity_cells.begin() + (itr - this->entity_cells.begin());
             this->entity_cells.erase(rm_itr);
+            this->clearNeighborGraph();
             return UDM_OK;
         }
     }
@@ -1003,6 +1414,7 @@ UdmError_t UdmSections::removeCell(const UdmCell* cell)
             delete cell;
             rm_itr = this->virtual_cells.begin() + (itr - this->virtual_cells.begin());
             this->virtual_cells.erase(rm_itr);
+            this->clearNeighborGraph();
             return UDM_OK;
         }
     }
@@ -1033,6 +1445,9 @@ UdmError_t UdmSections::removeComponentCell(const UdmComponent* component)
     itr = this->searchEntityId(this->component_cells, component_id);
     if (itr != this->component_cells.end()) {
         if ((*itr) == component) {
+            if (this->component_table != NULL) {
+                this->component_table->removeComponentCell(component);
+            }
             delete component;
             rm_itr = this->component_cells.begin() + (itr - this->component_cells.begin());
             this->component_cells.erase(rm_itr);
@@ -1081,6 +1496,8 @@ UdmSize_t UdmSections::insertEntityCell(UdmCell* cell)
     cell->setParentSections(this);
     // MPIランク番号
     cell->setMyRankno(this->getMpiRankno());
+    // 隣接情報を破棄する.
+    this->clearNeighborGraph();
 
     return cell->getId();
 }
@@ -1351,7 +1768,7 @@ UdmError_t UdmSections::importVirtualCells(
         }
 
         // 要素（セル）の作成
-        UdmCell *dest_cell = UdmCell::factoryCell(src_cell->getElementType());
+        UdmCell *dest_cell = UdmCell::factoryCell(src_cell->getElementType(), this->getEntityPool());
         if (dest_cell == NULL) {
             return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL,  "elem_type=%d", (int)src_cell->getElementType());
         }
@@ -1605,6 +2022,103 @@ template UdmError_t UdmSections::setSolutionVector<long long>(UdmSize_t cell_id,
 template UdmError_t UdmSections::setSolutionVector<float>(UdmSize_t cell_id, const std::string& solution_name, const float* values, unsigned int size);
 template UdmError_t UdmSections::setSolutionVector<double>(UdmSize_t cell_id, const std::string& solution_name, const double* values, unsigned int size);
 
+/**
+ * 要素（セル）の物理量データ値を取得する:スカラデータ, 物理量フィールドID.
+ * 物理量フィールドIDはUdmFlowSolutions::getFieldIdにて取得すること.
+ * @param [in]  cell_id        要素（セル）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  value                物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmSections::getSolutionScalar(
+                    UdmSize_t cell_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE& value) const
+{
+    UdmEntity *entity = this->getEntityCell(cell_id);
+    if (entity == NULL) return UDM_ERROR;
+    return this->getEntitySolutionScalar<VALUE_TYPE>(entity, field_id, value);
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:ベクトルデータ, 物理量フィールドID.
+ * @param [in]  cell_id        要素（セル）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  values                物理量データ値リスト
+ * @return      ベクトルデータ数
+ */
+template<class VALUE_TYPE>
+unsigned int UdmSections::getSolutionVector(
+                    UdmSize_t cell_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE* values) const
+{
+    UdmEntity *entity = this->getEntityCell(cell_id);
+    if (entity == NULL) return 0;
+    return this->getEntitySolutionVector<VALUE_TYPE>(entity, field_id, values);
+}
+
+/**
+ * 要素（セル）の物理量データ値を設定する:スカラデータ, 物理量フィールドID.
+ * @param cell_id                要素（セル）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param value                    物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmSections::setSolutionScalar(
+                        UdmSize_t cell_id,
+                        UdmSize_t field_id,
+                        VALUE_TYPE value)
+{
+    UdmEntity *entity = this->getEntityCell(cell_id);
+    if (entity == NULL) return UDM_ERROR;
+
+    return this->setEntitySolutionScalar<VALUE_TYPE>(entity, field_id, value);
+}
+
+/**
+ * 要素（セル）の物理量データ値を設定する:ベクトルデータ, 物理量フィールドID.
+ * @param cell_id                要素（セル）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param values                    物理量データリスト
+ * @param size                    物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmSections::setSolutionVector(
+                        UdmSize_t cell_id,
+                        UdmSize_t field_id,
+                        const VALUE_TYPE* values,
+                        unsigned int size)
+{
+    UdmEntity *entity = this->getEntityCell(cell_id);
+    if (entity == NULL) return UDM_ERROR;
+
+    return this->setEntitySolutionVector<VALUE_TYPE>(entity, field_id, values, size);
+}
+
+template UdmError_t UdmSections::getSolutionScalar<int>(UdmSize_t cell_id, UdmSize_t field_id, int& value) const;
+template UdmError_t UdmSections::getSolutionScalar<long long>(UdmSize_t cell_id, UdmSize_t field_id, long long& value) const;
+template UdmError_t UdmSections::getSolutionScalar<float>(UdmSize_t cell_id, UdmSize_t field_id, float& value) const;
+template UdmError_t UdmSections::getSolutionScalar<double>(UdmSize_t cell_id, UdmSize_t field_id, double& value) const;
+
+template unsigned int UdmSections::getSolutionVector<int>(UdmSize_t cell_id, UdmSize_t field_id, int* values) const;
+template unsigned int UdmSections::getSolutionVector<long long>(UdmSize_t cell_id, UdmSize_t field_id, long long* values) const;
+template unsigned int UdmSections::getSolutionVector<float>(UdmSize_t cell_id, UdmSize_t field_id, float* values) const;
+template unsigned int UdmSections::getSolutionVector<double>(UdmSize_t cell_id, UdmSize_t field_id, double* values) const;
+
+template UdmError_t UdmSections::setSolutionScalar<int>(UdmSize_t cell_id, UdmSize_t field_id, int value);
+template UdmError_t UdmSections::setSolutionScalar<long long>(UdmSize_t cell_id, UdmSize_t field_id, long long value);
+template UdmError_t UdmSections::setSolutionScalar<float>(UdmSize_t cell_id, UdmSize_t field_id, float value);
+template UdmError_t UdmSections::setSolutionScalar<double>(UdmSize_t cell_id, UdmSize_t field_id, double value);
+
+template UdmError_t UdmSections::setSolutionVector<int>(UdmSize_t cell_id, UdmSize_t field_id, const int* values, unsigned int size);
+template UdmError_t UdmSections::setSolutionVector<long long>(UdmSize_t cell_id, UdmSize_t field_id, const long long* values, unsigned int size);
+template UdmError_t UdmSections::setSolutionVector<float>(UdmSize_t cell_id, UdmSize_t field_id, const float* values, unsigned int size);
+template UdmError_t UdmSections::setSolutionVector<double>(UdmSize_t cell_id, UdmSize_t field_id, const double* values, unsigned int size);
+
 
 /**
  * 仮想セルをCGNSファイル出力する.
@@ -1779,6 +2293,8 @@ UdmError_t UdmSections::removeCells(const std::vector<UdmCell*>& remove_cells)
             delete cell;
         }
     }
+    // 隣接情報を破棄する.
+    this->clearNeighborGraph();
 
     return UDM_OK;
 }
@@ -1863,6 +2379,11 @@ UdmCell* UdmSections::getCellByLocalId(UdmSize_t cell_id) const
  */
 void UdmSections::finalize()
 {
+    if (this->component_table != NULL) {
+        delete this->component_table;
+        this->component_table = NULL;
+    }
+
     std::vector<UdmCell*>::const_iterator itr;
     for (itr=this->entity_cells.begin(); itr!=this->entity_cells.end(); itr++) {
         UdmCell* cell = (*itr);
@@ -58,7 +58,6 @@ void UdmShell::initialize()
  */
 UdmError_t UdmShell::createComponentCells()
 {
-    UdmError_t error;
     unsigned int n;
 
     // 頂点（ノード）数チェック
@@ -76,42 +75,21 @@ UdmError_t UdmShell::createComponentCells()
     this->clearComponentCells();
 
     // BAR要素を作成する.
-    if (this->getElementType() == Udm_TRI_3) {
-        // エッジID | 接続ノードID
-        //    E1   |   N1, N2
-        //    E2   |   N2, N3
-        //    E3   |   N3, N1
-        unsigned int num_nodes = 2;
-        UdmSize_t bar_nodes[][2] = {{1,2}, {2,3}, {3,1}};
-        for (n=0; n<num_bars; n++) {
-            if (this->createComponentCell(
-                            Udm_BAR_2,
-                            num_nodes, &bar_nodes[n][0]) == 0) {
-                return UDM_ERROR_INVALID_ELEMENTTYPE;
-            }
+    UdmElementType_t bar_type;
+    UdmSize_t bar_nodes[UDM_CELL_MAXCOMPONENTNODES];
+    for (n=1; n<=num_bars; n++) {
+        unsigned int num_nodes = this->getComponentNodes(n, bar_type, bar_nodes);
+        if (num_nodes <= 0) {
+            return UDM_ERROR_INVALID_ELEMENTTYPE;
         }
-    }
-    else if (this->getElementType() == Udm_QUAD_4) {
-        // エッジID | 接続ノードID
-        //    E1   |   N1,N2
-        //    E2   |   N2, N3
-        //    E3   |   N3, N4
-        //    E4   |   N4, N1
-        unsigned int num_nodes = 2;
-        UdmSize_t bar_nodes[][2] = {{1,2}, {2,3}, {3,4}, {4, 1} };
-        for (n=0; n<num_bars; n++) {
-            if (this->createComponentCell(
-                            Udm_BAR_2,
-                            num_nodes, &bar_nodes[n][0]) == 0) {
-                return UDM_ERROR_INVALID_ELEMENTTYPE;
-            }
+        if (this->createComponentCell(bar_type, num_nodes, bar_nodes) == 0) {
+            return UDM_ERROR_INVALID_ELEMENTTYPE;
         }
     }
 
     return UDM_OK;
 }
 
-
 /**
  * 部品要素（セル）を生成して、UdmSectionsクラスに格納を行う.
  * @param element_type        要素形状タイプ
@@ -122,13 +100,11 @@ UdmError_t UdmShell::createComponentCells()
 UdmSize_t UdmShell::createComponentCell(UdmElementType_t element_type, unsigned int num_nodes, UdmSize_t face_nodes[])
 {
     // 追加済みBAR数をチェックする
-    unsigned int num_bars = 0;
     UdmSize_t num_components = this->getNumComponentCells();
-    if (this->getElementType() == Udm_TRI_3) num_bars = 3;
-    else if (this->getElementType() == Udm_QUAD_4)  num_bars = 4;
-    else {
+    if (UdmElementTopology::getDimensions(this->getElementType()) != 2) {
         return 0;
     }
+    unsigned int num_bars = UdmElementTopology::getNumComponents(this->getElementType());
     if (num_components >= num_bars) {
         return 0;
     }
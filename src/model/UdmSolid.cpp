@@ -58,7 +58,6 @@ void UdmSolid::initialize()
  */
 UdmError_t UdmSolid::createComponentCells()
 {
-    UdmError_t error;
     unsigned int  n;
 
     // 頂点（ノード）数チェック
@@ -77,107 +76,17 @@ UdmError_t UdmSolid::createComponentCells()
     this->clearComponentCells();
 
     // 面要素を作成する.
-    if (this->getElementType() == Udm_TETRA_4) {
-        // 面ID |  接続ノードID
-        //  F1  |  N1,N3,N2
-        //  F2  |  N1,N2,N4
-        //  F3  |  N2,N3,N4
-        //  F4  |  N3,N1,N4
-        unsigned int num_nodes = 3;
-        UdmSize_t face_nodes[][3] = {{1,3,2}, {1,2,4}, {2,3,4}, {3,1,4}};
-        for (n=0; n<num_faces; n++) {
-            if (this->createComponentCell(
-                            Udm_TRI_3,
-                            num_nodes, &face_nodes[n][0]) == 0) {
-                return UDM_ERROR_INVALID_ELEMENTTYPE;
-            }
+    UdmElementType_t face_type;
+    UdmSize_t face_nodes[UDM_CELL_MAXCOMPONENTNODES];
+    for (n=1; n<=num_faces; n++) {
+        unsigned int num_nodes = this->getComponentNodes(n, face_type, face_nodes);
+        if (num_nodes <= 0) {
+            return UDM_ERROR_INVALID_ELEMENTTYPE;
         }
-    }
-    else if (this->getElementType() == Udm_PYRA_5) {
-        // 面ID |  接続ノードID
-        //  F1  |  N1,N4,N3,N2
-        //  F2  |  N1,N2,N5
-        //  F3  |  N2,N3,N5
-        //  F4  |  N3,N4,N5
-        //  F5  |  N4,N1,N5
-        UdmSize_t face_nodes[] = {1,4,3,2,
-                                  1,2,5,
-                                  2,3,5,
-                                  3,4,5,
-                                  4,1,5 };
-        int pos = 0;
-        for (n=0; n<num_faces; n++) {
-            if (n==0) {
-                if (this->createComponentCell(
-                                Udm_QUAD_4,
-                                4, &face_nodes[pos]) == 0) {
-                    return UDM_ERROR_INVALID_ELEMENTTYPE;
-                }
-                pos += 4;
-            }
-            else {
-                if (this->createComponentCell(
-                                Udm_TRI_3,
-                                3, &face_nodes[pos]) == 0) {
-                    return UDM_ERROR_INVALID_ELEMENTTYPE;
-                }
-                pos += 3;
-            }
-        }
-    }
-    else if (this->getElementType() == Udm_PENTA_6) {
-        // 面ID |  接続ノードID
-        //  F1  |  N1,N2,N5,N4
-        //  F2  |  N2,N3,N6,N5
-        //  F3  |  N3,N1,N4,N6
-        //  F4  |  N1,N3,N2
-        //  F5  |  N4,N5,N6
-        UdmSize_t face_nodes[] = {1,2,5,4,
-                                  2,3,6,5,
-                                  3,1,4,6,
-                                  1,3,2,
-                                  4,5,6 };
-        int pos = 0;
-        for (n=0; n<num_faces; n++) {
-            if (n==0 || n==1 || n==2) {
-                if (this->createComponentCell(
-                                Udm_QUAD_4,
-                                4, &face_nodes[pos]) == 0) {
-                    return UDM_ERROR_INVALID_ELEMENTTYPE;
-                }
-                pos += 4;
-            }
-            else {
-                if (this->createComponentCell(
-                                Udm_TRI_3,
-                                3, &face_nodes[pos]) == 0) {
-                    return UDM_ERROR_INVALID_ELEMENTTYPE;
-                }
-                pos += 3;
-            }
+        if (this->createComponentCell(face_type, num_nodes, face_nodes) == 0) {
+            return UDM_ERROR_INVALID_ELEMENTTYPE;
         }
     }
-    else if (this->getElementType() == Udm_HEXA_8) {
-        // 面ID |  接続ノードID
-        //  F1  |  N1,N4,N3,N2
-        //  F2  |  N1,N2,N6,N5
-        //  F3  |  N2,N3,N7,N6
-        //  F4  |  N3,N4,N8,N7
-        //  F5  |  N1,N5,N8,N4
-        //  F6  |  N5,N6,N7,N8
-        unsigned int num_nodes = 4;
-        UdmSize_t face_nodes[][4] = {{1,4,3,2}, {1,2,6,5}, {2,3,7,6}, {3,4,8,7}, {1,5,8,4}, {5,6,7,8}};
-        for (n=0; n<num_faces; n++) {
-            if (this->createComponentCell(
-                            Udm_QUAD_4,
-                            num_nodes, &face_nodes[n][0]) == 0) {
-                return UDM_ERROR_INVALID_ELEMENTTYPE;
-            }
-        }
-    }
-    else {
-        return UDM_ERROR_INVALID_ELEMENTTYPE;
-    }
 
     return UDM_OK;
 }
@@ -192,15 +101,11 @@ UdmError_t UdmSolid::createComponentCells()
 UdmSize_t UdmSolid::createComponentCell(UdmElementType_t element_type, unsigned int num_nodes, UdmSize_t face_nodes[])
 {
     // 追加済み面数をチェックする
-    unsigned int num_faces = 0;
     UdmSize_t num_components = this->getNumComponentCells();
-    if (this->getElementType() == Udm_TETRA_4) num_faces = 4;
-    else if (this->getElementType() == Udm_PYRA_5)  num_faces = 5;
-    else if (this->getElementType() == Udm_PENTA_6)  num_faces = 5;
-    else if (this->getElementType() == Udm_HEXA_8)  num_faces = 6;
-    else {
+    if (UdmElementTopology::getDimensions(this->getElementType()) != 3) {
         return 0;
     }
+    unsigned int num_faces = UdmElementTopology::getNumComponents(this->getElementType());
     if (num_components >= num_faces) {
         return 0;
     }
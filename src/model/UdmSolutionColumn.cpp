@@ -0,0 +1,372 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmSolutionColumn.cpp
+ * 物理量カラムデータクラスのソースファイル
+ */
+
+#include "model/UdmSolutionColumn.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ * @param name            物理量名称
+ * @param datatype        データ型
+ * @param vectortype        ベクトルタイプ
+ * @param nvector_size        物理量成分数
+ */
+UdmSolutionColumn::UdmSolutionColumn(
+                const std::string &name,
+                UdmDataType_t datatype,
+                UdmVectorType_t vectortype,
+                int nvector_size)
+            : UdmGeneral(name, 0, datatype)
+{
+    this->initialize();
+    this->vectortype = vectortype;
+    this->nvector_size = nvector_size;
+    if (this->nvector_size <= 0) {
+        // 成分数未設定の場合は、Udm_Scalarの場合は1, Udm_Vectorの場合は3とする.
+        this->nvector_size = (vectortype == Udm_Vector) ? 3 : 1;
+    }
+}
+
+/**
+ * デストラクタ
+ */
+UdmSolutionColumn::~UdmSolutionColumn()
+{
+    this->deleteDataArray(this->datas, this->getDataType());
+    this->datas = NULL;
+    this->exists_flags.clear();
+    this->capacity = 0;
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmSolutionColumn::initialize()
+{
+    this->datas = NULL;
+    this->exists_flags.clear();
+    this->capacity = 0;
+    this->vectortype = Udm_Scalar;
+    this->nvector_size = 1;
+}
+
+/**
+ * 物理量ベクトルデータタイプを取得する.
+ * @return        物理量ベクトルデータタイプ
+ */
+UdmVectorType_t UdmSolutionColumn::getVectorType() const
+{
+    return this->vectortype;
+}
+
+/**
+ * 物理量成分数を取得する.
+ * @return        物理量成分数
+ */
+int UdmSolutionColumn::getNvectorSize() const
+{
+    return this->nvector_size;
+}
+
+/**
+ * 確保スロット数を取得する.
+ * @return        確保スロット数
+ */
+UdmSize_t UdmSolutionColumn::getCapacity() const
+{
+    return this->capacity;
+}
+
+/**
+ * 格納スロットを確保する.
+ * 確保済みのデータはコピーする.
+ * @param size        確保スロット数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmSolutionColumn::reserveSlots(UdmSize_t size)
+{
+    if (size <= this->capacity) return UDM_OK;
+
+    void *new_datas = this->createDataArray(this->getDataType(), size*this->nvector_size);
+    if (new_datas == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid datatype[name=%s,datatype=%d].", this->getName().c_str(), this->getDataType());
+    }
+    if (this->datas != NULL) {
+        memcpy(new_datas, this->datas, this->capacity*this->nvector_size*this->sizeofDataType(this->getDataType()));
+        this->deleteDataArray(this->datas, this->getDataType());
+    }
+    this->datas = new_datas;
+    this->exists_flags.resize(size, 0);
+    this->capacity = size;
+
+    return UDM_OK;
+}
+
+/**
+ * スロットに物理量データが設定済みであるかチェックする.
+ * @param slot        格納スロット（０～）
+ * @return        true=設定済み
+ */
+bool UdmSolutionColumn::existsSolutionValue(UdmSize_t slot) const
+{
+    if (slot >= this->capacity) return false;
+    return (this->exists_flags[slot] != 0);
+}
+
+/**
+ * スロットの物理量データをクリアする.
+ * @param slot        格納スロット（０～）
+ */
+void UdmSolutionColumn::clearSolutionValue(UdmSize_t slot)
+{
+    if (slot >= this->capacity) return;
+    this->exists_flags[slot] = 0;
+    memset((char*)this->datas + slot*this->nvector_size*this->sizeofDataType(this->getDataType()),
+            0x00,
+            this->nvector_size*this->sizeofDataType(this->getDataType()));
+}
+
+/**
+ * すべての物理量データをクリアする.
+ * 確保スロットは解放しない.
+ */
+void UdmSolutionColumn::clearSolutionValues()
+{
+    if (this->datas == NULL) return;
+    memset(this->datas, 0x00, this->capacity*this->nvector_size*this->sizeofDataType(this->getDataType()));
+    std::fill(this->exists_flags.begin(), this->exists_flags.end(), 0);
+}
+
+/**
+ * スロットの物理量データ配列の先頭ポインタを取得する.
+ * @param slot        格納スロット（０～）
+ * @return        物理量データ配列ポインタ
+ */
+void* UdmSolutionColumn::getSolutionPointer(UdmSize_t slot)
+{
+    if (slot >= this->capacity) return NULL;
+    return (char*)this->datas + slot*this->nvector_size*this->sizeofDataType(this->getDataType());
+}
+
+/**
+ * スロットの物理量データ配列の先頭ポインタを取得する:const.
+ * @param slot        格納スロット（０～）
+ * @return        物理量データ配列ポインタ
+ */
+const void* UdmSolutionColumn::getSolutionPointer(UdmSize_t slot) const
+{
+    if (slot >= this->capacity) return NULL;
+    return (const char*)this->datas + slot*this->nvector_size*this->sizeofDataType(this->getDataType());
+}
+
+/**
+ * スロットに物理量データを設定する:void*.
+ * @param slot            格納スロット（０～）
+ * @param src_datatype        設定データのデータ型
+ * @param values        設定データ
+ * @param size            設定データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmSolutionColumn::setSolutionPointer(
+                        UdmSize_t slot,
+                        UdmDataType_t src_datatype,
+                        const void* values,
+                        unsigned int size)
+{
+    if (slot >= this->capacity) return UDM_ERROR;
+    if (values == NULL) return UDM_ERROR;
+    if (size > (unsigned int)this->nvector_size) size = this->nvector_size;
+
+    if (src_datatype == this->getDataType()) {
+        memcpy(this->getSolutionPointer(slot), values, size*this->sizeofDataType(src_datatype));
+        this->exists_flags[slot] = 1;
+    }
+    else if (src_datatype == Udm_Integer) {
+        this->setSolutionValues(slot, (const int*)values, size);
+    }
+    else if (src_datatype == Udm_LongInteger) {
+        this->setSolutionValues(slot, (const long long*)values, size);
+    }
+    else if (src_datatype == Udm_RealSingle) {
+        this->setSolutionValues(slot, (const float*)values, size);
+    }
+    else if (src_datatype == Udm_RealDouble) {
+        this->setSolutionValues(slot, (const double*)values, size);
+    }
+    else {
+        return UDM_ERROR;
+    }
+    return UDM_OK;
+}
+
+/**
+ * スロットの物理量データを取得する:void*.
+ * @param [in]  slot            格納スロット（０～）
+ * @param [in]  dest_datatype        取得データのデータ型
+ * @param [out] values        取得データ
+ * @param [in]  size            取得データ数
+ * @return        取得データ数
+ */
+unsigned int UdmSolutionColumn::getSolutionPointer(
+                        UdmSize_t slot,
+                        UdmDataType_t dest_datatype,
+                        void* values,
+                        unsigned int size) const
+{
+    unsigned int n;
+    if (slot >= this->capacity) return 0;
+    if (values == NULL) return 0;
+    if (size > (unsigned int)this->nvector_size) size = this->nvector_size;
+
+    if (dest_datatype == this->getDataType()) {
+        memcpy(values, this->getSolutionPointer(slot), size*this->sizeofDataType(dest_datatype));
+    }
+    else if (dest_datatype == Udm_Integer) {
+        for (n=0; n<size; n++) ((int*)values)[n] = this->getSolutionValue<int>(slot, n);
+    }
+    else if (dest_datatype == Udm_LongInteger) {
+        for (n=0; n<size; n++) ((long long*)values)[n] = this->getSolutionValue<long long>(slot, n);
+    }
+    else if (dest_datatype == Udm_RealSingle) {
+        for (n=0; n<size; n++) ((float*)values)[n] = this->getSolutionValue<float>(slot, n);
+    }
+    else if (dest_datatype == Udm_RealDouble) {
+        for (n=0; n<size; n++) ((double*)values)[n] = this->getSolutionValue<double>(slot, n);
+    }
+    else {
+        return 0;
+    }
+    return size;
+}
+
+/**
+ * スロットの物理量データをシリアライズする.
+ * UdmSolutionData::serializeと同一の形式で出力する.
+ * @param archive        シリアライズ・デシリアライズクラス
+ * @param slot            格納スロット（０～）
+ * @return        シリアライズ・デシリアライズクラス
+ */
+UdmSerializeArchive& UdmSolutionColumn::serializeSolutionValue(UdmSerializeArchive& archive, UdmSize_t slot) const
+{
+    unsigned int size = this->nvector_size;
+    UdmDataType_t data_type = this->getDataType();
+    unsigned int n;
+
+    // Genaral基本情報
+    this->serializeGeneralBase(archive, (UdmSize_t)0, data_type, this->getName());
+    // 物理量ベクトルデータタイプ
+    archive << this->vectortype;
+    // 物理量データサイズ.
+    archive << size;
+
+    const void *values = this->getSolutionPointer(slot);
+    if (data_type == Udm_Integer) {
+        for (n = 0; n<size; n++) archive << ((const int*)values)[n];
+    }
+    else if (data_type == Udm_LongInteger) {
+        for (n = 0; n<size; n++) archive << ((const long long*)values)[n];
+    }
+    else if (data_type == Udm_RealSingle) {
+        for (n = 0; n<size; n++) archive << ((const float*)values)[n];
+    }
+    else if (data_type == Udm_RealDouble) {
+        for (n = 0; n<size; n++) archive << ((const double*)values)[n];
+    }
+
+    return archive;
+}
+
+/**
+ * 物理量データクラスの物理量データをスロットに設定する.
+ * @param slot                格納スロット（０～）
+ * @param solution_data        物理量データクラス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmSolutionColumn::setSolutionData(UdmSize_t slot, const UdmSolutionData *solution_data)
+{
+    if (solution_data == NULL) return UDM_ERROR;
+    if (slot >= this->capacity) return UDM_ERROR;
+
+    unsigned int size = solution_data->getNumSolutionDatas();
+    if (size <= 0) return UDM_OK;
+    UdmDataType_t data_type = solution_data->getDataType();
+    void *values = this->createDataArray(data_type, size);
+    if (values == NULL) return UDM_ERROR;
+
+    if (data_type == Udm_Integer) {
+        solution_data->getSolutionDatas((int*)values);
+    }
+    else if (data_type == Udm_LongInteger) {
+        solution_data->getSolutionDatas((long long*)values);
+    }
+    else if (data_type == Udm_RealSingle) {
+        solution_data->getSolutionDatas((float*)values);
+    }
+    else if (data_type == Udm_RealDouble) {
+        solution_data->getSolutionDatas((double*)values);
+    }
+    UdmError_t error = this->setSolutionPointer(slot, data_type, values, size);
+    this->deleteDataArray(values, data_type);
+
+    return error;
+}
+
+/**
+ * スロットの物理量データから物理量データクラスを生成する.
+ * @param slot                格納スロット（０～）
+ * @return        生成物理量データクラス : 物理量データが未設定の場合はNULL
+ */
+UdmSolutionData* UdmSolutionColumn::factorySolutionData(UdmSize_t slot) const
+{
+    if (!this->existsSolutionValue(slot)) return NULL;
+
+    UdmDataType_t data_type = this->getDataType();
+    UdmSolutionData *solution_data = UdmSolutionData::factorySolutionData(this->getName(), this->vectortype, data_type);
+    if (solution_data == NULL) return NULL;
+
+    const void *values = this->getSolutionPointer(slot);
+    if (data_type == Udm_Integer) {
+        solution_data->setSolutionDatas((const int*)values, this->nvector_size);
+    }
+    else if (data_type == Udm_LongInteger) {
+        solution_data->setSolutionDatas((const long long*)values, this->nvector_size);
+    }
+    else if (data_type == Udm_RealSingle) {
+        solution_data->setSolutionDatas((const float*)values, this->nvector_size);
+    }
+    else if (data_type == Udm_RealDouble) {
+        solution_data->setSolutionDatas((const double*)values, this->nvector_size);
+    }
+
+    return solution_data;
+}
+
+/**
+ * メモリサイズを取得する.
+ * @return        メモリサイズ
+ */
+size_t UdmSolutionColumn::getMemSize() const
+{
+    size_t size = sizeof(*this);
+    size += this->capacity*this->nvector_size*this->sizeofDataType(this->getDataType());
+    size += this->exists_flags.capacity();
+    return size;
+}
+
+} /* namespace udm */
@@ -67,10 +67,20 @@ UdmZone::~UdmZone()
     if (this->inner_boundary != NULL) delete this->inner_boundary;
     if (this->user_datas != NULL) delete this->user_datas;
     if (this->grid_coordinates != NULL) delete this->grid_coordinates;
+    if (this->neighbor_graph != NULL) delete this->neighbor_graph;
+    if (this->halo_exchange != NULL) delete this->halo_exchange;
+    if (this->boundary_reduction != NULL) delete this->boundary_reduction;
     this->sections = NULL;
     this->solutions = NULL;
     this->user_datas = NULL;
     this->grid_coordinates = NULL;
+    this->neighbor_graph = NULL;
+    this->halo_exchange = NULL;
+    this->boundary_reduction = NULL;
+
+    // メモリプールの解放 : 割当済みの節点（ノード）、要素（セル）が存在する場合はすべての削除後に解放される.
+    if (this->entity_pool != NULL) this->entity_pool->releasePool();
+    this->entity_pool = NULL;
 }
 
 /**
@@ -78,6 +88,8 @@ UdmZone::~UdmZone()
  */
 void UdmZone::initialize()
 {
+    // 節点（ノード）、要素（セル）メモリプールの生成
+    this->entity_pool = new UdmEntityPool();
     // グリッド座標クラスの生成
     this->grid_coordinates = new UdmGridCoordinates(this);
     // 要素管理クラスの生成
@@ -88,6 +100,12 @@ void UdmZone::initialize()
     this->inner_boundary = new UdmRankConnectivity(this);
     // ユーザ定義データクラスの生成
     this->user_datas = new UdmUserDefinedDatas(this);
+    // 隣接グラフ
+    this->neighbor_graph = new UdmNeighborGraph();
+    // 仮想要素（セル）物理量交換
+    this->halo_exchange = new UdmHaloExchange(this);
+    // 内部境界節点（ノード）物理量集約
+    this->boundary_reduction = new UdmBoundaryReduction(this);
     // ゾーンタイプ
     this->zone_type = Udm_Unstructured;
     // 親モデル
@@ -166,6 +184,17 @@ UdmModel* UdmZone::getParentModel() const
     return this->parent_model;
 }
 
+/**
+ * 親モデルのCGNS出力作業バッファを取得する.
+ * @param size        要求サイズ(byte)
+ * @return        CGNS出力作業バッファ : 親モデルが存在しない場合はNULL
+ */
+void* UdmZone::getScratchBuffer(size_t size) const
+{
+    if (this->parent_model == NULL) return NULL;
+    return this->parent_model->getScratchBuffer(size);
+}
+
 
 
 /**
@@ -189,6 +218,13 @@ UdmError_t UdmZone::setParentModel(UdmModel* model)
  */
 UdmError_t UdmZone::readCgns(int index_file, int index_base, int index_zone, int timeslice_step)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
     char zonename[33] = {0x00};
     cgsize_t sizes[9] = {0x00};
 
@@ -633,6 +669,42 @@ UdmError_t UdmZone::initializeWriteCgns()
     return UDM_OK;
 }
 
+/**
+ * 非同期出力のため、出力するXYZ座標値, 要素接続情報と物理量データを退避バッファにコピーする.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmZone::stageWriteCgns()
+{
+    // 要素接続情報の退避 : 接続情報配列の整理は呼出スレッドにて行う.
+    if (this->getSections()->stageCgnsElements() != UDM_OK) {
+        this->clearStagedWriteCgns();
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_ZONE, "failure : UdmSections::stageCgnsElements()");
+    }
+
+    // XYZ座標値の退避
+    if (this->getGridCoordinates()->stageCgnsGridCoordinates() != UDM_OK) {
+        this->clearStagedWriteCgns();
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_ZONE, "failure : UdmGridCoordinates::stageCgnsGridCoordinates()");
+    }
+
+    // 物理量データの退避
+    if (this->getFlowSolutions()->stageCgnsSolutionFields() != UDM_OK) {
+        this->clearStagedWriteCgns();
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_ZONE, "failure : UdmFlowSolutions::stageCgnsSolutionFields()");
+    }
+    return UDM_OK;
+}
+
+/**
+ * 非同期出力の退避バッファを削除する.
+ */
+void UdmZone::clearStagedWriteCgns()
+{
+    this->getGridCoordinates()->clearStagedGridCoordinates();
+    this->getSections()->clearStagedElements();
+    this->getFlowSolutions()->clearStagedSolutionFields();
+}
+
 
 /**
  * 出力ステップ回数を取得する.
@@ -911,6 +983,13 @@ UdmError_t UdmZone::importCells(
                 const std::vector<UdmCell*>& import_cells,
                 std::vector<UdmNode*>& import_nodes)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
 #ifdef _DEBUG_TRACE
     UDM_DEBUG_PRINTF("%s:%d [%s]",  __FILE__, __LINE__, __FUNCTION__);
 #endif
@@ -993,7 +1072,7 @@ UdmError_t UdmZone::importCells(
 
             if (dest_node == NULL) {
                 // インポート節点（ノード）は使用せず、コピーを作成する.
-                dest_node = new UdmNode();
+                dest_node = new (this->entity_pool) UdmNode();
                 dest_node->cloneNode(*import_node);
             }
             // 接続MPIランク情報を削除する
@@ -1085,6 +1164,12 @@ UdmError_t UdmZone::importVirturalCells(
                 const std::vector<UdmCell*>& import_virtuals,
                 std::vector<UdmNode*>& import_nodes)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
 
     UdmError_t error = UDM_OK;
     int myrank = this->getMpiRankno();
@@ -1140,7 +1225,7 @@ UdmError_t UdmZone::importVirturalCells(
                 }
                 if (dest_node == NULL) {
                     // インポート節点（ノード）は使用せず、コピーを作成する.
-                    dest_node = new UdmNode();
+                    dest_node = new (this->entity_pool) UdmNode();
                     dest_node->cloneNode(*virtual_node);
                     // 内部境界節点（ノード）ではないので、仮想節点（ノード）である。
                     dest_node->setRealityType(Udm_Virtual);
@@ -1192,6 +1277,13 @@ UdmError_t UdmZone::exportCells(
                         const std::vector<UdmCell*>& export_cells,
                         std::vector<UdmEntity*>& export_nodes)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
     if (this->getSections() == NULL) return UDM_ERROR;
     if (this->getGridCoordinates() == NULL) return UDM_ERROR;
     if (this->getRankConnectivity() == NULL) return UDM_ERROR;
@@ -1419,6 +1511,13 @@ UdmError_t UdmZone::broadcastZone()
  */
 UdmError_t UdmZone::cloneZone(const UdmZone& src)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
     // ID : ゾーンID
     this->setId(src.getId());
     // データ型
@@ -1486,6 +1585,13 @@ UdmRankConnectivity* UdmZone::getRankConnectivity() const
  */
 UdmError_t UdmZone::rebuildZone(const std::vector<UdmNode*> import_nodes)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
 #ifdef _UDM_PROFILER
     udm_mpi_barrier(this->getMpiComm());
     UDM_STOPWATCH_START("UdmZone::rebuildZone");
@@ -1570,6 +1676,45 @@ UdmUserDefinedDatas* UdmZone::getUserDefinedDatas() const
     return this->user_datas;
 }
 
+/**
+ * 節点（ノード）、要素（セル）メモリプールを取得する.
+ * @return        節点（ノード）、要素（セル）メモリプール
+ */
+UdmEntityPool* UdmZone::getEntityPool() const
+{
+    return this->entity_pool;
+}
+
+/**
+ * 物理量データ格納タイプを取得する.
+ * @return        物理量データ格納タイプ
+ */
+UdmSolutionStorageType_t UdmZone::getSolutionStorageType() const
+{
+    if (this->grid_coordinates == NULL) return Udm_SolutionStorageUnknown;
+    return this->grid_coordinates->getSolutionStorageType();
+}
+
+/**
+ * 物理量データ格納タイプを設定する.
+ * グリッド座標、要素管理クラスの物理量データ格納タイプを設定する.
+ * @param storage_type        物理量データ格納タイプ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmZone::setSolutionStorageType(UdmSolutionStorageType_t storage_type)
+{
+    UdmError_t error = UDM_OK;
+    if (this->grid_coordinates != NULL) {
+        error = this->grid_coordinates->setSolutionStorageType(storage_type);
+        if (error != UDM_OK) return error;
+    }
+    if (this->sections != NULL) {
+        error = this->sections->setSolutionStorageType(storage_type);
+        if (error != UDM_OK) return error;
+    }
+    return UDM_OK;
+}
+
 /**
  * ドメイン、ランク情報を更新する.
  * @return        エラー番号 : UDM_OK | UDM_ERROR
@@ -1896,6 +2041,188 @@ template UdmError_t UdmZone::setSolutionVectorInCell<long long>(UdmSize_t cell_i
 template UdmError_t UdmZone::setSolutionVectorInCell<float>(UdmSize_t cell_id, const std::string& solution_name, const float* values, unsigned int size);
 template UdmError_t UdmZone::setSolutionVectorInCell<double>(UdmSize_t cell_id, const std::string& solution_name, const double* values, unsigned int size);
 
+/**
+ * 節点（ノード）の物理量データ値を取得する:スカラデータ, 物理量フィールドID.
+ * 物理量フィールドIDはUdmFlowSolutions::getFieldIdにて取得すること.
+ * @param [in]  node_id        節点（ノード）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  value                物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmZone::getSolutionScalarInNode(
+                    UdmSize_t node_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE& value) const
+{
+    if (this->getGridCoordinates() == NULL) return UDM_ERROR;
+    return this->getGridCoordinates()->getSolutionScalar<VALUE_TYPE>(node_id, field_id, value);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を取得する:ベクトルデータ, 物理量フィールドID.
+ * @param [in]  node_id        節点（ノード）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  values                物理量データ値リスト
+ * @return      ベクトルデータ数
+ */
+template<class VALUE_TYPE>
+unsigned int UdmZone::getSolutionVectorinNode(
+                    UdmSize_t node_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE* values) const
+{
+    if (this->getGridCoordinates() == NULL) return 0;
+    return this->getGridCoordinates()->getSolutionVector<VALUE_TYPE>(node_id, field_id, values);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を設定する:スカラデータ, 物理量フィールドID.
+ * @param node_id                節点（ノード）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param value                    物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmZone::setSolutionScalarInNode(
+                        UdmSize_t node_id,
+                        UdmSize_t field_id,
+                        VALUE_TYPE value)
+{
+    if (this->getGridCoordinates() == NULL) return UDM_ERROR;
+    return this->getGridCoordinates()->setSolutionScalar<VALUE_TYPE>(node_id, field_id, value);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を設定する:ベクトルデータ, 物理量フィールドID.
+ * @param node_id                節点（ノード）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param values                    物理量データリスト
+ * @param size                    物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmZone::setSolutionVectorInNode(
+                        UdmSize_t node_id,
+                        UdmSize_t field_id,
+                        const VALUE_TYPE* values,
+                        unsigned int size)
+{
+    if (this->getGridCoordinates() == NULL) return UDM_ERROR;
+    return this->getGridCoordinates()->setSolutionVector<VALUE_TYPE>(node_id, field_id, values, size);
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:スカラデータ, 物理量フィールドID.
+ * 物理量フィールドIDはUdmFlowSolutions::getFieldIdにて取得すること.
+ * @param [in]  cell_id        要素（セル）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  value                物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmZone::getSolutionScalarInCell(
+                    UdmSize_t cell_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE& value) const
+{
+    if (this->getSections() == NULL) return UDM_ERROR;
+    return this->getSections()->getSolutionScalar<VALUE_TYPE>(cell_id, field_id, value);
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:ベクトルデータ, 物理量フィールドID.
+ * @param [in]  cell_id        要素（セル）ID（=１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out]  values                物理量データ値リスト
+ * @return      ベクトルデータ数
+ */
+template<class VALUE_TYPE>
+unsigned int UdmZone::getSolutionVectorInCell(
+                    UdmSize_t cell_id,
+                    UdmSize_t field_id,
+                    VALUE_TYPE* values) const
+{
+    if (this->getSections() == NULL) return 0;
+    return this->getSections()->getSolutionVector<VALUE_TYPE>(cell_id, field_id, values);
+}
+
+/**
+ * 要素（セル）の物理量データ値を設定する:スカラデータ, 物理量フィールドID.
+ * @param cell_id                要素（セル）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param value                    物理量データ値
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmZone::setSolutionScalarInCell(
+                        UdmSize_t cell_id,
+                        UdmSize_t field_id,
+                        VALUE_TYPE value)
+{
+    if (this->getSections() == NULL) return UDM_ERROR;
+    return this->getSections()->setSolutionScalar<VALUE_TYPE>(cell_id, field_id, value);
+}
+
+/**
+ * 要素（セル）の物理量データ値を設定する:ベクトルデータ, 物理量フィールドID.
+ * @param cell_id                要素（セル）ID（=１～）
+ * @param field_id            物理量フィールドID（１～）
+ * @param values                    物理量データリスト
+ * @param size                    物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmZone::setSolutionVectorInCell(
+                        UdmSize_t cell_id,
+                        UdmSize_t field_id,
+                        const VALUE_TYPE* values,
+                        unsigned int size)
+{
+    if (this->getSections() == NULL) return UDM_ERROR;
+    return this->getSections()->setSolutionVector<VALUE_TYPE>(cell_id, field_id, values, size);
+}
+
+template UdmError_t UdmZone::getSolutionScalarInNode<int>(UdmSize_t node_id, UdmSize_t field_id, int& value) const;
+template UdmError_t UdmZone::getSolutionScalarInNode<long long>(UdmSize_t node_id, UdmSize_t field_id, long long& value) const;
+template UdmError_t UdmZone::getSolutionScalarInNode<float>(UdmSize_t node_id, UdmSize_t field_id, float& value) const;
+template UdmError_t UdmZone::getSolutionScalarInNode<double>(UdmSize_t node_id, UdmSize_t field_id, double& value) const;
+
+template unsigned int UdmZone::getSolutionVectorinNode<int>(UdmSize_t node_id, UdmSize_t field_id, int* values) const;
+template unsigned int UdmZone::getSolutionVectorinNode<long long>(UdmSize_t node_id, UdmSize_t field_id, long long* values) const;
+template unsigned int UdmZone::getSolutionVectorinNode<float>(UdmSize_t node_id, UdmSize_t field_id, float* values) const;
+template unsigned int UdmZone::getSolutionVectorinNode<double>(UdmSize_t node_id, UdmSize_t field_id, double* values) const;
+
+template UdmError_t UdmZone::setSolutionScalarInNode<int>(UdmSize_t node_id, UdmSize_t field_id, int value);
+template UdmError_t UdmZone::setSolutionScalarInNode<long long>(UdmSize_t node_id, UdmSize_t field_id, long long value);
+template UdmError_t UdmZone::setSolutionScalarInNode<float>(UdmSize_t node_id, UdmSize_t field_id, float value);
+template UdmError_t UdmZone::setSolutionScalarInNode<double>(UdmSize_t node_id, UdmSize_t field_id, double value);
+
+template UdmError_t UdmZone::setSolutionVectorInNode<int>(UdmSize_t node_id, UdmSize_t field_id, const int* values, unsigned int size);
+template UdmError_t UdmZone::setSolutionVectorInNode<long long>(UdmSize_t node_id, UdmSize_t field_id, const long long* values, unsigned int size);
+template UdmError_t UdmZone::setSolutionVectorInNode<float>(UdmSize_t node_id, UdmSize_t field_id, const float* values, unsigned int size);
+template UdmError_t UdmZone::setSolutionVectorInNode<double>(UdmSize_t node_id, UdmSize_t field_id, const double* values, unsigned int size);
+
+template UdmError_t UdmZone::getSolutionScalarInCell<int>(UdmSize_t cell_id, UdmSize_t field_id, int& value) const;
+template UdmError_t UdmZone::getSolutionScalarInCell<long long>(UdmSize_t cell_id, UdmSize_t field_id, long long& value) const;
+template UdmError_t UdmZone::getSolutionScalarInCell<float>(UdmSize_t cell_id, UdmSize_t field_id, float& value) const;
+template UdmError_t UdmZone::getSolutionScalarInCell<double>(UdmSize_t cell_id, UdmSize_t field_id, double& value) const;
+
+template unsigned int UdmZone::getSolutionVectorInCell<int>(UdmSize_t cell_id, UdmSize_t field_id, int* values) const;
+template unsigned int UdmZone::getSolutionVectorInCell<long long>(UdmSize_t cell_id, UdmSize_t field_id, long long* values) const;
+template unsigned int UdmZone::getSolutionVectorInCell<float>(UdmSize_t cell_id, UdmSize_t field_id, float* values) const;
+template unsigned int UdmZone::getSolutionVectorInCell<double>(UdmSize_t cell_id, UdmSize_t field_id, double* values) const;
+
+template UdmError_t UdmZone::setSolutionScalarInCell<int>(UdmSize_t cell_id, UdmSize_t field_id, int value);
+template UdmError_t UdmZone::setSolutionScalarInCell<long long>(UdmSize_t cell_id, UdmSize_t field_id, long long value);
+template UdmError_t UdmZone::setSolutionScalarInCell<float>(UdmSize_t cell_id, UdmSize_t field_id, float value);
+template UdmError_t UdmZone::setSolutionScalarInCell<double>(UdmSize_t cell_id, UdmSize_t field_id, double value);
+
+template UdmError_t UdmZone::setSolutionVectorInCell<int>(UdmSize_t cell_id, UdmSize_t field_id, const int* values, unsigned int size);
+template UdmError_t UdmZone::setSolutionVectorInCell<long long>(UdmSize_t cell_id, UdmSize_t field_id, const long long* values, unsigned int size);
+template UdmError_t UdmZone::setSolutionVectorInCell<float>(UdmSize_t cell_id, UdmSize_t field_id, const float* values, unsigned int size);
+template UdmError_t UdmZone::setSolutionVectorInCell<double>(UdmSize_t cell_id, UdmSize_t field_id, const double* values, unsigned int size);
+
 /**
  * CGNS:ZoneIterativeDataを取得する.
  * @param [in]  index_file        CGNSファイルインデックス
@@ -1977,6 +2304,13 @@ UdmError_t UdmZone::readCgnsZoneIterativeDatas(
  */
 UdmError_t UdmZone::clearVertialCells()
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
     UdmError_t error = UDM_OK;
 
     // 仮想要素（セル）を削除する.
@@ -2119,6 +2453,13 @@ UdmError_t UdmZone::writeVirtualZone(int index_file, int index_base, int &index_
  */
 UdmError_t UdmZone::joinCgnsZone(const UdmZone* dest_zone)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
     UdmError_t error = UDM_OK;
 
     // 部品要素を削除する
@@ -2160,6 +2501,13 @@ UdmError_t UdmZone::joinCgnsZone(const UdmZone* dest_zone)
  */
 UdmError_t UdmZone::transferVirtualCells(std::vector<UdmNode*>& virtual_nodes)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+    // 仮想要素（セル）物理量交換計画を破棄する.
+    this->clearHaloExchange();
+    // 内部境界節点（ノード）物理量集約計画を破棄する.
+    this->clearBoundaryReduction();
+
     if (this->getRankConnectivity() == NULL) return UDM_ERROR;
     return this->getRankConnectivity()->transferVirtualCells(virtual_nodes);
 }
@@ -2207,19 +2555,22 @@ void UdmZone::setPartitionWeight(bool set_weight)
 
 /**
  * 節点（ノード）が接続している要素（セル）数を取得する.
+ * 接続要素（セル）が未作成の場合は、すべての節点（ノード）の接続要素（セル）を作成する.
  * @param node_id        節点（ノード）ID
  * @return            接続要素（セル）数
  */
 int UdmZone::getNumConnectivityCells(UdmSize_t node_id) const
 {
     if (this->getGridCoordinates() == NULL) return 0;
-    UdmNode *node = this->getGridCoordinates()->getNodeById(node_id);
-    if (node == NULL) return 0;
-    return node->getNumConnectivityCells();
+    if (!this->neighbor_graph->isCreatedConnectivityCells(this->getGridCoordinates())) {
+        this->neighbor_graph->createConnectivityCells(this->getGridCoordinates());
+    }
+    return this->neighbor_graph->getNumConnectivityCells(node_id);
 }
 
 /**
  * 節点（ノード）が接続している要素（セル）を取得する.
+ * 接続要素（セル）が未作成の場合は、すべての節点（ノード）の接続要素（セル）を作成する.
  * @param  node_id        節点（ノード）ID
  * @param  connectivity_id        接続ID : 1～getNumConnectivityCells(node_id)
  * @return        接続要素（セル）数
@@ -2227,9 +2578,27 @@ int UdmZone::getNumConnectivityCells(UdmSize_t node_id) const
 UdmCell* UdmZone::getConnectivityCell(UdmSize_t node_id, int connectivity_id) const
 {
     if (this->getGridCoordinates() == NULL) return 0;
-    UdmNode *node = this->getGridCoordinates()->getNodeById(node_id);
-    if (node == NULL) return 0;
-    return node->getConnectivityCell(connectivity_id);
+    if (!this->neighbor_graph->isCreatedConnectivityCells(this->getGridCoordinates())) {
+        this->neighbor_graph->createConnectivityCells(this->getGridCoordinates());
+    }
+    return this->neighbor_graph->getConnectivityCell(node_id, connectivity_id);
+}
+
+/**
+ * 節点（ノード）-要素（セル）の接続グラフをCSR形式で取得する.
+ * xadjは節点（ノード）数+1のオフセット（０～）、adjncyは接続要素（セル）のローカルID（１～）とする.
+ * xadj, adjncyにNULLを指定した場合は、adjncyサイズのみを返す.
+ * @param [out] xadj        接続オフセット配列 : 節点（ノード）数+1
+ * @param [out] adjncy        接続要素（セル）ローカルID配列
+ * @return        接続要素（セル）ローカルID配列サイズ
+ */
+UdmSize_t UdmZone::getConnectivityCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const
+{
+    if (this->getGridCoordinates() == NULL) return 0;
+    if (!this->neighbor_graph->isCreatedConnectivityCells(this->getGridCoordinates())) {
+        this->neighbor_graph->createConnectivityCells(this->getGridCoordinates());
+    }
+    return this->neighbor_graph->getConnectivityCellsGraph(xadj, adjncy);
 }
 
 /**
@@ -2261,19 +2630,22 @@ UdmNode* UdmZone::getConnectivityNode(UdmSize_t cell_id, int connectivity_id) co
 
 /**
  * 要素（セル）の隣接要素（セル）数を取得する.
+ * 隣接要素（セル）が未作成の場合は、すべての要素（セル）の隣接要素（セル）を作成する.
  * @param cell_id        要素（セル）ID
  * @return        隣接要素（セル）数
  */
 int UdmZone::getNumNeighborCells(UdmSize_t cell_id) const
 {
     if (this->getSections() == NULL) return 0;
-    UdmCell *cell = this->getSections()->getEntityCell(cell_id);
-    if (cell == NULL) return 0;
-    return cell->getNumNeighborCells();
+    if (!this->neighbor_graph->isCreatedNeighborCells(this->getSections())) {
+        this->neighbor_graph->createNeighborCells(this->getSections());
+    }
+    return this->neighbor_graph->getNumNeighborCells(cell_id);
 }
 
 /**
  * 要素（セル）の隣接要素（セル）を取得する.
+ * 隣接要素（セル）が未作成の場合は、すべての要素（セル）の隣接要素（セル）を作成する.
  * @param  cell_id        要素（セル）ID
  * @param  neighbor_id        隣接ID : 1～getNumNeighborCells(cell_id)
  * @return        隣接要素（セル）数
@@ -2281,27 +2653,48 @@ int UdmZone::getNumNeighborCells(UdmSize_t cell_id) const
 UdmCell* UdmZone::getNeighborCell(UdmSize_t cell_id, int neighbor_id) const
 {
     if (this->getSections() == NULL) return 0;
-    UdmCell *cell = this->getSections()->getEntityCell(cell_id);
-    if (cell == NULL) return 0;
-    return cell->getNeighborCell(neighbor_id);
+    if (!this->neighbor_graph->isCreatedNeighborCells(this->getSections())) {
+        this->neighbor_graph->createNeighborCells(this->getSections());
+    }
+    return this->neighbor_graph->getNeighborCell(cell_id, neighbor_id);
+}
+
+/**
+ * 要素（セル）-要素（セル）の隣接グラフをCSR形式で取得する.
+ * xadjは要素（セル）数+1のオフセット（０～）、adjncyは隣接要素（セル）のローカルID（１～）とする.
+ * xadj, adjncyにNULLを指定した場合は、adjncyサイズのみを返す.
+ * @param [out] xadj        隣接オフセット配列 : 要素（セル）数+1
+ * @param [out] adjncy        隣接要素（セル）ローカルID配列
+ * @return        隣接要素（セル）ローカルID配列サイズ
+ */
+UdmSize_t UdmZone::getNeighborCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const
+{
+    if (this->getSections() == NULL) return 0;
+    if (!this->neighbor_graph->isCreatedNeighborCells(this->getSections())) {
+        this->neighbor_graph->createNeighborCells(this->getSections());
+    }
+    return this->neighbor_graph->getNeighborCellsGraph(xadj, adjncy);
 }
 
 
 /**
  * 節点（ノード）の隣接節点（ノード）数を取得する.
+ * 隣接節点（ノード）が未作成の場合は、すべての節点（ノード）の隣接節点（ノード）を作成する.
  * @param node_id        節点（ノード）ID
  * @return        隣接節点（ノード）数
  */
 int UdmZone::getNumNeighborNodes(UdmSize_t node_id) const
 {
     if (this->getGridCoordinates() == NULL) return 0;
-    UdmNode *node = this->getGridCoordinates()->getNodeById(node_id);
-    if (node == NULL) return 0;
-    return node->getNumNeighborNodes();
+    if (!this->neighbor_graph->isCreatedNeighborNodes(this->getGridCoordinates())) {
+        this->neighbor_graph->createNeighborNodes(this->getGridCoordinates());
+    }
+    return this->neighbor_graph->getNumNeighborNodes(node_id);
 }
 
 /**
  * 節点（ノード）の隣接節点（ノード）を取得する.
+ * 隣接節点（ノード）が未作成の場合は、すべての節点（ノード）の隣接節点（ノード）を作成する.
  * @param  node_id        節点（ノード）ID
  * @param  neighbor_id        隣接ID : 1～getNumNeighborCells(cell_id)
  * @return        隣接節点（ノード）数
@@ -2309,9 +2702,145 @@ int UdmZone::getNumNeighborNodes(UdmSize_t node_id) const
 UdmNode* UdmZone::getNeighborNode(UdmSize_t node_id, int neighbor_id) const
 {
     if (this->getGridCoordinates() == NULL) return 0;
-    UdmNode *node = this->getGridCoordinates()->getNodeById(node_id);
-    if (node == NULL) return 0;
-    return node->getNeighborNode(neighbor_id);
+    if (!this->neighbor_graph->isCreatedNeighborNodes(this->getGridCoordinates())) {
+        this->neighbor_graph->createNeighborNodes(this->getGridCoordinates());
+    }
+    return this->neighbor_graph->getNeighborNode(node_id, neighbor_id);
+}
+
+/**
+ * 節点（ノード）-節点（ノード）の隣接グラフをCSR形式で取得する.
+ * xadjは節点（ノード）数+1のオフセット（０～）、adjncyは隣接節点（ノード）のローカルID（１～）とする.
+ * xadj, adjncyにNULLを指定した場合は、adjncyサイズのみを返す.
+ * @param [out] xadj        隣接オフセット配列 : 節点（ノード）数+1
+ * @param [out] adjncy        隣接節点（ノード）ローカルID配列
+ * @return        隣接節点（ノード）ローカルID配列サイズ
+ */
+UdmSize_t UdmZone::getNeighborNodesGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const
+{
+    if (this->getGridCoordinates() == NULL) return 0;
+    if (!this->neighbor_graph->isCreatedNeighborNodes(this->getGridCoordinates())) {
+        this->neighbor_graph->createNeighborNodes(this->getGridCoordinates());
+    }
+    return this->neighbor_graph->getNeighborNodesGraph(xadj, adjncy);
+}
+
+/**
+ * 隣接要素（セル）、隣接節点（ノード）、接続要素（セル）を破棄する.
+ * 要素（セル）、部品要素（セル）の構成を変更した場合に呼び出す.
+ * 次回の隣接要素（セル）、隣接節点（ノード）、接続要素（セル）の参照時に再作成する.
+ */
+void UdmZone::clearNeighborGraph()
+{
+    if (this->neighbor_graph != NULL) {
+        this->neighbor_graph->clearNeighborGraph();
+    }
+}
+
+/**
+ * 仮想要素（セル）物理量交換クラスを取得する.
+ * @return        仮想要素（セル）物理量交換クラス
+ */
+UdmHaloExchange* UdmZone::getHaloExchange() const
+{
+    return this->halo_exchange;
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量交換計画を作成する.
+ * transferVirtualCells後に全ランクで実行すること.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmZone::createHaloExchange()
+{
+    if (this->halo_exchange == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "halo_exchange is null.");
+    }
+    return this->halo_exchange->createExchangePlan();
+}
+
+/**
+ * 仮想要素（セル）物理量交換計画を破棄する.
+ * 節点（ノード）, 要素（セル）の構成を変更した場合に呼び出す.
+ */
+void UdmZone::clearHaloExchange()
+{
+    if (this->halo_exchange != NULL) {
+        this->halo_exchange->clearExchangePlan();
+    }
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量の送受信を開始する.
+ * 交換計画が未作成の場合は作成する.
+ * @param field_names        送受信物理量名称リスト
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmZone::startHaloExchange(const std::vector<std::string> &field_names)
+{
+    UdmError_t error = UDM_OK;
+    if (this->halo_exchange == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "halo_exchange is null.");
+    }
+    if (!this->halo_exchange->isCreatedPlan()) {
+        error = this->halo_exchange->createExchangePlan();
+        if (error != UDM_OK) return UDM_ERRORNO_HANDLER(error);
+    }
+    return this->halo_exchange->startExchange(field_names);
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量の受信完了を待って、物理量を設定する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmZone::finishHaloExchange()
+{
+    if (this->halo_exchange == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "halo_exchange is null.");
+    }
+    return this->halo_exchange->finishExchange();
+}
+
+/**
+ * 内部境界節点（ノード）物理量集約クラスを取得する.
+ * @return        内部境界節点（ノード）物理量集約クラス
+ */
+UdmBoundaryReduction* UdmZone::getBoundaryReduction() const
+{
+    return this->boundary_reduction;
+}
+
+/**
+ * 内部境界節点（ノード）物理量集約計画を破棄する.
+ * 節点（ノード）, 内部境界情報を変更した場合に呼び出す.
+ */
+void UdmZone::clearBoundaryReduction()
+{
+    if (this->boundary_reduction != NULL) {
+        this->boundary_reduction->clearReductionPlan();
+    }
+}
+
+/**
+ * 内部境界節点（ノード）の物理量を接続ランク間で集約する.
+ * 集約計画が未作成の場合は作成する.
+ * @param field_names        集約物理量名称リスト : 節点（ノード）物理量
+ * @param reduce_type        集約演算タイプ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmZone::reduceBoundaryNodes(
+                const std::vector<std::string> &field_names,
+                UdmReduceType_t reduce_type)
+{
+    UdmError_t error = UDM_OK;
+    if (this->boundary_reduction == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "boundary_reduction is null.");
+    }
+    if (!this->boundary_reduction->isCreatedPlan()) {
+        error = this->boundary_reduction->createReductionPlan();
+        if (error != UDM_OK) return UDM_ERRORNO_HANDLER(error);
+    }
+    return this->boundary_reduction->reduceSolutions(field_names, reduce_type);
 }
 
 /**
@@ -2389,6 +2918,9 @@ void UdmZone::insertImportGlobalRankids(
  */
 UdmError_t UdmZone::createComponentCells(const std::vector<UdmNode*> import_nodes)
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+
     UdmError_t error = UDM_OK;
     // 再構成対象節点（ノード）の親要素（セル）を探索する.
     UdmScannerCells scanner;
@@ -2417,6 +2949,9 @@ UdmError_t UdmZone::createComponentCells(const std::vector<UdmNode*> import_node
  */
 UdmError_t UdmZone::createComponentCells()
 {
+    // 隣接グラフを破棄する.
+    this->clearNeighborGraph();
+
     UdmError_t error = UDM_OK;
     if (this->getSections() == NULL) return UDM_ERROR;
     error = this->getSections()->createComponentCells();
@@ -24,6 +24,7 @@
 #include "model/UdmRankConnectivity.h"
 #include "partition/UdmLoadBalance.h"
 #include "utils/UdmSerialization.h"
+#include "partition/UdmMigrationPipeline.h"
 
 namespace udm
 {
@@ -123,7 +124,6 @@ UdmError_t UdmLoadBalance::partitionZone(UdmZone *zone)
     int *importProcs, *importToPart, *exportProcs, *exportToPart;
     int zoltan_result;
     int mpi_flag;
-    int n;
 
     // MPI初期化済みであるかチェックする.
     MPI_Initialized(&mpi_flag);
@@ -225,70 +225,20 @@ UdmError_t UdmLoadBalance::partitionZone(UdmZone *zone)
 
 #ifdef _UDM_PROFILER
     udm_mpi_barrier(this->getMpiComm());
-    UDM_STOPWATCH_START("Zoltan::Migrate");
+    UDM_STOPWATCH_START("UdmLoadBalance::migrateCells");
 #endif
 
-    // 転送セルのオブジェクトサイズを取得する.
-    size_t total_cells_size = scanner->scannerCellsSize(
-                                                numGidEntries,
-                                                numLidEntries,
-                                                numExport,
-                                                exportGlobalGids,
-                                                exportLocalGids,
-                                                exportProcs);
-
-    // 転送回数を取得する。すべてのランク間のMAX値
-    int num_divide = (int)ceil((double)total_cells_size/(double)UDM_MIGRATION_MAXSIZE);
-    int num_migrate_count = 0;
-    udm_mpi_allreduce(&num_divide, &num_migrate_count, 1, MPI_INT, MPI_MAX, this->getMpiComm());
-
-    const std::vector<int> cell_sizes = scanner->getScanCellSizes();
-    std::vector<int>::const_iterator cell_itr = cell_sizes.begin();
-    int migrate_pos = 0;
-    int num_sub_exports = 0;
-    size_t migrate_size = 0;
-    for (n=0; n<num_migrate_count; n++) {
-        migrate_size = 0;
-        num_sub_exports = 0;
-        for (; cell_itr!=cell_sizes.end(); cell_itr++) {
-            migrate_size += (*cell_itr);
-            if (migrate_size > UDM_MIGRATION_MAXSIZE) {
-                break;
-            }
-            num_sub_exports++;
-        }
-
-        // 転送位置を設定する
-        scanner->setScanIterator(migrate_pos);
-
-        // Zoltan転送を行う.
-        zoltan_result = this->zoltan->Migrate(
-                                -1,
-                                NULL,
-                                NULL,
-                                NULL,
-                                NULL,
-                                num_sub_exports,
-                                exportGlobalGids + migrate_pos*numGidEntries,
-                                exportLocalGids + migrate_pos*numLidEntries,
-                                exportProcs + migrate_pos,
-                                exportToPart + migrate_pos);
-
-        migrate_pos += num_sub_exports;
-
-        printf("[rank=%d] Zoltan::Migrate loop = %d/%d, size=%ld\n",
-                this->getMpiRankno(), n+1, num_migrate_count, migrate_size);
-
-#ifdef _DEBUG
-        if (UDM_IS_DEBUG_LEVEL()) {
-            UDM_DEBUG_PRINTF("[rank=%d] Zoltan::Migrate loop = %d/%d, size=%d\n",
-                            this->getMpiRankno(), n+1, num_migrate_count, migrate_size);
-        }
-#endif
-    }
-
-    if (zoltan_result != ZOLTAN_OK) {
-        error = UDM_ERRORNO_HANDLER(UDM_ERROR_ZOLTAN_MIGRATE);
+    // 転送要素（セル）を転送先ランク別の列形式テーブルにて送受信する.
+    error = this->migrateCells(
+                            scanner,
+                            numGidEntries,
+                            numImport,
+                            importProcs,
+                            numExport,
+                            exportGlobalGids,
+                            exportProcs);
+    if (error != UDM_OK) {
+        error = UDM_ERRORNO_HANDLER(error);
     }
 
     // ACK
@@ -298,7 +248,7 @@ UdmError_t UdmLoadBalance::partitionZone(UdmZone *zone)
     }
 
 #ifdef _UDM_PROFILER
-    UDM_STOPWATCH_STOP("Zoltan::Migrate");
+    UDM_STOPWATCH_STOP("UdmLoadBalance::migrateCells");
 #endif
 
 #ifdef _DEBUG_TRACE
@@ -307,6 +257,7 @@ UdmError_t UdmLoadBalance::partitionZone(UdmZone *zone)
         char buf[8096] = {0x00};
         int my_rank = zone->getMpiRankno();
         int pos;
+        int n;
         sprintf(buf, "[rank:%d] numImport=%d\n", my_rank, numImport);
         stream << buf;
         sprintf(buf, "[rank:%d] importGlobalGids : ", my_rank);
@@ -612,10 +563,6 @@ UdmError_t UdmLoadBalance::setZoltanParameters(UdmScannerCells *scanner)
         this->zoltan->Set_Edge_List_Multi_Fn(UdmLoadBalance::zoltan_get_edge_list_multi, scanner);
     }
 
-    this->zoltan->Set_Obj_Size_Multi_Fn(UdmLoadBalance::zoltan_obj_size_multi, scanner);
-    this->zoltan->Set_Pack_Obj_Multi_Fn(UdmLoadBalance::zoltan_pack_obj_multi, scanner);
-    this->zoltan->Set_Unpack_Obj_Multi_Fn(UdmLoadBalance::zoltan_unpack_obj_multi, scanner);
-
 #endif        /* WITHOUT_MPI */
 
     return UDM_OK;
@@ -952,323 +899,6 @@ void UdmLoadBalance::zoltan_get_edge_list_multi(
 
     return;
 }
-
-
-/**
- * Zoltan:Migration呼出関数:データ転送を行うデータサイズを設定する.
- * @param [in]  data        UdmScannerCells
- * @param [in] num_gid_entries    グローバルIDのデータサイズ
- * @param [in] num_lid_entries    ローカルIDのデータサイズ
- * @param [in] num_ids            データ転送頂点数
- * @param [in] global_ids        グローバルIDリスト
- * @param [in] local_ids        ローカルIDリスト
- * @param [out] sizes            データサイズ
- * @param [out] ierr            エラー番号
- */
-void UdmLoadBalance::zoltan_obj_size_multi(
-                            void* data,
-                            int num_gid_entries,
-                            int num_lid_entries,
-                            int num_ids,
-                            ZOLTAN_ID_PTR global_ids,
-                            ZOLTAN_ID_PTR local_ids,
-                            int* sizes,
-                            int* ierr)
-{
-    UdmScannerCells* scanner = static_cast<UdmScannerCells*>(data);
-    if (scanner == NULL) {
-        *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "UdmScannerCells is null.");
-        return;
-    }
-
-#ifdef _DEBUG
-    size_t proc1_size = 0;
-    int pos = 0;
-    UdmSize_t cell_id;
-    int rankno;
-#endif
-
-    int i;
-    size_t total_size = 0;
-    // 転送位置
-    int migrate_pos = scanner->getScanIterator();
-    // 取得済みのシリアライズセルサイズ
-    const std::vector<int> cell_sizes = scanner->getScanCellSizes();
-    if (cell_sizes.size() > 0) {
-        for (i = 0; i < num_ids; i++) {
-
-#ifdef _DEBUG
-            // global_idsから要素（セル）IDの取得
-            pos += udm_get_entryid(global_ids+pos, cell_id, rankno, num_gid_entries);
-#endif
-
-            if (cell_sizes.size() <= (size_t)migrate_pos+i) {
-                *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_ZOLTAN_MIGRATE,
-                                "get position[%d] over than cell_sizes.size()[%d].",
-                                migrate_pos+i, cell_sizes.size());
-                return;
-            }
-            sizes[i] = cell_sizes[migrate_pos+i];
-            total_size += sizes[i];
-        }
-    }
-    else {
-        /**** ここを通ることはない  ****/
-        // 要素（セル）のシリアライズサイズを取得する.
-        const UdmZone *zone = scanner->getScanZone();
-        if (zone == NULL) {
-            *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmZone is null.");
-            return;
-        }
-
-        UdmSerializeBuffer streamBuffer;        // バッファ(char*)をNULLとする
-        UdmSerializeArchive archive(&streamBuffer);
-        UdmSize_t cell_id;
-        int rankno;
-        int pos = 0;
-        for (i = 0; i < num_ids; i++) {
-            // global_idsから要素（セル）IDの取得
-            pos += udm_get_entryid(global_ids+pos, cell_id, rankno, num_gid_entries);
-            const UdmCell *cell = UdmLoadBalance::getEntityCell(zone, cell_id);
-            if (cell == NULL) {
-                *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "not found cell(cell_id=%d,rankno=%d)", cell_id, rankno);
-                return;
-            }
-            archive << *cell;
-#if 0
-            // 終了マーク
-            archive << "END";
-#endif
-            size_t buf_size = archive.getOverflowSize();
-            sizes[i] = buf_size;
-            total_size += buf_size;
-            // バッファークリア
-            archive.clear();
-        }
-    }
-
-    return;
-}
-
-/**
- * Zoltan:Migration呼出関数:転送データを送信する.
- * @param [in]  data        UdmScannerCells
- * @param [in] num_gid_entries    グローバルIDのデータサイズ
- * @param [in] num_lid_entries    ローカルIDのデータサイズ
- * @param [in] num_ids            データ転送頂点数
- * @param [in] global_ids        グローバルIDリスト
- * @param [in] local_ids        ローカルIDリスト
- * @param [in]  dests            転送先プロセス番号
- * @param [in] sizes            転送データサイズ
- * @param [in]  idx                転送バッファ(=buf)のデータ先頭位置リスト
- * @param [out] buf                転送バッファ
- * @param [out] ierr            エラー番号
- */
-void UdmLoadBalance::zoltan_pack_obj_multi(
-                            void* data,
-                            int num_gid_entries,
-                            int num_lid_entries,
-                            int num_ids,
-                            ZOLTAN_ID_PTR global_ids,
-                            ZOLTAN_ID_PTR local_ids,
-                            int* dests,
-                            int* sizes,
-                            int* idx,
-                            char* buf,
-                            int* ierr)
-{
-#ifdef _UDM_PROFILER
-    UDM_STOPWATCH_START(__FUNCTION__);
-#endif
-
-    UdmScannerCells* scanner = static_cast<UdmScannerCells*>(data);
-    if (scanner == NULL) {
-        *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "UdmScannerCells is null.");
-        return;
-    }
-
-    // 要素（セル）のシリアライズデータを取得する.
-    const UdmZone *zone = scanner->getScanZone();
-    if (zone == NULL) {
-        *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmZone is null.");
-        return;
-    }
-#ifdef _DEBUG
-    size_t proc1_size = 0;
-#endif
-
-    UdmSerializeBuffer streamBuffer;
-    UdmSerializeArchive archive(&streamBuffer);
-    UdmSize_t cell_id;
-    int rankno;
-    int i;
-    int pos = 0;
-    int total_size = 0;
-    for (i = 0; i < num_ids; i++) {
-        // global_idsから要素（セル）IDの取得
-        pos += udm_get_entryid(global_ids+pos, cell_id, rankno, num_gid_entries);
-        UdmCell *cell = UdmLoadBalance::getEntityCell(zone, cell_id);
-        if (cell == NULL) {
-            *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "not found cell(cell_id=%d,rankno=%d)", cell_id, rankno);
-            return;
-        }
-
-        // charバッファーをセットする.
-        archive.initialize(buf + idx[i], sizes[i]);
-        // シリアライズ
-        archive << *cell;
-#if 0
-        // 終了マーク
-        archive << "END";
-#endif
-        total_size += sizes[i];
-
-//        if (!archive.validateFinish()) {
-//            *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_SERIALIZE, "abend serialize [num_ids=%d]", i);
-//            return;
-//        }
-
-        // エクスポート要素（セル）の追加
-        scanner->insertExportCell(cell);
-
-        // バッファークリア
-        archive.clear();
-
-#ifdef _DEBUG
-        if (dests[i] == 1) {
-            proc1_size += sizes[i];
-        }
-#endif
-    }
-#ifdef _DEBUG
-    printf("[rank=%d] zoltan_pack_obj_multi: proc1 size = %ld\n",
-            zone->getMpiRankno(), proc1_size);
-#endif
-
-#ifdef _UDM_PROFILER
-    UDM_STOPWATCH_STOP(__FUNCTION__);
-    char info[128] = {0x00};
-    sprintf(info, "zoltan_pack_obj_multi:count=%d,total_size=%d", num_ids, total_size);
-    UDM_STOPWATCH_INFORMATION(__FUNCTION__, info);
-#endif
-    return;
-}
-
-/**
- * Zoltan:Migration呼出関数:転送データを受信する.
- * @param [in]  data        UdmScannerCells
- * @param [in] num_gid_entries    グローバルIDのデータサイズ
- * @param [in] num_ids            データ転送頂点数
- * @param [in] global_ids        グローバルIDリスト
- * @param [in] sizes            転送データサイズ
- * @param [in] idx                転送バッファ(=buf)のデータ先頭位置リスト
- * @param [in] buf                転送バッファ
- * @param [out] ierr            エラー番号
- */
-void UdmLoadBalance::zoltan_unpack_obj_multi(
-                            void* data,
-                            int num_gid_entries,
-                            int num_ids,
-                            ZOLTAN_ID_PTR global_ids,
-                            int* sizes,
-                            int* idx,
-                            char* buf,
-                            int* ierr)
-{
-#ifdef _UDM_PROFILER
-    UDM_STOPWATCH_START(__FUNCTION__);
-#endif
-
-    UdmScannerCells* scanner = static_cast<UdmScannerCells*>(data);
-    if (scanner == NULL) {
-        *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "UdmScannerCells is null.");
-        return;
-    }
-
-    // 要素（セル）のシリアライズデータを取得する.
-    const UdmZone *zone = scanner->getScanZone();
-    if (zone == NULL) {
-        *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmZone is null.");
-        return;
-    }
-
-    int myrank = zone->getMpiRankno();
-    UdmSize_t cell_id;
-    int rankno;
-    int i;
-    int pos = 0;
-    size_t total_size = 0;
-    for (i = 0; i < num_ids; i++) {
-        if (sizes[i] == 0) continue;
-
-        // global_idsから要素（セル）IDの取得
-        pos += udm_get_entryid(global_ids+pos, cell_id, rankno, num_gid_entries);
-        const UdmCell *cell = NULL;
-        if (myrank == rankno) {
-            cell = UdmLoadBalance::getEntityCell(zone, cell_id);
-            if (cell == NULL) {
-                *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "not found cell(cell_id=%d,rankno=%d)", cell_id, rankno);
-                return;
-            }
-        }
-
-        // デシリアライズを行う.
-        char* unpack_buf = buf + idx[i];
-        int unpack_size = sizes[i];
-        total_size += sizes[i];
-
-        UdmSerializeBuffer streamBuffer(unpack_buf, unpack_size);
-        UdmSerializeArchive archive(&streamBuffer);
-
-#if 0         // tellg, seekg削除
-        // 要素（セル）:現在位置
-        // std::iostream::pos_type cur = archive.tellg();
-        size_t cur = archive.tellg();
-
-        UdmSize_t id;
-        UdmDataType_t data_type;
-        UdmElementType_t element_type;
-
-        // UdmEntity基本情報
-        UdmCell::deserializeEntityBase(archive, id, element_type);
-
-        // 要素（セル）の生成
-        UdmCell *deser_cell = UdmCell::factoryCell(element_type);
-
-        // 要素（セル）:現在位置まで戻す。
-        archive.seekg(cur);
-#endif
-
-        // デシリアライズを行う。UdmSolid固定とする
-        UdmCell *deser_cell = new UdmSolid();
-        archive >> *deser_cell;
-
-#if 0
-        // 終了マークチェック
-        char strend[8] = {0x00};
-        archive.readString(strend, 3);
-        if (strcmp(strend, "END") != 0) {
-            *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize to check end mark [num_ids=%d]", i);
-            return;
-        }
-#endif
-        if (!archive.validateFinish()) {
-            *ierr = (int)UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize [num_ids=%d]", i);
-            return;
-        }
-
-        // インポート要素（セル）の追加
-        scanner->insertImportCell(deser_cell);
-    }
-
-#ifdef _UDM_PROFILER
-    UDM_STOPWATCH_STOP(__FUNCTION__);
-    char info[128] = {0x00};
-    sprintf(info, "zoltan_unpack_obj_multi:count=%d,total_size=%d", num_ids, total_size);
-    UDM_STOPWATCH_INFORMATION(__FUNCTION__, info);
-#endif
-    return;
-}
 #endif        /* WITHOUT_MPI */
 
 /**
@@ -1361,6 +991,115 @@ UdmError_t UdmLoadBalance::exportProcess(
 
     return UDM_OK;
 }
+
+/**
+ * エクスポート要素（セル）を転送先ランクに転送し、インポート要素（セル）を受信する.
+ * 転送先ランク別のエクスポート要素（セル）を分割転送パイプライン(UdmMigrationPipeline)にて、
+ * 列形式(UdmMigrationArchive)のチャンクに分けて転送先ランクとのみ非同期送受信を行う.
+ * 同時に保持する送受信チャンクのサイズはMIGRATION_MEMORY_SIZEパラメータ以下とする.
+ * 受信元ランクはZoltanのインポートリストから取得する.
+ * エクスポート要素（セル）が取得できない場合も分割転送は行い、転送先ランクに終了メッセージのみ送信してからエラーを返す.
+ * @param scanner            要素（セル）グラフデータ : エクスポート要素（セル）, インポート要素（セル）を追加する.
+ * @param numGidEntries        グローバルIDのデータサイズ
+ * @param numImport            インポート頂点数
+ * @param importProcs        インポート元プロセス番号
+ * @param numExport            エクスポート頂点数
+ * @param exportGlobalGids    エクスポートグローバルIDリスト
+ * @param exportProcs        エクスポート先プロセス番号
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmLoadBalance::migrateCells(
+                        UdmScannerCells *scanner,
+                        int numGidEntries,
+                        int numImport,
+                        int *importProcs,
+                        int numExport,
+                        ZOLTAN_ID_PTR exportGlobalGids,
+                        int *exportProcs)
+{
+    UdmError_t error = UDM_OK, ierror;
+    const UdmZone *zone = scanner->getScanZone();
+    if (zone == NULL) {
+        error = UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmZone is null.");
+    }
+    int myrank = this->getMpiRankno();
+    UdmSize_t cell_id;
+    int rankno;
+    int i;
+    int pos = 0;
+
+    // 転送先ランク別のエクスポート要素（セル）
+    std::map< int, std::vector<UdmCell*> > export_cells;
+    for (i = 0; i < numExport; i++) {
+        // global_idsから要素（セル）IDの取得
+        pos += udm_get_entryid(exportGlobalGids+pos, cell_id, rankno, numGidEntries);
+        std::vector<UdmCell*> &cells = export_cells[exportProcs[i]];
+        if (error != UDM_OK) continue;
+        UdmCell *cell = UdmLoadBalance::getEntityCell(zone, cell_id);
+        if (cell == NULL) {
+            error = UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "not found cell(cell_id=%d,rankno=%d)", cell_id, rankno);
+            continue;
+        }
+        cells.push_back(cell);
+
+        // エクスポート要素（セル）の追加
+        scanner->insertExportCell(cell);
+    }
+
+    // エラーの場合も分割転送にて転送先ランクに終了メッセージのみ送信して、全ランクの転送を完了させる.
+    std::map< int, std::vector<UdmCell*> >::iterator export_itr;
+    if (error != UDM_OK) {
+        for (export_itr=export_cells.begin(); export_itr!=export_cells.end(); export_itr++) {
+            export_itr->second.clear();
+        }
+    }
+
+    // 受信元ランク
+    std::set<int> import_ranks;
+    for (i = 0; i < numImport; i++) {
+        if (importProcs[i] != myrank) import_ranks.insert(importProcs[i]);
+    }
+
+    // 分割転送
+    size_t memory_size = UDM_MIGRATION_MEMORY_SIZE;
+    if (this->config != NULL) {
+        memory_size = this->config->getMigrationMemorySize();
+    }
+    UdmMigrationPipeline pipeline(memory_size);
+    std::vector<UdmCell*> import_cells;
+    ierror = pipeline.migrateCells(
+                            this->getMpiComm(),
+                            zone,
+                            export_cells,
+                            import_ranks,
+                            import_cells);
+    if (ierror != UDM_OK && error == UDM_OK) error = ierror;
+    std::vector<UdmCell*>::iterator import_itr;
+    if (error != UDM_OK) {
+        for (import_itr=import_cells.begin(); import_itr!=import_cells.end(); import_itr++) {
+            UdmCell::freeDeserialize(*import_itr);
+        }
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    // インポート要素（セル）の追加
+    for (import_itr=import_cells.begin(); import_itr!=import_cells.end(); import_itr++) {
+        scanner->insertImportCell(*import_itr);
+    }
+
+#ifdef _UDM_PROFILER
+    char info[256] = {0x00};
+    sprintf(info, "migrateCells:export=%d,import=%d,send_size=%lld,send_chunks=%d,recv_chunks=%d,max_inflight=%lld",
+                numExport, (int)import_cells.size(),
+                pipeline.getSendSize(),
+                pipeline.getNumSendChunks(),
+                pipeline.getNumRecvChunks(),
+                (long long)pipeline.getMaxInflightSize());
+    UDM_STOPWATCH_INFORMATION("UdmLoadBalance::migrateCells", info);
+#endif
+
+    return UDM_OK;
+}
 #endif        /* WITHOUT_MPI */
 
 /**
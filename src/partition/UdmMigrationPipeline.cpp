@@ -0,0 +1,614 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmMigrationPipeline.cpp
+ * 分割転送パイプラインクラスのソースファイル
+ */
+
+#include "partition/UdmMigrationPipeline.h"
+#include "model/UdmZone.h"
+#include "model/UdmCell.h"
+#include "utils/UdmMigrationArchive.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ */
+UdmMigrationPipeline::UdmMigrationPipeline()
+{
+    this->initialize();
+}
+
+/**
+ * コンストラクタ
+ * @param memory_size        送受信バッファ上限サイズ(byte)
+ */
+UdmMigrationPipeline::UdmMigrationPipeline(size_t memory_size)
+{
+    this->initialize();
+    this->setMemorySize(memory_size);
+}
+
+/**
+ * デストラクタ
+ */
+UdmMigrationPipeline::~UdmMigrationPipeline()
+{
+    this->clear();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmMigrationPipeline::initialize()
+{
+    this->mpi_communicator = MPI_COMM_NULL;
+    this->mpi_rankno = -1;
+    this->zone = NULL;
+    this->next_send = 0;
+    this->send_inflight = 0;
+    this->cell_size = 0.0;
+    this->packed_size = 0;
+    this->packed_cells = 0;
+    this->recv_inflight = 0;
+    this->num_send_chunks = 0;
+    this->num_recv_chunks = 0;
+    this->send_size = 0;
+    this->recv_size = 0;
+    this->max_inflight = 0;
+    this->header_request = MPI_REQUEST_NULL;
+    this->header_posted = false;
+    this->progressed = false;
+    this->setMemorySize(UDM_MIGRATION_MEMORY_SIZE);
+}
+
+/**
+ * 転送状態をクリアする.
+ * 送信中のチャンク、未取得のインポート要素（セル）は破棄する.
+ */
+void UdmMigrationPipeline::clear()
+{
+    std::list<UdmMigrationSendChunk>::iterator send_itr;
+    for (send_itr=this->send_chunks.begin(); send_itr!=this->send_chunks.end(); send_itr++) {
+        if (send_itr->archive != NULL) delete send_itr->archive;
+    }
+    this->send_chunks.clear();
+    this->recv_headers.clear();
+    this->recv_chunks.clear();
+    this->header_request = MPI_REQUEST_NULL;
+    this->header_posted = false;
+
+    std::map< int, std::vector<UdmCell*> >::iterator cell_itr;
+    std::vector<UdmCell*>::iterator itr;
+    for (cell_itr=this->recv_cells.begin(); cell_itr!=this->recv_cells.end(); cell_itr++) {
+        for (itr=cell_itr->second.begin(); itr!=cell_itr->second.end(); itr++) {
+            UdmCell::freeDeserialize(*itr);
+        }
+    }
+    this->recv_cells.clear();
+
+    this->send_ranks.clear();
+    this->send_cells.clear();
+    this->send_positions.clear();
+    this->send_finished.clear();
+    this->recv_ranks.clear();
+    this->zone = NULL;
+    this->next_send = 0;
+    this->send_inflight = 0;
+    this->cell_size = 0.0;
+    this->packed_size = 0;
+    this->packed_cells = 0;
+    this->recv_inflight = 0;
+}
+
+/**
+ * 送受信バッファ上限サイズを取得する.
+ * @return        送受信バッファ上限サイズ(byte)
+ */
+size_t UdmMigrationPipeline::getMemorySize() const
+{
+    return this->memory_size;
+}
+
+/**
+ * 送受信バッファ上限サイズを設定する.
+ * チャンクサイズは上限サイズの1/4とし、UDM_MIGRATION_MAXSIZE以下とする.
+ * @param memory_size        送受信バッファ上限サイズ(byte)
+ */
+void UdmMigrationPipeline::setMemorySize(size_t memory_size)
+{
+    this->memory_size = memory_size;
+    this->chunk_size = memory_size/4;
+    if (this->chunk_size > (size_t)UDM_MIGRATION_MAXSIZE) this->chunk_size = UDM_MIGRATION_MAXSIZE;
+    if (this->chunk_size <= 0) this->chunk_size = 1;
+}
+
+/**
+ * チャンクサイズを取得する.
+ * @return        チャンクサイズ(byte)
+ */
+size_t UdmMigrationPipeline::getChunkSize() const
+{
+    return this->chunk_size;
+}
+
+/**
+ * 送信チャンク数を取得する.
+ * @return        送信チャンク数
+ */
+int UdmMigrationPipeline::getNumSendChunks() const
+{
+    return this->num_send_chunks;
+}
+
+/**
+ * 受信チャンク数を取得する.
+ * @return        受信チャンク数
+ */
+int UdmMigrationPipeline::getNumRecvChunks() const
+{
+    return this->num_recv_chunks;
+}
+
+/**
+ * 送信データサイズを取得する.
+ * @return        送信データサイズ(byte)
+ */
+long long UdmMigrationPipeline::getSendSize() const
+{
+    return this->send_size;
+}
+
+/**
+ * 受信データサイズを取得する.
+ * @return        受信データサイズ(byte)
+ */
+long long UdmMigrationPipeline::getRecvSize() const
+{
+    return this->recv_size;
+}
+
+/**
+ * 送受信チャンクの最大保持サイズを取得する.
+ * @return        送受信チャンクの最大保持サイズ(byte)
+ */
+size_t UdmMigrationPipeline::getMaxInflightSize() const
+{
+    return this->max_inflight;
+}
+
+/**
+ * 転送要素（セル）を転送先ランクに転送し、インポート要素（セル）を受信する.
+ * 転送先ランク別のチャンクの作成、送信と、受信チャンクのデシリアライズを交互に行い、
+ * 全転送先ランクへの終了メッセージの送信完了、全受信元ランクからの終了メッセージの受信まで繰り返す.
+ * 自ランクへの転送要素（セル）はチャンク毎にシリアライズ、デシリアライズのみ行う.
+ * 送受信が進まなかった場合は送受信中の通信のいずれかの完了まで待機する.
+ * エラーが発生した場合も終了メッセージの送受信は行い、他ランクの転送は完了させる.
+ * 転送先ランクは転送要素（セル）が空であっても終了メッセージを送信する為、受信元ランクのインポート元ランクのみとすること.
+ * コミュニケータを複製する為、全ランクにて呼び出すこと.
+ * @param comm                MPIコミュニケータ
+ * @param zone                転送元ゾーン
+ * @param export_cells        転送先ランク別の転送要素（セル）
+ * @param import_ranks        受信元ランク番号
+ * @param import_cells        インポート要素（セル） : UdmCell::freeDeserializeにて開放すること
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationPipeline::migrateCells(
+                        MPI_Comm comm,
+                        const UdmZone *zone,
+                        const std::map< int, std::vector<UdmCell*> > &export_cells,
+                        const std::set<int> &import_ranks,
+                        std::vector<UdmCell*> &import_cells)
+{
+    UdmError_t error = UDM_OK, ierror;
+
+    this->clear();
+    this->num_send_chunks = 0;
+    this->num_recv_chunks = 0;
+    this->send_size = 0;
+    this->recv_size = 0;
+    this->max_inflight = 0;
+    if (zone == NULL) {
+        // 終了メッセージのみ送信して、他ランクの転送は完了させる.
+        error = UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmZone is null.");
+    }
+    this->zone = zone;
+
+    // 分割転送用にコミュニケータを複製する.
+    if (udm_mpi_comm_dup(comm, &this->mpi_communicator) != MPI_SUCCESS) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_MPI, "failure : MPI_Comm_dup");
+    }
+    udm_mpi_comm_rank(this->mpi_communicator, &this->mpi_rankno);
+
+    // 転送先ランク : 転送要素（セル）が無い転送先ランクにも終了メッセージを送信する.
+    std::map< int, std::vector<UdmCell*> >::const_iterator export_itr;
+    for (export_itr=export_cells.begin(); export_itr!=export_cells.end(); export_itr++) {
+        this->send_ranks.push_back(export_itr->first);
+        this->send_cells.push_back(&export_itr->second);
+        this->send_positions.push_back(error == UDM_OK ? 0 : export_itr->second.size());
+        this->send_finished.push_back(false);
+    }
+
+    // 受信元ランク
+    std::set<int>::const_iterator import_itr;
+    for (import_itr=import_ranks.begin(); import_itr!=import_ranks.end(); import_itr++) {
+        if (*import_itr != this->mpi_rankno) this->recv_ranks.insert(*import_itr);
+    }
+    this->postRecvHeader();
+
+    while (!this->isFinished()) {
+        this->progressed = false;
+
+        // チャンクを作成して送信する.
+        ierror = this->postSendChunks();
+        if (ierror != UDM_OK && error == UDM_OK) error = ierror;
+
+        // 受信チャンクの受信を開始する.
+        this->postRecvChunks();
+
+        // 受信済みチャンクをデシリアライズする : 後続チャンクは受信中
+        ierror = this->unpackRecvChunks();
+        if (ierror != UDM_OK && error == UDM_OK) error = ierror;
+
+        // 送信済みチャンクを開放する.
+        this->completeSendChunks();
+
+        // 送受信が進まなかった場合は通信の完了を待つ.
+        if (!this->progressed && !this->isFinished()) {
+            this->waitChunks();
+        }
+    }
+
+    udm_mpi_comm_free(&this->mpi_communicator);
+    this->mpi_communicator = MPI_COMM_NULL;
+
+    if (error != UDM_OK) {
+        this->clear();
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    // インポート要素（セル） : 受信元ランク番号順
+    std::map< int, std::vector<UdmCell*> >::iterator cell_itr;
+    for (cell_itr=this->recv_cells.begin(); cell_itr!=this->recv_cells.end(); cell_itr++) {
+        import_cells.insert(import_cells.end(), cell_itr->second.begin(), cell_itr->second.end());
+    }
+    this->recv_cells.clear();
+    this->clear();
+
+    return UDM_OK;
+}
+
+/**
+ * 転送先ランク毎に１チャンクを作成して送信を開始する.
+ * 送信中チャンクのバッファサイズが上限サイズの1/2を超える場合は作成しない.
+ * 送信中チャンクが無い場合は上限サイズを超えても１チャンクは作成する.
+ * 転送先ランクは巡回順とし、上限サイズにより作成できなかった転送先ランクは次回の先頭とする.
+ * チャンクの送信前にチャンクサイズ、自ランク番号のヘッダを送信する.
+ * 全要素（セル）の送信後に終了メッセージ（サイズ0のヘッダ）を送信する.
+ * シリアライズにてエラーが発生した場合は以降のチャンクの作成を中止し、終了メッセージのみ送信する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationPipeline::postSendChunks()
+{
+    UdmError_t error = UDM_OK;
+    size_t num_sends = this->send_ranks.size();
+    size_t i, n, m;
+
+    for (i=0; i<num_sends; i++) {
+        n = this->next_send;
+        this->next_send = (n+1) % num_sends;
+        if (this->send_finished[n]) continue;
+        int rankno = this->send_ranks[n];
+
+        // 終了メッセージ
+        if (this->send_positions[n] >= this->send_cells[n]->size()) {
+            this->send_finished[n] = true;
+            this->progressed = true;
+            if (rankno == this->mpi_rankno) continue;
+            this->send_chunks.push_back(UdmMigrationSendChunk());
+            UdmMigrationSendChunk &chunk = this->send_chunks.back();
+            chunk.rankno = rankno;
+            chunk.archive = NULL;
+            chunk.header[0] = 0;
+            chunk.header[1] = this->mpi_rankno;
+            udm_mpi_isend(chunk.header, 2, MPI_LONG_LONG, rankno, UDM_MIGRATION_HEADER_TAG, this->mpi_communicator, &chunk.requests[0]);
+            chunk.requests[1] = MPI_REQUEST_NULL;
+            continue;
+        }
+
+        // 送信バッファ上限
+        if (rankno != this->mpi_rankno
+            && this->send_inflight > 0
+            && this->send_inflight + this->chunk_size > this->memory_size/2) {
+            // 送信できなかった転送先ランクから次回の送信を開始する.
+            this->next_send = n;
+            break;
+        }
+
+        UdmMigrationArchive *archive = new UdmMigrationArchive();
+        UdmError_t ierror = this->packChunk(n, archive);
+        this->progressed = true;
+        if (ierror == UDM_OK && rankno == this->mpi_rankno) {
+            // 自ランクへの転送はデシリアライズのみ行う.
+            ierror = archive->unpackCells(archive->getBuffer(), archive->getBufferSize(), this->recv_cells[rankno]);
+            delete archive;
+            archive = NULL;
+        }
+        if (ierror != UDM_OK) {
+            if (archive != NULL) delete archive;
+            if (error == UDM_OK) error = ierror;
+            // 以降のチャンクの作成を中止する.
+            for (m=0; m<num_sends; m++) {
+                this->send_positions[m] = this->send_cells[m]->size();
+            }
+            continue;
+        }
+        if (archive == NULL) continue;
+
+        size_t size = archive->getBufferSize();
+        this->send_chunks.push_back(UdmMigrationSendChunk());
+        UdmMigrationSendChunk &chunk = this->send_chunks.back();
+        chunk.rankno = rankno;
+        chunk.archive = archive;
+        chunk.header[0] = (long long)size;
+        chunk.header[1] = this->mpi_rankno;
+        udm_mpi_isend(chunk.header, 2, MPI_LONG_LONG, rankno, UDM_MIGRATION_HEADER_TAG, this->mpi_communicator, &chunk.requests[0]);
+        udm_mpi_isend(archive->getBuffer(), (int)size, MPI_BYTE, rankno, UDM_MIGRATION_CHUNK_TAG, this->mpi_communicator, &chunk.requests[1]);
+
+        this->send_inflight += size;
+        this->num_send_chunks++;
+        this->send_size += size;
+        if (this->max_inflight < this->send_inflight + this->recv_inflight) {
+            this->max_inflight = this->send_inflight + this->recv_inflight;
+        }
+    }
+
+    if (error != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    return UDM_OK;
+}
+
+/**
+ * 転送先ランクの未送信の要素（セル）からチャンクを作成する.
+ * チャンクの要素（セル）数はシリアライズ済みの要素（セル）あたりのサイズから推定する.
+ * 初回は１要素（セル）をシリアライズしたサイズにて推定する.
+ * チャンクサイズを超えた場合は要素（セル）数を1/2として再作成する.
+ * @param send_id        転送先ランクインデックス
+ * @param archive        シリアライズアーカイブ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationPipeline::packChunk(size_t send_id, UdmMigrationArchive *archive)
+{
+    UdmError_t error = UDM_OK;
+    const std::vector<UdmCell*> &cells = *(this->send_cells[send_id]);
+    size_t position = this->send_positions[send_id];
+    size_t num_remains = cells.size() - position;
+    size_t num_cells;
+
+    // 要素（セル）あたりのシリアライズサイズの推定
+    if (this->packed_cells > 0) {
+        this->cell_size = (double)this->packed_size / (double)this->packed_cells;
+    }
+    else if (this->cell_size <= 0.0) {
+        std::vector<UdmCell*> sample_cells(cells.begin()+position, cells.begin()+position+1);
+        if ((error = archive->packCells(this->zone, sample_cells)) != UDM_OK) {
+            return UDM_ERRORNO_HANDLER(error);
+        }
+        this->cell_size = (double)archive->getBufferSize();
+    }
+    num_cells = (size_t)((double)this->chunk_size / this->cell_size);
+    if (num_cells <= 0) num_cells = 1;
+    if (num_cells > num_remains) num_cells = num_remains;
+
+    while (true) {
+        std::vector<UdmCell*> chunk_cells(cells.begin()+position, cells.begin()+position+num_cells);
+        if ((error = archive->packCells(this->zone, chunk_cells)) != UDM_OK) {
+            return UDM_ERRORNO_HANDLER(error);
+        }
+        if (archive->getBufferSize() <= this->chunk_size || num_cells <= 1) break;
+        num_cells /= 2;
+    }
+    if (archive->getBufferSize() > (size_t)UDM_MIGRATION_MAXSIZE) {
+        return UDM_ERROR_HANDLER(UDM_ERROR, "migration chunk size(%lld) is over UDM_MIGRATION_MAXSIZE.", (long long)archive->getBufferSize());
+    }
+
+    this->send_positions[send_id] += num_cells;
+    this->packed_size += archive->getBufferSize();
+    this->packed_cells += num_cells;
+
+    return UDM_OK;
+}
+
+/**
+ * 送信完了したチャンクを開放する.
+ */
+void UdmMigrationPipeline::completeSendChunks()
+{
+    std::list<UdmMigrationSendChunk>::iterator itr = this->send_chunks.begin();
+    while (itr != this->send_chunks.end()) {
+        int flag = 0;
+        MPI_Status status[2];
+        udm_mpi_testall(2, itr->requests, &flag, status);
+        if (!flag) {
+            itr++;
+            continue;
+        }
+        this->progressed = true;
+        if (itr->archive != NULL) {
+            this->send_inflight -= itr->archive->getBufferSize();
+            delete itr->archive;
+        }
+        itr = this->send_chunks.erase(itr);
+    }
+}
+
+/**
+ * 任意の受信元ランクからのヘッダの受信を開始する.
+ * 終了メッセージ未受信の受信元ランクが無い場合、ヘッダ受信中の場合は開始しない.
+ */
+void UdmMigrationPipeline::postRecvHeader()
+{
+    if (this->recv_ranks.empty()) return;
+    if (this->header_posted) return;
+    udm_mpi_irecv(this->recv_header, 2, MPI_LONG_LONG, MPI_ANY_SOURCE,
+                UDM_MIGRATION_HEADER_TAG, this->mpi_communicator, &this->header_request);
+    this->header_posted = true;
+}
+
+/**
+ * 受信済みのヘッダのチャンクの受信を開始する.
+ * 終了メッセージを受信した受信元ランクは受信済みとする.
+ * 受信中チャンクのバッファサイズが上限サイズの1/2を超える場合は受信を開始しない.
+ * 受信中チャンクが無い場合は上限サイズを超えても受信を開始する.
+ */
+void UdmMigrationPipeline::postRecvChunks()
+{
+    while (this->header_posted) {
+        int flag = 0;
+        MPI_Status status;
+        udm_mpi_test(&this->header_request, &flag, &status);
+        if (!flag) break;
+        this->header_posted = false;
+        this->progressed = true;
+
+        int rankno = (int)this->recv_header[1];
+        if (this->recv_header[0] <= 0) {
+            // 終了メッセージ
+            this->recv_ranks.erase(rankno);
+        }
+        else {
+            UdmMigrationRecvHeader header;
+            header.rankno = rankno;
+            header.size = (size_t)this->recv_header[0];
+            this->recv_headers.push_back(header);
+        }
+        this->postRecvHeader();
+    }
+
+    while (!this->recv_headers.empty()) {
+        const UdmMigrationRecvHeader &header = this->recv_headers.front();
+
+        // 受信バッファ上限
+        if (this->recv_inflight > 0
+            && this->recv_inflight + header.size > this->memory_size - this->memory_size/2) {
+            break;
+        }
+
+        this->recv_chunks.push_back(UdmMigrationRecvChunk());
+        UdmMigrationRecvChunk &chunk = this->recv_chunks.back();
+        chunk.rankno = header.rankno;
+        chunk.buffer.resize(header.size);
+        udm_mpi_irecv(&chunk.buffer[0], (int)header.size, MPI_BYTE,
+                    chunk.rankno, UDM_MIGRATION_CHUNK_TAG, this->mpi_communicator, &chunk.request);
+
+        this->recv_inflight += header.size;
+        this->num_recv_chunks++;
+        this->recv_size += header.size;
+        if (this->max_inflight < this->send_inflight + this->recv_inflight) {
+            this->max_inflight = this->send_inflight + this->recv_inflight;
+        }
+        this->recv_headers.pop_front();
+        this->progressed = true;
+    }
+}
+
+/**
+ * 受信完了したチャンクをデシリアライズする.
+ * 受信元ランク毎に受信開始順にデシリアライズし、受信中のチャンクがある受信元ランクの後続チャンクは次回とする.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationPipeline::unpackRecvChunks()
+{
+    UdmError_t error = UDM_OK, ierror;
+    std::set<int> waiting_ranks;
+    std::list<UdmMigrationRecvChunk>::iterator itr = this->recv_chunks.begin();
+    while (itr != this->recv_chunks.end()) {
+        if (waiting_ranks.find(itr->rankno) != waiting_ranks.end()) {
+            itr++;
+            continue;
+        }
+        int flag = 0;
+        MPI_Status status;
+        udm_mpi_test(&itr->request, &flag, &status);
+        if (!flag) {
+            waiting_ranks.insert(itr->rankno);
+            itr++;
+            continue;
+        }
+
+        UdmMigrationArchive archive;
+        ierror = archive.unpackCells(&itr->buffer[0], itr->buffer.size(), this->recv_cells[itr->rankno]);
+        if (ierror != UDM_OK && error == UDM_OK) {
+            error = UDM_ERROR_HANDLER(ierror, "abend unpackCells[rankno=%d].", itr->rankno);
+        }
+        this->recv_inflight -= itr->buffer.size();
+        this->progressed = true;
+        itr = this->recv_chunks.erase(itr);
+    }
+
+    return error;
+}
+
+/**
+ * 受信中のヘッダ、受信中、送信中のチャンクのいずれかの通信の完了を待つ.
+ * 完了した通信リクエストはMPI_REQUEST_NULLとなり、次回の完了確認にて処理する.
+ */
+void UdmMigrationPipeline::waitChunks()
+{
+    std::vector<MPI_Request*> waits;
+    if (this->header_posted) {
+        waits.push_back(&this->header_request);
+    }
+    std::list<UdmMigrationRecvChunk>::iterator recv_itr;
+    for (recv_itr=this->recv_chunks.begin(); recv_itr!=this->recv_chunks.end(); recv_itr++) {
+        if (recv_itr->request != MPI_REQUEST_NULL) waits.push_back(&recv_itr->request);
+    }
+    std::list<UdmMigrationSendChunk>::iterator send_itr;
+    for (send_itr=this->send_chunks.begin(); send_itr!=this->send_chunks.end(); send_itr++) {
+        if (send_itr->requests[0] != MPI_REQUEST_NULL) waits.push_back(&send_itr->requests[0]);
+        if (send_itr->requests[1] != MPI_REQUEST_NULL) waits.push_back(&send_itr->requests[1]);
+    }
+    if (waits.empty()) return;
+
+    int num_waits = waits.size();
+    int num_completes = 0;
+    int i;
+    std::vector<MPI_Request> requests(num_waits);
+    std::vector<int> indices(num_waits);
+    std::vector<MPI_Status> status(num_waits);
+    for (i=0; i<num_waits; i++) requests[i] = *waits[i];
+    udm_mpi_waitsome(num_waits, &requests[0], &num_completes, &indices[0], &status[0]);
+    for (i=0; i<num_waits; i++) *waits[i] = requests[i];
+}
+
+/**
+ * 全転送先ランクへの送信、全受信元ランクからの受信が完了したかチェックする.
+ * @return        true=送受信完了
+ */
+bool UdmMigrationPipeline::isFinished() const
+{
+    size_t n;
+    for (n=0; n<this->send_finished.size(); n++) {
+        if (!this->send_finished[n]) return false;
+    }
+    if (!this->send_chunks.empty()) return false;
+    if (!this->recv_ranks.empty()) return false;
+    if (!this->recv_headers.empty()) return false;
+    if (!this->recv_chunks.empty()) return false;
+    return true;
+}
+
+} /* namespace udm */
@@ -59,6 +59,35 @@ UdmError_t udm_load_model(
     return model->loadModel(dfi_filename, timeslice_step);
 }
 
+/**
+ * DFIファイルの設定情報に従って、指定物理量のみCGNSファイルから読み込む.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param dfi_filename        index.dfiファイル名
+ * @param timeslice_step    読込ステップ番号 (-1 = 最初の時系列データ)
+ * @param field_names        読込物理量名称リスト
+ * @param num_fields        読込物理量数 : 0の場合は物理量を読み込まない.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_load_model_fields(
+                        UdmHanler_t udm_handler,
+                        const char* dfi_filename,
+                        int timeslice_step,
+                        const char* const* field_names,
+                        int num_fields)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (num_fields > 0 && field_names == NULL) return UDM_ERROR_NULL_VARIABLE;
+
+    std::vector<std::string> names;
+    int n;
+    for (n=0; n<num_fields; n++) {
+        if (field_names[n] == NULL) continue;
+        names.push_back(std::string(field_names[n]));
+    }
+    return model->loadModel(dfi_filename, names, timeslice_step);
+}
+
 
 /**
  * CGNSファイルを読みこむ.
@@ -114,6 +143,71 @@ UdmError_t udm_write_model_average(
     return model->writeModel(timeslice_step, timeslice_time, average_step, average_time);
 }
 
+/**
+ * DFI設定に従って、CGNSファイル, index.dfiを非同期に出力する.
+ * 出力完了はudm_wait_model_asyncにて待つこと.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_write_model_async(
+                            UdmHanler_t udm_handler,
+                            int timeslice_step,
+                            float timeslice_time)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return model->writeModelAsync(timeslice_step, timeslice_time);
+}
+
+/**
+ * DFI設定に従って、CGNSファイル, index.dfiを非同期に出力する.
+ * 出力完了はudm_wait_model_asyncにて待つこと.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param timeslice_step        時系列ステップ数
+ * @param timeslice_time        時系列ステップ時間
+ * @param average_step            平均ステップ数
+ * @param average_time            平均ステップ時間
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_write_model_average_async(
+                            UdmHanler_t udm_handler,
+                            int timeslice_step,
+                            float timeslice_time,
+                            int average_step,
+                            float average_time)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return model->writeModelAsync(timeslice_step, timeslice_time, average_step, average_time);
+}
+
+/**
+ * 非同期出力の完了を待つ.
+ * 全ランクで実行すること.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_wait_model_async(UdmHanler_t udm_handler)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return model->waitModelAsync();
+}
+
+/**
+ * 自ランクの非同期出力のCGNSファイル出力が終了しているかチェックする.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @return        true=CGNSファイル出力終了又は非同期出力中でない
+ */
+bool udm_test_model_async(UdmHanler_t udm_handler)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return true;
+    return model->testModelAsync();
+}
+
 /**
  * ベースファイル名を設定する.
  * @param udm_handler           UdmModelクラスポインタ
@@ -1511,6 +1605,7 @@ void udm_config_removeunit(
  *         CGNS:GridCoordinates出力方法            : [IncludeGrid | ExcludeGrid]
  *         CGNS:FlowSolutionのステップ出力方法    : [AppendStep | EachStep]
  *         CGNS:GridCoordinatesの時系列出力方法    : [GridConstant | GridTimeSlice]
+ * AggregateFileは計算ノード毎のランクグループで１つのCGNSファイルを出力する(IncludeGridと同時設定).
  * @param udm_handler           UdmModelクラスポインタ
  * @param type        CGNSファイル構成タイプ
  */
@@ -1631,6 +1726,46 @@ bool udm_config_istimeslicedirectory(
     return fileinfo->isTimeSliceDirectory();
 }
 
+/**
+ * プロセスディレクトリ作成オプションを設定する.
+ * ランク毎のCGNSファイルを、設定ランク数毎のサブディレクトリ(rank%06d)に出力する.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param num_ranks        ディレクトリ当りのランク数 : 0=プロセスディレクトリを作成しない
+ */
+void udm_config_setprocessdirectory(
+                UdmHanler_t udm_handler,
+                int num_ranks)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return;
+    UdmDfiConfig *config = model->getDfiConfig();
+    if (config == NULL) return;
+    // CGNS構成
+    UdmFileInfoConfig* fileinfo = config->getFileinfoConfig();
+    if (fileinfo == NULL) return;
+    fileinfo->setProcessDirectory(num_ranks);
+
+    return;
+}
+
+/**
+ * プロセスディレクトリ作成オプションを取得する.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @return        ディレクトリ当りのランク数 : 0=プロセスディレクトリを作成しない
+ */
+int udm_config_getprocessdirectory(
+                UdmHanler_t udm_handler)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return 0;
+    UdmDfiConfig *config = model->getDfiConfig();
+    if (config == NULL) return 0;
+    // CGNS構成
+    UdmFileInfoConfig* fileinfo = config->getFileinfoConfig();
+    if (fileinfo == NULL) return 0;
+    return fileinfo->getProcessDirectory();
+}
+
 /**
  * 物理量変数名称の物理量情報を削除する.
  * @param udm_handler           UdmModelクラスポインタ
@@ -1663,6 +1798,82 @@ UdmError_t udm_transfer_virtualcells(UdmHanler_t udm_handler)
     return model->transferVirtualCells();
 }
 
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量交換計画を作成する.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_create_halo_exchange(UdmHanler_t udm_handler)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return model->createHaloExchange();
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量の送受信を開始する.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param field_names        送受信物理量名称リスト
+ * @param num_fields        送受信物理量数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_start_halo_exchange(
+                        UdmHanler_t udm_handler,
+                        const char* const* field_names,
+                        int num_fields)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (num_fields > 0 && field_names == NULL) return UDM_ERROR_NULL_VARIABLE;
+
+    std::vector<std::string> names;
+    int n;
+    for (n=0; n<num_fields; n++) {
+        if (field_names[n] == NULL) continue;
+        names.push_back(std::string(field_names[n]));
+    }
+    return model->startHaloExchange(names);
+}
+
+/**
+ * 仮想要素（セル）, 仮想節点（ノード）の物理量の受信完了を待って、物理量を設定する.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_finish_halo_exchange(UdmHanler_t udm_handler)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return model->finishHaloExchange();
+}
+
+/**
+ * 内部境界節点（ノード）の物理量を接続ランク間で集約する.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param field_names        集約物理量名称リスト : 節点（ノード）物理量
+ * @param num_fields        集約物理量数
+ * @param reduce_type        集約演算タイプ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_reduce_boundary_nodes(
+                        UdmHanler_t udm_handler,
+                        const char* const* field_names,
+                        int num_fields,
+                        UdmReduceType_t reduce_type)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (num_fields > 0 && field_names == NULL) return UDM_ERROR_NULL_VARIABLE;
+
+    std::vector<std::string> names;
+    int n;
+    for (n=0; n<num_fields; n++) {
+        if (field_names[n] == NULL) continue;
+        names.push_back(std::string(field_names[n]));
+    }
+    return model->reduceBoundaryNodes(names, reduce_type);
+}
+
 /**
  * 構成ノード（節点）数を取得する.
  * @param  udm_handler           UdmModelクラスポインタ
@@ -1704,6 +1915,10 @@ int udm_getnum_nodeconnectivity(
     if (zone == NULL) return 0;
     UdmGridCoordinates* grid = zone->getGridCoordinates();
     if (grid == NULL) return 0;
+    if (node_id <= grid->getNumNodes()) {
+        return zone->getNumConnectivityCells(node_id);
+    }
+    // 仮想節点（ノード）
     UdmNode *node = grid->getNodeByLocalId(node_id);
     if (node == NULL) return 0;
 
@@ -1735,13 +1950,18 @@ int udm_get_nodeconnectivity(
     if (zone == NULL) return 0;
     UdmGridCoordinates* grid = zone->getGridCoordinates();
     if (grid == NULL) return 0;
+    bool entity_node = (node_id <= grid->getNumNodes());
     UdmNode *node = grid->getNodeByLocalId(node_id);
     if (node == NULL) return 0;
-    UdmSize_t size = node->getNumConnectivityCells();
+    UdmSize_t size = 0;
+    if (entity_node) size = zone->getNumConnectivityCells(node_id);
+    else size = node->getNumConnectivityCells();
     if (cell_ids != NULL) {
         UdmSize_t n;
         for (n=1; n<=size; n++) {
-            UdmCell *cell = node->getConnectivityCell(n);
+            UdmCell *cell = NULL;
+            if (entity_node) cell = zone->getConnectivityCell(node_id, n);
+            else cell = node->getConnectivityCell(n);
             cell_ids[n-1] = cell->getLocalId();
             cell_types[n-1] = cell->getRealityType();
         }
@@ -1770,7 +1990,12 @@ int udm_getnum_neighborcells(
     if (zone == NULL) return 0;
     UdmSections *sections  = zone->getSections();
     if (sections == NULL) return 0;
+    if (cell_id <= sections->getNumEntityCells()) {
+        return zone->getNumNeighborCells(cell_id);
+    }
+    // 仮想要素（セル）
     UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return 0;
     return cell->getNumNeighborCells();
 }
 
@@ -1799,12 +2024,18 @@ int udm_get_neighborcells(
     if (zone == NULL) return 0;
     UdmSections *sections  = zone->getSections();
     if (sections == NULL) return 0;
+    bool entity_cell = (cell_id <= sections->getNumEntityCells());
     UdmCell* cell = sections->getCellByLocalId(cell_id);
-    int size = cell->getNumNeighborCells();
+    if (cell == NULL) return 0;
+    int size = 0;
+    if (entity_cell) size = zone->getNumNeighborCells(cell_id);
+    else size = cell->getNumNeighborCells();
     if (neighbor_cellids != NULL) {
         int n;
         for (n=1; n<=size; n++) {
-            UdmCell *neighbor_cell = cell->getNeighborCell(n);
+            UdmCell *neighbor_cell = NULL;
+            if (entity_cell) neighbor_cell = zone->getNeighborCell(cell_id, n);
+            else neighbor_cell = cell->getNeighborCell(n);
             neighbor_cellids[n-1] = neighbor_cell->getLocalId();
             neighbor_types[n-1] = neighbor_cell->getRealityType();
         }
@@ -1835,6 +2066,10 @@ int udm_getnum_neighbornodes(
     if (zone == NULL) return 0;
     UdmGridCoordinates* grid = zone->getGridCoordinates();
     if (grid == NULL) return 0;
+    if (node_id <= grid->getNumNodes()) {
+        return zone->getNumNeighborNodes(node_id);
+    }
+    // 仮想節点（ノード）
     UdmNode *node = grid->getNodeByLocalId(node_id);
     if (node == NULL) return 0;
 
@@ -1866,13 +2101,18 @@ int udm_get_neighbornodes(
     if (zone == NULL) return 0;
     UdmGridCoordinates* grid = zone->getGridCoordinates();
     if (grid == NULL) return 0;
+    bool entity_node = (node_id <= grid->getNumNodes());
     UdmNode *node = grid->getNodeByLocalId(node_id);
     if (node == NULL) return 0;
-    int size = node->getNumNeighborNodes();
+    int size = 0;
+    if (entity_node) size = zone->getNumNeighborNodes(node_id);
+    else size = node->getNumNeighborNodes();
     if (neighbor_nodeids != NULL) {
         int n;
         for (n=1; n<=size; n++) {
-            UdmNode *neighbor_node = node->getNeighborNode(n);
+            UdmNode *neighbor_node = NULL;
+            if (entity_node) neighbor_node = zone->getNeighborNode(node_id, n);
+            else neighbor_node = node->getNeighborNode(n);
             neighbor_nodeids[n-1] = neighbor_node->getLocalId();
             neighbor_types[n-1] = neighbor_node->getRealityType();
         }
@@ -1885,6 +2125,105 @@ int udm_get_neighbornodes(
 
 }
 
+/**
+ * 要素（セル）-要素（セル）の隣接グラフをCSR形式で取得する.
+ * 実体要素（セル）の隣接要素（セル）を一括取得する.
+ * xadjは要素（セル）数+1のオフセット（０～）、adjncyは隣接要素（セル）のローカルID（１～）とする.
+ * 要素（セル）IDがnの隣接要素（セル）はadjncy[xadj[n-1]]～adjncy[xadj[n]-1]となる.
+ * xadj, adjncyにNULLを指定した場合は、num_adjncyのみを取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [out] xadj        隣接オフセット配列 : 要素（セル）数+1
+ * @param [out] adjncy        隣接要素（セル）ローカルID配列 : num_adjncy
+ * @param [out] num_adjncy        隣接要素（セル）ローカルID配列サイズ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_neighborcells_graph(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t *xadj,
+                UdmSize_t *adjncy,
+                UdmSize_t *num_adjncy)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR;
+    if (zone->getSections() == NULL) return UDM_ERROR;
+
+    UdmSize_t size = zone->getNeighborCellsGraph(xadj, adjncy);
+    if (num_adjncy != NULL) {
+        *num_adjncy = size;
+    }
+    return UDM_OK;
+}
+
+/**
+ * 節点（ノード）-節点（ノード）の隣接グラフをCSR形式で取得する.
+ * 実体節点（ノード）の隣接節点（ノード）を一括取得する.
+ * xadjは節点（ノード）数+1のオフセット（０～）、adjncyは隣接節点（ノード）のローカルID（１～）とする.
+ * 節点（ノード）IDがnの隣接節点（ノード）はadjncy[xadj[n-1]]～adjncy[xadj[n]-1]となる.
+ * xadj, adjncyにNULLを指定した場合は、num_adjncyのみを取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [out] xadj        隣接オフセット配列 : 節点（ノード）数+1
+ * @param [out] adjncy        隣接節点（ノード）ローカルID配列 : num_adjncy
+ * @param [out] num_adjncy        隣接節点（ノード）ローカルID配列サイズ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_neighbornodes_graph(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t *xadj,
+                UdmSize_t *adjncy,
+                UdmSize_t *num_adjncy)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR;
+    if (zone->getGridCoordinates() == NULL) return UDM_ERROR;
+
+    UdmSize_t size = zone->getNeighborNodesGraph(xadj, adjncy);
+    if (num_adjncy != NULL) {
+        *num_adjncy = size;
+    }
+    return UDM_OK;
+}
+
+/**
+ * 節点（ノード）-要素（セル）の接続グラフをCSR形式で取得する.
+ * 実体節点（ノード）の接続要素（セル）を一括取得する.
+ * xadjは節点（ノード）数+1のオフセット（０～）、adjncyは接続要素（セル）のローカルID（１～）とする.
+ * 節点（ノード）IDがnの接続要素（セル）はadjncy[xadj[n-1]]～adjncy[xadj[n]-1]となる.
+ * xadj, adjncyにNULLを指定した場合は、num_adjncyのみを取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [out] xadj        接続オフセット配列 : 節点（ノード）数+1
+ * @param [out] adjncy        接続要素（セル）ローカルID配列 : num_adjncy
+ * @param [out] num_adjncy        接続要素（セル）ローカルID配列サイズ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_nodeconnectivity_graph(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t *xadj,
+                UdmSize_t *adjncy,
+                UdmSize_t *num_adjncy)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR;
+    if (zone->getGridCoordinates() == NULL) return UDM_ERROR;
+
+    UdmSize_t size = zone->getConnectivityCellsGraph(xadj, adjncy);
+    if (num_adjncy != NULL) {
+        *num_adjncy = size;
+    }
+    return UDM_OK;
+}
+
 /**
  * CGNS:GridCoordinatesが固定タイプ設定であるかチェックする.
  * @param  udm_handler           UdmModelクラスポインタ
@@ -2120,4 +2459,543 @@ UdmError_t udm_get_cellsolution_real(
     return cell->getSolutionScalar(solution_name, *value);
 }
 
+/**
+ * 物理量フィールドIDを取得する.
+ * 物理量フィールドIDを使用して、物理量名称の検索を行わずに物理量データの取得、設定を行う.
+ * 物理量フィールドIDは物理量の追加、削除により変更されるため、物理量の追加、削除後は再取得すること.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [in] solution_name        物理量データ名称
+ * @return        物理量フィールドID : 存在しない場合は0を返す.
+ */
+UdmSize_t udm_get_solutionfieldid(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                const char* solution_name)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return 0;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return 0;
+    if (zone->getFlowSolutions() == NULL) return 0;
+    if (solution_name == NULL) return 0;
+    return zone->getFlowSolutions()->getFieldId(solution_name);
+}
+
+/**
+ * 節点（ノード）に物理量データ値リストを設定する:integer(ベクトル), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param node_id        節点（ノード）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param values        物理量データ値リスト:integer
+ * @param size            物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_nodesolutions_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                const UdmInteger_t *values,
+                int size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return grid->setEntitySolutionVector(node, field_id, values, size);
+}
+
+/**
+ * 節点（ノード）に物理量データ値リストを設定する:real(ベクトル), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param node_id        節点（ノード）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param values        物理量データ値リスト:real
+ * @param size            物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_nodesolutions_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                const UdmReal_t *values,
+                int size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return grid->setEntitySolutionVector(node, field_id, values, size);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を取得する:integer(ベクトル), 物理量フィールドID.
+ * 取得物理データ値(values)がNULLの場合は、取得物理データ数(size)のみ取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [in] node_id        節点（ノード）ID（１～）
+ * @param [in] field_id        物理量フィールドID（１～）
+ * @param [out] values        取得物理データ値
+ * @param [out] size        取得物理データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_nodesolutions_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                UdmInteger_t* values,
+                int* size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (values != NULL) {
+        unsigned int len = grid->getEntitySolutionVector(node, field_id, values);
+        if (size != NULL) *size = len;
+        if (len <= 0) return UDM_ERROR;
+    }
+    else if (size != NULL) {
+        const UdmSolutionFieldConfig* field = NULL;
+        if (zone->getFlowSolutions() != NULL) {
+            field = zone->getFlowSolutions()->getSolutionField(field_id);
+        }
+        if (field == NULL) return UDM_ERROR;
+        *size = field->getNvectorSize();
+        if (*size <= 0) *size = 1;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 節点（ノード）の物理量データ値を取得する:real(ベクトル), 物理量フィールドID.
+ * 取得物理データ値(values)がNULLの場合は、取得物理データ数(size)のみ取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [in] node_id        節点（ノード）ID（１～）
+ * @param [in] field_id        物理量フィールドID（１～）
+ * @param [out] values        取得物理データ値
+ * @param [out] size        取得物理データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_nodesolutions_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                UdmReal_t* values,
+                int* size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (values != NULL) {
+        unsigned int len = grid->getEntitySolutionVector(node, field_id, values);
+        if (size != NULL) *size = len;
+        if (len <= 0) return UDM_ERROR;
+    }
+    else if (size != NULL) {
+        const UdmSolutionFieldConfig* field = NULL;
+        if (zone->getFlowSolutions() != NULL) {
+            field = zone->getFlowSolutions()->getSolutionField(field_id);
+        }
+        if (field == NULL) return UDM_ERROR;
+        *size = field->getNvectorSize();
+        if (*size <= 0) *size = 1;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 節点（ノード）に物理量データ値を設定する:integer(スカラ), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param node_id        節点（ノード）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param value        物理データ値:integer(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_nodesolution_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                UdmInteger_t value)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return grid->setEntitySolutionScalar(node, field_id, value);
+}
+
+/**
+ * 節点（ノード）に物理量データ値を設定する:real(スカラ), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param node_id        節点（ノード）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param value        物理データ値:real(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_nodesolution_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                UdmReal_t value)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return grid->setEntitySolutionScalar(node, field_id, value);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を取得する:integer(スカラ), 物理量フィールドID.
+ * @param [in]  udm_handler           UdmModelクラスポインタ
+ * @param [in]  zone_id        ゾーンID（１～）
+ * @param [in]  node_id        節点（ノード）ID（１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] value        取得物理データ値:integer(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_nodesolution_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                UdmInteger_t* value)
+{
+    if (value == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return grid->getEntitySolutionScalar(node, field_id, *value);
+}
+
+/**
+ * 節点（ノード）の物理量データ値を取得する:real(スカラ), 物理量フィールドID.
+ * @param [in]  udm_handler           UdmModelクラスポインタ
+ * @param [in]  zone_id        ゾーンID（１～）
+ * @param [in]  node_id        節点（ノード）ID（１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] value        取得物理データ値:real(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_nodesolution_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t node_id,
+                UdmSize_t field_id,
+                UdmReal_t* value)
+{
+    if (value == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmGridCoordinates* grid = zone->getGridCoordinates();
+    if (grid == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmNode* node = grid->getNodeByLocalId(node_id);
+    if (node == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return grid->getEntitySolutionScalar(node, field_id, *value);
+}
+
+/**
+ * 要素（セル）に物理量データ値リストを設定する:integer(ベクトル), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param cell_id        要素（セル）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param values        物理量データ値リスト:integer
+ * @param size            物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_cellsolutions_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                const UdmInteger_t *values,
+                int size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return sections->setEntitySolutionVector(cell, field_id, values, size);
+}
+
+/**
+ * 要素（セル）に物理量データ値リストを設定する:real(ベクトル), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param cell_id        要素（セル）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param values        物理量データ値リスト:real
+ * @param size            物理量データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_cellsolutions_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                const UdmReal_t *values,
+                int size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return sections->setEntitySolutionVector(cell, field_id, values, size);
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:integer(ベクトル), 物理量フィールドID.
+ * 取得物理データ値(values)がNULLの場合は、取得物理データ数(size)のみ取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [in] cell_id        要素（セル）ID（１～）
+ * @param [in] field_id        物理量フィールドID（１～）
+ * @param [out] values        取得物理データ値
+ * @param [out] size        取得物理データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_cellsolutions_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                UdmInteger_t* values,
+                int* size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (values != NULL) {
+        unsigned int len = sections->getEntitySolutionVector(cell, field_id, values);
+        if (size != NULL) *size = len;
+        if (len <= 0) return UDM_ERROR;
+    }
+    else if (size != NULL) {
+        const UdmSolutionFieldConfig* field = NULL;
+        if (zone->getFlowSolutions() != NULL) {
+            field = zone->getFlowSolutions()->getSolutionField(field_id);
+        }
+        if (field == NULL) return UDM_ERROR;
+        *size = field->getNvectorSize();
+        if (*size <= 0) *size = 1;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:real(ベクトル), 物理量フィールドID.
+ * 取得物理データ値(values)がNULLの場合は、取得物理データ数(size)のみ取得する.
+ * @param [in] udm_handler           UdmModelクラスポインタ
+ * @param [in] zone_id        ゾーンID（１～）
+ * @param [in] cell_id        要素（セル）ID（１～）
+ * @param [in] field_id        物理量フィールドID（１～）
+ * @param [out] values        取得物理データ値
+ * @param [out] size        取得物理データ数
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_cellsolutions_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                UdmReal_t* values,
+                int* size)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    if (values != NULL) {
+        unsigned int len = sections->getEntitySolutionVector(cell, field_id, values);
+        if (size != NULL) *size = len;
+        if (len <= 0) return UDM_ERROR;
+    }
+    else if (size != NULL) {
+        const UdmSolutionFieldConfig* field = NULL;
+        if (zone->getFlowSolutions() != NULL) {
+            field = zone->getFlowSolutions()->getSolutionField(field_id);
+        }
+        if (field == NULL) return UDM_ERROR;
+        *size = field->getNvectorSize();
+        if (*size <= 0) *size = 1;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 要素（セル）に物理量データ値を設定する:integer(スカラ), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param cell_id        要素（セル）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param value        物理データ値:integer(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_cellsolution_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                UdmInteger_t value)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return sections->setEntitySolutionScalar(cell, field_id, value);
+}
+
+/**
+ * 要素（セル）に物理量データ値を設定する:real(スカラ), 物理量フィールドID.
+ * @param udm_handler           UdmModelクラスポインタ
+ * @param zone_id        ゾーンID（１～）
+ * @param cell_id        要素（セル）ID（１～）
+ * @param field_id        物理量フィールドID（１～）
+ * @param value        物理データ値:real(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_set_cellsolution_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                UdmReal_t value)
+{
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return sections->setEntitySolutionScalar(cell, field_id, value);
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:integer(スカラ), 物理量フィールドID.
+ * @param [in]  udm_handler           UdmModelクラスポインタ
+ * @param [in]  zone_id        ゾーンID（１～）
+ * @param [in]  cell_id        要素（セル）ID（１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] value        取得物理データ値:integer(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_cellsolution_integer_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                UdmInteger_t* value)
+{
+    if (value == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return sections->getEntitySolutionScalar(cell, field_id, *value);
+}
+
+/**
+ * 要素（セル）の物理量データ値を取得する:real(スカラ), 物理量フィールドID.
+ * @param [in]  udm_handler           UdmModelクラスポインタ
+ * @param [in]  zone_id        ゾーンID（１～）
+ * @param [in]  cell_id        要素（セル）ID（１～）
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [out] value        取得物理データ値:real(スカラ)
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t udm_get_cellsolution_real_byfield(
+                UdmHanler_t udm_handler,
+                int zone_id,
+                UdmSize_t cell_id,
+                UdmSize_t field_id,
+                UdmReal_t* value)
+{
+    if (value == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmModel* model = static_cast<UdmModel*> (udm_handler);
+    if (model == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmZone* zone = model->getZone(zone_id);
+    if (zone == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmSections* sections = zone->getSections();
+    if (sections == NULL) return UDM_ERROR_NULL_VARIABLE;
+    UdmCell* cell = sections->getCellByLocalId(cell_id);
+    if (cell == NULL) return UDM_ERROR_NULL_VARIABLE;
+    return sections->getEntitySolutionScalar(cell, field_id, *value);
+}
+
 } /* namespace udm */
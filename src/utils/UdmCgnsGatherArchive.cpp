@@ -0,0 +1,772 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmCgnsGatherArchive.cpp
+ * CGNS集約出力アーカイブクラスのソースファイル
+ */
+
+#include "utils/UdmCgnsGatherArchive.h"
+#include "model/UdmModel.h"
+#include "model/UdmZone.h"
+#include "model/UdmGridCoordinates.h"
+#include "model/UdmSections.h"
+#include "model/UdmElements.h"
+#include "model/UdmFlowSolutions.h"
+#include "model/UdmUserDefinedDatas.h"
+#include "model/UdmRankConnectivity.h"
+#include "config/UdmSolutionFieldConfig.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ */
+UdmCgnsGatherArchive::UdmCgnsGatherArchive()
+{
+    this->initialize();
+}
+
+/**
+ * デストラクタ
+ */
+UdmCgnsGatherArchive::~UdmCgnsGatherArchive()
+{
+    this->clear();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmCgnsGatherArchive::initialize()
+{
+    this->read_pos = NULL;
+    this->read_end = NULL;
+}
+
+/**
+ * シリアライズバッファを破棄する.
+ */
+void UdmCgnsGatherArchive::clear()
+{
+    std::vector<char>().swap(this->buffer);
+    this->read_pos = NULL;
+    this->read_end = NULL;
+}
+
+/**
+ * シリアライズバッファを取得する.
+ * @return        シリアライズバッファ
+ */
+const char* UdmCgnsGatherArchive::getBuffer() const
+{
+    if (this->buffer.empty()) return NULL;
+    return &this->buffer[0];
+}
+
+/**
+ * シリアライズバッファを取得する.
+ * @return        シリアライズバッファ
+ */
+char* UdmCgnsGatherArchive::getBuffer()
+{
+    if (this->buffer.empty()) return NULL;
+    return &this->buffer[0];
+}
+
+/**
+ * シリアライズバッファサイズを取得する.
+ * @return        シリアライズバッファサイズ(byte)
+ */
+size_t UdmCgnsGatherArchive::getBufferSize() const
+{
+    return this->buffer.size();
+}
+
+/**
+ * 受信の為にシリアライズバッファを確保する.
+ * @param size        シリアライズバッファサイズ(byte)
+ */
+void UdmCgnsGatherArchive::resizeBuffer(size_t size)
+{
+    this->buffer.resize(size);
+    this->read_pos = NULL;
+    this->read_end = NULL;
+}
+
+/**
+ * ゾーンのCGNS出力データをシリアライズする.
+ * @param zones            出力ゾーン
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データをシリアライズする.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packZones(const std::vector<UdmZone*> &zones, bool write_constsolutions)
+{
+    UdmError_t error = UDM_OK;
+    size_t n;
+
+    this->buffer.clear();
+    this->writeValue((int)zones.size());
+    for (n=0; n<zones.size(); n++) {
+        if (zones[n] == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "zone is null.");
+        }
+        if ((error = this->packZone(zones[n], write_constsolutions)) != UDM_OK) {
+            return UDM_ERROR_HANDLER(error, "failure : packZone(zone_id=%d).", (int)zones[n]->getId());
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * ゾーンのCGNS出力データをシリアライズする : ID, 名称, XYZ座標値, 要素接続情報, 物理量, ユーザ定義データ, 内部境界情報.
+ * @param zone            出力ゾーン
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データをシリアライズする.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packZone(UdmZone *zone, bool write_constsolutions)
+{
+    UdmError_t error = UDM_OK;
+
+    this->writeValue(zone->getId());
+    this->writeString(zone->getName());
+
+    if ((error = this->packGridCoordinates(zone->getGridCoordinates())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->packSections(zone->getSections())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->packSolutionFields(zone, write_constsolutions)) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->packUserDatas(zone->getUserDefinedDatas())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->packRankConnectivity(zone->getRankConnectivity())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * XYZ座標値をシリアライズする : データ型, 節点（ノード）数, X,Y,Z座標値の列データ.
+ * @param grid            グリッド座標
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packGridCoordinates(UdmGridCoordinates *grid)
+{
+    if (grid == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmGridCoordinates is null.");
+    }
+    UdmDataType_t datatype = grid->getDataType();
+    UdmSize_t num_nodes = grid->getNumNodes();
+    if (datatype != Udm_RealSingle && datatype != Udm_RealDouble) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid coordinates datatype=%d.", (int)datatype);
+    }
+    this->writeValue((int)datatype);
+    this->writeValue(num_nodes);
+    if (num_nodes <= 0) return UDM_OK;
+
+    UdmSize_t count = 0;
+    if (datatype == Udm_RealSingle) {
+        float *coords = (float*)this->reserveColumn(sizeof(float)*num_nodes*3);
+        count += grid->getGridCoordinatesX(1, num_nodes, coords);
+        count += grid->getGridCoordinatesY(1, num_nodes, coords+num_nodes);
+        count += grid->getGridCoordinatesZ(1, num_nodes, coords+2*num_nodes);
+    }
+    else {
+        double *coords = (double*)this->reserveColumn(sizeof(double)*num_nodes*3);
+        count += grid->getGridCoordinatesX(1, num_nodes, coords);
+        count += grid->getGridCoordinatesY(1, num_nodes, coords+num_nodes);
+        count += grid->getGridCoordinatesZ(1, num_nodes, coords+2*num_nodes);
+    }
+    if (count != num_nodes*3) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : getGridCoordinates(num_nodes=%d).", (int)num_nodes);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * セクション（要素構成）をシリアライズする.
+ * セクション（要素構成）毎に名称, 要素形状タイプ, 要素（セル）数, CGNS:Elementsの接続情報（ノードID）の列データとする.
+ * @param sections            要素管理クラス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packSections(UdmSections *sections)
+{
+    int n;
+    if (sections == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmSections is null.");
+    }
+
+    int num_sections = sections->getNumSections();
+    this->writeValue(num_sections);
+    for (n=1; n<=num_sections; n++) {
+        UdmElements *section = sections->getSection(n);
+        if (section == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmElements is null(section_id=%d).", n);
+        }
+        UdmSize_t num_cells = section->getNumCells();
+        this->writeString(section->getName());
+        this->writeValue((int)section->getElementType());
+        this->writeValue(num_cells);
+
+        size_t data_size = 0;
+        cgsize_t *element_ids = NULL;
+        if (num_cells > 0) {
+            element_ids = section->createCgnsElementIds(data_size);
+        }
+        this->writeValue((UdmSize_t)data_size);
+        if (data_size > 0) {
+            memcpy(this->reserveColumn(sizeof(cgsize_t)*data_size), element_ids, sizeof(cgsize_t)*data_size);
+        }
+        if (element_ids != NULL) delete []element_ids;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 物理量をシリアライズする.
+ * 物理量毎に名称, 適用位置, データ型, 成分数, 節点（ノード）又は要素（セル）数, 成分毎の連続配列の列データとする.
+ * @param zone            出力ゾーン
+ * @param write_constsolutions    固定物理量データの出力フラグ : true=固定物理量データをシリアライズする.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packSolutionFields(UdmZone *zone, bool write_constsolutions)
+{
+    UdmSize_t field_id, num_fields;
+    size_t n;
+    UdmFlowSolutions *solutions = zone->getFlowSolutions();
+    if (solutions == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmFlowSolutions is null.");
+    }
+
+    // 出力物理量 : 固定値物理量は出力時のみ
+    std::vector<const UdmSolutionFieldConfig*> configs;
+    num_fields = solutions->getNumSolutionFields();
+    for (field_id=1; field_id<=num_fields; field_id++) {
+        const UdmSolutionFieldConfig* config = solutions->getSolutionField(field_id);
+        if (config == NULL) continue;
+        if (config->isConstantFlag() && !write_constsolutions) continue;
+        if (config->getGridLocation() != Udm_Vertex && config->getGridLocation() != Udm_CellCenter) continue;
+        configs.push_back(config);
+    }
+
+    this->writeValue((int)configs.size());
+    for (n=0; n<configs.size(); n++) {
+        const UdmSolutionFieldConfig* config = configs[n];
+        UdmEntityVoxels *voxels = NULL;
+        if (config->getGridLocation() == Udm_Vertex) voxels = zone->getGridCoordinates();
+        else voxels = zone->getSections();
+        UdmDataType_t datatype = config->getDataType();
+        int vector_size = config->getNvectorSize();
+        UdmSize_t num_entities = voxels->getNumEntities();
+        unsigned int sizeofdata = this->sizeofDataType(datatype);
+        if (sizeofdata <= 0) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_INVALID_PARAMETERS, "invalid field[%s] datatype=%d.", config->getSolutionName().c_str(), (int)datatype);
+        }
+
+        this->writeString(config->getSolutionName());
+        this->writeValue((int)config->getGridLocation());
+        this->writeValue((int)datatype);
+        this->writeValue(vector_size);
+        this->writeValue(num_entities);
+        if (num_entities <= 0 || vector_size <= 0) continue;
+
+        void *values = this->reserveColumn((size_t)num_entities*vector_size*sizeofdata);
+        if (voxels->getEntitySolutionArray(
+                                config->getSolutionName(),
+                                1, num_entities,
+                                vector_size,
+                                datatype,
+                                values,
+                                Udm_MemSequentialArray) != UDM_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : getEntitySolutionArray(field name=%s)", config->getSolutionName().c_str());
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * ユーザ定義データをシリアライズする : 名称, データ型, 次元数, 次元毎のデータ数, データの列データ.
+ * @param user_datas            ユーザ定義データ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packUserDatas(const UdmUserDefinedDatas *user_datas)
+{
+    int n, i;
+    if (user_datas == NULL) {
+        this->writeValue((int)0);
+        return UDM_OK;
+    }
+
+    int num_datas = user_datas->getNumUserDatas();
+    this->writeValue(num_datas);
+    for (n=1; n<=num_datas; n++) {
+        const std::string &array_name = user_datas->getUserDataName(n);
+        UdmDataType_t datatype = Udm_DataTypeUnknown;
+        int dimension = 0;
+        UdmSize_t dim_sizes[12] = {0x00};
+        if (user_datas->getUserDataInfo(array_name, datatype, dimension, dim_sizes) != UDM_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "failure : getUserDataInfo(%s)", array_name.c_str());
+        }
+        size_t size = this->sizeofDataType(datatype);
+        for (i=0; i<dimension; i++) size *= dim_sizes[i];
+        if (size <= 0) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "invalid user data(%s).", array_name.c_str());
+        }
+
+        this->writeString(array_name);
+        this->writeValue((int)datatype);
+        this->writeValue(dimension);
+        for (i=0; i<dimension; i++) this->writeValue(dim_sizes[i]);
+        if (user_datas->getUserDataArray(array_name, datatype, this->reserveColumn(size)) != UDM_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "failure : getUserDataArray(%s)", array_name.c_str());
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 内部境界情報をシリアライズする : 内部境界情報数, 内部境界情報の列データ.
+ * 内部境界情報は送信元ランクにてCGNS出力内部境界情報として作成し、自ランク番号は送信元ランク番号とする.
+ * @param rank_connectivity            内部境界情報
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::packRankConnectivity(const UdmRankConnectivity *rank_connectivity)
+{
+    std::vector<int> info_array;
+    if (rank_connectivity != NULL) {
+        rank_connectivity->createCgnsRankInfos(info_array);
+    }
+
+    UdmSize_t num_infos = info_array.size()/4;
+    this->writeValue(num_infos);
+    if (num_infos <= 0) return UDM_OK;
+    memcpy(this->reserveColumn(sizeof(int)*num_infos*4), &info_array[0], sizeof(int)*num_infos*4);
+
+    return UDM_OK;
+}
+
+/**
+ * 値を書き込む.
+ * @param value        書込値
+ */
+template<class VALUE_TYPE>
+void UdmCgnsGatherArchive::writeValue(VALUE_TYPE value)
+{
+    memcpy(this->reserveBuffer(sizeof(VALUE_TYPE)), &value, sizeof(VALUE_TYPE));
+}
+
+/**
+ * 文字列を書き込む : 文字列長, 文字列.
+ * @param value        書込文字列
+ */
+void UdmCgnsGatherArchive::writeString(const std::string &value)
+{
+    this->writeValue((unsigned int)value.length());
+    if (value.empty()) return;
+    memcpy(this->reserveBuffer(value.length()), value.c_str(), value.length());
+}
+
+/**
+ * シリアライズバッファの末尾に書込領域を確保する.
+ * @param size        書込サイズ(byte)
+ * @return        書込位置
+ */
+char* UdmCgnsGatherArchive::reserveBuffer(size_t size)
+{
+    size_t pos = this->buffer.size();
+    if (this->buffer.capacity() < pos + size) {
+        this->buffer.reserve((pos + size)*2);
+    }
+    this->buffer.resize(pos + size);
+    return &this->buffer[pos];
+}
+
+/**
+ * シリアライズバッファの末尾に列データの書込領域を確保する.
+ * 列データの位置は倍精度のアライメントとする.
+ * @param size        列データサイズ(byte)
+ * @return        書込位置
+ */
+char* UdmCgnsGatherArchive::reserveColumn(size_t size)
+{
+    size_t padding = (sizeof(double) - this->buffer.size() % sizeof(double)) % sizeof(double);
+    char *buf = this->reserveBuffer(padding + size);
+    if (padding > 0) memset(buf, 0x00, padding);
+    return buf + padding;
+}
+
+/**
+ * シリアライズバッファからゾーンを生成する.
+ * ゾーンは親モデルに追加せず、呼出元にて出力後に削除すること.
+ * エラーの場合も生成したゾーンは返す.
+ * @param [in] model        生成ゾーンの親モデル : 物理量情報、CGNS出力作業バッファを使用する.
+ * @param [out] zones        生成ゾーン : 追加する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackZones(UdmModel *model, std::vector<UdmZone*> &zones)
+{
+    UdmError_t error = UDM_OK;
+    int n, num_zones = 0;
+
+    this->read_pos = this->getBuffer();
+    this->read_end = this->read_pos + this->buffer.size();
+    if (!this->readValue(num_zones) || num_zones < 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of zones.");
+    }
+    for (n=0; n<num_zones; n++) {
+        UdmZone *zone = new UdmZone(model);
+        zones.push_back(zone);
+        if ((error = this->unpackZone(zone)) != UDM_OK) {
+            return UDM_ERROR_HANDLER(error, "abend unpackZone[%d].", n+1);
+        }
+    }
+    if (this->read_pos != this->read_end) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize : remaining %d bytes.", (int)(this->read_end - this->read_pos));
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * ゾーンをデシリアライズする.
+ * @param zone        生成ゾーン
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackZone(UdmZone *zone)
+{
+    UdmError_t error = UDM_OK;
+    UdmSize_t zone_id = 0;
+    std::string zone_name;
+
+    if (!this->readValue(zone_id) || !this->readString(zone_name)) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize zone.");
+    }
+    zone->setId(zone_id);
+    zone->setName(zone_name);
+
+    if ((error = this->unpackGridCoordinates(zone->getGridCoordinates())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->unpackSections(zone->getSections())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->unpackSolutionFields(zone)) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->unpackUserDatas(zone->getUserDefinedDatas())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    if ((error = this->unpackRankConnectivity(zone->getRankConnectivity())) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * XYZ座標値をデシリアライズして、節点（ノード）を生成する.
+ * @param grid            グリッド座標
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackGridCoordinates(UdmGridCoordinates *grid)
+{
+    int datatype = Udm_DataTypeUnknown;
+    UdmSize_t num_nodes = 0;
+    if (!this->readValue(datatype) || !this->readValue(num_nodes)) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize GridCoordinates.");
+    }
+    grid->setDataType((UdmDataType_t)datatype);
+    if (num_nodes <= 0) return UDM_OK;
+
+    UdmSize_t count = 0;
+    if (datatype == Udm_RealSingle) {
+        float *coords = (float*)this->readColumn(sizeof(float)*num_nodes*3);
+        if (coords == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize coords[num_nodes=%d].", (int)num_nodes);
+        }
+        count = grid->setGridCoordinatesArray(num_nodes, coords, coords+num_nodes, coords+2*num_nodes);
+    }
+    else if (datatype == Udm_RealDouble) {
+        double *coords = (double*)this->readColumn(sizeof(double)*num_nodes*3);
+        if (coords == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize coords[num_nodes=%d].", (int)num_nodes);
+        }
+        count = grid->setGridCoordinatesArray(num_nodes, coords, coords+num_nodes, coords+2*num_nodes);
+    }
+    else {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "invalid coordinates datatype=%d.", datatype);
+    }
+    if (count != num_nodes) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_GRIDCOORDINATES, "failure : setGridCoordinatesArray(num_nodes=%d).", (int)num_nodes);
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * セクション（要素構成）をデシリアライズして、要素（セル）を生成する.
+ * 要素（セル）はCGNSファイルの読込と同様に接続情報（ノードID）から生成する.
+ * @param sections            要素管理クラス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackSections(UdmSections *sections)
+{
+    UdmError_t error = UDM_OK;
+    int n, num_sections = 0;
+    UdmSize_t start = 1;
+
+    if (!this->readValue(num_sections) || num_sections < 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of sections.");
+    }
+    for (n=1; n<=num_sections; n++) {
+        std::string section_name;
+        int element_type = Udm_ElementTypeUnknown;
+        UdmSize_t num_cells = 0, data_size = 0;
+        if (!this->readString(section_name)
+            || !this->readValue(element_type)
+            || !this->readValue(num_cells)
+            || !this->readValue(data_size)) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize section[%d].", n);
+        }
+        const cgsize_t *element_ids = (const cgsize_t*)this->readColumn(sizeof(cgsize_t)*data_size);
+        if (num_cells > 0 && element_ids == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize section[%s] elements.", section_name.c_str());
+        }
+
+        UdmElements *section = new UdmElements(sections);
+        section->setName(section_name);
+        section->setElementType((UdmElementType_t)element_type);
+        if (num_cells > 0) {
+            error = section->readCgnsElements((UdmElementType_t)element_type, start, num_cells, element_ids);
+            if (error != UDM_OK) {
+                delete section;
+                return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_CREATE_CELL, "failure : readCgnsElements(section=%s).", section_name.c_str());
+            }
+        }
+        sections->setSection(section);
+        start += num_cells;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 物理量をデシリアライズして、節点（ノード）又は要素（セル）に設定する.
+ * @param zone            生成ゾーン
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackSolutionFields(UdmZone *zone)
+{
+    int n, num_fields = 0;
+    if (!this->readValue(num_fields) || num_fields < 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of fields.");
+    }
+    for (n=0; n<num_fields; n++) {
+        std::string field_name;
+        int location = Udm_GridLocationUnknown, datatype = Udm_DataTypeUnknown;
+        int vector_size = 0;
+        UdmSize_t num_entities = 0;
+        if (!this->readString(field_name)
+            || !this->readValue(location)
+            || !this->readValue(datatype)
+            || !this->readValue(vector_size)
+            || !this->readValue(num_entities)) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize field[%d].", n+1);
+        }
+        if (num_entities <= 0 || vector_size <= 0) continue;
+
+        unsigned int sizeofdata = this->sizeofDataType((UdmDataType_t)datatype);
+        if (sizeofdata <= 0) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "invalid field[%s] datatype=%d.", field_name.c_str(), datatype);
+        }
+        void *values = this->readColumn((size_t)num_entities*vector_size*sizeofdata);
+        if (values == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize field[%s] values.", field_name.c_str());
+        }
+
+        UdmEntityVoxels *voxels = NULL;
+        if (location == Udm_Vertex) voxels = zone->getGridCoordinates();
+        else if (location == Udm_CellCenter) voxels = zone->getSections();
+        else {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "invalid field[%s] GridLocation=%d.", field_name.c_str(), location);
+        }
+        if (voxels->setEntitySolutionArray(
+                                field_name,
+                                num_entities,
+                                vector_size,
+                                (UdmDataType_t)datatype,
+                                values,
+                                Udm_MemSequentialArray) != UDM_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : setEntitySolutionArray(field name=%s)", field_name.c_str());
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * ユーザ定義データをデシリアライズする.
+ * @param user_datas            ユーザ定義データ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackUserDatas(UdmUserDefinedDatas *user_datas)
+{
+    int n, i, num_datas = 0;
+    if (!this->readValue(num_datas) || num_datas < 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of user datas.");
+    }
+    for (n=0; n<num_datas; n++) {
+        std::string array_name;
+        int datatype = Udm_DataTypeUnknown, dimension = 0;
+        UdmSize_t dim_sizes[12] = {0x00};
+        if (!this->readString(array_name)
+            || !this->readValue(datatype)
+            || !this->readValue(dimension)
+            || dimension <= 0 || dimension > 12) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize user data[%d].", n+1);
+        }
+        size_t size = this->sizeofDataType((UdmDataType_t)datatype);
+        for (i=0; i<dimension; i++) {
+            if (!this->readValue(dim_sizes[i])) {
+                return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize user data[%s] sizes.", array_name.c_str());
+            }
+            size *= dim_sizes[i];
+        }
+        void *data = this->readColumn(size);
+        if (data == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize user data[%s].", array_name.c_str());
+        }
+        if (user_datas->setUserData(array_name, (UdmDataType_t)datatype, dimension, dim_sizes, data) != UDM_OK) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_USERDEFINEDDATA, "failure : setUserData(%s)", array_name.c_str());
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 内部境界情報をデシリアライズして、CGNS出力内部境界情報に設定する.
+ * 生成ゾーンの節点（ノード）は集約ランクのランク番号となる為、内部境界情報は送信元ランク番号のまま出力する.
+ * @param rank_connectivity            内部境界情報
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmCgnsGatherArchive::unpackRankConnectivity(UdmRankConnectivity *rank_connectivity)
+{
+    UdmSize_t num_infos = 0;
+    if (!this->readValue(num_infos)) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of rank connectivity.");
+    }
+    if (num_infos <= 0) return UDM_OK;
+
+    const int *infos = (const int*)this->readColumn(sizeof(int)*num_infos*4);
+    if (infos == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize rank connectivity[num_infos=%d].", (int)num_infos);
+    }
+    if (rank_connectivity == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "UdmRankConnectivity is null.");
+    }
+    rank_connectivity->setCgnsRankInfos(std::vector<int>(infos, infos+num_infos*4));
+
+    return UDM_OK;
+}
+
+/**
+ * 値を読み込む.
+ * @param [out] value        読込値
+ * @return        true=読込成功
+ */
+template<class VALUE_TYPE>
+bool UdmCgnsGatherArchive::readValue(VALUE_TYPE &value)
+{
+    const char *buf = this->readBuffer(sizeof(VALUE_TYPE));
+    if (buf == NULL) return false;
+    memcpy(&value, buf, sizeof(VALUE_TYPE));
+    return true;
+}
+
+/**
+ * 読込位置を取得して、デシリアライズ位置を進める.
+ * @param size        読込サイズ(byte)
+ * @return        読込位置 : 読込サイズ=0, 又はバッファサイズを超える場合はNULL
+ */
+char* UdmCgnsGatherArchive::readBuffer(size_t size)
+{
+    if (size == 0) return NULL;
+    if (this->read_pos == NULL) return NULL;
+    if ((size_t)(this->read_end - this->read_pos) < size) return NULL;
+    char *buf = this->read_pos;
+    this->read_pos += size;
+    return buf;
+}
+
+/**
+ * 列データ位置を取得して、デシリアライズ位置を進める.
+ * 列データの位置は倍精度のアライメントとする.
+ * @param size        列データサイズ(byte)
+ * @return        列データ位置 : 列データサイズ=0, 又はバッファサイズを超える場合はNULL
+ */
+char* UdmCgnsGatherArchive::readColumn(size_t size)
+{
+    if (size == 0) return NULL;
+    if (this->read_pos == NULL) return NULL;
+    size_t offset = this->read_pos - this->getBuffer();
+    size_t padding = (sizeof(double) - offset % sizeof(double)) % sizeof(double);
+    char *buf = this->readBuffer(padding + size);
+    if (buf == NULL) return NULL;
+    return buf + padding;
+}
+
+/**
+ * 文字列を読み込む : 文字列長, 文字列.
+ * @param [out] value        読込文字列
+ * @return        true=読込成功
+ */
+bool UdmCgnsGatherArchive::readString(std::string &value)
+{
+    unsigned int length = 0;
+    if (!this->readValue(length)) return false;
+    if (length == 0) {
+        value.clear();
+        return true;
+    }
+    const char *buf = this->readBuffer(length);
+    if (buf == NULL) return false;
+    value.assign(buf, length);
+    return true;
+}
+
+/**
+ * データ型のサイズを取得する.
+ * @param datatype        データ型
+ * @return        データ型のサイズ(byte) : 未対応のデータ型は0
+ */
+unsigned int UdmCgnsGatherArchive::sizeofDataType(UdmDataType_t datatype)
+{
+    if (datatype == Udm_Integer) return sizeof(int);
+    else if (datatype == Udm_LongInteger) return sizeof(long long);
+    else if (datatype == Udm_RealSingle) return sizeof(float);
+    else if (datatype == Udm_RealDouble) return sizeof(double);
+    return 0;
+}
+
+} /* namespace udm */
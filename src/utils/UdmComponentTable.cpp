@@ -0,0 +1,326 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmComponentTable.cpp
+ * 部品要素（セル）検索テーブルクラスのソースファイル
+ */
+
+#include "utils/UdmComponentTable.h"
+#include "model/UdmNode.h"
+#include "model/UdmComponent.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ */
+UdmComponentTable::UdmComponentTable()
+{
+    this->initialize();
+}
+
+/**
+ * コンストラクタ
+ * @param components        登録部品要素（セル）リスト
+ */
+UdmComponentTable::UdmComponentTable(const std::vector<UdmComponent*> &components)
+{
+    this->initialize();
+    this->createComponentTable(components);
+}
+
+/**
+ * デストラクタ
+ */
+UdmComponentTable::~UdmComponentTable()
+{
+    this->component_slots.clear();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmComponentTable::initialize()
+{
+    this->component_slots.clear();
+    this->num_entries = 0;
+}
+
+/**
+ * 部品要素（セル）検索テーブルを作成する.
+ * @param components        登録部品要素（セル）リスト
+ */
+void UdmComponentTable::createComponentTable(const std::vector<UdmComponent*> &components)
+{
+    this->clearComponentTable();
+    this->reserve(components.size());
+
+    std::vector<UdmComponent*>::const_iterator itr;
+    for (itr=components.begin(); itr!=components.end(); itr++) {
+        this->addComponentCell(*itr);
+    }
+
+    return;
+}
+
+/**
+ * 部品要素（セル）検索テーブルをクリアする.
+ * 確保スロットは解放しない.
+ */
+void UdmComponentTable::clearComponentTable()
+{
+    if (this->num_entries > 0) {
+        std::vector<UdmComponentTableSlot>::iterator itr;
+        for (itr=this->component_slots.begin(); itr!=this->component_slots.end(); itr++) {
+            itr->component = NULL;
+        }
+    }
+    this->num_entries = 0;
+    return;
+}
+
+/**
+ * 部品要素（セル）を追加する.
+ * 同一構成節点（ノード）の部品要素（セル）が登録済みの場合は追加しない.
+ * @param component        部品要素（セル）
+ * @return        true=追加した
+ */
+bool UdmComponentTable::addComponentCell(UdmComponent* component)
+{
+    if (component == NULL) return false;
+    if (component->getNumNodes() <= 0) return false;
+
+    // 登録数がスロット数の1/2を超える場合は拡張する.
+    if ((this->num_entries+1)*2 > this->component_slots.size()) {
+        UdmSize_t num_slots = this->component_slots.size();
+        if (num_slots < UDM_COMPONENTTABLE_MINSLOTS) num_slots = UDM_COMPONENTTABLE_MINSLOTS;
+        while ((this->num_entries+1)*2 > num_slots) num_slots *= 2;
+        this->rehash(num_slots);
+    }
+
+    const std::vector<UdmNode*> &nodes = component->getNodes();
+    if (this->findComponentCell(nodes) != NULL) {
+        return false;
+    }
+
+    unsigned long long hash_key = UdmComponentTable::hashNodes(&nodes[0], nodes.size());
+    UdmSize_t mask = this->component_slots.size() - 1;
+    UdmSize_t slot = this->getHomeSlot(hash_key);
+    while (this->component_slots[slot].component != NULL) {
+        slot = (slot + 1) & mask;
+    }
+    this->component_slots[slot].hash_key = hash_key;
+    this->component_slots[slot].component = component;
+    this->num_entries++;
+
+    return true;
+}
+
+/**
+ * 部品要素（セル）を削除する.
+ * 登録部品要素（セル）が削除部品要素（セル）と一致する場合のみ削除する.
+ * @param component        削除部品要素（セル）
+ * @return        true=削除した
+ */
+bool UdmComponentTable::removeComponentCell(const UdmComponent* component)
+{
+    if (component == NULL) return false;
+    if (this->num_entries <= 0) return false;
+
+    unsigned long long hash_key = UdmComponentTable::hashNodes(component);
+    UdmSize_t mask = this->component_slots.size() - 1;
+    UdmSize_t slot = this->getHomeSlot(hash_key);
+    while (this->component_slots[slot].component != component) {
+        if (this->component_slots[slot].component == NULL) return false;
+        slot = (slot + 1) & mask;
+    }
+
+    // 後続スロットを詰める（線形探索の探索列を維持する）.
+    UdmSize_t empty = slot;
+    UdmSize_t next = (slot + 1) & mask;
+    while (this->component_slots[next].component != NULL) {
+        UdmSize_t home = this->getHomeSlot(this->component_slots[next].hash_key);
+        // homeが(empty, next]の範囲外であれば空きスロットに移動する.
+        if (((next - home) & mask) >= ((next - empty) & mask)) {
+            this->component_slots[empty] = this->component_slots[next];
+            empty = next;
+        }
+        next = (next + 1) & mask;
+    }
+    this->component_slots[empty].component = NULL;
+    this->num_entries--;
+
+    return true;
+}
+
+/**
+ * 同一構成節点（ノード）の部品要素（セル）を検索する.
+ * 構成節点（ノード）の順序は問わない.
+ * @param nodes        構成節点（ノード）リスト
+ * @return        検索結果部品要素（セル）：存在しない場合はNULLを返す。
+ */
+UdmComponent* UdmComponentTable::findComponentCell(const std::vector<UdmNode*> &nodes) const
+{
+    if (nodes.size() <= 0) return NULL;
+    return this->findComponentCell(&nodes[0], nodes.size());
+}
+
+/**
+ * 同一構成節点（ノード）の部品要素（セル）を検索する.
+ * 構成節点（ノード）の順序は問わない.
+ * @param nodes        構成節点（ノード）配列
+ * @param num_nodes        構成節点（ノード）数
+ * @return        検索結果部品要素（セル）：存在しない場合はNULLを返す。
+ */
+UdmComponent* UdmComponentTable::findComponentCell(UdmNode* const nodes[], unsigned int num_nodes) const
+{
+    if (this->num_entries <= 0) return NULL;
+    if (num_nodes <= 0) return NULL;
+
+    unsigned long long hash_key = UdmComponentTable::hashNodes(nodes, num_nodes);
+    UdmSize_t mask = this->component_slots.size() - 1;
+    UdmSize_t slot = this->getHomeSlot(hash_key);
+    while (this->component_slots[slot].component != NULL) {
+        if (this->component_slots[slot].hash_key == hash_key
+            && this->component_slots[slot].component->equalsNodeIds(nodes, num_nodes)) {
+            return this->component_slots[slot].component;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+/**
+ * 登録数を予め確保する.
+ * @param size        登録数
+ */
+void UdmComponentTable::reserve(UdmSize_t size)
+{
+    UdmSize_t num_slots = UDM_COMPONENTTABLE_MINSLOTS;
+    while (size*2 > num_slots) num_slots *= 2;
+    if (num_slots <= this->component_slots.size()) return;
+    this->rehash(num_slots);
+    return;
+}
+
+/**
+ * 登録数を取得する.
+ * @return        登録数
+ */
+UdmSize_t UdmComponentTable::size() const
+{
+    return this->num_entries;
+}
+
+/**
+ * メモリサイズを取得する.
+ * @return        メモリサイズ
+ */
+size_t UdmComponentTable::getMemSize() const
+{
+    return sizeof(*this) + this->component_slots.capacity()*sizeof(UdmComponentTableSlot);
+}
+
+/**
+ * 構成節点（ノード）配列のハッシュ値を取得する.
+ * 節点（ノード）毎のハッシュ値の和と排他的論理和を合成して、節点（ノード）の順序に依存しない値とする.
+ * @param nodes        構成節点（ノード）配列
+ * @param num_nodes        構成節点（ノード）数
+ * @return        ハッシュ値
+ */
+unsigned long long UdmComponentTable::hashNodes(UdmNode* const nodes[], unsigned int num_nodes)
+{
+    unsigned long long sum_key = 0, xor_key = 0;
+    unsigned int n;
+    for (n=0; n<num_nodes; n++) {
+        unsigned long long key = UdmComponentTable::hashNodeId(nodes[n]->getMyRankno(), nodes[n]->getId());
+        sum_key += key;
+        xor_key ^= key;
+    }
+    unsigned long long key = sum_key ^ ((xor_key << 31) | (xor_key >> 33));
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key;
+}
+
+/**
+ * 部品要素（セル）の構成節点（ノード）のハッシュ値を取得する.
+ * @param component        部品要素（セル）
+ * @return        ハッシュ値
+ */
+unsigned long long UdmComponentTable::hashNodes(const UdmComponent* component)
+{
+    const std::vector<UdmNode*> &nodes = component->getNodes();
+    if (nodes.size() <= 0) return UdmComponentTable::hashNodes(NULL, 0);
+    return UdmComponentTable::hashNodes(&nodes[0], nodes.size());
+}
+
+/**
+ * 節点（ノード）のランク番号、IDのハッシュ値を取得する.
+ * @param rankno        ランク番号
+ * @param localid        ID
+ * @return        ハッシュ値
+ */
+unsigned long long UdmComponentTable::hashNodeId(int rankno, UdmSize_t localid)
+{
+    unsigned long long key = ((unsigned long long)(unsigned int)rankno << 32)
+                            ^ (unsigned long long)localid;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return key;
+}
+
+/**
+ * ハッシュ値からスロット位置を取得する.
+ * @param hash_key        ハッシュ値
+ * @return        スロット位置
+ */
+UdmSize_t UdmComponentTable::getHomeSlot(unsigned long long hash_key) const
+{
+    return (UdmSize_t)(hash_key & (this->component_slots.size() - 1));
+}
+
+/**
+ * スロット数を変更して、登録済みの部品要素（セル）を再配置する.
+ * @param num_slots        スロット数（２のべき乗）
+ */
+void UdmComponentTable::rehash(UdmSize_t num_slots)
+{
+    std::vector<UdmComponentTableSlot> old_slots;
+    old_slots.swap(this->component_slots);
+
+    UdmComponentTableSlot empty_slot;
+    empty_slot.hash_key = 0;
+    empty_slot.component = NULL;
+    this->component_slots.assign(num_slots, empty_slot);
+
+    UdmSize_t mask = num_slots - 1;
+    std::vector<UdmComponentTableSlot>::const_iterator itr;
+    for (itr=old_slots.begin(); itr!=old_slots.end(); itr++) {
+        if (itr->component == NULL) continue;
+        UdmSize_t slot = this->getHomeSlot(itr->hash_key);
+        while (this->component_slots[slot].component != NULL) {
+            slot = (slot + 1) & mask;
+        }
+        this->component_slots[slot] = *itr;
+    }
+
+    return;
+}
+
+} /* namespace udm */
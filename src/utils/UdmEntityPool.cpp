@@ -0,0 +1,238 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmEntityPool.cpp
+ * 節点（ノード）、要素（セル）メモリプールクラスのソースファイル
+ */
+
+#include "utils/UdmEntityPool.h"
+#include <new>
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ */
+UdmEntityPool::UdmEntityPool()
+{
+    this->initialize();
+}
+
+/**
+ * デストラクタ
+ */
+UdmEntityPool::~UdmEntityPool()
+{
+    this->clearPool();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmEntityPool::initialize()
+{
+    this->slot_sizes.clear();
+    this->free_slots.clear();
+    this->pool_blocks.clear();
+    this->num_allocated = 0;
+    this->released = false;
+}
+
+/**
+ * 確保ブロックをすべて解放する.
+ */
+void UdmEntityPool::clearPool()
+{
+    std::vector< std::vector<char*> >::iterator itr;
+    std::vector<char*>::iterator block_itr;
+    for (itr=this->pool_blocks.begin(); itr!=this->pool_blocks.end(); itr++) {
+        for (block_itr=itr->begin(); block_itr!=itr->end(); block_itr++) {
+            free(*block_itr);
+        }
+    }
+    this->slot_sizes.clear();
+    this->free_slots.clear();
+    this->pool_blocks.clear();
+    this->num_allocated = 0;
+}
+
+/**
+ * スロットサイズのインデックスを取得する.
+ * スロットサイズが未登録の場合は追加する.
+ * @param slot_size        スロットサイズ
+ * @return        スロットサイズインデックス
+ */
+int UdmEntityPool::getSlotIndex(size_t slot_size)
+{
+    int n;
+    int num_sizes = this->slot_sizes.size();
+    for (n=0; n<num_sizes; n++) {
+        if (this->slot_sizes[n] == slot_size) return n;
+    }
+    this->slot_sizes.push_back(slot_size);
+    this->free_slots.push_back(NULL);
+    this->pool_blocks.push_back(std::vector<char*>());
+    return num_sizes;
+}
+
+/**
+ * オブジェクト領域を割り当てる.
+ * 空きスロットが存在しない場合は、ブロックを確保する.
+ * @param size        オブジェクトサイズ
+ * @return        オブジェクト領域
+ */
+void* UdmEntityPool::allocate(size_t size)
+{
+    size_t slot_size = sizeof(UdmEntityPoolHeader) + ((size + sizeof(double) - 1) / sizeof(double)) * sizeof(double);
+    int index = this->getSlotIndex(slot_size);
+
+    if (this->free_slots[index] == NULL) {
+        // ブロックの確保
+        char *block = (char*)malloc(slot_size*UDM_ENTITYPOOL_BLOCKSLOTS);
+        if (block == NULL) throw std::bad_alloc();
+        this->pool_blocks[index].push_back(block);
+
+        // 空きスロットリストの作成 : 空きスロットはオブジェクト領域の先頭に次の空きスロットを保持する.
+        int n;
+        void *next = NULL;
+        for (n=UDM_ENTITYPOOL_BLOCKSLOTS-1; n>=0; n--) {
+            UdmEntityPoolHeader *header = (UdmEntityPoolHeader*)(block + slot_size*n);
+            header->pool = this;
+            header->slot_index = index;
+            *(void**)(header + 1) = next;
+            next = header;
+        }
+        this->free_slots[index] = next;
+    }
+
+    UdmEntityPoolHeader *header = (UdmEntityPoolHeader*)this->free_slots[index];
+    this->free_slots[index] = *(void**)(header + 1);
+    this->num_allocated++;
+
+    return (void*)(header + 1);
+}
+
+/**
+ * スロットを空きスロットリストに戻す.
+ * 割当スロットがすべて解放された場合は、確保ブロックを一括解放する.
+ * @param header        スロットヘッダ
+ */
+void UdmEntityPool::deallocate(UdmEntityPoolHeader *header)
+{
+    size_t index = header->slot_index;
+    if (index >= this->free_slots.size()) return;
+
+    *(void**)(header + 1) = this->free_slots[index];
+    this->free_slots[index] = header;
+    if (this->num_allocated > 0) this->num_allocated--;
+
+    if (this->num_allocated == 0) {
+        this->clearPool();
+    }
+}
+
+/**
+ * 所有ゾーンからメモリプールを解放する.
+ * 割当スロットが存在しない場合は、メモリプールを削除する.
+ * 割当スロットが存在する場合は、すべてのスロットが解放された時点で削除する.
+ */
+void UdmEntityPool::releasePool()
+{
+    bool remove = false;
+#ifdef _OPENMP
+#pragma omp critical (udm_entity_pool)
+#endif
+    {
+        this->released = true;
+        remove = (this->num_allocated == 0);
+    }
+    if (remove) delete this;
+}
+
+/**
+ * 割当スロット数を取得する.
+ * @return        割当スロット数
+ */
+size_t UdmEntityPool::getNumAllocated() const
+{
+    return this->num_allocated;
+}
+
+/**
+ * 節点（ノード）、要素（セル）のオブジェクト領域を割り当てる.
+ * メモリプールが指定されていない場合は、ヒープから割り当てる.
+ * @param size        オブジェクトサイズ
+ * @param pool        メモリプール
+ * @return        オブジェクト領域
+ */
+void* UdmEntityPool::allocateEntity(size_t size, UdmEntityPool *pool)
+{
+    if (pool == NULL) {
+        UdmEntityPoolHeader *header = (UdmEntityPoolHeader*)::operator new(sizeof(UdmEntityPoolHeader) + size);
+        header->pool = NULL;
+        header->slot_index = 0;
+        return (void*)(header + 1);
+    }
+
+    void *ptr = NULL;
+#ifdef _OPENMP
+#pragma omp critical (udm_entity_pool)
+#endif
+    {
+        ptr = pool->allocate(size);
+    }
+    return ptr;
+}
+
+/**
+ * 節点（ノード）、要素（セル）のオブジェクト領域を解放する.
+ * @param ptr        オブジェクト領域
+ */
+void UdmEntityPool::deallocateEntity(void *ptr)
+{
+    if (ptr == NULL) return;
+    UdmEntityPoolHeader *header = ((UdmEntityPoolHeader*)ptr) - 1;
+    UdmEntityPool *pool = header->pool;
+    if (pool == NULL) {
+        ::operator delete((void*)header);
+        return;
+    }
+
+    bool remove = false;
+#ifdef _OPENMP
+#pragma omp critical (udm_entity_pool)
+#endif
+    {
+        pool->deallocate(header);
+        remove = (pool->released && pool->num_allocated == 0);
+    }
+    if (remove) delete pool;
+}
+
+/**
+ * メモリサイズを取得する.
+ * @return        メモリサイズ
+ */
+size_t UdmEntityPool::getMemSize() const
+{
+    size_t size = sizeof(*this);
+    int n;
+    int num_sizes = this->slot_sizes.size();
+    for (n=0; n<num_sizes; n++) {
+        size += this->slot_sizes[n]*UDM_ENTITYPOOL_BLOCKSLOTS*this->pool_blocks[n].size();
+    }
+    return size;
+}
+
+} /* namespace udm */
@@ -0,0 +1,864 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmMigrationArchive.cpp
+ * 分割転送アーカイブクラスのソースファイル
+ */
+
+#include "utils/UdmMigrationArchive.h"
+#include "model/UdmZone.h"
+#include "model/UdmFlowSolutions.h"
+#include "model/UdmElements.h"
+#include "model/UdmSolid.h"
+#include "model/UdmNode.h"
+#include "model/UdmSolutionData.h"
+#include "model/UdmEntityVoxels.h"
+#include "config/UdmSolutionFieldConfig.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ */
+UdmMigrationArchive::UdmMigrationArchive()
+{
+    this->initialize();
+}
+
+/**
+ * デストラクタ
+ */
+UdmMigrationArchive::~UdmMigrationArchive()
+{
+    this->clear();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmMigrationArchive::initialize()
+{
+    this->read_pos = NULL;
+    this->read_end = NULL;
+}
+
+/**
+ * シリアライズバッファを破棄する.
+ */
+void UdmMigrationArchive::clear()
+{
+    std::vector<char>().swap(this->buffer);
+    this->read_pos = NULL;
+    this->read_end = NULL;
+}
+
+/**
+ * シリアライズバッファを取得する.
+ * @return        シリアライズバッファ
+ */
+const char* UdmMigrationArchive::getBuffer() const
+{
+    if (this->buffer.empty()) return NULL;
+    return &this->buffer[0];
+}
+
+/**
+ * シリアライズバッファを取得する.
+ * @return        シリアライズバッファ
+ */
+char* UdmMigrationArchive::getBuffer()
+{
+    if (this->buffer.empty()) return NULL;
+    return &this->buffer[0];
+}
+
+/**
+ * シリアライズバッファサイズを取得する.
+ * @return        シリアライズバッファサイズ(byte)
+ */
+size_t UdmMigrationArchive::getBufferSize() const
+{
+    return this->buffer.size();
+}
+
+/**
+ * 転送要素（セル）をシリアライズする.
+ * 構成節点（ノード）テーブル、要素（セル）テーブルの順にシリアライズバッファに書き込む.
+ * 構成節点（ノード）は初出順に重複を除いてテーブルに追加する.
+ * @param zone        転送元ゾーン : 物理量情報の取得に使用する
+ * @param cells        転送要素（セル）
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationArchive::packCells(const UdmZone *zone, const std::vector<UdmCell*> &cells)
+{
+    UdmSize_t n, num_nodes;
+    size_t i;
+
+    this->buffer.clear();
+
+    // 構成節点（ノード）テーブル
+    std::vector<const UdmEntity*> nodes;
+    std::vector<unsigned int> node_counts(cells.size());
+    std::vector<unsigned int> node_indices;
+    std::map<const UdmNode*, unsigned int> node_map;
+    for (i=0; i<cells.size(); i++) {
+        const UdmCell *cell = cells[i];
+        if (cell == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "cell is null.");
+        }
+        num_nodes = cell->getNumNodes();
+        node_counts[i] = (unsigned int)num_nodes;
+        for (n=1; n<=num_nodes; n++) {
+            const UdmNode *node = cell->getNode(n);
+            if (node == NULL) {
+                return UDM_ERROR_HANDLER(UDM_ERROR_NULL_VARIABLE, "node is null(cell_id=%d,node=%d).", cell->getId(), n);
+            }
+            std::pair<std::map<const UdmNode*, unsigned int>::iterator, bool> result
+                    = node_map.insert(std::make_pair(node, (unsigned int)nodes.size()));
+            if (result.second) {
+                nodes.push_back(node);
+            }
+            node_indices.push_back(result.first->second);
+        }
+    }
+
+    // 節点（ノード）テーブル : エンティティ列データ
+    this->packEntityTable(zone, nodes);
+
+    // 節点（ノード）テーブル : XYZ座標値. 倍精度の節点（ノード）が含まれる場合は倍精度とする.
+    UdmDataType_t coords_datatype = Udm_RealSingle;
+    for (i=0; i<nodes.size(); i++) {
+        if (static_cast<const UdmNode*>(nodes[i])->getCoordsDataType() == Udm_RealDouble) {
+            coords_datatype = Udm_RealDouble;
+            break;
+        }
+    }
+    this->writeValue((int)coords_datatype);
+    if (coords_datatype == Udm_RealDouble) {
+        std::vector<double> coords(nodes.size()*3);
+        for (i=0; i<nodes.size(); i++) {
+            static_cast<const UdmNode*>(nodes[i])->getCoords(coords[i*3], coords[i*3+1], coords[i*3+2]);
+        }
+        this->writeValues(coords.empty()?NULL:&coords[0], coords.size());
+    }
+    else {
+        std::vector<float> coords(nodes.size()*3);
+        for (i=0; i<nodes.size(); i++) {
+            static_cast<const UdmNode*>(nodes[i])->getCoords(coords[i*3], coords[i*3+1], coords[i*3+2]);
+        }
+        this->writeValues(coords.empty()?NULL:&coords[0], coords.size());
+    }
+
+    // 要素（セル）テーブル : エンティティ列データ
+    std::vector<const UdmEntity*> entities(cells.begin(), cells.end());
+    this->packEntityTable(zone, entities);
+
+    // 要素（セル）テーブル : セクション（要素構成）情報 : IDと要素形状タイプのみ
+    std::vector<UdmSize_t> elements_ids(cells.size());
+    std::vector<unsigned char> elements_types(cells.size());
+    for (i=0; i<cells.size(); i++) {
+        const UdmElements *elements = cells[i]->getParentElements();
+        if (elements != NULL) {
+            elements_ids[i] = elements->getId();
+            elements_types[i] = (unsigned char)elements->getElementType();
+        }
+        else {
+            // 仮想セルの場合、セクション（要素構成）情報はない
+            elements_ids[i] = 0;
+            elements_types[i] = (unsigned char)Udm_ElementTypeUnknown;
+        }
+    }
+    this->writeValues(elements_ids.empty()?NULL:&elements_ids[0], elements_ids.size());
+    this->writeValues(elements_types.empty()?NULL:&elements_types[0], elements_types.size());
+
+    // 要素（セル）テーブル : 構成節点（ノード）数, 節点（ノード）テーブルのインデックス
+    this->writeValues(node_counts.empty()?NULL:&node_counts[0], node_counts.size());
+    this->writeValues(node_indices.empty()?NULL:&node_indices[0], node_indices.size());
+
+    return UDM_OK;
+}
+
+/**
+ * エンティティテーブルをシリアライズする.
+ * エンティティ数, ID, 自ランク番号, 要素形状タイプ, 実体タイプ, 分割重み,
+ * MPIランク番号リスト, 以前のランク番号リスト, 物理量の順に列データとして書き込む.
+ * @param zone            転送元ゾーン
+ * @param entities        エンティティ
+ */
+void UdmMigrationArchive::packEntityTable(
+                    const UdmZone *zone,
+                    const std::vector<const UdmEntity*> &entities)
+{
+    size_t i, num_entities = entities.size();
+
+    this->writeValue((UdmSize_t)num_entities);
+
+    std::vector<UdmSize_t> ids(num_entities);
+    std::vector<int> ranknos(num_entities);
+    std::vector<unsigned char> element_types(num_entities);
+    std::vector<unsigned char> reality_types(num_entities);
+    std::vector<float> weights(num_entities);
+    for (i=0; i<num_entities; i++) {
+        const UdmEntity *entity = entities[i];
+        ids[i] = entity->getId();
+        ranknos[i] = entity->getMyRankno();
+        element_types[i] = (unsigned char)entity->getElementType();
+        reality_types[i] = (unsigned char)entity->getRealityType();
+        weights[i] = entity->getPartitionWeight();
+    }
+    this->writeValues(ids.empty()?NULL:&ids[0], num_entities);
+    this->writeValues(ranknos.empty()?NULL:&ranknos[0], num_entities);
+    this->writeValues(element_types.empty()?NULL:&element_types[0], num_entities);
+    this->writeValues(reality_types.empty()?NULL:&reality_types[0], num_entities);
+    this->writeValues(weights.empty()?NULL:&weights[0], num_entities);
+
+    // MPI:ランク番号リスト
+    this->packRankInfos(entities, false);
+    // 以前のID、ランク番号
+    this->packRankInfos(entities, true);
+
+    // 物理量 : いずれかのエンティティに設定されている物理量のみとする.
+    // 物理量フィールドIDは物理量毎に１度のみ取得し、エンティティ毎に物理量名称の検索は行わない.
+    std::vector<const UdmSolutionFieldConfig*> fields;
+    std::vector<UdmSize_t> field_ids;
+    std::vector< std::vector<unsigned int> > field_counts;
+    const UdmFlowSolutions *solutions = (zone != NULL) ? zone->getFlowSolutions() : NULL;
+    if (solutions != NULL) {
+        UdmSize_t n, num_fields = solutions->getNumSolutionFields();
+        std::vector<unsigned int> counts;
+        for (n=1; n<=num_fields; n++) {
+            const UdmSolutionFieldConfig *config = solutions->getSolutionField(n);
+            if (config == NULL) continue;
+            UdmSize_t field_id = solutions->getFieldId(config->getSolutionName());
+            if (!this->countSolutionValues(entities, field_id, config->getSolutionName(), counts)) continue;
+            fields.push_back(config);
+            field_ids.push_back(field_id);
+            field_counts.push_back(counts);
+        }
+    }
+    this->writeValue((int)fields.size());
+    for (i=0; i<fields.size(); i++) {
+        this->packSolutionField(
+                    entities,
+                    field_ids[i],
+                    fields[i]->getSolutionName(),
+                    fields[i]->getDataType(),
+                    fields[i]->getVectorType(),
+                    field_counts[i]);
+    }
+
+    return;
+}
+
+/**
+ * ランク番号リストをシリアライズする.
+ * エンティティ別のリスト数, ランク番号列, ローカルID列の順に書き込む.
+ * @param entities        エンティティ
+ * @param previous        true=以前のランク番号リスト, false=MPIランク番号リスト
+ */
+void UdmMigrationArchive::packRankInfos(const std::vector<const UdmEntity*> &entities, bool previous)
+{
+    size_t i;
+    int n, num_infos;
+    int rankno;
+    UdmSize_t localid;
+
+    std::vector<unsigned int> counts(entities.size());
+    std::vector<int> ranknos;
+    std::vector<UdmSize_t> localids;
+    for (i=0; i<entities.size(); i++) {
+        const UdmEntity *entity = entities[i];
+        num_infos = previous ? entity->getNumPreviousRankInfos() : entity->getNumMpiRankInfos();
+        counts[i] = (unsigned int)num_infos;
+        for (n=1; n<=num_infos; n++) {
+            if (previous) entity->getPreviousRankInfo(n, rankno, localid);
+            else entity->getMpiRankInfo(n, rankno, localid);
+            ranknos.push_back(rankno);
+            localids.push_back(localid);
+        }
+    }
+    this->writeValues(counts.empty()?NULL:&counts[0], counts.size());
+    this->writeValues(ranknos.empty()?NULL:&ranknos[0], ranknos.size());
+    this->writeValues(localids.empty()?NULL:&localids[0], localids.size());
+
+    return;
+}
+
+/**
+ * エンティティの物理量フィールドIDの物理量カラムデータを取得する.
+ * 物理量カラムデータにエンティティの物理量が設定されていない場合はNULLとする.
+ * @param entity        エンティティ
+ * @param field_id        物理量フィールドID（１～）
+ * @return        物理量カラムデータ
+ */
+const UdmSolutionColumn* UdmMigrationArchive::getSolutionColumn(const UdmEntity *entity, UdmSize_t field_id) const
+{
+    if (entity->solution_voxels == NULL) return NULL;
+    const UdmEntityVoxels *voxels = entity->solution_voxels;
+    const UdmSolutionColumn *column = voxels->getSolutionColumnByFieldId(field_id);
+    if (column == NULL) return NULL;
+    if (!column->existsSolutionValue(entity->solution_slot)) return NULL;
+    return column;
+}
+
+/**
+ * エンティティ別の物理量データ数を取得する.
+ * 物理量カラムデータは物理量フィールドIDにて取得し、物理量データリストを持つエンティティのみ物理量名称にて検索する.
+ * @param [in]  entities        エンティティ
+ * @param [in]  field_id        物理量フィールドID（１～）
+ * @param [in]  name            物理量名称
+ * @param [out] counts        エンティティ別の物理量データ数(未設定=0)
+ * @return        true=いずれかのエンティティに物理量が設定されている.
+ */
+bool UdmMigrationArchive::countSolutionValues(
+                    const std::vector<const UdmEntity*> &entities,
+                    UdmSize_t field_id,
+                    const std::string &name,
+                    std::vector<unsigned int> &counts) const
+{
+    size_t i;
+    bool exists = false;
+    counts.assign(entities.size(), 0);
+    for (i=0; i<entities.size(); i++) {
+        const UdmSolutionColumn *column = this->getSolutionColumn(entities[i], field_id);
+        if (column != NULL) {
+            counts[i] = column->getNvectorSize();
+        }
+        else if (!entities[i]->solution_fields.empty()) {
+            counts[i] = entities[i]->getNumSolutionValue(name);
+        }
+        if (counts[i] > 0) exists = true;
+    }
+    return exists;
+}
+
+/**
+ * 物理量列データをシリアライズする.
+ * 物理量名称, データ型, ベクトルデータタイプ, データ数の順に書き込み、物理量データを連続して書き込む.
+ * すべてのエンティティに同一データ数の物理量が設定されている場合はデータ数のみとし、
+ * それ以外はデータ数を0として、エンティティ別のデータ数(未設定=0)の列を書き込む.
+ * @param entities        エンティティ
+ * @param field_id        物理量フィールドID（１～）
+ * @param name            物理量名称
+ * @param datatype        物理量データ型
+ * @param vectortype        物理量ベクトルデータタイプ
+ * @param counts        エンティティ別の物理量データ数(未設定=0) : countSolutionValuesにて取得する.
+ */
+void UdmMigrationArchive::packSolutionField(
+                    const std::vector<const UdmEntity*> &entities,
+                    UdmSize_t field_id,
+                    const std::string &name,
+                    UdmDataType_t datatype,
+                    UdmVectorType_t vectortype,
+                    const std::vector<unsigned int> &counts)
+{
+    size_t i;
+    bool uniform = true;
+    for (i=0; i<counts.size(); i++) {
+        if (counts[i] != counts[0]) uniform = false;
+    }
+    if (!counts.empty() && counts[0] == 0) uniform = false;
+
+    this->writeString(name);
+    this->writeValue((int)datatype);
+    this->writeValue((int)vectortype);
+    if (uniform) {
+        this->writeValue(counts[0]);
+    }
+    else {
+        this->writeValue((unsigned int)0);
+        this->writeValues(counts.empty()?NULL:&counts[0], counts.size());
+    }
+
+    if (datatype == Udm_Integer) {
+        this->writeSolutionValues<int>(entities, field_id, name, counts);
+    }
+    else if (datatype == Udm_LongInteger) {
+        this->writeSolutionValues<long long>(entities, field_id, name, counts);
+    }
+    else if (datatype == Udm_RealSingle) {
+        this->writeSolutionValues<float>(entities, field_id, name, counts);
+    }
+    else if (datatype == Udm_RealDouble) {
+        this->writeSolutionValues<double>(entities, field_id, name, counts);
+    }
+
+    return;
+}
+
+/**
+ * 物理量データ列を書き込む.
+ * 物理量カラムデータは物理量フィールドIDにて取得する.
+ * @param entities        エンティティ
+ * @param field_id        物理量フィールドID（１～）
+ * @param name            物理量名称
+ * @param counts        エンティティ別の物理量データ数
+ */
+template<class VALUE_TYPE>
+void UdmMigrationArchive::writeSolutionValues(
+                    const std::vector<const UdmEntity*> &entities,
+                    UdmSize_t field_id,
+                    const std::string &name,
+                    const std::vector<unsigned int> &counts)
+{
+    size_t i, total = 0;
+    for (i=0; i<counts.size(); i++) total += counts[i];
+    if (total == 0) return;
+
+    std::vector<VALUE_TYPE> values(total);
+    size_t pos = 0;
+    for (i=0; i<entities.size(); i++) {
+        if (counts[i] == 0) continue;
+        const UdmSolutionColumn *column = this->getSolutionColumn(entities[i], field_id);
+        if (column != NULL) {
+            column->getSolutionValues<VALUE_TYPE>(entities[i]->solution_slot, &values[pos]);
+        }
+        else {
+            entities[i]->getSolutionValues(name, &values[pos]);
+        }
+        pos += counts[i];
+    }
+    this->writeValues(&values[0], total);
+
+    return;
+}
+
+/**
+ * 値を書き込む.
+ * @param value        書込値
+ */
+template<class VALUE_TYPE>
+void UdmMigrationArchive::writeValue(VALUE_TYPE value)
+{
+    this->writeValues(&value, 1);
+}
+
+/**
+ * 値の配列を書き込む.
+ * @param values        書込配列
+ * @param size            配列数
+ */
+template<class VALUE_TYPE>
+void UdmMigrationArchive::writeValues(const VALUE_TYPE *values, size_t size)
+{
+    if (size == 0 || values == NULL) return;
+    char *buf = this->reserveBuffer(sizeof(VALUE_TYPE)*size);
+    memcpy(buf, values, sizeof(VALUE_TYPE)*size);
+}
+
+/**
+ * 文字列を書き込む : 文字列長, 文字列.
+ * @param value        書込文字列
+ */
+void UdmMigrationArchive::writeString(const std::string &value)
+{
+    this->writeValue((unsigned int)value.length());
+    this->writeValues(value.c_str(), value.length());
+}
+
+/**
+ * シリアライズバッファの末尾に書込領域を確保する.
+ * @param size        書込サイズ(byte)
+ * @return        書込位置
+ */
+char* UdmMigrationArchive::reserveBuffer(size_t size)
+{
+    size_t pos = this->buffer.size();
+    if (this->buffer.capacity() < pos + size) {
+        this->buffer.reserve((pos + size)*2);
+    }
+    this->buffer.resize(pos + size);
+    return &this->buffer[pos];
+}
+
+/**
+ * 転送要素（セル）をデシリアライズする.
+ * 要素（セル）はUdmSolid、構成節点（ノード）は要素（セル）毎に節点（ノード）テーブルから生成する.
+ * 生成した要素（セル）はUdmCell::freeDeserializeにて開放すること.
+ * @param [in] buf            シリアライズバッファ
+ * @param [in] size            シリアライズバッファサイズ(byte)
+ * @param [out] cells        生成要素（セル） : 追加する.
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationArchive::unpackCells(const char *buf, size_t size, std::vector<UdmCell*> &cells)
+{
+    UdmError_t error;
+    size_t i, n;
+    this->read_pos = buf;
+    this->read_end = buf + size;
+
+    // 節点（ノード）テーブル
+    UdmMigrationTable node_table;
+    if ((error = this->unpackEntityTable(node_table)) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    int coords_datatype = Udm_DataTypeUnknown;
+    if (!this->readValue(coords_datatype)) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize coords datatype.");
+    }
+    size_t coords_size = (coords_datatype == Udm_RealDouble) ? sizeof(double) : sizeof(float);
+    const char *coords = this->readColumn(coords_size*3*node_table.num_entities);
+    if (coords == NULL && node_table.num_entities > 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize coords[num_nodes=%d].", node_table.num_entities);
+    }
+
+    // 要素（セル）テーブル
+    UdmMigrationTable cell_table;
+    if ((error = this->unpackEntityTable(cell_table)) != UDM_OK) {
+        return UDM_ERRORNO_HANDLER(error);
+    }
+    size_t num_cells = cell_table.num_entities;
+    const char *elements_ids = this->readColumn(sizeof(UdmSize_t)*num_cells);
+    const char *elements_types = this->readColumn(sizeof(unsigned char)*num_cells);
+    const char *node_counts = this->readColumn(sizeof(unsigned int)*num_cells);
+    if (num_cells > 0 && (elements_ids == NULL || elements_types == NULL || node_counts == NULL)) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize cells[num_cells=%d].", num_cells);
+    }
+    size_t num_indices = 0;
+    for (i=0; i<num_cells; i++) {
+        num_indices += getColumnValue<unsigned int>(node_counts, i);
+    }
+    const char *node_indices = this->readColumn(sizeof(unsigned int)*num_indices);
+    if (num_indices > 0 && node_indices == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize node indices[size=%d].", num_indices);
+    }
+    if (this->read_pos != this->read_end) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize : remaining %d bytes.", this->read_end - this->read_pos);
+    }
+
+    // 要素（セル）を生成する.
+    size_t index_pos = 0;
+    for (i=0; i<num_cells; i++) {
+        // デシリアライズを行う。UdmSolid固定とする
+        UdmCell *cell = new UdmSolid();
+        if ((error = this->setEntityValues(cell, cell_table, i)) != UDM_OK) {
+            UdmCell::freeDeserialize(cell);
+            return UDM_ERRORNO_HANDLER(error);
+        }
+
+        // UdmElements
+        UdmSize_t elements_id = getColumnValue<UdmSize_t>(elements_ids, i);
+        if (elements_id > 0) {
+            UdmElements *elements = new UdmElements();
+            elements->setId(elements_id);
+            elements->setElementType((UdmElementType_t)getColumnValue<unsigned char>(elements_types, i));
+            cell->parent_elements = elements;
+        }
+        else {
+            cell->parent_elements = NULL;
+        }
+
+        // 構成ノード
+        unsigned int num_nodes = getColumnValue<unsigned int>(node_counts, i);
+        for (n=0; n<num_nodes; n++) {
+            unsigned int index = getColumnValue<unsigned int>(node_indices, index_pos++);
+            if (index >= node_table.num_entities) {
+                UdmCell::freeDeserialize(cell);
+                return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "invalid node index[%d], num_nodes=%d.", index, node_table.num_entities);
+            }
+            UdmNode *node = new UdmNode();
+            if ((error = this->setEntityValues(node, node_table, index)) != UDM_OK) {
+                UdmNode::freeDeserialize(node);
+                UdmCell::freeDeserialize(cell);
+                return UDM_ERRORNO_HANDLER(error);
+            }
+            if (coords_datatype == Udm_RealDouble) {
+                node->setCoords(getColumnValue<double>(coords, index*3),
+                                getColumnValue<double>(coords, index*3+1),
+                                getColumnValue<double>(coords, index*3+2));
+            }
+            else {
+                node->setCoords(getColumnValue<float>(coords, index*3),
+                                getColumnValue<float>(coords, index*3+1),
+                                getColumnValue<float>(coords, index*3+2));
+            }
+            // ノードの挿入
+            cell->insertNode(node);
+        }
+        cells.push_back(cell);
+    }
+
+    this->read_pos = NULL;
+    this->read_end = NULL;
+
+    return UDM_OK;
+}
+
+/**
+ * エンティティテーブルの列データ位置を取得する.
+ * @param [out] table        エンティティテーブル列データ
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationArchive::unpackEntityTable(UdmMigrationTable &table)
+{
+    UdmError_t error;
+    size_t i;
+    UdmSize_t num_entities = 0;
+    if (!this->readValue(num_entities)) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of entities.");
+    }
+    table.num_entities = num_entities;
+    table.ids = this->readColumn(sizeof(UdmSize_t)*num_entities);
+    table.ranknos = this->readColumn(sizeof(int)*num_entities);
+    table.element_types = this->readColumn(sizeof(unsigned char)*num_entities);
+    table.reality_types = this->readColumn(sizeof(unsigned char)*num_entities);
+    table.weights = this->readColumn(sizeof(float)*num_entities);
+    if (num_entities > 0 && table.weights == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize entities[num_entities=%d].", num_entities);
+    }
+
+    // MPI:ランク番号リスト
+    error = this->unpackRankInfos(num_entities, table.rankinfo_offsets, table.rankinfo_ranknos, table.rankinfo_localids);
+    if (error != UDM_OK) return UDM_ERRORNO_HANDLER(error);
+    // 以前のID、ランク番号
+    error = this->unpackRankInfos(num_entities, table.previous_offsets, table.previous_ranknos, table.previous_localids);
+    if (error != UDM_OK) return UDM_ERRORNO_HANDLER(error);
+
+    // 物理量
+    int n, num_fields = 0;
+    if (!this->readValue(num_fields) || num_fields < 0) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize number of fields.");
+    }
+    table.fields.resize(num_fields);
+    for (n=0; n<num_fields; n++) {
+        UdmMigrationField &field = table.fields[n];
+        int datatype = Udm_DataTypeUnknown, vectortype = Udm_VectorTypeUnknown;
+        if (!this->readString(field.name)
+            || !this->readValue(datatype)
+            || !this->readValue(vectortype)
+            || !this->readValue(field.nvector_size)) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize field[%d].", n+1);
+        }
+        field.datatype = (UdmDataType_t)datatype;
+        field.vectortype = (UdmVectorType_t)vectortype;
+
+        field.value_offsets.resize(num_entities+1);
+        field.value_offsets[0] = 0;
+        if (field.nvector_size > 0) {
+            for (i=0; i<num_entities; i++) {
+                field.value_offsets[i+1] = field.value_offsets[i] + field.nvector_size;
+            }
+        }
+        else {
+            const char *counts = this->readColumn(sizeof(unsigned int)*num_entities);
+            if (num_entities > 0 && counts == NULL) {
+                return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize field[%s] counts.", field.name.c_str());
+            }
+            for (i=0; i<num_entities; i++) {
+                field.value_offsets[i+1] = field.value_offsets[i] + getColumnValue<unsigned int>(counts, i);
+            }
+        }
+
+        size_t value_size = 0;
+        if (field.datatype == Udm_Integer) value_size = sizeof(int);
+        else if (field.datatype == Udm_LongInteger) value_size = sizeof(long long);
+        else if (field.datatype == Udm_RealSingle) value_size = sizeof(float);
+        else if (field.datatype == Udm_RealDouble) value_size = sizeof(double);
+        else {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "invalid field[%s] datatype=%d.", field.name.c_str(), datatype);
+        }
+        size_t num_values = field.value_offsets[num_entities];
+        field.values = this->readColumn(value_size*num_values);
+        if (num_values > 0 && field.values == NULL) {
+            return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize field[%s] values.", field.name.c_str());
+        }
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * ランク番号リストの列データ位置を取得する.
+ * @param [in] num_entities        エンティティ数
+ * @param [out] offsets            エンティティ別のリスト位置 : エンティティ数+1
+ * @param [out] ranknos            ランク番号列
+ * @param [out] localids        ローカルID列
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationArchive::unpackRankInfos(
+                    size_t num_entities,
+                    std::vector<size_t> &offsets,
+                    const char *&ranknos,
+                    const char *&localids)
+{
+    size_t i;
+    const char *counts = this->readColumn(sizeof(unsigned int)*num_entities);
+    if (num_entities > 0 && counts == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize rank infos.");
+    }
+    offsets.resize(num_entities+1);
+    offsets[0] = 0;
+    for (i=0; i<num_entities; i++) {
+        offsets[i+1] = offsets[i] + getColumnValue<unsigned int>(counts, i);
+    }
+    ranknos = this->readColumn(sizeof(int)*offsets[num_entities]);
+    localids = this->readColumn(sizeof(UdmSize_t)*offsets[num_entities]);
+    if (offsets[num_entities] > 0 && localids == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_DESERIALIZE, "abend deserialize rank infos[size=%d].", offsets[num_entities]);
+    }
+    return UDM_OK;
+}
+
+/**
+ * エンティティテーブルの列データをエンティティに設定する.
+ * @param entity        設定エンティティ
+ * @param table            エンティティテーブル列データ
+ * @param index            エンティティテーブルのインデックス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+UdmError_t UdmMigrationArchive::setEntityValues(
+                    UdmEntity *entity,
+                    const UdmMigrationTable &table,
+                    size_t index) const
+{
+    size_t n;
+
+    entity->setId(getColumnValue<UdmSize_t>(table.ids, index));
+    entity->setElementType((UdmElementType_t)getColumnValue<unsigned char>(table.element_types, index));
+    entity->setMyRankno(getColumnValue<int>(table.ranknos, index));
+    entity->setRealityType((UdmRealityType_t)getColumnValue<unsigned char>(table.reality_types, index));
+    entity->setPartitionWeight(getColumnValue<float>(table.weights, index));
+
+    // 以前のID、ランク番号
+    for (n=table.previous_offsets[index]; n<table.previous_offsets[index+1]; n++) {
+        entity->previous_rankinfos.addGlobalRankid(
+                    getColumnValue<int>(table.previous_ranknos, n),
+                    getColumnValue<UdmSize_t>(table.previous_localids, n));
+    }
+    // MPI:ランク番号リスト
+    for (n=table.rankinfo_offsets[index]; n<table.rankinfo_offsets[index+1]; n++) {
+        entity->mpi_rankinfos.addGlobalRankid(
+                    getColumnValue<int>(table.rankinfo_ranknos, n),
+                    getColumnValue<UdmSize_t>(table.rankinfo_localids, n));
+    }
+
+    // 物理量データリスト
+    std::vector<UdmMigrationField>::const_iterator itr;
+    for (itr=table.fields.begin(); itr!=table.fields.end(); itr++) {
+        UdmError_t error = UDM_OK;
+        if (itr->datatype == Udm_Integer) {
+            error = this->setSolutionValues<int>(entity, *itr, index);
+        }
+        else if (itr->datatype == Udm_LongInteger) {
+            error = this->setSolutionValues<long long>(entity, *itr, index);
+        }
+        else if (itr->datatype == Udm_RealSingle) {
+            error = this->setSolutionValues<float>(entity, *itr, index);
+        }
+        else if (itr->datatype == Udm_RealDouble) {
+            error = this->setSolutionValues<double>(entity, *itr, index);
+        }
+        if (error != UDM_OK) return error;
+    }
+
+    return UDM_OK;
+}
+
+/**
+ * 物理量列データから物理量データを生成してエンティティに追加する.
+ * @param entity        設定エンティティ
+ * @param field            物理量列データ
+ * @param index            エンティティテーブルのインデックス
+ * @return        エラー番号 : UDM_OK | UDM_ERROR
+ */
+template<class VALUE_TYPE>
+UdmError_t UdmMigrationArchive::setSolutionValues(
+                    UdmEntity *entity,
+                    const UdmMigrationField &field,
+                    size_t index) const
+{
+    size_t offset = field.value_offsets[index];
+    size_t size = field.value_offsets[index+1] - offset;
+    if (size == 0) return UDM_OK;
+
+    std::vector<VALUE_TYPE> values(size);
+    memcpy(&values[0], field.values + offset*sizeof(VALUE_TYPE), size*sizeof(VALUE_TYPE));
+
+    // 物理量データを作成する.
+    UdmSolutionData *data = UdmSolutionData::factorySolutionData(field.name, field.vectortype, field.datatype);
+    if (data == NULL) {
+        return UDM_ERROR_HANDLER(UDM_ERROR_CGNS_INVALID_FLOWSOLUTION, "failure : factorySolutionData[name=%s,data_type=%d].", field.name.c_str(), field.datatype);
+    }
+    data->setSolutionDatas(&values[0], (unsigned int)size);
+
+    // 作成物理量データを挿入する.
+    entity->insertSolutionData(data);
+
+    return UDM_OK;
+}
+
+/**
+ * 値を読み込む.
+ * @param [out] value        読込値
+ * @return        true=読込成功
+ */
+template<class VALUE_TYPE>
+bool UdmMigrationArchive::readValue(VALUE_TYPE &value)
+{
+    const char *buf = this->readColumn(sizeof(VALUE_TYPE));
+    if (buf == NULL) return false;
+    memcpy(&value, buf, sizeof(VALUE_TYPE));
+    return true;
+}
+
+/**
+ * 列データ位置を取得して、デシリアライズ位置を進める.
+ * @param size        列データサイズ(byte)
+ * @return        列データ位置 : 列データサイズ=0, 又はバッファサイズを超える場合はNULL
+ */
+const char* UdmMigrationArchive::readColumn(size_t size)
+{
+    if (size == 0) return NULL;
+    if (this->read_pos == NULL) return NULL;
+    if ((size_t)(this->read_end - this->read_pos) < size) return NULL;
+    const char *column = this->read_pos;
+    this->read_pos += size;
+    return column;
+}
+
+/**
+ * 文字列を読み込む : 文字列長, 文字列.
+ * @param [out] value        読込文字列
+ * @return        true=読込成功
+ */
+bool UdmMigrationArchive::readString(std::string &value)
+{
+    unsigned int length = 0;
+    if (!this->readValue(length)) return false;
+    if (length == 0) {
+        value.clear();
+        return true;
+    }
+    const char *buf = this->readColumn(length);
+    if (buf == NULL) return false;
+    value.assign(buf, length);
+    return true;
+}
+
+/**
+ * 列データの値を取得する.
+ * 列データはシリアライズバッファ内の位置である為、アライメントを考慮してコピーにて取得する.
+ * @param column        列データ位置
+ * @param index            インデックス
+ * @return        値
+ */
+template<class VALUE_TYPE>
+VALUE_TYPE UdmMigrationArchive::getColumnValue(const char *column, size_t index)
+{
+    VALUE_TYPE value;
+    memcpy(&value, column + index*sizeof(VALUE_TYPE), sizeof(VALUE_TYPE));
+    return value;
+}
+
+} /* namespace udm */
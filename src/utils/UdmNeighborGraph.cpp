@@ -0,0 +1,354 @@
+// ##################################################################################
+//
+// UDMlib - Unstructured Data Management Library
+//
+// Copyright (C) 2012-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+// ###################################################################################
+
+/**
+ * @file UdmNeighborGraph.cpp
+ * 隣接グラフクラスのソースファイル
+ */
+
+#include "utils/UdmNeighborGraph.h"
+#include "model/UdmGridCoordinates.h"
+#include "model/UdmSections.h"
+#include "model/UdmCell.h"
+#include "model/UdmNode.h"
+#include "utils/UdmScannerCells.h"
+
+namespace udm
+{
+
+/**
+ * コンストラクタ
+ */
+UdmNeighborGraph::UdmNeighborGraph()
+{
+    this->initialize();
+}
+
+/**
+ * デストラクタ
+ */
+UdmNeighborGraph::~UdmNeighborGraph()
+{
+    this->clearNeighborGraph();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmNeighborGraph::initialize()
+{
+    this->clearNeighborGraph();
+}
+
+/**
+ * 隣接情報を破棄する.
+ */
+void UdmNeighborGraph::clearNeighborGraph()
+{
+    std::vector<UdmSize_t>().swap(this->neighbor_cell_offsets);
+    std::vector<UdmEntity*>().swap(this->neighbor_cells);
+    std::vector<UdmSize_t>().swap(this->neighbor_node_offsets);
+    std::vector<UdmEntity*>().swap(this->neighbor_nodes);
+    std::vector<UdmSize_t>().swap(this->connectivity_cell_offsets);
+    std::vector<UdmEntity*>().swap(this->connectivity_cells);
+}
+
+/**
+ * 要素（セル）の隣接要素（セル）を作成する.
+ * 隣接要素（セル）はUdmScannerCells::getNeighborCellsと同じくID順とする.
+ * @param sections        要素管理クラス
+ */
+void UdmNeighborGraph::createNeighborCells(const UdmSections *sections)
+{
+    this->neighbor_cell_offsets.clear();
+    this->neighbor_cells.clear();
+    if (sections == NULL) return;
+
+    UdmSize_t n, num_cells = sections->getNumEntityCells();
+    UdmScannerCells scanner;
+    std::vector<UdmEntity*> neighbors;
+
+    this->neighbor_cell_offsets.reserve(num_cells+1);
+    this->neighbor_cell_offsets.push_back(0);
+    for (n=1; n<=num_cells; n++) {
+        scanner.getNeighborCells(sections->getEntityCell(n), neighbors);
+        this->neighbor_cells.insert(this->neighbor_cells.end(), neighbors.begin(), neighbors.end());
+        this->neighbor_cell_offsets.push_back(this->neighbor_cells.size());
+    }
+
+    return;
+}
+
+/**
+ * 要素（セル）の隣接要素（セル）が作成済みであるかチェックする.
+ * 要素（セル）数が変更されている場合は作成済みとしない.
+ * 要素（セル）の追加、削除時はUdmSectionsにてUdmZone::clearNeighborGraphにより破棄される.
+ * @param sections        要素管理クラス
+ * @return        true=作成済み
+ */
+bool UdmNeighborGraph::isCreatedNeighborCells(const UdmSections *sections) const
+{
+    if (sections == NULL) return false;
+    if (this->neighbor_cell_offsets.size() <= 0) return false;
+    return (this->neighbor_cell_offsets.size() == sections->getNumEntityCells()+1);
+}
+
+/**
+ * 隣接要素（セル）数を取得する.
+ * @param cell_id        要素（セル）ID（１～）
+ * @return        隣接要素（セル）数
+ */
+int UdmNeighborGraph::getNumNeighborCells(UdmSize_t cell_id) const
+{
+    return UdmNeighborGraph::getGraphSize(this->neighbor_cell_offsets, cell_id);
+}
+
+/**
+ * 隣接要素（セル）を取得する.
+ * @param cell_id        要素（セル）ID（１～）
+ * @param neighbor_id        隣接ID : 1～getNumNeighborCells(cell_id)
+ * @return        隣接要素（セル）
+ */
+UdmCell* UdmNeighborGraph::getNeighborCell(UdmSize_t cell_id, int neighbor_id) const
+{
+    if (neighbor_id <= 0) return NULL;
+    if (neighbor_id > this->getNumNeighborCells(cell_id)) return NULL;
+    return static_cast<UdmCell*>(this->neighbor_cells[this->neighbor_cell_offsets[cell_id-1] + neighbor_id - 1]);
+}
+
+/**
+ * 要素（セル）-要素（セル）の隣接グラフをCSR形式で取得する.
+ * @param [out] xadj        隣接オフセット配列 : 要素（セル）数+1, NULLの場合は取得しない
+ * @param [out] adjncy        隣接要素（セル）ローカルID配列 : 戻り値のサイズ, NULLの場合は取得しない
+ * @return        隣接要素（セル）ローカルID配列サイズ
+ */
+UdmSize_t UdmNeighborGraph::getNeighborCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const
+{
+    return UdmNeighborGraph::exportGraph(this->neighbor_cell_offsets, this->neighbor_cells, xadj, adjncy);
+}
+
+/**
+ * 節点（ノード）の隣接節点（ノード）を作成する.
+ * 隣接節点（ノード）はUdmScannerCells::getNeighborNodesと同じくID順とする.
+ * @param grid        グリッド座標クラス
+ */
+void UdmNeighborGraph::createNeighborNodes(const UdmGridCoordinates *grid)
+{
+    this->neighbor_node_offsets.clear();
+    this->neighbor_nodes.clear();
+    if (grid == NULL) return;
+
+    UdmSize_t n, num_nodes = grid->getNumNodes();
+    UdmScannerCells scanner;
+    std::vector<UdmEntity*> neighbors;
+
+    this->neighbor_node_offsets.reserve(num_nodes+1);
+    this->neighbor_node_offsets.push_back(0);
+    for (n=1; n<=num_nodes; n++) {
+        scanner.getNeighborNodes(grid->getNodeById(n), neighbors);
+        this->neighbor_nodes.insert(this->neighbor_nodes.end(), neighbors.begin(), neighbors.end());
+        this->neighbor_node_offsets.push_back(this->neighbor_nodes.size());
+    }
+
+    return;
+}
+
+/**
+ * 節点（ノード）の隣接節点（ノード）が作成済みであるかチェックする.
+ * 節点（ノード）数が変更されている場合は作成済みとしない.
+ * 要素（セル）の追加、削除時はUdmSectionsにてUdmZone::clearNeighborGraphにより破棄される.
+ * @param grid        グリッド座標クラス
+ * @return        true=作成済み
+ */
+bool UdmNeighborGraph::isCreatedNeighborNodes(const UdmGridCoordinates *grid) const
+{
+    if (grid == NULL) return false;
+    if (this->neighbor_node_offsets.size() <= 0) return false;
+    return (this->neighbor_node_offsets.size() == grid->getNumNodes()+1);
+}
+
+/**
+ * 隣接節点（ノード）数を取得する.
+ * @param node_id        節点（ノード）ID（１～）
+ * @return        隣接節点（ノード）数
+ */
+int UdmNeighborGraph::getNumNeighborNodes(UdmSize_t node_id) const
+{
+    return UdmNeighborGraph::getGraphSize(this->neighbor_node_offsets, node_id);
+}
+
+/**
+ * 隣接節点（ノード）を取得する.
+ * @param node_id        節点（ノード）ID（１～）
+ * @param neighbor_id        隣接ID : 1～getNumNeighborNodes(node_id)
+ * @return        隣接節点（ノード）
+ */
+UdmNode* UdmNeighborGraph::getNeighborNode(UdmSize_t node_id, int neighbor_id) const
+{
+    if (neighbor_id <= 0) return NULL;
+    if (neighbor_id > this->getNumNeighborNodes(node_id)) return NULL;
+    return static_cast<UdmNode*>(this->neighbor_nodes[this->neighbor_node_offsets[node_id-1] + neighbor_id - 1]);
+}
+
+/**
+ * 節点（ノード）-節点（ノード）の隣接グラフをCSR形式で取得する.
+ * @param [out] xadj        隣接オフセット配列 : 節点（ノード）数+1, NULLの場合は取得しない
+ * @param [out] adjncy        隣接節点（ノード）ローカルID配列 : 戻り値のサイズ, NULLの場合は取得しない
+ * @return        隣接節点（ノード）ローカルID配列サイズ
+ */
+UdmSize_t UdmNeighborGraph::getNeighborNodesGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const
+{
+    return UdmNeighborGraph::exportGraph(this->neighbor_node_offsets, this->neighbor_nodes, xadj, adjncy);
+}
+
+/**
+ * 節点（ノード）の接続要素（セル）を作成する.
+ * 接続要素（セル）はUdmScannerCells::getParentCellsと同じく親要素（セル）順とする.
+ * @param grid        グリッド座標クラス
+ */
+void UdmNeighborGraph::createConnectivityCells(const UdmGridCoordinates *grid)
+{
+    this->connectivity_cell_offsets.clear();
+    this->connectivity_cells.clear();
+    if (grid == NULL) return;
+
+    UdmSize_t n, num_nodes = grid->getNumNodes();
+    UdmScannerCells scanner;
+    std::vector<UdmEntity*> parents;
+
+    this->connectivity_cell_offsets.reserve(num_nodes+1);
+    this->connectivity_cell_offsets.push_back(0);
+    for (n=1; n<=num_nodes; n++) {
+        scanner.getParentCells(grid->getNodeById(n), parents);
+        this->connectivity_cells.insert(this->connectivity_cells.end(), parents.begin(), parents.end());
+        this->connectivity_cell_offsets.push_back(this->connectivity_cells.size());
+    }
+
+    return;
+}
+
+/**
+ * 節点（ノード）の接続要素（セル）が作成済みであるかチェックする.
+ * 節点（ノード）数が変更されている場合は作成済みとしない.
+ * 要素（セル）の追加、削除時はUdmSectionsにてUdmZone::clearNeighborGraphにより破棄される.
+ * @param grid        グリッド座標クラス
+ * @return        true=作成済み
+ */
+bool UdmNeighborGraph::isCreatedConnectivityCells(const UdmGridCoordinates *grid) const
+{
+    if (grid == NULL) return false;
+    if (this->connectivity_cell_offsets.size() <= 0) return false;
+    return (this->connectivity_cell_offsets.size() == grid->getNumNodes()+1);
+}
+
+/**
+ * 接続要素（セル）数を取得する.
+ * @param node_id        節点（ノード）ID（１～）
+ * @return        接続要素（セル）数
+ */
+int UdmNeighborGraph::getNumConnectivityCells(UdmSize_t node_id) const
+{
+    return UdmNeighborGraph::getGraphSize(this->connectivity_cell_offsets, node_id);
+}
+
+/**
+ * 接続要素（セル）を取得する.
+ * @param node_id        節点（ノード）ID（１～）
+ * @param connectivity_id        接続ID : 1～getNumConnectivityCells(node_id)
+ * @return        接続要素（セル）
+ */
+UdmCell* UdmNeighborGraph::getConnectivityCell(UdmSize_t node_id, int connectivity_id) const
+{
+    if (connectivity_id <= 0) return NULL;
+    if (connectivity_id > this->getNumConnectivityCells(node_id)) return NULL;
+    return static_cast<UdmCell*>(this->connectivity_cells[this->connectivity_cell_offsets[node_id-1] + connectivity_id - 1]);
+}
+
+/**
+ * 節点（ノード）-要素（セル）の接続グラフをCSR形式で取得する.
+ * @param [out] xadj        接続オフセット配列 : 節点（ノード）数+1, NULLの場合は取得しない
+ * @param [out] adjncy        接続要素（セル）ローカルID配列 : 戻り値のサイズ, NULLの場合は取得しない
+ * @return        接続要素（セル）ローカルID配列サイズ
+ */
+UdmSize_t UdmNeighborGraph::getConnectivityCellsGraph(UdmSize_t *xadj, UdmSize_t *adjncy) const
+{
+    return UdmNeighborGraph::exportGraph(this->connectivity_cell_offsets, this->connectivity_cells, xadj, adjncy);
+}
+
+/**
+ * CSR形式の隣接数を取得する.
+ * @param offsets        隣接オフセット
+ * @param id        ID（１～）
+ * @return        隣接数
+ */
+UdmSize_t UdmNeighborGraph::getGraphSize(const std::vector<UdmSize_t> &offsets, UdmSize_t id)
+{
+    if (id <= 0) return 0;
+    if (id >= offsets.size()) return 0;
+    return offsets[id] - offsets[id-1];
+}
+
+/**
+ * CSR形式の隣接情報を出力する.
+ * 隣接リストはローカルID（１～）として出力する.
+ * 実体節点（ノード）、要素（セル）はID、仮想節点（ノード）、要素（セル）は実体数に続くローカルIDとなる.
+ * @param [in]  offsets        隣接オフセット
+ * @param [in]  entities        隣接リスト
+ * @param [out] xadj        隣接オフセット配列 : offsets.size(), NULLの場合は出力しない
+ * @param [out] adjncy        隣接ローカルID配列 : entities.size(), NULLの場合は出力しない
+ * @return        隣接ローカルID配列サイズ
+ */
+UdmSize_t UdmNeighborGraph::exportGraph(
+                const std::vector<UdmSize_t> &offsets,
+                const std::vector<UdmEntity*> &entities,
+                UdmSize_t *xadj,
+                UdmSize_t *adjncy)
+{
+    UdmSize_t n;
+    UdmSize_t num_offsets = offsets.size();
+    UdmSize_t num_entities = entities.size();
+
+    if (xadj != NULL && num_offsets > 0) {
+        memcpy(xadj, &offsets[0], num_offsets*sizeof(UdmSize_t));
+    }
+    if (adjncy != NULL) {
+        for (n=0; n<num_entities; n++) {
+            const UdmEntity *entity = entities[n];
+            if (entity->getRealityType() == Udm_Virtual) {
+                adjncy[n] = entity->getLocalId();
+            }
+            else {
+                adjncy[n] = entity->getId();
+            }
+        }
+    }
+
+    return num_entities;
+}
+
+/**
+ * メモリサイズを取得する.
+ * @return        メモリサイズ
+ */
+size_t UdmNeighborGraph::getMemSize() const
+{
+    size_t size = sizeof(*this);
+    size += this->neighbor_cell_offsets.capacity()*sizeof(UdmSize_t);
+    size += this->neighbor_cells.capacity()*sizeof(UdmEntity*);
+    size += this->neighbor_node_offsets.capacity()*sizeof(UdmSize_t);
+    size += this->neighbor_nodes.capacity()*sizeof(UdmEntity*);
+    size += this->connectivity_cell_offsets.capacity()*sizeof(UdmSize_t);
+    size += this->connectivity_cells.capacity()*sizeof(UdmEntity*);
+    return size;
+}
+
+} /* namespace udm */
@@ -711,9 +711,27 @@ UdmSize_t UdmScannerCells::scannerParents(const std::vector<UdmNode*>& node_list
  */
 UdmSize_t UdmScannerCells::scannerParents(const UdmNode* node)
 {
+    std::vector<UdmEntity*> parents;
+    this->getParentCells(node, parents);
+
+    if (parents.size() > 0) {
+        this->scan_arrays.push_back(parents);
+    }
+    return parents.size();
+}
+
+/**
+ * 節点（ノード）の親要素（セル）を取得する.
+ * 部品要素は除外する.
+ * @param [in]  node        探索対象節点（ノード）
+ * @param [out] parents        親要素（セル）リスト
+ * @return        親要素（セル）数
+ */
+UdmSize_t UdmScannerCells::getParentCells(const UdmNode* node, std::vector<UdmEntity*> &parents) const
+{
+    parents.clear();
     if (node == NULL) return 0;
 
-    std::vector<UdmEntity*> parents;
     int n;
     int num_parents = node->getNumParentCells();
     for (n=1; n<=num_parents; n++) {
@@ -722,9 +740,6 @@ UdmSize_t UdmScannerCells::scannerParents(const UdmNode* node)
         if (parent_cell->getCellClass() != Udm_CellClass) continue;
         parents.push_back(dynamic_cast<UdmCell*>(parent_cell));
     }
-    if (parents.size() > 0) {
-        this->scan_arrays.push_back(parents);
-    }
     return parents.size();
 }
 
@@ -745,9 +760,26 @@ UdmScannerCells::getScanArrays() const
  */
 UdmSize_t UdmScannerCells::scannerNeighborNodes(const UdmNode* node)
 {
+    std::vector<UdmEntity*> neighbors;
+    this->getNeighborNodes(node, neighbors);
+
+    if (neighbors.size() > 0) {
+        this->scan_arrays.push_back(neighbors);
+    }
+    return neighbors.size();
+}
+
+/**
+ * 節点（ノード）の隣接節点（ノード）をID順に取得する.
+ * @param [in]  node        探索対象節点（ノード）
+ * @param [out] neighbors        隣接節点（ノード）リスト
+ * @return        隣接節点（ノード）数
+ */
+UdmSize_t UdmScannerCells::getNeighborNodes(const UdmNode* node, std::vector<UdmEntity*> &neighbors) const
+{
+    neighbors.clear();
     if (node == NULL) return 0;
 
-    std::vector<UdmEntity*> neighbors;
     int n, m;
     int num_parents = node->getNumParentCells();
     for (n=1; n<=num_parents; n++) {
@@ -800,9 +832,6 @@ UdmSize_t UdmScannerCells::scannerNeighborNodes(const UdmNode* node)
     // ソート
     std::sort(neighbors.begin(), neighbors.end(), UdmEntity::compareIds);
 
-    if (neighbors.size() > 0) {
-        this->scan_arrays.push_back(neighbors);
-    }
     return neighbors.size();
 }
 
@@ -814,9 +843,26 @@ UdmSize_t UdmScannerCells::scannerNeighborNodes(const UdmNode* node)
  */
 UdmSize_t UdmScannerCells::scannerNeighborCells(const UdmCell* cell)
 {
+    std::vector<UdmEntity*> neighbors;
+    this->getNeighborCells(cell, neighbors);
+
+    if (neighbors.size() > 0) {
+        this->scan_arrays.push_back(neighbors);
+    }
+    return neighbors.size();
+}
+
+/**
+ * 要素（セル）の隣接要素（セル）をID順に取得する.
+ * @param [in]  cell        探索対象要素（セル）
+ * @param [out] neighbors        隣接要素（セル）リスト
+ * @return        隣接要素（セル）数
+ */
+UdmSize_t UdmScannerCells::getNeighborCells(const UdmCell* cell, std::vector<UdmEntity*> &neighbors) const
+{
+    neighbors.clear();
     if (cell == NULL) return 0;
 
-    std::vector<UdmEntity*> neighbors;
     int n, m;
 
     // 部品要素の検索
@@ -838,9 +884,6 @@ UdmSize_t UdmScannerCells::scannerNeighborCells(const UdmCell* cell)
     // ソート
     std::sort(neighbors.begin(), neighbors.end(), UdmEntity::compareIds);
 
-    if (neighbors.size() > 0) {
-        this->scan_arrays.push_back(neighbors);
-    }
     return neighbors.size();
 }
 
@@ -16,6 +16,7 @@
  */
 
 #include "utils/UdmSearchTable.h"
+#include "model/UdmNode.h"
 
 namespace udm
 {
@@ -25,16 +26,16 @@ namespace udm
  */
 UdmSearchTable::UdmSearchTable()
 {
-    this->search_table.clear();
+    this->initialize();
 }
 
 /**
  * コンストラクタ
  * @param nodes        検索対象の節点（ノード）リスト
  */
-UdmSearchTable::UdmSearchTable(const std::vector<UdmNode*> nodes)
+UdmSearchTable::UdmSearchTable(const std::vector<UdmNode*> &nodes)
 {
-    this->search_table.clear();
+    this->initialize();
     this->createSearchTable(nodes);
 }
 
@@ -43,18 +44,35 @@ UdmSearchTable::UdmSearchTable(const std::vector<UdmNode*> nodes)
  */
 UdmSearchTable::~UdmSearchTable()
 {
-    this->search_table.clear();
+    this->search_slots.clear();
+}
+
+/**
+ * 初期化を行う.
+ */
+void UdmSearchTable::initialize()
+{
+    this->search_slots.clear();
+    this->num_entries = 0;
 }
 
 /**
  * ランク番号、ID検索テーブルを作成する.
  * @param nodes        検索対象の節点（ノード）リスト
  */
-void UdmSearchTable::createSearchTable(const std::vector<UdmNode*> nodes)
+void UdmSearchTable::createSearchTable(const std::vector<UdmNode*> &nodes)
 {
     this->clearSearchTable();
 
+    // 登録数を予め確保する.
+    UdmSize_t size = 0;
     std::vector<UdmNode*>::const_iterator itr;
+    for (itr=nodes.begin(); itr!=nodes.end(); itr++) {
+        UdmNode *node = *itr;
+        size += 1 + node->getNumPreviousRankInfos() + node->getNumMpiRankInfos();
+    }
+    this->reserve(size);
+
     for (itr=nodes.begin(); itr!=nodes.end(); itr++) {
         UdmNode *node = *itr;
         this->addSearchTable(node);
@@ -65,10 +83,17 @@ void UdmSearchTable::createSearchTable(const std::vector<UdmNode*> nodes)
 
 /**
  * ランク番号、ID検索テーブルをクリアする.
+ * 確保スロットは解放しない.
  */
 void UdmSearchTable::clearSearchTable()
 {
-    this->search_table.clear();
+    if (this->num_entries > 0) {
+        std::vector<UdmSearchTableSlot>::iterator itr;
+        for (itr=this->search_slots.begin(); itr!=this->search_slots.end(); itr++) {
+            itr->node = NULL;
+        }
+    }
+    this->num_entries = 0;
     return;
 }
 
@@ -86,20 +111,52 @@ void UdmSearchTable::addSearchTable(UdmNode* node)
     UdmSize_t localid;
 
     // ランク番号、ID
-    this->search_table.addGlobalRankid(node->getMyRankno(), node->getId(), node);
+    this->addRankid(node->getMyRankno(), node->getId(), node);
+
+    // 以前のランク番号, ID
+    len = node->getNumPreviousRankInfos();
+    for (n=1; n<=len; n++) {
+        node->getPreviousRankInfo(n, rankno, localid);
+        this->addRankid(rankno, localid, node);
+    }
+
+    // MPI接続ランク番号, ID
+    len = node->getNumMpiRankInfos();
+    for (n=1; n<=len; n++) {
+        node->getMpiRankInfo(n, rankno, localid);
+        this->addRankid(rankno, localid, node);
+    }
+
+    return;
+}
+
+/**
+ * ランク番号、ID検索テーブルから節点（ノード）を削除する.
+ * 節点（ノード）のランク番号、ID、以前のランク番号、ID、MPI接続のランク番号、IDを削除する.
+ * @param node        削除節点（ノード）
+ */
+void UdmSearchTable::removeSearchTable(const UdmNode* node)
+{
+    int n;
+    int len;
+    int rankno;
+    UdmSize_t localid;
+
+    // ランク番号、ID
+    this->removeRankid(node->getMyRankno(), node->getId(), node);
 
     // 以前のランク番号, ID
     len = node->getNumPreviousRankInfos();
     for (n=1; n<=len; n++) {
         node->getPreviousRankInfo(n, rankno, localid);
-        this->search_table.addGlobalRankid(rankno, localid, node);
+        this->removeRankid(rankno, localid, node);
     }
 
     // MPI接続ランク番号, ID
     len = node->getNumMpiRankInfos();
     for (n=1; n<=len; n++) {
         node->getMpiRankInfo(n, rankno, localid);
-        this->search_table.addGlobalRankid(rankno, localid, node);
+        this->removeRankid(rankno, localid, node);
     }
 
     return;
@@ -109,11 +166,19 @@ void UdmSearchTable::addSearchTable(UdmNode* node)
  * MPI接続ランク番号, IDのみのランク番号、ID検索テーブルを作成する.
  * @param nodes        検索対象の節点（ノード）リスト
  */
-void UdmSearchTable::createMpiRankidTable(const std::vector<UdmNode*> nodes)
+void UdmSearchTable::createMpiRankidTable(const std::vector<UdmNode*> &nodes)
 {
     this->clearSearchTable();
 
+    // 登録数を予め確保する.
+    UdmSize_t size = 0;
     std::vector<UdmNode*>::const_iterator itr;
+    for (itr=nodes.begin(); itr!=nodes.end(); itr++) {
+        UdmNode *node = *itr;
+        size += node->getNumMpiRankInfos();
+    }
+    this->reserve(size);
+
     for (itr=nodes.begin(); itr!=nodes.end(); itr++) {
         UdmNode *node = *itr;
         this->addMpiRankid(node);
@@ -138,7 +203,7 @@ void UdmSearchTable::addMpiRankid(UdmNode* node)
     len = node->getNumMpiRankInfos();
     for (n=1; n<=len; n++) {
         node->getMpiRankInfo(n, rankno, localid);
-        this->search_table.addGlobalRankid(rankno, localid, node);
+        this->addRankid(rankno, localid, node);
     }
 
     return;
@@ -152,8 +217,11 @@ void UdmSearchTable::addMpiRankid(UdmNode* node)
  */
 UdmNode* UdmSearchTable::findMpiRankInfo(int rankno, UdmSize_t localid) const
 {
-    UdmEntity *node = this->search_table.getReferenceEntity(rankno, localid);
-    return (UdmNode*)node;
+    UdmSize_t slot;
+    if (!this->findSlot(rankno, localid, slot)) {
+        return NULL;
+    }
+    return this->search_slots[slot].node;
 }
 
 /**
@@ -164,7 +232,7 @@ UdmNode* UdmSearchTable::findMpiRankInfo(int rankno, UdmSize_t localid) const
 UdmNode* UdmSearchTable::findMpiRankInfo(const UdmNode* node) const
 {
     if (node == NULL) return NULL;
-    if (this->search_table.size() <= 0) return NULL;
+    if (this->num_entries <= 0) return NULL;
 
     int n;
     int rankno;
@@ -173,7 +241,7 @@ UdmNode* UdmSearchTable::findMpiRankInfo(const UdmNode* node) const
 
     rankno = node->getMyRankno();
     localid = node->getId();
-    find_node = (UdmNode*)this->search_table.getReferenceEntity(rankno, localid);
+    find_node = this->findMpiRankInfo(rankno, localid);
     if (find_node != NULL) {
         return find_node;
     }
@@ -191,4 +259,171 @@ UdmNode* UdmSearchTable::findMpiRankInfo(const UdmNode* node) const
     return find_node;
 }
 
+/**
+ * ランク番号、IDの節点（ノード）を追加する.
+ * 同一のランク番号、IDが登録済みの場合は追加しない.
+ * @param rankno        ランク番号
+ * @param localid        ID
+ * @param node        節点（ノード）
+ * @return        true=追加した
+ */
+bool UdmSearchTable::addRankid(int rankno, UdmSize_t localid, UdmNode* node)
+{
+    if (node == NULL) return false;
+
+    // 登録数がスロット数の1/2を超える場合は拡張する.
+    if ((this->num_entries+1)*2 > this->search_slots.size()) {
+        UdmSize_t num_slots = this->search_slots.size();
+        if (num_slots < UDM_SEARCHTABLE_MINSLOTS) num_slots = UDM_SEARCHTABLE_MINSLOTS;
+        while ((this->num_entries+1)*2 > num_slots) num_slots *= 2;
+        this->rehash(num_slots);
+    }
+
+    UdmSize_t slot;
+    if (this->findSlot(rankno, localid, slot)) {
+        return false;
+    }
+    this->search_slots[slot].rankno = rankno;
+    this->search_slots[slot].localid = localid;
+    this->search_slots[slot].node = node;
+    this->num_entries++;
+
+    return true;
+}
+
+/**
+ * ランク番号、IDの節点（ノード）を削除する.
+ * 登録節点（ノード）が削除節点（ノード）と一致する場合のみ削除する.
+ * @param rankno        ランク番号
+ * @param localid        ID
+ * @param node        削除節点（ノード）
+ * @return        true=削除した
+ */
+bool UdmSearchTable::removeRankid(int rankno, UdmSize_t localid, const UdmNode* node)
+{
+    UdmSize_t slot;
+    if (!this->findSlot(rankno, localid, slot)) {
+        return false;
+    }
+    if (this->search_slots[slot].node != node) {
+        return false;
+    }
+
+    // 後続スロットを詰める（線形探索の探索列を維持する）.
+    UdmSize_t mask = this->search_slots.size() - 1;
+    UdmSize_t empty = slot;
+    UdmSize_t next = (slot + 1) & mask;
+    while (this->search_slots[next].node != NULL) {
+        UdmSize_t home = this->hashRankid(this->search_slots[next].rankno,
+                                          this->search_slots[next].localid);
+        // homeが(empty, next]の範囲外であれば空きスロットに移動する.
+        if (((next - home) & mask) >= ((next - empty) & mask)) {
+            this->search_slots[empty] = this->search_slots[next];
+            empty = next;
+        }
+        next = (next + 1) & mask;
+    }
+    this->search_slots[empty].node = NULL;
+    this->num_entries--;
+
+    return true;
+}
+
+/**
+ * 登録数を予め確保する.
+ * @param size        登録数
+ */
+void UdmSearchTable::reserve(UdmSize_t size)
+{
+    UdmSize_t num_slots = UDM_SEARCHTABLE_MINSLOTS;
+    while (size*2 > num_slots) num_slots *= 2;
+    if (num_slots <= this->search_slots.size()) return;
+    this->rehash(num_slots);
+    return;
+}
+
+/**
+ * 登録数を取得する.
+ * @return        登録数
+ */
+UdmSize_t UdmSearchTable::size() const
+{
+    return this->num_entries;
+}
+
+/**
+ * メモリサイズを取得する.
+ * @return        メモリサイズ
+ */
+size_t UdmSearchTable::getMemSize() const
+{
+    return sizeof(*this) + this->search_slots.capacity()*sizeof(UdmSearchTableSlot);
+}
+
+/**
+ * ランク番号、IDのハッシュ値からスロット位置を取得する.
+ * @param rankno        ランク番号
+ * @param localid        ID
+ * @return        スロット位置
+ */
+UdmSize_t UdmSearchTable::hashRankid(int rankno, UdmSize_t localid) const
+{
+    unsigned long long key = ((unsigned long long)(unsigned int)rankno << 32)
+                            ^ (unsigned long long)localid;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return (UdmSize_t)(key & (this->search_slots.size() - 1));
+}
+
+/**
+ * ランク番号、IDのスロットを検索する.
+ * 一致するスロットが存在しない場合は、追加位置の空きスロットを返す.
+ * @param [in] rankno        ランク番号
+ * @param [in] localid        ID
+ * @param [out] slot        一致スロット、又は空きスロット位置
+ * @return        true=一致するスロットが存在する
+ */
+bool UdmSearchTable::findSlot(int rankno, UdmSize_t localid, UdmSize_t &slot) const
+{
+    if (this->search_slots.size() <= 0) return false;
+
+    UdmSize_t mask = this->search_slots.size() - 1;
+    slot = this->hashRankid(rankno, localid);
+    while (this->search_slots[slot].node != NULL) {
+        if (this->search_slots[slot].rankno == rankno
+            && this->search_slots[slot].localid == localid) {
+            return true;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+/**
+ * スロット数を変更して、登録済みのランク番号、IDを再配置する.
+ * @param num_slots        スロット数（２のべき乗）
+ */
+void UdmSearchTable::rehash(UdmSize_t num_slots)
+{
+    std::vector<UdmSearchTableSlot> old_slots;
+    old_slots.swap(this->search_slots);
+
+    UdmSearchTableSlot empty_slot;
+    empty_slot.rankno = -1;
+    empty_slot.localid = 0;
+    empty_slot.node = NULL;
+    this->search_slots.assign(num_slots, empty_slot);
+
+    UdmSize_t slot;
+    std::vector<UdmSearchTableSlot>::const_iterator itr;
+    for (itr=old_slots.begin(); itr!=old_slots.end(); itr++) {
+        if (itr->node == NULL) continue;
+        this->findSlot(itr->rankno, itr->localid, slot);
+        this->search_slots[slot] = *itr;
+    }
+
+    return;
+}
+
 } /* namespace udm */
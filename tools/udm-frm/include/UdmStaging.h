@@ -27,6 +27,7 @@
 #include <iostream>
 #include <dirent.h>
 #include <fstream>
+#include <algorithm>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -88,6 +89,13 @@ private:
                        int rankno,
                        const char *field_directory,
                        bool timeslicedirectory) const;
+    bool copyAggregateCgnsFiles(const char *input_dir,
+                       const char *output_dir,
+                       const char *prefix,
+                       int rankno,
+                       const char *field_directory,
+                       bool timeslicedirectory,
+                       int stepno) const;
     bool writeCgnsFiles(const char *index_dfi,
                         const char *read_cgns,
                         const char *output_dir,
@@ -213,6 +213,31 @@ bool UdmStaging::mappingFiles(int num_procs)
         // 読込プロセス番号の取得
         int num_ranks = this->dfi_config.makeIoRankTable(num_procs, n, input_rank_ids);
 
+        // 集約CGNSファイル : 読込ランクのCGNS:Baseを含む集約ランク番号のファイルをコピーする.
+        if (fileinfo_config->isFileAggregate()) {
+            std::vector<int> file_rank_ids;
+            std::vector<int>::iterator rank_itr;
+            for (rank_itr=input_rank_ids.begin(); rank_itr!=input_rank_ids.end(); rank_itr++) {
+                int file_rankno = this->dfi_config.getCgnsFileRankno(*rank_itr);
+                if (std::find(file_rank_ids.begin(), file_rank_ids.end(), file_rankno) == file_rank_ids.end()) {
+                    file_rank_ids.push_back(file_rankno);
+                }
+            }
+            for (rank_itr=file_rank_ids.begin(); rank_itr!=file_rank_ids.end(); rank_itr++) {
+                if (!this->copyAggregateCgnsFiles(
+                                this->input_dir.c_str(),
+                                output_rank,
+                                prefix.c_str(),
+                                *rank_itr,
+                                field_directory.c_str(),
+                                timeslicedirectory,
+                                this->stepno)) {
+                    return false;
+                }
+            }
+            input_rank_ids.clear();
+        }
+
         // cgnsファイルのコピーを行う。
         std::vector<int>::iterator itr;
         for (itr=input_rank_ids.begin(); itr!=input_rank_ids.end(); itr++) {
@@ -405,6 +430,24 @@ bool UdmStaging::copyCgnsFiles(
         }
     }
 
+    // プロセスディレクトリ : proc.dfiに記録されたランク番号のプロセスディレクトリのCGNSファイルをコピーする.
+    std::string process_directory;
+    this->dfi_config.getCgnsProcessDirectory(process_directory, rankno);
+    if (!process_directory.empty()) {
+        char input_process[1024] = {0x00};
+        char output_process[1024] = {0x00};
+        udm_connect_path(input_dir, process_directory.c_str(), input_process);
+        udm_connect_path(output_dir, process_directory.c_str(), output_process);
+        if (this->existsDirectory(input_process)) {
+            if (!copyCgnsFiles(input_process, output_process,
+                                prefix, rankno,
+                                NULL, false)) {
+                printf("Error : can not copy input_dir[%s] to output_dir[%s].\n", input_process, output_process);
+                return false;
+            }
+        }
+    }
+
     // フィールドディレクトリ
     if (field_directory != NULL && strlen(field_directory) > 0) {
         char input_field[1024] = {0x00};
@@ -445,6 +488,55 @@ bool UdmStaging::copyCgnsFiles(
     return true;
 }
 
+/**
+ * 集約CGNSファイルをコピーする.
+ * ステップ番号が指定されている場合は、ステップ番号のCGNSファイルのみコピーする.
+ * @param input_dir        コピー元ディレクトリ
+ * @param output_dir    コピー先ディレクトリ
+ * @param prefix        ファイル接頭文字列
+ * @param rankno        集約ランク番号
+ * @param field_directory     フィールドディレクトリ
+ * @param timeslicedirectory   時系列ディレクトリの有無
+ * @param stepno        コピーステップ番号 : -1=すべての集約CGNSファイル
+ * @return        true=success
+ */
+bool UdmStaging::copyAggregateCgnsFiles(
+                        const char *input_dir,
+                        const char *output_dir,
+                        const char *prefix,
+                        int rankno,
+                        const char *field_directory,
+                        bool timeslicedirectory,
+                        int stepno) const
+{
+    if (stepno < 0) {
+        return this->copyCgnsFiles(input_dir, output_dir,
+                                prefix, rankno,
+                                field_directory, timeslicedirectory);
+    }
+
+    const UdmFileInfoConfig *fileinfo_config = this->dfi_config.getFileinfoConfig();
+    if (fileinfo_config == NULL) return false;
+
+    // ステップ番号の集約CGNSファイル名 : フィールドデータディレクトリ, 時刻ディレクトリを含む.
+    std::string filename;
+    if (fileinfo_config->isFileTimeSlice()) {
+        fileinfo_config->generateCgnsFileName(filename, rankno);
+    }
+    else {
+        fileinfo_config->generateCgnsTimeSliceName(filename, rankno, stepno);
+    }
+    if (filename.empty()) return false;
+    // 集約CGNSファイルのプロセスディレクトリ
+    this->dfi_config.connectProcessDirectory(filename, rankno);
+
+    char src_path[1024] = {0x00};
+    char dest_path[1024] = {0x00};
+    udm_connect_path(input_dir, filename.c_str(), src_path);
+    udm_connect_path(output_dir, filename.c_str(), dest_path);
+    return this->copyFile(src_path, dest_path);
+}
+
 /**
  * コピー対象のファイルであるかチェックする.
  * @param filename            チェック対象CGNSファイル名